@@ -31,6 +31,10 @@ let package = Package(
             name: "PlayaAPITestHelpers",
             dependencies: ["PlayaAPI"]
         ),
+        .executableTarget(
+            name: "playa-pack",
+            dependencies: ["PlayaAPI"]
+        ),
         .testTarget(
             name: "PlayaAPITests",
             dependencies: [
@@ -0,0 +1,42 @@
+#!/bin/sh
+# Builds data.pack.lzfse from the bundled API JSON into the app's resources.
+#
+# Run by the iBurn target's "Build Data Pack" phase. The year comes from PlayaYear in
+# iBurn/YearSettings.plist, which must match `Bundle.brc_dataBundle`. PlayaDBSeeder falls back
+# to the JSON importer when the pack is missing, so in Debug a failure only warns; Release
+# builds fail instead of shipping without the pack.
+
+YEAR_SETTINGS="${SRCROOT}/iBurn/YearSettings.plist"
+PACKAGE_DIR="${SRCROOT}/Packages/PlayaAPI"
+OUTPUT="${SCRIPT_OUTPUT_FILE_0:-${TARGET_BUILD_DIR}/${UNLOCALIZED_RESOURCES_FOLDER_PATH}/data.pack.lzfse}"
+
+fail() {
+    if [ "${CONFIGURATION}" = "Release" ]; then
+        echo "error: $1"
+        exit 1
+    fi
+    echo "warning: $1; the app will seed from JSON"
+    exit 0
+}
+
+YEAR=$(/usr/libexec/PlistBuddy -c "Print :PlayaYear" "${YEAR_SETTINGS}" 2>/dev/null)
+[ -n "${YEAR}" ] || fail "no PlayaYear in ${YEAR_SETTINGS}"
+DATA_DIR="${SRCROOT}/Submodules/iBurn-Data/data/${YEAR}/APIData/APIData.bundle"
+
+if [ ! -d "${DATA_DIR}" ]; then
+    fail "${DATA_DIR} not found (run git submodule update --init)"
+fi
+
+# The data directory follows the year, so it can't be a static phase input and the phase runs
+# every build; skip when the pack is newer than the data, the year and the pack sources
+if [ -f "${OUTPUT}" ] && [ -z "$(find "${DATA_DIR}" "${YEAR_SETTINGS}" "$0" "${PACKAGE_DIR}/Package.swift" "${PACKAGE_DIR}/Sources" -newer "${OUTPUT}" -print | head -n 1)" ]; then
+    exit 0
+fi
+
+# playa-pack is a macOS tool; drop the iOS build settings Xcode exports to this phase
+env -i PATH="${PATH}" HOME="${HOME}" DEVELOPER_DIR="${DEVELOPER_DIR}" \
+    xcrun --sdk macosx swift run -c release \
+    --package-path "${PACKAGE_DIR}" \
+    --scratch-path "${DERIVED_FILE_DIR}/playa-pack" \
+    playa-pack "${DATA_DIR}" "${OUTPUT}" \
+    || fail "playa-pack failed for ${YEAR}"
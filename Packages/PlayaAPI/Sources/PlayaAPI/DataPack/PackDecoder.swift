@@ -0,0 +1,402 @@
+import Foundation
+
+/// Value tags in pack records. Containers carry their byte length so readers can skip them.
+enum PackTag: UInt8 {
+    case null = 0
+    case `false` = 1
+    case `true` = 2
+    /// Zigzag varint
+    case int = 3
+    /// Varint
+    case uint = 4
+    /// 8-byte IEEE 754
+    case double = 5
+    /// Varint string table index
+    case string = 6
+    /// Varint byte length, varint count, values
+    case array = 7
+    /// Varint byte length, varint count, (varint key string index, value) pairs
+    case keyed = 8
+    /// 8-byte IEEE 754 seconds since 1970
+    case date = 9
+}
+
+/// Borrowed view of a pack's bytes. Only valid inside `PlayaDataPack.withBytes`.
+struct PackBytes {
+    let buffer: UnsafeRawBufferPointer
+    let stringCount: Int
+    let stringTableOffset: Int
+
+    func u16(at offset: Int) -> UInt16 {
+        UInt16(littleEndian: buffer.loadUnaligned(fromByteOffset: offset, as: UInt16.self))
+    }
+
+    func u32(at offset: Int) -> UInt32 {
+        UInt32(littleEndian: buffer.loadUnaligned(fromByteOffset: offset, as: UInt32.self))
+    }
+
+    func f64(at offset: Int) -> Double {
+        Double(bitPattern: UInt64(littleEndian: buffer.loadUnaligned(fromByteOffset: offset, as: UInt64.self)))
+    }
+
+    func tag(at offset: Int) throws -> PackTag {
+        guard offset < buffer.count, let tag = PackTag(rawValue: buffer[offset]) else {
+            throw PlayaDataPack.FormatError.corrupt("bad tag at \(offset)")
+        }
+        return tag
+    }
+
+    func varint(at offset: inout Int) throws -> UInt64 {
+        var result: UInt64 = 0
+        var shift: UInt64 = 0
+        while offset < buffer.count, shift < 64 {
+            let byte = buffer[offset]
+            offset += 1
+            result |= UInt64(byte & 0x7F) << shift
+            if byte & 0x80 == 0 { return result }
+            shift += 7
+        }
+        throw PlayaDataPack.FormatError.corrupt("bad varint")
+    }
+
+    // MARK: - Strings
+
+    private func stringRange(_ index: Int) -> Range<Int>? {
+        guard index < stringCount else { return nil }
+        let pool = stringTableOffset + stringCount * 4
+        let start = index == 0 ? 0 : Int(u32(at: stringTableOffset + (index - 1) * 4))
+        let end = Int(u32(at: stringTableOffset + index * 4))
+        guard start <= end, pool + end <= buffer.count else { return nil }
+        return (pool + start)..<(pool + end)
+    }
+
+    func string(_ index: Int) throws -> String {
+        guard let range = stringRange(index) else {
+            throw PlayaDataPack.FormatError.corrupt("bad string index \(index)")
+        }
+        return String(decoding: UnsafeRawBufferPointer(rebasing: buffer[range]), as: UTF8.self)
+    }
+
+    /// Compares a table string with `key` without allocating.
+    func string(_ index: Int, equals key: String) -> Bool {
+        guard let range = stringRange(index) else { return false }
+        return key.utf8.elementsEqual(UnsafeRawBufferPointer(rebasing: buffer[range]))
+    }
+
+    // MARK: - Values
+
+    /// Offset just past the value starting at `offset`
+    func skipValue(at offset: Int) throws -> Int {
+        var cursor = offset + 1
+        switch try tag(at: offset) {
+        case .null, .false, .true:
+            return cursor
+        case .int, .uint, .string:
+            _ = try varint(at: &cursor)
+            return cursor
+        case .double, .date:
+            return cursor + 8
+        case .array, .keyed:
+            let length = Int(try varint(at: &cursor))
+            return cursor + length
+        }
+    }
+
+    /// Offset of the value at `keyPath` through nested keyed containers, if present
+    func valueOffset(at keyPath: [String], from offset: Int) -> Int? {
+        var current = offset
+        for key in keyPath {
+            guard let found = try? keyedEntries(at: current).first(where: { string($0.key, equals: key) }) else {
+                return nil
+            }
+            current = found.offset
+        }
+        return current
+    }
+
+    /// Key string indexes and value offsets of the keyed container at `offset`
+    func keyedEntries(at offset: Int) throws -> [(key: Int, offset: Int)] {
+        guard try tag(at: offset) == .keyed else {
+            throw PlayaDataPack.FormatError.corrupt("expected keyed container at \(offset)")
+        }
+        var cursor = offset + 1
+        _ = try varint(at: &cursor)
+        let count = Int(try varint(at: &cursor))
+        var entries: [(key: Int, offset: Int)] = []
+        entries.reserveCapacity(count)
+        for _ in 0..<count {
+            let key = Int(try varint(at: &cursor))
+            entries.append((key, cursor))
+            cursor = try skipValue(at: cursor)
+        }
+        return entries
+    }
+
+    /// Value offsets of the array at `offset`
+    func arrayElements(at offset: Int) throws -> [Int] {
+        guard try tag(at: offset) == .array else {
+            throw PlayaDataPack.FormatError.corrupt("expected array at \(offset)")
+        }
+        var cursor = offset + 1
+        _ = try varint(at: &cursor)
+        let count = Int(try varint(at: &cursor))
+        var elements: [Int] = []
+        elements.reserveCapacity(count)
+        for _ in 0..<count {
+            elements.append(cursor)
+            cursor = try skipValue(at: cursor)
+        }
+        return elements
+    }
+
+    func stringValue(at offset: Int) -> String? {
+        guard (try? tag(at: offset)) == .string else { return nil }
+        var cursor = offset + 1
+        guard let index = try? varint(at: &cursor) else { return nil }
+        return try? string(Int(index))
+    }
+
+    func doubleValue(at offset: Int) -> Double? {
+        var cursor = offset + 1
+        switch try? tag(at: offset) {
+        case .double, .date:
+            return f64(at: cursor)
+        case .int:
+            return (try? varint(at: &cursor)).map { Double(Self.unzigzag($0)) }
+        case .uint:
+            return (try? varint(at: &cursor)).map { Double($0) }
+        default:
+            return nil
+        }
+    }
+
+    static func unzigzag(_ value: UInt64) -> Int64 {
+        Int64(bitPattern: (value >> 1) ^ (0 &- (value & 1)))
+    }
+}
+
+// MARK: - Decoder
+
+/// `Decoder` reading one value straight from the mapped bytes.
+struct PackDecoder: Decoder {
+    let bytes: PackBytes
+    let offset: Int
+    let codingPath: [CodingKey]
+    var userInfo: [CodingUserInfoKey: Any] { [:] }
+
+    init(bytes: PackBytes, offset: Int, codingPath: [CodingKey]) {
+        self.bytes = bytes
+        self.offset = offset
+        self.codingPath = codingPath
+    }
+
+    func unbox<T: Decodable>(_ type: T.Type) throws -> T {
+        // Match the JSON representation the API uses for these
+        if type == Date.self {
+            guard try bytes.tag(at: offset) == .date else { throw mismatch(type) }
+            return Date(timeIntervalSince1970: bytes.f64(at: offset + 1)) as! T
+        }
+        if type == URL.self {
+            guard let string = bytes.stringValue(at: offset), let url = URL(string: string) else { throw mismatch(type) }
+            return url as! T
+        }
+        return try T(from: self)
+    }
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) throws -> KeyedDecodingContainer<Key> {
+        KeyedDecodingContainer(try PackKeyedDecodingContainer<Key>(decoder: self))
+    }
+
+    func unkeyedContainer() throws -> UnkeyedDecodingContainer {
+        try PackUnkeyedDecodingContainer(decoder: self)
+    }
+
+    func singleValueContainer() throws -> SingleValueDecodingContainer {
+        self
+    }
+
+    func child(at offset: Int, key: CodingKey) -> PackDecoder {
+        PackDecoder(bytes: bytes, offset: offset, codingPath: codingPath + [key])
+    }
+
+    func mismatch(_ type: Any.Type) -> DecodingError {
+        DecodingError.typeMismatch(type, .init(codingPath: codingPath, debugDescription: "Unexpected pack value"))
+    }
+
+    fileprivate func integer<T: FixedWidthInteger>(_ type: T.Type) throws -> T {
+        var cursor = offset + 1
+        let value: T?
+        switch try bytes.tag(at: offset) {
+        case .int:
+            value = T(exactly: PackBytes.unzigzag(try bytes.varint(at: &cursor)))
+        case .uint:
+            value = T(exactly: try bytes.varint(at: &cursor))
+        default:
+            value = nil
+        }
+        guard let value else { throw mismatch(type) }
+        return value
+    }
+}
+
+extension PackDecoder: SingleValueDecodingContainer {
+    func decodeNil() -> Bool {
+        (try? bytes.tag(at: offset)) == .null
+    }
+
+    func decode(_ type: Bool.Type) throws -> Bool {
+        switch try bytes.tag(at: offset) {
+        case .true: return true
+        case .false: return false
+        default: throw mismatch(type)
+        }
+    }
+
+    func decode(_ type: String.Type) throws -> String {
+        guard let value = bytes.stringValue(at: offset) else { throw mismatch(type) }
+        return value
+    }
+
+    func decode(_ type: Double.Type) throws -> Double {
+        guard let value = bytes.doubleValue(at: offset) else { throw mismatch(type) }
+        return value
+    }
+
+    func decode(_ type: Float.Type) throws -> Float { Float(try decode(Double.self)) }
+    func decode(_ type: Int.Type) throws -> Int { try integer(type) }
+    func decode(_ type: Int8.Type) throws -> Int8 { try integer(type) }
+    func decode(_ type: Int16.Type) throws -> Int16 { try integer(type) }
+    func decode(_ type: Int32.Type) throws -> Int32 { try integer(type) }
+    func decode(_ type: Int64.Type) throws -> Int64 { try integer(type) }
+    func decode(_ type: UInt.Type) throws -> UInt { try integer(type) }
+    func decode(_ type: UInt8.Type) throws -> UInt8 { try integer(type) }
+    func decode(_ type: UInt16.Type) throws -> UInt16 { try integer(type) }
+    func decode(_ type: UInt32.Type) throws -> UInt32 { try integer(type) }
+    func decode(_ type: UInt64.Type) throws -> UInt64 { try integer(type) }
+
+    func decode<T: Decodable>(_ type: T.Type) throws -> T {
+        try unbox(type)
+    }
+}
+
+private struct PackKeyedDecodingContainer<Key: CodingKey>: KeyedDecodingContainerProtocol {
+    let decoder: PackDecoder
+    private let entries: [String: Int]
+
+    init(decoder: PackDecoder) throws {
+        self.decoder = decoder
+        var entries: [String: Int] = [:]
+        for entry in try decoder.bytes.keyedEntries(at: decoder.offset) {
+            entries[try decoder.bytes.string(entry.key)] = entry.offset
+        }
+        self.entries = entries
+    }
+
+    var codingPath: [CodingKey] { decoder.codingPath }
+    var allKeys: [Key] { entries.keys.compactMap(Key.init(stringValue:)) }
+
+    func contains(_ key: Key) -> Bool {
+        entries[key.stringValue] != nil
+    }
+
+    private func value(for key: Key) throws -> PackDecoder {
+        guard let offset = entries[key.stringValue] else {
+            throw DecodingError.keyNotFound(key, .init(codingPath: codingPath, debugDescription: "Missing key \(key.stringValue)"))
+        }
+        return decoder.child(at: offset, key: key)
+    }
+
+    func decodeNil(forKey key: Key) throws -> Bool { try value(for: key).decodeNil() }
+    func decode(_ type: Bool.Type, forKey key: Key) throws -> Bool { try value(for: key).decode(type) }
+    func decode(_ type: String.Type, forKey key: Key) throws -> String { try value(for: key).decode(type) }
+    func decode(_ type: Double.Type, forKey key: Key) throws -> Double { try value(for: key).decode(type) }
+    func decode(_ type: Float.Type, forKey key: Key) throws -> Float { try value(for: key).decode(type) }
+    func decode(_ type: Int.Type, forKey key: Key) throws -> Int { try value(for: key).decode(type) }
+    func decode(_ type: Int8.Type, forKey key: Key) throws -> Int8 { try value(for: key).decode(type) }
+    func decode(_ type: Int16.Type, forKey key: Key) throws -> Int16 { try value(for: key).decode(type) }
+    func decode(_ type: Int32.Type, forKey key: Key) throws -> Int32 { try value(for: key).decode(type) }
+    func decode(_ type: Int64.Type, forKey key: Key) throws -> Int64 { try value(for: key).decode(type) }
+    func decode(_ type: UInt.Type, forKey key: Key) throws -> UInt { try value(for: key).decode(type) }
+    func decode(_ type: UInt8.Type, forKey key: Key) throws -> UInt8 { try value(for: key).decode(type) }
+    func decode(_ type: UInt16.Type, forKey key: Key) throws -> UInt16 { try value(for: key).decode(type) }
+    func decode(_ type: UInt32.Type, forKey key: Key) throws -> UInt32 { try value(for: key).decode(type) }
+    func decode(_ type: UInt64.Type, forKey key: Key) throws -> UInt64 { try value(for: key).decode(type) }
+    func decode<T: Decodable>(_ type: T.Type, forKey key: Key) throws -> T { try value(for: key).unbox(type) }
+
+    func nestedContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type, forKey key: Key) throws -> KeyedDecodingContainer<NestedKey> {
+        try value(for: key).container(keyedBy: type)
+    }
+
+    func nestedUnkeyedContainer(forKey key: Key) throws -> UnkeyedDecodingContainer {
+        try value(for: key).unkeyedContainer()
+    }
+
+    func superDecoder() throws -> Decoder { decoder }
+    func superDecoder(forKey key: Key) throws -> Decoder { try value(for: key) }
+}
+
+private struct PackUnkeyedDecodingContainer: UnkeyedDecodingContainer {
+    let decoder: PackDecoder
+    private let elements: [Int]
+    private(set) var currentIndex = 0
+
+    init(decoder: PackDecoder) throws {
+        self.decoder = decoder
+        self.elements = try decoder.bytes.arrayElements(at: decoder.offset)
+    }
+
+    var codingPath: [CodingKey] { decoder.codingPath }
+    var count: Int? { elements.count }
+    var isAtEnd: Bool { currentIndex >= elements.count }
+
+    private struct IndexKey: CodingKey {
+        let intValue: Int?
+        var stringValue: String { "Index \(intValue ?? 0)" }
+        init(intValue: Int) { self.intValue = intValue }
+        init?(stringValue: String) { nil }
+    }
+
+    private mutating func next() throws -> PackDecoder {
+        guard !isAtEnd else {
+            throw DecodingError.valueNotFound(Any.self, .init(codingPath: codingPath, debugDescription: "Unkeyed container is at end"))
+        }
+        defer { currentIndex += 1 }
+        return decoder.child(at: elements[currentIndex], key: IndexKey(intValue: currentIndex))
+    }
+
+    mutating func decodeNil() throws -> Bool {
+        guard !isAtEnd, decoder.child(at: elements[currentIndex], key: IndexKey(intValue: currentIndex)).decodeNil() else {
+            return false
+        }
+        currentIndex += 1
+        return true
+    }
+
+    mutating func decode(_ type: Bool.Type) throws -> Bool { try next().decode(type) }
+    mutating func decode(_ type: String.Type) throws -> String { try next().decode(type) }
+    mutating func decode(_ type: Double.Type) throws -> Double { try next().decode(type) }
+    mutating func decode(_ type: Float.Type) throws -> Float { try next().decode(type) }
+    mutating func decode(_ type: Int.Type) throws -> Int { try next().decode(type) }
+    mutating func decode(_ type: Int8.Type) throws -> Int8 { try next().decode(type) }
+    mutating func decode(_ type: Int16.Type) throws -> Int16 { try next().decode(type) }
+    mutating func decode(_ type: Int32.Type) throws -> Int32 { try next().decode(type) }
+    mutating func decode(_ type: Int64.Type) throws -> Int64 { try next().decode(type) }
+    mutating func decode(_ type: UInt.Type) throws -> UInt { try next().decode(type) }
+    mutating func decode(_ type: UInt8.Type) throws -> UInt8 { try next().decode(type) }
+    mutating func decode(_ type: UInt16.Type) throws -> UInt16 { try next().decode(type) }
+    mutating func decode(_ type: UInt32.Type) throws -> UInt32 { try next().decode(type) }
+    mutating func decode(_ type: UInt64.Type) throws -> UInt64 { try next().decode(type) }
+    mutating func decode<T: Decodable>(_ type: T.Type) throws -> T { try next().unbox(type) }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type) throws -> KeyedDecodingContainer<NestedKey> {
+        try next().container(keyedBy: type)
+    }
+
+    mutating func nestedUnkeyedContainer() throws -> UnkeyedDecodingContainer {
+        try next().unkeyedContainer()
+    }
+
+    mutating func superDecoder() throws -> Decoder {
+        try next()
+    }
+}
@@ -0,0 +1,234 @@
+import Foundation
+
+/// Compact binary bundle of the API data files, read through a memory map.
+///
+/// Built at build time by `PlayaDataPackWriter` (see the `playa-pack` tool). Every string is
+/// interned once in a shared table, and records use a small tagged encoding of the models'
+/// `Codable` representation. Callers can walk a section one record at a time, decoding only
+/// the record they are on, or read single fields (`Record.string(at:)`) without decoding at all.
+///
+/// Layout (little-endian):
+/// ```
+/// header      magic "IBDP" u32, version u16, sectionCount u16, stringCount u32, stringTableOffset u32
+/// directory   sectionCount × (kind u32, recordCount u32, indexOffset u32)
+/// strings     stringCount × end offset u32 into the pool, then UTF-8 pool bytes
+/// index       per section: (recordCount + 1) × absolute record offset u32
+/// records     tagged values (see `PackTag`)
+/// ```
+public final class PlayaDataPack: @unchecked Sendable {
+
+    /// Data set stored in a section
+    public enum Kind: UInt32, CaseIterable, Sendable {
+        case art = 1
+        case camps = 2
+        case events = 3
+        case mutantVehicles = 4
+        /// Points of interest. There's no API model, so records are the JSON objects as-is.
+        case points = 5
+        /// Sentence embeddings of the other data sets, as `PlayaEmbedding` records
+        case embeddings = 6
+    }
+
+    /// Errors reading a pack
+    public enum FormatError: Error, LocalizedError {
+        case invalidHeader
+        case unsupportedVersion(UInt16)
+        case corrupt(String)
+        case decompressionFailed
+
+        public var errorDescription: String? {
+            switch self {
+            case .invalidHeader:
+                return "Not a data pack"
+            case .unsupportedVersion(let version):
+                return "Unsupported data pack version: \(version)"
+            case .corrupt(let reason):
+                return "Corrupt data pack: \(reason)"
+            case .decompressionFailed:
+                return "Failed to decompress data pack"
+            }
+        }
+    }
+
+    static let magic: UInt32 = 0x5044_4249  // "IBDP"
+    static let version: UInt16 = 1
+    static let headerSize = 16
+    static let directoryEntrySize = 12
+
+    private let data: Data
+    private let stringCount: Int
+    private let stringTableOffset: Int
+    private let sections: [Kind: (count: Int, indexOffset: Int)]
+
+    /// Reads a pack from uncompressed bytes.
+    public init(data: Data) throws {
+        self.data = data
+        let header = try data.withUnsafeBytes { buffer -> (Int, Int, [Kind: (count: Int, indexOffset: Int)]) in
+            let bytes = PackBytes(buffer: buffer, stringCount: 0, stringTableOffset: 0)
+            guard buffer.count >= Self.headerSize, bytes.u32(at: 0) == Self.magic else {
+                throw FormatError.invalidHeader
+            }
+            let version = bytes.u16(at: 4)
+            guard version == Self.version else { throw FormatError.unsupportedVersion(version) }
+
+            let sectionCount = Int(bytes.u16(at: 6))
+            let stringCount = Int(bytes.u32(at: 8))
+            let stringTableOffset = Int(bytes.u32(at: 12))
+            guard Self.headerSize + sectionCount * Self.directoryEntrySize <= buffer.count,
+                  stringTableOffset + stringCount * 4 <= buffer.count else {
+                throw FormatError.corrupt("header out of bounds")
+            }
+
+            var sections: [Kind: (count: Int, indexOffset: Int)] = [:]
+            for i in 0..<sectionCount {
+                let entry = Self.headerSize + i * Self.directoryEntrySize
+                let count = Int(bytes.u32(at: entry + 4))
+                let indexOffset = Int(bytes.u32(at: entry + 8))
+                guard indexOffset + (count + 1) * 4 <= buffer.count else {
+                    throw FormatError.corrupt("section index out of bounds")
+                }
+                // Unknown kinds come from newer writers; skip them
+                if let kind = Kind(rawValue: bytes.u32(at: entry)) {
+                    sections[kind] = (count, indexOffset)
+                }
+            }
+            return (stringCount, stringTableOffset, sections)
+        }
+        (stringCount, stringTableOffset, sections) = header
+    }
+
+    /// Memory-maps an uncompressed pack file.
+    public convenience init(contentsOf url: URL) throws {
+        try self.init(data: Data(contentsOf: url, options: .alwaysMapped))
+    }
+
+    /// Opens an LZFSE-compressed pack (as shipped in the app bundle).
+    ///
+    /// The first call decompresses it once into `cacheDirectory`; later calls map the cached
+    /// copy directly. Caches from other builds of the source file are removed.
+    public static func open(compressedAt url: URL, cacheDirectory: URL) throws -> PlayaDataPack {
+        let fileManager = FileManager.default
+        let attributes = try fileManager.attributesOfItem(atPath: url.path)
+        let size = (attributes[.size] as? NSNumber)?.intValue ?? 0
+        let modified = Int((attributes[.modificationDate] as? Date)?.timeIntervalSince1970 ?? 0)
+        let baseName = url.deletingPathExtension().deletingPathExtension().lastPathComponent
+        let cachedURL = cacheDirectory.appendingPathComponent("\(baseName)-\(size)-\(modified).pack")
+
+        if fileManager.fileExists(atPath: cachedURL.path), let pack = try? PlayaDataPack(contentsOf: cachedURL) {
+            return pack
+        }
+
+        let compressed = try Data(contentsOf: url, options: .alwaysMapped)
+        guard let decompressed = try? (compressed as NSData).decompressed(using: .lzfse) as Data else {
+            throw FormatError.decompressionFailed
+        }
+        _ = try PlayaDataPack(data: decompressed)  // validate before caching
+
+        try fileManager.createDirectory(at: cacheDirectory, withIntermediateDirectories: true)
+        let stale = (try? fileManager.contentsOfDirectory(atPath: cacheDirectory.path)) ?? []
+        for name in stale where name.hasPrefix("\(baseName)-") && name.hasSuffix(".pack") {
+            try? fileManager.removeItem(at: cacheDirectory.appendingPathComponent(name))
+        }
+        try decompressed.write(to: cachedURL, options: .atomic)
+        return try PlayaDataPack(contentsOf: cachedURL)
+    }
+
+    /// Records of one data set, or nil if the pack doesn't contain it.
+    public func section(_ kind: Kind) -> Section? {
+        guard let entry = sections[kind] else { return nil }
+        return Section(pack: self, kind: kind, count: entry.count, indexOffset: entry.indexOffset)
+    }
+
+    /// Data sets present in the pack
+    public var kinds: [Kind] {
+        Kind.allCases.filter { sections[$0] != nil }
+    }
+
+    /// Runs `body` with a view of the mapped bytes. Nothing is copied.
+    func withBytes<T>(_ body: (PackBytes) throws -> T) rethrows -> T {
+        try data.withUnsafeBytes { buffer in
+            try body(PackBytes(buffer: buffer, stringCount: stringCount, stringTableOffset: stringTableOffset))
+        }
+    }
+
+    // MARK: - Section
+
+    /// Random access to the records of one data set.
+    public struct Section: RandomAccessCollection, Sendable {
+        public let kind: Kind
+        private let pack: PlayaDataPack
+        private let indexOffset: Int
+
+        public let startIndex = 0
+        public let endIndex: Int
+
+        init(pack: PlayaDataPack, kind: Kind, count: Int, indexOffset: Int) {
+            self.pack = pack
+            self.kind = kind
+            self.endIndex = count
+            self.indexOffset = indexOffset
+        }
+
+        public subscript(position: Int) -> Record {
+            precondition(indices.contains(position), "Record index out of range")
+            let (start, end) = pack.withBytes { bytes in
+                (Int(bytes.u32(at: indexOffset + position * 4)), Int(bytes.u32(at: indexOffset + (position + 1) * 4)))
+            }
+            return Record(pack: pack, offset: start, length: end - start)
+        }
+
+        /// Decodes each record in turn. Only one decoded record is alive at a time.
+        public func forEach<T: Decodable>(as type: T.Type, _ body: (T) throws -> Void) throws {
+            for record in self {
+                try body(try record.decode(type))
+            }
+        }
+
+        /// Decodes every record.
+        public func decodeAll<T: Decodable>(as type: T.Type) throws -> [T] {
+            var result: [T] = []
+            result.reserveCapacity(count)
+            try forEach(as: type) { result.append($0) }
+            return result
+        }
+    }
+
+    // MARK: - Record
+
+    /// One encoded object in the mapped file.
+    public struct Record: Sendable {
+        private let pack: PlayaDataPack
+        let offset: Int
+        /// Encoded size in bytes
+        public let length: Int
+
+        init(pack: PlayaDataPack, offset: Int, length: Int) {
+            self.pack = pack
+            self.offset = offset
+            self.length = length
+        }
+
+        /// Decodes the whole record into a model.
+        public func decode<T: Decodable>(_ type: T.Type) throws -> T {
+            try pack.withBytes { bytes in
+                try PackDecoder(bytes: bytes, offset: offset, codingPath: []).unbox(type)
+            }
+        }
+
+        /// Reads one string field by key path (e.g. `"uid"`, `"location", "string"`) without
+        /// decoding the rest of the record. Keys are the models' Swift property names.
+        public func string(at keyPath: String...) -> String? {
+            pack.withBytes { bytes in
+                bytes.valueOffset(at: keyPath, from: offset).flatMap { bytes.stringValue(at: $0) }
+            }
+        }
+
+        /// Reads one numeric field by key path (e.g. `"location", "gpsLatitude"`) without
+        /// decoding the rest of the record.
+        public func double(at keyPath: String...) -> Double? {
+            pack.withBytes { bytes in
+                bytes.valueOffset(at: keyPath, from: offset).flatMap { bytes.doubleValue(at: $0) }
+            }
+        }
+    }
+}
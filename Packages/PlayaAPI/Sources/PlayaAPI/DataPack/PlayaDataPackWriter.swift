@@ -0,0 +1,418 @@
+import Foundation
+
+/// Builds a `PlayaDataPack` from API models. Used at build time by the `playa-pack` tool
+/// and by tests.
+public struct PlayaDataPackWriter {
+    private var strings: [String] = []
+    private var stringIndexes: [String: Int] = [:]
+    private var sections: [(kind: PlayaDataPack.Kind, records: [[UInt8]])] = []
+
+    public init() {}
+
+    /// Adds a data set. Each object becomes one record.
+    public mutating func add<T: Encodable>(_ objects: [T], as kind: PlayaDataPack.Kind) throws {
+        var records: [[UInt8]] = []
+        records.reserveCapacity(objects.count)
+        for object in objects {
+            let node = PackNode()
+            try PackEncoder(node: node, codingPath: []).box(object)
+            var bytes: [UInt8] = []
+            append(node.value, to: &bytes)
+            records.append(bytes)
+        }
+        setSection(kind, records: records)
+    }
+
+    /// Adds a data set straight from API JSON, decoding it with the API decoder first.
+    public mutating func addJSON(_ data: Data, as kind: PlayaDataPack.Kind) throws {
+        let parser = APIParserFactory.create()
+        switch kind {
+        case .art:
+            try add(parser.parseArt(from: data), as: kind)
+        case .camps:
+            try add(parser.parseCamps(from: data), as: kind)
+        case .events:
+            try add(parser.parseEvents(from: data), as: kind)
+        case .mutantVehicles:
+            try add(parser.parseMutantVehicles(from: data), as: kind)
+        case .points:
+            // No model: store each JSON object as-is
+            let json = try JSONSerialization.jsonObject(with: data)
+            let objects = (json as? [Any]) ?? [json]
+            var records: [[UInt8]] = []
+            for object in objects {
+                var bytes: [UInt8] = []
+                append(try PackValue(jsonObject: object), to: &bytes)
+                records.append(bytes)
+            }
+            setSection(kind, records: records)
+        case .embeddings:
+            // Computed from the other data sets, see `PlayaTextEmbedder`
+            throw EncodingError.invalidValue(data, .init(codingPath: [], debugDescription: "Embeddings have no JSON form"))
+        }
+    }
+
+    /// Uncompressed pack bytes, readable with `PlayaDataPack(data:)`
+    public func encoded() -> Data {
+        let header = PlayaDataPack.headerSize + sections.count * PlayaDataPack.directoryEntrySize
+
+        var pool: [UInt8] = []
+        var stringEnds: [UInt32] = []
+        stringEnds.reserveCapacity(strings.count)
+        for string in strings {
+            pool.append(contentsOf: string.utf8)
+            stringEnds.append(UInt32(pool.count))
+        }
+        let stringTableOffset = header
+        var cursor = stringTableOffset + strings.count * 4 + pool.count
+
+        // Index tables, then records
+        var indexOffsets: [Int] = []
+        for section in sections {
+            indexOffsets.append(cursor)
+            cursor += (section.records.count + 1) * 4
+        }
+
+        var out: [UInt8] = []
+        out.reserveCapacity(cursor + sections.reduce(0) { $0 + $1.records.reduce(0) { $0 + $1.count } })
+        Self.put(PlayaDataPack.magic, into: &out)
+        Self.put(PlayaDataPack.version, into: &out)
+        Self.put(UInt16(sections.count), into: &out)
+        Self.put(UInt32(strings.count), into: &out)
+        Self.put(UInt32(stringTableOffset), into: &out)
+        for (section, indexOffset) in zip(sections, indexOffsets) {
+            Self.put(section.kind.rawValue, into: &out)
+            Self.put(UInt32(section.records.count), into: &out)
+            Self.put(UInt32(indexOffset), into: &out)
+        }
+        stringEnds.forEach { Self.put($0, into: &out) }
+        out.append(contentsOf: pool)
+
+        var recordOffset = cursor
+        for section in sections {
+            for record in section.records {
+                Self.put(UInt32(recordOffset), into: &out)
+                recordOffset += record.count
+            }
+            Self.put(UInt32(recordOffset), into: &out)
+        }
+        for section in sections {
+            section.records.forEach { out.append(contentsOf: $0) }
+        }
+        return Data(out)
+    }
+
+    /// LZFSE-compressed pack, for `PlayaDataPack.open(compressedAt:cacheDirectory:)`
+    public func compressed() throws -> Data {
+        try (encoded() as NSData).compressed(using: .lzfse) as Data
+    }
+
+    // MARK: - Private
+
+    private mutating func setSection(_ kind: PlayaDataPack.Kind, records: [[UInt8]]) {
+        sections.removeAll { $0.kind == kind }
+        sections.append((kind, records))
+    }
+
+    private mutating func intern(_ string: String) -> Int {
+        if let index = stringIndexes[string] { return index }
+        let index = strings.count
+        strings.append(string)
+        stringIndexes[string] = index
+        return index
+    }
+
+    private mutating func append(_ value: PackValue, to bytes: inout [UInt8]) {
+        switch value {
+        case .null:
+            bytes.append(PackTag.null.rawValue)
+        case .bool(let flag):
+            bytes.append((flag ? PackTag.true : PackTag.false).rawValue)
+        case .int(let number):
+            bytes.append(PackTag.int.rawValue)
+            Self.putVarint(UInt64(bitPattern: (number << 1) ^ (number >> 63)), into: &bytes)
+        case .uint(let number):
+            bytes.append(PackTag.uint.rawValue)
+            Self.putVarint(number, into: &bytes)
+        case .double(let number):
+            bytes.append(PackTag.double.rawValue)
+            Self.put(number.bitPattern, into: &bytes)
+        case .date(let date):
+            bytes.append(PackTag.date.rawValue)
+            Self.put(date.timeIntervalSince1970.bitPattern, into: &bytes)
+        case .string(let string):
+            bytes.append(PackTag.string.rawValue)
+            Self.putVarint(UInt64(intern(string)), into: &bytes)
+        case .array(let elements):
+            var body: [UInt8] = []
+            Self.putVarint(UInt64(elements.count), into: &body)
+            elements.forEach { append($0, to: &body) }
+            bytes.append(PackTag.array.rawValue)
+            Self.putVarint(UInt64(body.count), into: &bytes)
+            bytes.append(contentsOf: body)
+        case .keyed(let entries):
+            var body: [UInt8] = []
+            Self.putVarint(UInt64(entries.count), into: &body)
+            for (key, element) in entries {
+                Self.putVarint(UInt64(intern(key)), into: &body)
+                append(element, to: &body)
+            }
+            bytes.append(PackTag.keyed.rawValue)
+            Self.putVarint(UInt64(body.count), into: &bytes)
+            bytes.append(contentsOf: body)
+        }
+    }
+
+    private static func put<T: FixedWidthInteger>(_ value: T, into bytes: inout [UInt8]) {
+        withUnsafeBytes(of: value.littleEndian) { bytes.append(contentsOf: $0) }
+    }
+
+    private static func putVarint(_ value: UInt64, into bytes: inout [UInt8]) {
+        var value = value
+        while value >= 0x80 {
+            bytes.append(UInt8(value & 0x7F) | 0x80)
+            value >>= 7
+        }
+        bytes.append(UInt8(value))
+    }
+}
+
+// MARK: - Values
+
+/// Intermediate tree built by `PackEncoder` before serializing
+enum PackValue {
+    case null
+    case bool(Bool)
+    case int(Int64)
+    case uint(UInt64)
+    case double(Double)
+    case date(Date)
+    case string(String)
+    case array([PackValue])
+    case keyed([(String, PackValue)])
+
+    init(jsonObject: Any) throws {
+        switch jsonObject {
+        case is NSNull:
+            self = .null
+        case let number as NSNumber where CFGetTypeID(number) == CFBooleanGetTypeID():
+            self = .bool(number.boolValue)
+        case let number as NSNumber:
+            if CFNumberIsFloatType(number) {
+                self = .double(number.doubleValue)
+            } else {
+                self = .int(number.int64Value)
+            }
+        case let string as String:
+            self = .string(string)
+        case let array as [Any]:
+            self = .array(try array.map(PackValue.init(jsonObject:)))
+        case let object as [String: Any]:
+            self = .keyed(try object.sorted { $0.key < $1.key }.map { ($0.key, try PackValue(jsonObject: $0.value)) })
+        default:
+            throw EncodingError.invalidValue(jsonObject, .init(codingPath: [], debugDescription: "Unsupported JSON value"))
+        }
+    }
+}
+
+/// Mutable slot filled in by an encoder. Containers hand out child nodes so nested
+/// encoders can write into them after the container is created.
+final class PackNode {
+    private enum Storage {
+        case empty
+        case value(PackValue)
+        case array([PackNode])
+        case keyed([(String, PackNode)])
+    }
+
+    private var storage: Storage = .empty
+
+    var value: PackValue {
+        switch storage {
+        case .empty: return .keyed([])
+        case .value(let value): return value
+        case .array(let nodes): return .array(nodes.map(\.value))
+        case .keyed(let entries): return .keyed(entries.map { ($0.0, $0.1.value) })
+        }
+    }
+
+    func set(_ value: PackValue) {
+        storage = .value(value)
+    }
+
+    func appendElement() -> PackNode {
+        let node = PackNode()
+        if case .array(var nodes) = storage {
+            nodes.append(node)
+            storage = .array(nodes)
+        } else {
+            storage = .array([node])
+        }
+        return node
+    }
+
+    func makeArray() {
+        if case .array = storage { return }
+        storage = .array([])
+    }
+
+    func makeKeyed() {
+        if case .keyed = storage { return }
+        storage = .keyed([])
+    }
+
+    func child(forKey key: String) -> PackNode {
+        let node = PackNode()
+        if case .keyed(var entries) = storage {
+            entries.removeAll { $0.0 == key }
+            entries.append((key, node))
+            storage = .keyed(entries)
+        } else {
+            storage = .keyed([(key, node)])
+        }
+        return node
+    }
+
+    var arrayCount: Int {
+        if case .array(let nodes) = storage { return nodes.count }
+        return 0
+    }
+}
+
+// MARK: - Encoder
+
+struct PackEncoder: Encoder {
+    let node: PackNode
+    let codingPath: [CodingKey]
+    var userInfo: [CodingUserInfoKey: Any] { [:] }
+
+    func box<T: Encodable>(_ value: T) throws {
+        // Match the JSON representation the API uses for these
+        if let date = value as? Date {
+            node.set(.date(date))
+        } else if let url = value as? URL {
+            node.set(.string(url.absoluteString))
+        } else {
+            try value.encode(to: self)
+        }
+    }
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) -> KeyedEncodingContainer<Key> {
+        node.makeKeyed()
+        return KeyedEncodingContainer(PackKeyedEncodingContainer<Key>(encoder: self))
+    }
+
+    func unkeyedContainer() -> UnkeyedEncodingContainer {
+        node.makeArray()
+        return PackUnkeyedEncodingContainer(encoder: self)
+    }
+
+    func singleValueContainer() -> SingleValueEncodingContainer {
+        self
+    }
+
+    func child(_ node: PackNode, key: CodingKey) -> PackEncoder {
+        PackEncoder(node: node, codingPath: codingPath + [key])
+    }
+}
+
+extension PackEncoder: SingleValueEncodingContainer {
+    func encodeNil() { node.set(.null) }
+    func encode(_ value: Bool) { node.set(.bool(value)) }
+    func encode(_ value: String) { node.set(.string(value)) }
+    func encode(_ value: Double) { node.set(.double(value)) }
+    func encode(_ value: Float) { node.set(.double(Double(value))) }
+    func encode(_ value: Int) { node.set(.int(Int64(value))) }
+    func encode(_ value: Int8) { node.set(.int(Int64(value))) }
+    func encode(_ value: Int16) { node.set(.int(Int64(value))) }
+    func encode(_ value: Int32) { node.set(.int(Int64(value))) }
+    func encode(_ value: Int64) { node.set(.int(value)) }
+    func encode(_ value: UInt) { node.set(.uint(UInt64(value))) }
+    func encode(_ value: UInt8) { node.set(.uint(UInt64(value))) }
+    func encode(_ value: UInt16) { node.set(.uint(UInt64(value))) }
+    func encode(_ value: UInt32) { node.set(.uint(UInt64(value))) }
+    func encode(_ value: UInt64) { node.set(.uint(value)) }
+    func encode<T: Encodable>(_ value: T) throws { try box(value) }
+}
+
+private struct PackKeyedEncodingContainer<Key: CodingKey>: KeyedEncodingContainerProtocol {
+    let encoder: PackEncoder
+    var codingPath: [CodingKey] { encoder.codingPath }
+
+    private func value(for key: Key) -> PackEncoder {
+        encoder.child(encoder.node.child(forKey: key.stringValue), key: key)
+    }
+
+    mutating func encodeNil(forKey key: Key) { value(for: key).encodeNil() }
+    mutating func encode(_ value: Bool, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: String, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Double, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Float, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Int, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Int8, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Int16, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Int32, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: Int64, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: UInt, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: UInt8, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: UInt16, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: UInt32, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode(_ value: UInt64, forKey key: Key) { self.value(for: key).encode(value) }
+    mutating func encode<T: Encodable>(_ value: T, forKey key: Key) throws { try self.value(for: key).box(value) }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type, forKey key: Key) -> KeyedEncodingContainer<NestedKey> {
+        value(for: key).container(keyedBy: keyType)
+    }
+
+    mutating func nestedUnkeyedContainer(forKey key: Key) -> UnkeyedEncodingContainer {
+        value(for: key).unkeyedContainer()
+    }
+
+    mutating func superEncoder() -> Encoder { encoder }
+    mutating func superEncoder(forKey key: Key) -> Encoder { value(for: key) }
+}
+
+private struct PackUnkeyedEncodingContainer: UnkeyedEncodingContainer {
+    let encoder: PackEncoder
+    var codingPath: [CodingKey] { encoder.codingPath }
+    var count: Int { encoder.node.arrayCount }
+
+    private struct IndexKey: CodingKey {
+        let intValue: Int?
+        var stringValue: String { "Index \(intValue ?? 0)" }
+        init(intValue: Int) { self.intValue = intValue }
+        init?(stringValue: String) { nil }
+    }
+
+    private func next() -> PackEncoder {
+        let key = IndexKey(intValue: count)
+        return encoder.child(encoder.node.appendElement(), key: key)
+    }
+
+    mutating func encodeNil() { next().encodeNil() }
+    mutating func encode(_ value: Bool) { next().encode(value) }
+    mutating func encode(_ value: String) { next().encode(value) }
+    mutating func encode(_ value: Double) { next().encode(value) }
+    mutating func encode(_ value: Float) { next().encode(value) }
+    mutating func encode(_ value: Int) { next().encode(value) }
+    mutating func encode(_ value: Int8) { next().encode(value) }
+    mutating func encode(_ value: Int16) { next().encode(value) }
+    mutating func encode(_ value: Int32) { next().encode(value) }
+    mutating func encode(_ value: Int64) { next().encode(value) }
+    mutating func encode(_ value: UInt) { next().encode(value) }
+    mutating func encode(_ value: UInt8) { next().encode(value) }
+    mutating func encode(_ value: UInt16) { next().encode(value) }
+    mutating func encode(_ value: UInt32) { next().encode(value) }
+    mutating func encode(_ value: UInt64) { next().encode(value) }
+    mutating func encode<T: Encodable>(_ value: T) throws { try next().box(value) }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type) -> KeyedEncodingContainer<NestedKey> {
+        next().container(keyedBy: keyType)
+    }
+
+    mutating func nestedUnkeyedContainer() -> UnkeyedEncodingContainer {
+        next().unkeyedContainer()
+    }
+
+    mutating func superEncoder() -> Encoder { next() }
+}
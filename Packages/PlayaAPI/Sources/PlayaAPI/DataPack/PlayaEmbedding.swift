@@ -0,0 +1,38 @@
+import Foundation
+
+/// Sentence embedding of one object, stored in the `.embeddings` section of a data pack.
+///
+/// Components are quantized to signed bytes, scaled so the largest magnitude is 127. Only the
+/// direction matters for cosine similarity, so the scale isn't stored.
+public struct PlayaEmbedding: Codable, Hashable, Sendable {
+    /// `"art"`, `"camp"`, `"event"` or `"mutantVehicle"`
+    public let objectType: String
+    public let uid: String
+    /// `NLEmbedding` sentence embedding revision the vector came from; queries must use the same one
+    public let revision: Int
+    /// Base64 of the quantized components
+    public let vector: String
+
+    public init(objectType: String, uid: String, revision: Int, vector: String) {
+        self.objectType = objectType
+        self.uid = uid
+        self.revision = revision
+        self.vector = vector
+    }
+
+    public init(objectType: String, uid: String, revision: Int, values: [Float]) {
+        self.init(objectType: objectType, uid: uid, revision: revision, vector: Self.quantize(values).base64EncodedString())
+    }
+
+    /// Quantized components, nil if `vector` isn't valid base64
+    public var quantized: Data? {
+        Data(base64Encoded: vector)
+    }
+
+    /// Scales `values` into signed bytes
+    public static func quantize(_ values: [Float]) -> Data {
+        let largest = values.reduce(0) { max($0, abs($1)) }
+        let scale = largest > 0 ? 127 / largest : 0
+        return Data(values.map { UInt8(bitPattern: Int8(($0 * scale).rounded())) })
+    }
+}
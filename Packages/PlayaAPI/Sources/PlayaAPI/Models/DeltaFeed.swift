@@ -0,0 +1,169 @@
+import Foundation
+import CryptoKit
+
+/// Object UIDs grouped by data type. Used for patch requests and deletions.
+public struct DeltaObjectIDs: Codable, Hashable, Sendable {
+    public var art: [String]
+    public var camps: [String]
+    public var events: [String]
+    public var mutantVehicles: [String]
+
+    public init(art: [String] = [], camps: [String] = [], events: [String] = [], mutantVehicles: [String] = []) {
+        self.art = art
+        self.camps = camps
+        self.events = events
+        self.mutantVehicles = mutantVehicles
+    }
+
+    public var isEmpty: Bool {
+        art.isEmpty && camps.isEmpty && events.isEmpty && mutantVehicles.isEmpty
+    }
+
+    public var count: Int {
+        art.count + camps.count + events.count + mutantVehicles.count
+    }
+}
+
+/// Per-object content hashes (uid → hash) for every object in a data set.
+///
+/// The client keeps the manifest of what it has imported, downloads the server's manifest,
+/// and requests only the objects whose hash differs. Objects missing from the server
+/// manifest are deleted locally.
+public struct DeltaManifest: Codable, Hashable, Sendable {
+    /// Opaque server version, e.g. the newest `updated` date of the underlying files
+    public var version: String
+    public var art: [String: String]
+    public var camps: [String: String]
+    public var events: [String: String]
+    public var mutantVehicles: [String: String]
+
+    public init(
+        version: String,
+        art: [String: String] = [:],
+        camps: [String: String] = [:],
+        events: [String: String] = [:],
+        mutantVehicles: [String: String] = [:]
+    ) {
+        self.version = version
+        self.art = art
+        self.camps = camps
+        self.events = events
+        self.mutantVehicles = mutantVehicles
+    }
+
+    /// Builds a manifest by hashing each object.
+    public init(
+        version: String,
+        art: [Art] = [],
+        camps: [Camp] = [],
+        events: [Event] = [],
+        mutantVehicles: [MutantVehicle] = []
+    ) throws {
+        self.init(
+            version: version,
+            art: try Self.hashes(art, uid: \.uid.value),
+            camps: try Self.hashes(camps, uid: \.uid.value),
+            events: try Self.hashes(events, uid: \.uid.value),
+            mutantVehicles: try Self.hashes(mutantVehicles, uid: \.uid.value)
+        )
+    }
+
+    /// Manifests use plain JSON coding: the API's snake-case key strategy would also
+    /// rewrite the UID dictionary keys.
+    public static func decode(from data: Data) throws -> DeltaManifest {
+        try JSONDecoder().decode(DeltaManifest.self, from: data)
+    }
+
+    public func encoded() throws -> Data {
+        try JSONEncoder().encode(self)
+    }
+
+    /// What to fetch and what to delete to go from `local` to this manifest.
+    public func plan(from local: DeltaManifest) -> DeltaPlan {
+        DeltaPlan(
+            changed: DeltaObjectIDs(
+                art: Self.changed(art, local.art),
+                camps: Self.changed(camps, local.camps),
+                events: Self.changed(events, local.events),
+                mutantVehicles: Self.changed(mutantVehicles, local.mutantVehicles)
+            ),
+            deleted: DeltaObjectIDs(
+                art: Self.removed(art, local.art),
+                camps: Self.removed(camps, local.camps),
+                events: Self.removed(events, local.events),
+                mutantVehicles: Self.removed(mutantVehicles, local.mutantVehicles)
+            )
+        )
+    }
+
+    // MARK: - Hashing
+
+    /// Stable content hash of an API object: SHA-256 of its sorted-key JSON encoding,
+    /// truncated to 64 bits (hex). Client and server must hash decoded models the same way.
+    public static func contentHash<T: Encodable>(_ object: T) throws -> String {
+        let encoder = PlayaAPI.createEncoder()
+        encoder.outputFormatting = [.sortedKeys]
+        let digest = SHA256.hash(data: try encoder.encode(object))
+        return digest.prefix(8).map { String(format: "%02x", $0) }.joined()
+    }
+
+    private static func hashes<T: Encodable>(_ objects: [T], uid: (T) -> String) throws -> [String: String] {
+        var result: [String: String] = [:]
+        result.reserveCapacity(objects.count)
+        for object in objects {
+            result[uid(object)] = try contentHash(object)
+        }
+        return result
+    }
+
+    private static func changed(_ remote: [String: String], _ local: [String: String]) -> [String] {
+        remote.compactMap { uid, hash in local[uid] == hash ? nil : uid }.sorted()
+    }
+
+    private static func removed(_ remote: [String: String], _ local: [String: String]) -> [String] {
+        local.keys.filter { remote[$0] == nil }.sorted()
+    }
+}
+
+/// Result of comparing a local manifest with the server's.
+public struct DeltaPlan: Hashable, Sendable {
+    /// New or modified objects to request
+    public let changed: DeltaObjectIDs
+    /// Objects no longer on the server
+    public let deleted: DeltaObjectIDs
+
+    public var isEmpty: Bool {
+        changed.isEmpty && deleted.isEmpty
+    }
+}
+
+/// Changed objects plus deletions, applied on top of the data described by a manifest.
+public struct DeltaPatch: Codable, Hashable, Sendable {
+    /// Server manifest version this patch brings the client to
+    public var version: String
+    public var art: [Art]
+    public var camps: [Camp]
+    public var events: [Event]
+    public var mutantVehicles: [MutantVehicle]
+    public var deleted: DeltaObjectIDs
+
+    public init(
+        version: String,
+        art: [Art] = [],
+        camps: [Camp] = [],
+        events: [Event] = [],
+        mutantVehicles: [MutantVehicle] = [],
+        deleted: DeltaObjectIDs = DeltaObjectIDs()
+    ) {
+        self.version = version
+        self.art = art
+        self.camps = camps
+        self.events = events
+        self.mutantVehicles = mutantVehicles
+        self.deleted = deleted
+    }
+
+    public var isEmpty: Bool {
+        art.isEmpty && camps.isEmpty && events.isEmpty && mutantVehicles.isEmpty && deleted.isEmpty
+    }
+}
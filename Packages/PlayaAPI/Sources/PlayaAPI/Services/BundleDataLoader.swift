@@ -89,6 +89,25 @@ public enum BundleDataLoader {
         return try loadDataFile(named: "points", from: bundle)
     }
     
+    /// Load the compressed binary data pack (`data.pack.lzfse`) from bundle
+    ///
+    /// The pack is decompressed once into `cacheDirectory` and memory-mapped from there, so
+    /// records can be walked without reading or decoding whole JSON files.
+    /// - Parameters:
+    ///   - bundle: Optional bundle to load from. If nil, attempts to find appropriate bundle.
+    ///   - cacheDirectory: Where to keep the decompressed pack. Defaults to Caches.
+    /// - Returns: The mapped data pack
+    /// - Throws: LoadError if the pack is missing, or PlayaDataPack.FormatError if it is invalid
+    public static func loadDataPack(from bundle: Bundle? = nil, cacheDirectory: URL? = nil) throws -> PlayaDataPack {
+        let targetBundle = bundle ?? Bundle.main
+        guard let url = targetBundle.url(forResource: "data", withExtension: "pack.lzfse") else {
+            throw LoadError.fileNotFound("data.pack.lzfse")
+        }
+        let caches = cacheDirectory ?? FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask)[0]
+            .appendingPathComponent("PlayaDataPack", isDirectory: true)
+        return try PlayaDataPack.open(compressedAt: url, cacheDirectory: caches)
+    }
+    
     // MARK: - Private Methods
     
     /// Load a specific data file from the given bundle
@@ -0,0 +1,71 @@
+import Foundation
+
+/// Raw transport for the delta feed. Implementations return encoded JSON so byte counts
+/// reflect what actually crosses the network.
+public protocol DeltaFeedTransport: Sendable {
+    /// GET the server's current `DeltaManifest`
+    func fetchManifest() async throws -> Data
+
+    /// POST an encoded `DeltaObjectIDs` request, returning an encoded `DeltaPatch`
+    /// containing those objects
+    func fetchPatch(request: Data) async throws -> Data
+}
+
+/// Delta feed over HTTP: `GET <baseURL>/manifest.json` and `POST <baseURL>/patch`.
+public struct URLSessionDeltaFeedTransport: DeltaFeedTransport {
+    public let baseURL: URL
+    private let session: URLSession
+
+    public init(baseURL: URL, session: URLSession = .shared) {
+        self.baseURL = baseURL
+        self.session = session
+    }
+
+    public func fetchManifest() async throws -> Data {
+        let (data, response) = try await session.data(from: baseURL.appendingPathComponent("manifest.json"))
+        try Self.validate(response)
+        return data
+    }
+
+    public func fetchPatch(request body: Data) async throws -> Data {
+        var request = URLRequest(url: baseURL.appendingPathComponent("patch"))
+        request.httpMethod = "POST"
+        request.setValue("application/json", forHTTPHeaderField: "Content-Type")
+        request.httpBody = body
+        let (data, response) = try await session.data(for: request)
+        try Self.validate(response)
+        return data
+    }
+
+    private static func validate(_ response: URLResponse) throws {
+        if let http = response as? HTTPURLResponse, !(200..<300).contains(http.statusCode) {
+            throw URLError(.badServerResponse)
+        }
+    }
+}
+
+/// Compares a local manifest with the server's and downloads only what changed.
+public struct DeltaFeedClient: Sendable {
+    private let transport: DeltaFeedTransport
+
+    public init(transport: DeltaFeedTransport) {
+        self.transport = transport
+    }
+
+    /// Returns the patch that brings `local` up to date, or nil if nothing changed.
+    /// Deletions come from the manifest diff; only changed objects are requested.
+    public func fetchPatch(from local: DeltaManifest) async throws -> DeltaPatch? {
+        let remote = try DeltaManifest.decode(from: try await transport.fetchManifest())
+        let plan = remote.plan(from: local)
+        guard !plan.isEmpty else { return nil }
+
+        var patch = DeltaPatch(version: remote.version)
+        if !plan.changed.isEmpty {
+            let request = try PlayaAPI.createEncoder().encode(plan.changed)
+            patch = try PlayaAPI.createDecoder().decode(DeltaPatch.self, from: try await transport.fetchPatch(request: request))
+            patch.version = remote.version
+        }
+        patch.deleted = plan.deleted
+        return patch
+    }
+}
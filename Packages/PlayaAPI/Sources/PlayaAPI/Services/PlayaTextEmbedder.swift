@@ -0,0 +1,99 @@
+import Foundation
+#if canImport(NaturalLanguage)
+import NaturalLanguage
+#endif
+
+// MARK: - Embedding Text
+
+extension PlayaEmbedding {
+    /// Longest description prefix embedded; sentence embeddings summarize the opening best
+    static let maxDescriptionLength = 600
+
+    /// Text embedded for an object: what it's called, what kind of thing it is, and what it's about
+    static func text(_ parts: [String?]) -> String {
+        parts
+            .compactMap { $0?.trimmingCharacters(in: .whitespacesAndNewlines) }
+            .filter { !$0.isEmpty }
+            .map { $0.count > maxDescriptionLength ? String($0.prefix(maxDescriptionLength)) : $0 }
+            .joined(separator: ". ")
+    }
+
+    public static func text(for art: Art) -> String {
+        text([art.name, "Art", art.category, art.artist, art.description])
+    }
+
+    public static func text(for camp: Camp) -> String {
+        text([camp.name, "Camp", camp.landmark, camp.description])
+    }
+
+    public static func text(for event: Event) -> String {
+        text([event.title, event.eventType.label, event.description])
+    }
+
+    public static func text(for mutantVehicle: MutantVehicle) -> String {
+        text([mutantVehicle.name, "Mutant vehicle", mutantVehicle.tags.joined(separator: ", "), mutantVehicle.description])
+    }
+}
+
+#if canImport(NaturalLanguage)
+
+// MARK: - Embedder
+
+/// English sentence embeddings from the on-device `NLEmbedding` model, L2-normalized.
+///
+/// The `playa-pack` tool embeds every object at build time; the app embeds only the query,
+/// with the revision recorded in the pack so both land in the same vector space.
+public final class PlayaTextEmbedder: @unchecked Sendable {
+    public let revision: Int
+    public let dimension: Int
+
+    private let embedding: NLEmbedding
+    /// `NLEmbedding` isn't documented as thread-safe
+    private let lock = NSLock()
+
+    /// nil when the model (or the requested revision) isn't on this device
+    public init?(revision: Int? = nil) {
+        let revision = revision ?? NLEmbedding.currentSentenceEmbeddingRevision(for: .english)
+        guard let embedding = NLEmbedding.sentenceEmbedding(for: .english, revision: revision) else {
+            return nil
+        }
+        self.embedding = embedding
+        self.revision = embedding.revision
+        self.dimension = embedding.dimension
+    }
+
+    /// Unit-length vector for `text`, nil if the model can't embed it
+    public func vector(for text: String) -> [Float]? {
+        lock.lock()
+        let values = embedding.vector(for: text)
+        lock.unlock()
+        guard let values, values.count == dimension else { return nil }
+        let norm = values.reduce(0) { $0 + $1 * $1 }.squareRoot()
+        guard norm > 0 else { return nil }
+        return values.map { Float($0 / norm) }
+    }
+
+    /// Embeddings of every object that the model can embed
+    public func embeddings(
+        art: [Art],
+        camps: [Camp],
+        events: [Event],
+        mutantVehicles: [MutantVehicle]
+    ) -> [PlayaEmbedding] {
+        var texts: [(type: String, uid: String, text: String)] = []
+        texts += art.map { ("art", $0.uid.value, PlayaEmbedding.text(for: $0)) }
+        texts += camps.map { ("camp", $0.uid.value, PlayaEmbedding.text(for: $0)) }
+        texts += events.map { ("event", $0.uid.value, PlayaEmbedding.text(for: $0)) }
+        texts += mutantVehicles.map { ("mutantVehicle", $0.uid.value, PlayaEmbedding.text(for: $0)) }
+
+        var seen = Set<String>()
+        return texts.compactMap { entry in
+            // Events repeat in the API data; keep the first
+            guard seen.insert("\(entry.type):\(entry.uid)").inserted,
+                  let values = vector(for: entry.text) else { return nil }
+            return PlayaEmbedding(objectType: entry.type, uid: entry.uid, revision: revision, values: values)
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,143 @@
+import Foundation
+import PlayaAPI
+
+/// In-process stand-in for the delta feed server, for testing the update flow offline.
+///
+/// Holds a mutable data set, serves its manifest and patches through `DeltaFeedTransport`,
+/// and counts the bytes it sends so tests can assert a delta is smaller than a full download.
+public final class DeltaFeedFixtureServer: DeltaFeedTransport, @unchecked Sendable {
+    private let lock = NSLock()
+    private var art: [String: Art]
+    private var camps: [String: Camp]
+    private var events: [String: Event]
+    private var mutantVehicles: [String: MutantVehicle]
+    private var revision = 1
+
+    private var _bytesServed = 0
+    private var _patchRequests: [DeltaObjectIDs] = []
+
+    public init(art: [Art] = [], camps: [Camp] = [], events: [Event] = [], mutantVehicles: [MutantVehicle] = []) {
+        self.art = Dictionary(art.map { ($0.uid.value, $0) }, uniquingKeysWith: { first, _ in first })
+        self.camps = Dictionary(camps.map { ($0.uid.value, $0) }, uniquingKeysWith: { first, _ in first })
+        self.events = Dictionary(events.map { ($0.uid.value, $0) }, uniquingKeysWith: { first, _ in first })
+        self.mutantVehicles = Dictionary(mutantVehicles.map { ($0.uid.value, $0) }, uniquingKeysWith: { first, _ in first })
+    }
+
+    /// Serves the data set in `MockAPIData`
+    public static func mock() throws -> DeltaFeedFixtureServer {
+        let parser = APIParserFactory.create()
+        return DeltaFeedFixtureServer(
+            art: try parser.parseArt(from: MockAPIData.artJSON),
+            camps: try parser.parseCamps(from: MockAPIData.campJSON),
+            events: try parser.parseEvents(from: MockAPIData.eventJSON),
+            mutantVehicles: try parser.parseMutantVehicles(from: MockAPIData.mutantVehicleJSON)
+        )
+    }
+
+    // MARK: - Stats
+
+    /// Total response bytes served since init or the last `resetStats()`
+    public var bytesServed: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _bytesServed
+    }
+
+    /// Object IDs requested in each patch call
+    public var patchRequests: [DeltaObjectIDs] {
+        lock.lock()
+        defer { lock.unlock() }
+        return _patchRequests
+    }
+
+    public func resetStats() {
+        lock.lock()
+        defer { lock.unlock() }
+        _bytesServed = 0
+        _patchRequests = []
+    }
+
+    // MARK: - Mutations
+
+    public func upsert(_ object: Art) { mutate { art[object.uid.value] = object } }
+    public func upsert(_ object: Camp) { mutate { camps[object.uid.value] = object } }
+    public func upsert(_ object: Event) { mutate { events[object.uid.value] = object } }
+    public func upsert(_ object: MutantVehicle) { mutate { mutantVehicles[object.uid.value] = object } }
+
+    public func removeArt(uid: String) { mutate { art[uid] = nil } }
+    public func removeCamp(uid: String) { mutate { camps[uid] = nil } }
+    public func removeEvent(uid: String) { mutate { events[uid] = nil } }
+    public func removeMutantVehicle(uid: String) { mutate { mutantVehicles[uid] = nil } }
+
+    /// Full files in the regular API format, as a non-delta client would download them
+    public func fullFiles() throws -> (art: Data, camps: Data, events: Data, mutantVehicles: Data) {
+        lock.lock()
+        defer { lock.unlock() }
+        let encoder = PlayaAPI.createEncoder()
+        return (
+            try encoder.encode(Self.sorted(art)),
+            try encoder.encode(Self.sorted(camps)),
+            try encoder.encode(Self.sorted(events)),
+            try encoder.encode(Self.sorted(mutantVehicles))
+        )
+    }
+
+    // MARK: - DeltaFeedTransport
+
+    public func fetchManifest() async throws -> Data {
+        let data = try withLock {
+            try DeltaManifest(
+                version: "\(revision)",
+                art: Self.sorted(art),
+                camps: Self.sorted(camps),
+                events: Self.sorted(events),
+                mutantVehicles: Self.sorted(mutantVehicles)
+            ).encoded()
+        }
+        record(bytes: data.count, request: nil)
+        return data
+    }
+
+    public func fetchPatch(request: Data) async throws -> Data {
+        let ids = try PlayaAPI.createDecoder().decode(DeltaObjectIDs.self, from: request)
+        let data = try withLock {
+            try PlayaAPI.createEncoder().encode(DeltaPatch(
+                version: "\(revision)",
+                art: ids.art.compactMap { art[$0] },
+                camps: ids.camps.compactMap { camps[$0] },
+                events: ids.events.compactMap { events[$0] },
+                mutantVehicles: ids.mutantVehicles.compactMap { mutantVehicles[$0] }
+            ))
+        }
+        record(bytes: data.count, request: ids)
+        return data
+    }
+
+    // MARK: - Private
+
+    private func mutate(_ body: () -> Void) {
+        lock.lock()
+        defer { lock.unlock() }
+        body()
+        revision += 1
+    }
+
+    private func withLock<T>(_ body: () throws -> T) rethrows -> T {
+        lock.lock()
+        defer { lock.unlock() }
+        return try body()
+    }
+
+    private func record(bytes: Int, request: DeltaObjectIDs?) {
+        lock.lock()
+        defer { lock.unlock() }
+        _bytesServed += bytes
+        if let request {
+            _patchRequests.append(request)
+        }
+    }
+
+    private static func sorted<T>(_ objects: [String: T]) -> [T] {
+        objects.sorted { $0.key < $1.key }.map(\.value)
+    }
+}
@@ -0,0 +1,65 @@
+import Foundation
+import PlayaAPI
+
+// Builds the compressed data pack shipped in the app bundle from a directory of API JSON files.
+//
+//   swift run --package-path Packages/PlayaAPI playa-pack <data-dir> <output.pack.lzfse>
+//
+// Reads art.json, camp.json, event.json, mv.json and points.json; missing files are skipped.
+// Where the NaturalLanguage sentence embedding model is available, also embeds every object
+// for the app's semantic search.
+
+let arguments = CommandLine.arguments
+guard arguments.count == 3 else {
+    FileHandle.standardError.write(Data("usage: playa-pack <data-dir> <output.pack.lzfse>\n".utf8))
+    exit(64)
+}
+
+let inputDirectory = URL(fileURLWithPath: arguments[1], isDirectory: true)
+let outputURL = URL(fileURLWithPath: arguments[2])
+let files: [(String, PlayaDataPack.Kind)] = [
+    ("art", .art),
+    ("camp", .camps),
+    ("event", .events),
+    ("mv", .mutantVehicles),
+    ("points", .points)
+]
+
+do {
+    var writer = PlayaDataPackWriter()
+    var jsonBytes = 0
+    var inputs: [PlayaDataPack.Kind: Data] = [:]
+    for (name, kind) in files {
+        let url = inputDirectory.appendingPathComponent("\(name).json")
+        guard let data = try? Data(contentsOf: url) else {
+            print("Skipping missing \(name).json")
+            continue
+        }
+        jsonBytes += data.count
+        try writer.addJSON(data, as: kind)
+        inputs[kind] = data
+    }
+
+    #if canImport(NaturalLanguage)
+    if let embedder = PlayaTextEmbedder() {
+        let parser = APIParserFactory.create()
+        let embeddings = embedder.embeddings(
+            art: try inputs[.art].map { try parser.parseArt(from: $0) } ?? [],
+            camps: try inputs[.camps].map { try parser.parseCamps(from: $0) } ?? [],
+            events: try inputs[.events].map { try parser.parseEvents(from: $0) } ?? [],
+            mutantVehicles: try inputs[.mutantVehicles].map { try parser.parseMutantVehicles(from: $0) } ?? []
+        )
+        try writer.add(embeddings, as: .embeddings)
+        print("Embedded \(embeddings.count) objects (\(embedder.dimension) dimensions, revision \(embedder.revision))")
+    } else {
+        print("Skipping embeddings: no sentence embedding model")
+    }
+    #endif
+
+    let compressed = try writer.compressed()
+    try compressed.write(to: outputURL, options: .atomic)
+    print("Wrote \(outputURL.lastPathComponent): \(jsonBytes) bytes of JSON -> \(writer.encoded().count) bytes packed, \(compressed.count) compressed")
+} catch {
+    FileHandle.standardError.write(Data("playa-pack failed: \(error)\n".utf8))
+    exit(1)
+}
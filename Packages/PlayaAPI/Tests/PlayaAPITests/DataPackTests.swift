@@ -0,0 +1,114 @@
+import XCTest
+@testable import PlayaAPI
+import PlayaAPITestHelpers
+
+final class DataPackTests: XCTestCase {
+
+    private func mockPack() throws -> PlayaDataPack {
+        var writer = PlayaDataPackWriter()
+        try writer.addJSON(MockAPIData.artJSON, as: .art)
+        try writer.addJSON(MockAPIData.campJSON, as: .camps)
+        try writer.addJSON(MockAPIData.eventJSON, as: .events)
+        try writer.addJSON(MockAPIData.mutantVehicleJSON, as: .mutantVehicles)
+        return try PlayaDataPack(data: writer.encoded())
+    }
+
+    // MARK: - Round-trip Tests
+
+    func testRoundTrip_MatchesJSONDecoding() throws {
+        let parser = APIParserFactory.create()
+        let pack = try mockPack()
+
+        XCTAssertEqual(try pack.section(.art)?.decodeAll(as: Art.self), try parser.parseArt(from: MockAPIData.artJSON))
+        XCTAssertEqual(try pack.section(.camps)?.decodeAll(as: Camp.self), try parser.parseCamps(from: MockAPIData.campJSON))
+        XCTAssertEqual(try pack.section(.events)?.decodeAll(as: Event.self), try parser.parseEvents(from: MockAPIData.eventJSON))
+        XCTAssertEqual(
+            try pack.section(.mutantVehicles)?.decodeAll(as: MutantVehicle.self),
+            try parser.parseMutantVehicles(from: MockAPIData.mutantVehicleJSON)
+        )
+        XCTAssertEqual(pack.kinds, [.art, .camps, .events, .mutantVehicles])
+        XCTAssertNil(pack.section(.points))
+    }
+
+    func testRecordFields_ReadWithoutDecoding() throws {
+        let pack = try mockPack()
+        let art = try XCTUnwrap(pack.section(.art)?.first)
+
+        XCTAssertEqual(art.string(at: "uid"), "a2IVI000000yWeZ2AU")
+        XCTAssertEqual(try XCTUnwrap(art.double(at: "location", "gpsLatitude")), 40.79179890754886, accuracy: 1e-12)
+        XCTAssertNil(art.string(at: "noSuchField"))
+        XCTAssertNil(art.string(at: "location", "noSuchField"))
+    }
+
+    func testPoints_StoredAsJSONObjects() throws {
+        let json = Data(#"[{"title": "Center Camp", "gps_latitude": 40.78, "year": 2025, "open": true}, {"title": "Temple"}]"#.utf8)
+        var writer = PlayaDataPackWriter()
+        try writer.addJSON(json, as: .points)
+        let points = try XCTUnwrap(PlayaDataPack(data: writer.encoded()).section(.points))
+
+        XCTAssertEqual(points.count, 2)
+        XCTAssertEqual(points[0].string(at: "title"), "Center Camp")
+        XCTAssertEqual(points[0].double(at: "gps_latitude"), 40.78)
+        XCTAssertEqual(points[0].double(at: "year"), 2025)
+        XCTAssertEqual(points[1].string(at: "title"), "Temple")
+    }
+
+    func testEmbeddings_QuantizedRoundTrip() throws {
+        let values: [Float] = [0.5, -0.25, 0, 0.125]
+        var writer = PlayaDataPackWriter()
+        try writer.add([PlayaEmbedding(objectType: "art", uid: "a1", revision: 1, values: values)], as: .embeddings)
+        let section = try XCTUnwrap(PlayaDataPack(data: writer.encoded()).section(.embeddings))
+
+        let embedding = try XCTUnwrap(section.decodeAll(as: PlayaEmbedding.self).first)
+        XCTAssertEqual(embedding.uid, "a1")
+        XCTAssertEqual(embedding.revision, 1)
+        // Largest component scales to 127, the rest keep their ratio to it
+        XCTAssertEqual(try XCTUnwrap(embedding.quantized).map { Int8(bitPattern: $0) }, [127, -64, 0, 32])
+        XCTAssertThrowsError(try writer.addJSON(Data("[]".utf8), as: .embeddings))
+    }
+
+    func testEmbeddingText_IncludesNameTypeAndDescription() throws {
+        let art = try XCTUnwrap(APIParserFactory.create().parseArt(from: MockAPIData.artJSON).first)
+        let text = PlayaEmbedding.text(for: art)
+
+        XCTAssertTrue(text.hasPrefix("Burning Questions. Art. Open Playa. "))
+        XCTAssertTrue(text.hasSuffix("An interactive art installation exploring curiosity and wonder."))
+    }
+
+    // MARK: - Format Tests
+
+    func testPack_IsSmallerThanJSON() throws {
+        var writer = PlayaDataPackWriter()
+        // Repeated objects share interned strings
+        let events = try APIParserFactory.create().parseEvents(from: MockAPIData.eventJSON)
+        let many = Array(repeating: events, count: 50).flatMap { $0 }
+        try writer.add(many, as: .events)
+
+        XCTAssertLessThan(writer.encoded().count, try PlayaAPI.createEncoder().encode(many).count)
+        XCTAssertLessThan(try writer.compressed().count, writer.encoded().count)
+    }
+
+    func testInvalidData_Throws() {
+        XCTAssertThrowsError(try PlayaDataPack(data: Data("[]".utf8)))
+        XCTAssertThrowsError(try PlayaDataPack(data: Data()))
+    }
+
+    func testOpenCompressed_CachesDecompressedCopy() throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        var writer = PlayaDataPackWriter()
+        try writer.addJSON(MockAPIData.artJSON, as: .art)
+        let source = directory.appendingPathComponent("data.pack.lzfse")
+        try writer.compressed().write(to: source)
+        let cache = directory.appendingPathComponent("cache")
+
+        let first = try PlayaDataPack.open(compressedAt: source, cacheDirectory: cache)
+        let second = try PlayaDataPack.open(compressedAt: source, cacheDirectory: cache)
+
+        XCTAssertEqual(first.section(.art)?.count, 1)
+        XCTAssertEqual(second.section(.art)?.first?.string(at: "uid"), "a2IVI000000yWeZ2AU")
+        XCTAssertEqual(try FileManager.default.contentsOfDirectory(atPath: cache.path).count, 1)
+    }
+}
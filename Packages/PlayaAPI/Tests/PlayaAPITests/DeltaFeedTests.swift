@@ -0,0 +1,46 @@
+import XCTest
+@testable import PlayaAPI
+import PlayaAPITestHelpers
+
+final class DeltaFeedTests: XCTestCase {
+
+    func testContentHash_IsStableAcrossRoundTrip() throws {
+        let art = MockAPIData.mockArt
+        let roundTripped = try PlayaAPI.createDecoder().decode(Art.self, from: PlayaAPI.createEncoder().encode(art))
+
+        XCTAssertEqual(try DeltaManifest.contentHash(art), try DeltaManifest.contentHash(roundTripped))
+        XCTAssertEqual(try DeltaManifest.contentHash(art).count, 16)
+    }
+
+    func testPlan_FindsChangedAddedAndDeleted() {
+        let local = DeltaManifest(version: "1", art: ["a": "1", "b": "2"], camps: ["c": "3"])
+        let remote = DeltaManifest(version: "2", art: ["a": "1", "b": "9", "n": "4"])
+
+        let plan = remote.plan(from: local)
+
+        XCTAssertEqual(plan.changed, DeltaObjectIDs(art: ["b", "n"]))
+        XCTAssertEqual(plan.deleted, DeltaObjectIDs(camps: ["c"]))
+        XCTAssertTrue(remote.plan(from: remote).isEmpty)
+    }
+
+    func testManifest_KeepsUIDKeysVerbatim() throws {
+        let manifest = DeltaManifest(version: "1", events: ["78ZvNx_SeeZ": "abc"])
+        XCTAssertEqual(try DeltaManifest.decode(from: manifest.encoded()), manifest)
+    }
+
+    func testClient_RequestsOnlyChangedObjects() async throws {
+        let server = try DeltaFeedFixtureServer.mock()
+        let client = DeltaFeedClient(transport: server)
+        let local = try DeltaManifest.decode(from: await server.fetchManifest())
+
+        server.removeEvent(uid: "78ZvNxSeeZQbaeHuughD")
+        server.upsert(Camp(uid: CampID("new-camp"), name: "New Camp", year: 2025))
+        server.resetStats()
+
+        let patch = try await client.fetchPatch(from: local)
+
+        XCTAssertEqual(patch?.camps.map(\.uid.value), ["new-camp"])
+        XCTAssertEqual(patch?.deleted.events, ["78ZvNxSeeZQbaeHuughD"])
+        XCTAssertEqual(server.patchRequests, [DeltaObjectIDs(camps: ["new-camp"])])
+    }
+}
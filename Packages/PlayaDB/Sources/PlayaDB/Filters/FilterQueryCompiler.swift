@@ -0,0 +1,373 @@
+import Foundation
+import GRDB
+import MapKit
+
+/// A filter compiled to a single SQL statement.
+///
+/// `sql` depends only on which predicates the filter uses (its shape), never on their values,
+/// so it doubles as the key of the connection's prepared-statement cache: refreshing an
+/// observation re-binds `arguments` to an already prepared statement.
+struct CompiledFilterQuery {
+    let sql: String
+    let arguments: StatementArguments
+
+    /// Runs the query through the connection's statement cache
+    func fetchAll<Record: FetchableRecord>(
+        _ type: Record.Type,
+        _ db: Database,
+        adapter: (any RowAdapter)? = nil
+    ) throws -> [Record] {
+        let statement = try db.cachedStatement(sql: sql)
+        return try Record.fetchAll(statement, arguments: arguments, adapter: adapter)
+    }
+
+    /// Runs a `count` query through the connection's statement cache
+    func fetchCount(_ db: Database) throws -> Int {
+        try Int.fetchOne(db.cachedStatement(sql: sql), arguments: arguments) ?? 0
+    }
+}
+
+/// Compiles `ArtFilter`, `CampFilter`, `MutantVehicleFilter` and `EventFilter` into one SQL
+/// statement each, with every predicate (search, region, favorites, year, event type, time)
+/// pushed into SQL. The SQL text for each shape is built once and reused.
+///
+/// Every query orders by its list sort key (name, or start time for events) plus a unique
+/// tiebreaker, so a `ListWindowRequest` can page it by keyset: the window's cursor becomes
+/// a row-value comparison against the last row seen, and `LIMIT` bounds the rows decoded.
+enum FilterQueryCompiler {
+    /// What an event query returns
+    enum EventSelection {
+        /// Occurrence, event, hosting camp and art columns; decode with `eventRowAdapter(_:)`
+        case joined
+        /// Occurrence columns only
+        case occurrences
+    }
+
+    /// - Parameter window: Rows after the window's cursor, at most `limit + 1` of them so the
+    ///   caller can tell whether more follow. Nil for every matching row.
+    static func compile(_ filter: ArtFilter, window: ListWindowRequest? = nil) -> CompiledFilterQuery {
+        artQuery.compile(filter, now: Date(), window: window)
+    }
+
+    static func compile(_ filter: CampFilter, window: ListWindowRequest? = nil) -> CompiledFilterQuery {
+        campQuery.compile(filter, now: Date(), window: window)
+    }
+
+    static func compile(_ filter: MutantVehicleFilter, window: ListWindowRequest? = nil) -> CompiledFilterQuery {
+        mutantVehicleQuery.compile(filter, now: Date(), window: window)
+    }
+
+    /// - Parameter now: Reference time for `happeningNow`, `startingWithinHours` and
+    ///   `includeExpired`. Bound as an argument, so it doesn't change the statement.
+    static func compile(
+        _ filter: EventFilter,
+        selecting selection: EventSelection = .joined,
+        window: ListWindowRequest? = nil,
+        now: Date = Date()
+    ) -> CompiledFilterQuery {
+        switch selection {
+        case .joined: return joinedEventQuery.compile(filter, now: now, window: window)
+        case .occurrences: return occurrenceQuery.compile(filter, now: now, window: window)
+        }
+    }
+
+    /// `SELECT COUNT(*)` of the rows `compile(_:)` returns
+    static func count(_ filter: ArtFilter) -> CompiledFilterQuery {
+        artQuery.count(filter, now: Date())
+    }
+
+    static func count(_ filter: CampFilter) -> CompiledFilterQuery {
+        campQuery.count(filter, now: Date())
+    }
+
+    static func count(_ filter: MutantVehicleFilter) -> CompiledFilterQuery {
+        mutantVehicleQuery.count(filter, now: Date())
+    }
+
+    static func count(_ filter: EventFilter, now: Date = Date()) -> CompiledFilterQuery {
+        occurrenceQuery.count(filter, now: now)
+    }
+
+    /// Splits a `.joined` event row into the scopes `EventOccurrenceJoinedRow` expects:
+    /// the occurrence at the root, `event` beneath it, and `hostedCamp`/`locatedArt` beneath
+    /// the event.
+    static func eventRowAdapter(_ db: Database) throws -> any RowAdapter {
+        let counts = try ["event_occurrences", "event_objects", "camp_objects", "art_objects"]
+            .map { try db.columns(in: $0).count }
+        let adapters = splittingRowAdapters(columnCounts: counts)
+        return ScopeAdapter(base: adapters[0], scopes: [
+            "event": ScopeAdapter(base: adapters[1], scopes: [
+                "hostedCamp": adapters[2],
+                "locatedArt": adapters[3],
+            ])
+        ])
+    }
+
+    // MARK: - Queries
+
+    private static let artQuery = FilterQuery<ArtFilter>(
+        select: "SELECT art_objects.* FROM art_objects",
+        order: "art_objects.name",
+        tiebreaker: "art_objects.uid",
+        clauses: [
+            .year(table: "art_objects") { $0.year },
+            .region(table: "art_objects", spatialType: "art") { $0.region },
+            .search(table: "art_objects") { $0.searchText },
+            .favorites(table: "art_objects", type: .art) { $0.onlyFavorites },
+            FilterClause(sql: """
+                EXISTS (SELECT 1 FROM event_objects WHERE event_objects.located_at_art = art_objects.uid)
+                """) { filter, _ in filter.onlyWithEvents ? [] : nil },
+        ]
+    )
+
+    private static let campQuery = FilterQuery<CampFilter>(
+        select: "SELECT camp_objects.* FROM camp_objects",
+        order: "camp_objects.name",
+        tiebreaker: "camp_objects.uid",
+        clauses: [
+            .year(table: "camp_objects") { $0.year },
+            .region(table: "camp_objects", spatialType: "camp") { $0.region },
+            .search(table: "camp_objects") { $0.searchText },
+            .favorites(table: "camp_objects", type: .camp) { $0.onlyFavorites },
+        ]
+    )
+
+    private static let mutantVehicleQuery = FilterQuery<MutantVehicleFilter>(
+        select: "SELECT mv_objects.* FROM mv_objects",
+        order: "mv_objects.name",
+        tiebreaker: "mv_objects.uid",
+        clauses: [
+            .year(table: "mv_objects") { $0.year },
+            .search(table: "mv_objects") { $0.searchText },
+            .favorites(table: "mv_objects", type: .mutantVehicle) { $0.onlyFavorites },
+            FilterClause(sql: """
+                EXISTS (SELECT 1 FROM mv_tags WHERE mv_tags.mv_id = mv_objects.uid AND mv_tags.tag = ?)
+                """) { filter, _ in filter.tag.map { [$0] } },
+        ]
+    )
+
+    private static let eventFrom = """
+        FROM event_occurrences
+        JOIN event_objects ON event_objects.uid = event_occurrences.event_id
+        """
+
+    private static let joinedEventQuery = FilterQuery<EventFilter>(
+        select: """
+            SELECT event_occurrences.*, event_objects.*, camp_objects.*, art_objects.*
+            \(eventFrom)
+            LEFT JOIN camp_objects ON camp_objects.uid = event_objects.hosted_by_camp
+            LEFT JOIN art_objects ON art_objects.uid = event_objects.located_at_art
+            """,
+        order: "event_occurrences.start_time",
+        tiebreaker: "event_occurrences.id",
+        clauses: eventClauses
+    )
+
+    private static let occurrenceQuery = FilterQuery<EventFilter>(
+        select: "SELECT event_occurrences.* \(eventFrom)",
+        order: "event_occurrences.start_time",
+        tiebreaker: "event_occurrences.id",
+        clauses: eventClauses
+    )
+
+    /// Same semantics as `eventOccurrenceRequest(filter:)`: one time constraint (happening now,
+    /// starting soon or not expired), then the date bounds, overlap window and parent-event
+    /// predicates. Favorites match either the event or the single occurrence.
+    private static let eventClauses: [FilterClause<EventFilter>] = [
+        FilterClause(sql: "event_occurrences.start_time <= ? AND event_occurrences.end_time > ?") { filter, now in
+            filter.happeningNow ? [now, now] : nil
+        },
+        FilterClause(sql: "event_occurrences.start_time >= ? AND event_occurrences.start_time <= ?") { filter, now in
+            guard !filter.happeningNow, let hours = filter.startingWithinHours else { return nil }
+            return [now, Calendar.current.date(byAdding: .hour, value: hours, to: now) ?? now]
+        },
+        FilterClause(sql: "event_occurrences.end_time > ?") { filter, now in
+            guard !filter.happeningNow, filter.startingWithinHours == nil, !filter.includeExpired else { return nil }
+            return [now]
+        },
+        FilterClause(sql: "event_occurrences.start_time >= ?") { filter, _ in filter.startDate.map { [$0] } },
+        FilterClause(sql: "event_occurrences.start_time < ?") { filter, _ in filter.endDate.map { [$0] } },
+        FilterClause(sql: "event_occurrences.start_time < ? AND event_occurrences.end_time > ?") { filter, _ in
+            filter.activeWindow.map { [$0.end, $0.start] }
+        },
+        .search(table: "event_objects") { $0.searchText },
+        FilterClause(sql: """
+            event_occurrences.id IN (
+                SELECT id FROM event_occurrence_rtree
+                WHERE maxLat >= ? AND minLat <= ? AND maxLon >= ? AND minLon <= ?
+            )
+            """) { filter, _ in
+            filter.region.map { region -> FilterArguments in
+                let bounds = FilterRegion(region).bounds
+                return [bounds.minLat, bounds.maxLat, bounds.minLon, bounds.maxLon]
+            }
+        },
+        FilterClause(sql: """
+            EXISTS (
+                SELECT 1 FROM object_metadata
+                WHERE object_metadata.object_type = '\(DataObjectType.event.rawValue)'
+                  AND object_metadata.object_id IN (
+                      event_occurrences.event_id,
+                      event_occurrences.event_id || '_' || event_occurrences.id
+                  )
+                  AND object_metadata.is_favorite = 1
+            )
+            """) { filter, _ in filter.onlyFavorites ? [] : nil },
+        .year(table: "event_objects") { $0.year },
+        FilterClause(sql: "event_objects.event_type_code IN (SELECT value FROM json_each(?))") { filter, _ in
+            // One JSON argument keeps the statement shape independent of the number of codes
+            guard let codes = filter.eventTypeCodes, !codes.isEmpty,
+                  let json = try? JSONEncoder().encode(codes.sorted()) else { return nil }
+            return [String(decoding: json, as: UTF8.self)]
+        },
+    ]
+}
+
+// MARK: - Building Blocks
+
+private typealias FilterArguments = [(any DatabaseValueConvertible)?]
+
+/// One optional predicate of a filter query. `arguments` returns nil when the predicate
+/// doesn't apply to a filter, otherwise the values for its placeholders.
+private struct FilterClause<Filter> {
+    let sql: String
+    let arguments: (Filter, Date) -> FilterArguments?
+
+    init(sql: String, arguments: @escaping (Filter, Date) -> FilterArguments?) {
+        self.sql = sql
+        self.arguments = arguments
+    }
+
+    static func year(table: String, _ year: @escaping (Filter) -> Int?) -> Self {
+        FilterClause(sql: "\(table).year = ?") { filter, _ in year(filter).map { [$0] } }
+    }
+
+    /// Point R*Tree lookup, same as `QueryInterfaceRequest.inRegion(_:)` plus `withLocation()`
+    static func region(table: String, spatialType: String, _ region: @escaping (Filter) -> MKCoordinateRegion?) -> Self {
+        FilterClause(sql: """
+            \(table).gps_latitude IS NOT NULL AND \(table).gps_longitude IS NOT NULL
+            AND \(table).uid IN (
+                SELECT so.object_uid FROM spatial_objects so
+                JOIN spatial_index si ON si.id = so.spatial_id
+                WHERE so.object_type = '\(spatialType)'
+                  AND si.maxLat >= ? AND si.minLat <= ?
+                  AND si.maxLon >= ? AND si.minLon <= ?
+            )
+            """) { filter, _ in
+            region(filter).map { region -> FilterArguments in
+                let bounds = FilterRegion(region).bounds
+                return [bounds.minLat, bounds.maxLat, bounds.minLon, bounds.maxLon]
+            }
+        }
+    }
+
+    /// FTS5 match against `<table>_fts`, same as `QueryInterfaceRequest.matching(searchText:)`
+    static func search(table: String, _ searchText: @escaping (Filter) -> String?) -> Self {
+        FilterClause(sql: "\(table).rowid IN (SELECT rowid FROM \(table)_fts WHERE \(table)_fts MATCH ?)") { filter, _ in
+            guard let text = searchText(filter), !text.isEmpty else { return nil }
+            return [FTS5Pattern(matchingAllTokensIn: text)]
+        }
+    }
+
+    static func favorites(table: String, type: DataObjectType, _ onlyFavorites: @escaping (Filter) -> Bool) -> Self {
+        FilterClause(sql: """
+            EXISTS (
+                SELECT 1 FROM object_metadata
+                WHERE object_metadata.object_type = '\(type.rawValue)'
+                  AND object_metadata.object_id = \(table).uid
+                  AND object_metadata.is_favorite = 1
+            )
+            """) { filter, _ in onlyFavorites(filter) ? [] : nil }
+    }
+}
+
+/// The clauses of one filter type, with the SQL text built once per shape. A shape is the
+/// bit set of clauses that apply, plus the kind of statement: every row, a keyset window,
+/// or a count.
+private final class FilterQuery<Filter>: @unchecked Sendable {
+    private enum Kind: Hashable {
+        case all
+        case window(hasCursor: Bool)
+        case count
+    }
+
+    private struct Shape: Hashable {
+        let clauses: Int
+        let kind: Kind
+    }
+
+    private let select: String
+    private let order: String
+    private let tiebreaker: String
+    private let clauses: [FilterClause<Filter>]
+    private let lock = NSLock()
+    private var sqlByShape: [Shape: String] = [:]
+
+    /// - Parameters:
+    ///   - order: Sort key of the list
+    ///   - tiebreaker: Unique column breaking ties in `order`, so keyset windows neither skip
+    ///     nor repeat rows sharing a sort key
+    init(select: String, order: String, tiebreaker: String, clauses: [FilterClause<Filter>]) {
+        self.select = select
+        self.order = order
+        self.tiebreaker = tiebreaker
+        self.clauses = clauses
+    }
+
+    func compile(_ filter: Filter, now: Date, window: ListWindowRequest? = nil) -> CompiledFilterQuery {
+        let (shape, clauseArguments) = bind(filter, now: now)
+        var arguments = clauseArguments
+        guard let window else {
+            return CompiledFilterQuery(sql: sql(for: Shape(clauses: shape, kind: .all)), arguments: StatementArguments(arguments))
+        }
+        if let cursor = window.after {
+            arguments += [cursor.key, cursor.tiebreaker]
+        }
+        // One extra row tells whether the window has a next page
+        arguments.append(window.limit + 1)
+        let kind = Kind.window(hasCursor: window.after != nil)
+        return CompiledFilterQuery(sql: sql(for: Shape(clauses: shape, kind: kind)), arguments: StatementArguments(arguments))
+    }
+
+    func count(_ filter: Filter, now: Date) -> CompiledFilterQuery {
+        let (shape, arguments) = bind(filter, now: now)
+        return CompiledFilterQuery(sql: sql(for: Shape(clauses: shape, kind: .count)), arguments: StatementArguments(arguments))
+    }
+
+    private func bind(_ filter: Filter, now: Date) -> (shape: Int, arguments: FilterArguments) {
+        var shape = 0
+        var arguments: FilterArguments = []
+        for (index, clause) in clauses.enumerated() {
+            guard let values = clause.arguments(filter, now) else { continue }
+            shape |= 1 << index
+            arguments += values
+        }
+        return (shape, arguments)
+    }
+
+    private func sql(for shape: Shape) -> String {
+        lock.lock()
+        defer { lock.unlock() }
+        if let sql = sqlByShape[shape] { return sql }
+        var predicates = clauses.indices
+            .filter { shape.clauses & (1 << $0) != 0 }
+            .map { "(\(clauses[$0].sql))" }
+        if shape.kind == .window(hasCursor: true) {
+            predicates.append("((\(order), \(tiebreaker)) > (?, ?))")
+        }
+        var sql = select
+        if !predicates.isEmpty {
+            sql += "\nWHERE " + predicates.joined(separator: "\n  AND ")
+        }
+        switch shape.kind {
+        case .all:
+            sql += "\nORDER BY \(order), \(tiebreaker)"
+        case .window:
+            sql += "\nORDER BY \(order), \(tiebreaker)\nLIMIT ?"
+        case .count:
+            sql = "SELECT COUNT(*) FROM (\(sql))"
+        }
+        sqlByShape[shape] = sql
+        return sql
+    }
+}
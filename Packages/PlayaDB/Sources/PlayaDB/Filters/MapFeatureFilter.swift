@@ -0,0 +1,36 @@
+import Foundation
+
+/// Selects which objects go into a map feature collection.
+///
+/// Each category is optional; a `nil` category is left out of the collection entirely.
+/// Categories reuse the list filters so the map and the lists agree on what matches.
+///
+/// Example:
+/// ```swift
+/// let filter = MapFeatureFilter(
+///     art: ArtFilter(),
+///     events: EventFilter(happeningNow: true)
+/// )
+/// let collection = try await playaDB.fetchMapFeatures(filter: filter)
+/// shapeSource.shape = try MLNShape(data: collection.geoJSON, encoding: String.Encoding.utf8.rawValue)
+/// ```
+public struct MapFeatureFilter: Hashable, Codable {
+    /// Art to include, or nil for none
+    public var art: ArtFilter?
+
+    /// Camps to include, or nil for none
+    public var camps: CampFilter?
+
+    /// Event occurrences to include, or nil for none
+    public var events: EventFilter?
+
+    public init(
+        art: ArtFilter? = nil,
+        camps: CampFilter? = nil,
+        events: EventFilter? = nil
+    ) {
+        self.art = art
+        self.camps = camps
+        self.events = events
+    }
+}
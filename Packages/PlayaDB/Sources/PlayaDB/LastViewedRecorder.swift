@@ -0,0 +1,44 @@
+import Foundation
+
+/// Pending last-viewed dates waiting to be written in one batch.
+///
+/// Opening a detail page used to do a metadata write on the spot. Views are now recorded
+/// here and flushed together a moment later, so paging through several objects costs one
+/// write instead of one per page. Repeated views of the same object keep the latest date.
+final class LastViewedRecorder {
+    struct Key: Hashable {
+        let type: DataObjectType
+        let uid: String
+    }
+
+    private let lock = NSLock()
+    private var pending: [Key: Date] = [:]
+    private var flushScheduled = false
+
+    /// Adds a view. Returns true when no flush is scheduled yet and the caller should schedule one.
+    func record(_ date: Date, type: DataObjectType, uid: String) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        let key = Key(type: type, uid: uid)
+        pending[key] = max(pending[key] ?? date, date)
+        guard !flushScheduled else { return false }
+        flushScheduled = true
+        return true
+    }
+
+    /// Removes and returns everything recorded so far.
+    func drain() -> [Key: Date] {
+        lock.lock()
+        defer { lock.unlock() }
+        let drained = pending
+        pending = [:]
+        flushScheduled = false
+        return drained
+    }
+
+    var isEmpty: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return pending.isEmpty
+    }
+}
@@ -0,0 +1,62 @@
+import Foundation
+
+/// Per-category cache of built map features and their GeoJSON encoding.
+///
+/// Entries are keyed by object type and the category filter, and dropped wholesale per type
+/// when a table feeding that type changes (see `PlayaDBImpl.setupMapFeatureInvalidation`).
+/// A generation counter per type guards against storing results of a read that raced an
+/// invalidating write.
+final class MapFeatureCache {
+    struct Fragment {
+        let features: [MapFeature]
+        /// Output of `MapFeatureCollection.encodeFeatures`
+        let encoded: Data
+    }
+
+    private struct Entry {
+        let fragment: Fragment
+        /// Set for time-relative filters (e.g. happening now), whose results go stale
+        /// without any table changing.
+        let expiresAt: Date?
+    }
+
+    private let lock = NSLock()
+    /// isolate access with `lock`
+    private var entries: [DataObjectType: [AnyHashable: Entry]] = [:]
+    /// isolate access with `lock`
+    private var generations: [DataObjectType: Int] = [:]
+
+    func fragment(type: DataObjectType, key: AnyHashable, now: Date = Date()) -> Fragment? {
+        lock.lock()
+        defer { lock.unlock() }
+        guard let entry = entries[type]?[key] else { return nil }
+        if let expiresAt = entry.expiresAt, expiresAt <= now {
+            entries[type]?[key] = nil
+            return nil
+        }
+        return entry.fragment
+    }
+
+    /// Capture before reading from the database, pass back to `store`.
+    func generation(for type: DataObjectType) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return generations[type, default: 0]
+    }
+
+    func store(_ fragment: Fragment, type: DataObjectType, key: AnyHashable, generation: Int, expiresAt: Date?) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard generations[type, default: 0] == generation else { return }
+        entries[type, default: [:]][key] = Entry(fragment: fragment, expiresAt: expiresAt)
+    }
+
+    func invalidate(_ types: [DataObjectType]) {
+        lock.lock()
+        defer { lock.unlock() }
+        for type in types {
+            entries[type] = nil
+            generations[type, default: 0] += 1
+        }
+    }
+}
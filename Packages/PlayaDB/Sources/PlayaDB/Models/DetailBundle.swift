@@ -0,0 +1,44 @@
+import Foundation
+
+/// Everything the detail screen needs for one object, read in a single GRDB transaction.
+/// See `PlayaDB.fetchDetailBundle(uid:)`.
+public struct DetailBundle {
+    /// Art, camp, event, event occurrence or mutant vehicle
+    public let object: any DataObject
+
+    /// Stored metadata for `object`, nil if the object has never been favorited, noted or viewed.
+    /// The bundle read never inserts a default row.
+    public let metadata: ObjectMetadata?
+
+    /// Cached colors for the object's thumbnail. For events this is keyed by the host camp/art.
+    public let thumbnailColors: ThumbnailColors?
+
+    /// Host camp or art for events, nil otherwise
+    public let host: (any PlaceDataObject)?
+
+    /// Events at the host (for events) or at the object itself (for art/camps),
+    /// sorted by start time
+    public let hostEvents: [EventObjectOccurrence]
+
+    /// All occurrences of the event (for events), sorted by start time
+    public let occurrences: [EventObjectOccurrence]
+
+    /// Convenience: whether this object is favorited.
+    public var isFavorite: Bool { metadata?.isFavorite ?? false }
+
+    public init(
+        object: any DataObject,
+        metadata: ObjectMetadata?,
+        thumbnailColors: ThumbnailColors?,
+        host: (any PlaceDataObject)?,
+        hostEvents: [EventObjectOccurrence],
+        occurrences: [EventObjectOccurrence]
+    ) {
+        self.object = object
+        self.metadata = metadata
+        self.thumbnailColors = thumbnailColors
+        self.host = host
+        self.hostEvents = hostEvents
+        self.occurrences = occurrences
+    }
+}
@@ -0,0 +1,279 @@
+import Foundation
+import CoreLocation
+
+/// Struct-of-arrays snapshot of event occurrences.
+///
+/// `[ListRow<EventObjectOccurrence>]` stores a full `EventObject` copy and an existential host
+/// per occurrence, so a festival's ~8k occurrences retain ~8k copies of ~4k events. Here each
+/// occurrence is four scalar columns; events and hosts are stored once and referenced by
+/// index, and repeated strings (event type codes/labels) are interned so equal values share
+/// one buffer.
+///
+/// Occurrences keep the query's start-time ordering. Iterate with the `Row` view, which is
+/// a store reference plus an index, and only materialize `EventObjectOccurrence` values at
+/// the edges that need them.
+public final class EventOccurrenceStore {
+
+    // MARK: - Occurrence Columns
+
+    /// `EventOccurrence.id`, 0 if unsaved
+    public let occurrenceIDs: [Int64]
+    /// Seconds since 1970
+    public let startTimes: [TimeInterval]
+    /// Seconds since 1970
+    public let endTimes: [TimeInterval]
+    /// Index into `events`
+    public let eventIndices: [Int32]
+    /// Whether the event or this occurrence is favorited
+    public let isFavorite: [Bool]
+
+    // MARK: - Shared Records
+
+    public let events: [EventObject]
+    /// Index into `hosts` per event, -1 if the event has no resolved host
+    public let eventHostIndices: [Int32]
+    /// Index into `strings` per event
+    public let eventTypeCodeIndices: [Int32]
+    /// Cached thumbnail colors per event
+    public let eventThumbnailColors: [ThumbnailColors?]
+    public let hosts: [any PlaceDataObject]
+    /// Interned string table
+    public let strings: [String]
+
+    public init(
+        occurrences: [EventOccurrence],
+        events: [EventObject],
+        hosts: [String: any PlaceDataObject],
+        favoriteIDs: Set<String> = [],
+        thumbnailColors: [String: ThumbnailColors] = [:]
+    ) {
+        var interner = StringInterner()
+        var internedEvents: [EventObject] = []
+        internedEvents.reserveCapacity(events.count)
+        var eventIndexByUID: [String: Int32] = [:]
+        eventIndexByUID.reserveCapacity(events.count)
+        var typeCodeIndices: [Int32] = []
+        typeCodeIndices.reserveCapacity(events.count)
+        var hostIndices: [Int32] = []
+        hostIndices.reserveCapacity(events.count)
+        var hostList: [any PlaceDataObject] = []
+        var hostIndexByUID: [String: Int32] = [:]
+
+        for var event in events where eventIndexByUID[event.uid] == nil {
+            let code = interner.intern(event.eventTypeCode)
+            event.eventTypeCode = interner.strings[Int(code)]
+            event.eventTypeLabel = interner.strings[Int(interner.intern(event.eventTypeLabel))]
+            event.otherLocation = interner.strings[Int(interner.intern(event.otherLocation))]
+
+            var hostIndex: Int32 = -1
+            if let host = hosts[event.uid] {
+                if let existing = hostIndexByUID[host.uid] {
+                    hostIndex = existing
+                } else {
+                    hostIndex = Int32(hostList.count)
+                    hostIndexByUID[host.uid] = hostIndex
+                    hostList.append(host)
+                }
+            }
+
+            eventIndexByUID[event.uid] = Int32(internedEvents.count)
+            internedEvents.append(event)
+            typeCodeIndices.append(code)
+            hostIndices.append(hostIndex)
+        }
+
+        var occurrenceIDs: [Int64] = []
+        var startTimes: [TimeInterval] = []
+        var endTimes: [TimeInterval] = []
+        var eventIndices: [Int32] = []
+        var isFavorite: [Bool] = []
+        occurrenceIDs.reserveCapacity(occurrences.count)
+        startTimes.reserveCapacity(occurrences.count)
+        endTimes.reserveCapacity(occurrences.count)
+        eventIndices.reserveCapacity(occurrences.count)
+        isFavorite.reserveCapacity(occurrences.count)
+        for occurrence in occurrences {
+            guard let eventIndex = eventIndexByUID[occurrence.eventId] else { continue }
+            occurrenceIDs.append(occurrence.id ?? 0)
+            startTimes.append(occurrence.startTime.timeIntervalSince1970)
+            endTimes.append(occurrence.endTime.timeIntervalSince1970)
+            eventIndices.append(eventIndex)
+            // Metadata keys either the event or the occurrence (`EventObjectOccurrence.uid`)
+            isFavorite.append(!favoriteIDs.isEmpty && (
+                favoriteIDs.contains(occurrence.eventId)
+                    || favoriteIDs.contains("\(occurrence.eventId)_\(occurrence.id ?? 0)")
+            ))
+        }
+
+        self.occurrenceIDs = occurrenceIDs
+        self.startTimes = startTimes
+        self.endTimes = endTimes
+        self.eventIndices = eventIndices
+        self.isFavorite = isFavorite
+        self.events = internedEvents
+        self.eventHostIndices = hostIndices
+        self.eventTypeCodeIndices = typeCodeIndices
+        self.eventThumbnailColors = internedEvents.map { thumbnailColors[$0.uid] }
+        self.hosts = hostList
+        self.strings = interner.strings
+    }
+
+    /// Empty store
+    public convenience init() {
+        self.init(occurrences: [], events: [], hosts: [:])
+    }
+
+    // MARK: - Row View
+
+    /// Lightweight view of one occurrence. Reads columns on demand; nothing is copied
+    /// until `materialize()`.
+    public struct Row {
+        public let store: EventOccurrenceStore
+        public let index: Int
+
+        var eventIndex: Int { Int(store.eventIndices[index]) }
+
+        public var occurrenceID: Int64 { store.occurrenceIDs[index] }
+        public var startDate: Date { Date(timeIntervalSince1970: store.startTimes[index]) }
+        public var endDate: Date { Date(timeIntervalSince1970: store.endTimes[index]) }
+        public var event: EventObject { store.events[eventIndex] }
+        public var eventUID: String { store.events[eventIndex].uid }
+        public var name: String { store.events[eventIndex].name }
+        public var eventTypeCode: String { store.strings[Int(store.eventTypeCodeIndices[eventIndex])] }
+        public var isFavorite: Bool { store.isFavorite[index] }
+        public var thumbnailColors: ThumbnailColors? { store.eventThumbnailColors[eventIndex] }
+
+        /// Same format as `EventObjectOccurrence.uid`
+        public var uid: String { "\(eventUID)_\(occurrenceID)" }
+
+        public var host: (any PlaceDataObject)? {
+            let hostIndex = store.eventHostIndices[eventIndex]
+            return hostIndex >= 0 ? store.hosts[Int(hostIndex)] : nil
+        }
+
+        public var hostName: String? { host?.name }
+
+        /// Event GPS, falling back to the host's
+        public var location: CLLocation? {
+            event.location ?? host?.location
+        }
+
+        /// Whether the occurrence overlaps `date` (start inclusive, end exclusive)
+        public func isHappening(at date: Date) -> Bool {
+            let t = date.timeIntervalSince1970
+            return store.startTimes[index] <= t && t < store.endTimes[index]
+        }
+
+        /// Builds the full value type, for APIs that still take `EventObjectOccurrence`.
+        public func materialize() -> EventObjectOccurrence {
+            EventObjectOccurrence(
+                event: event,
+                occurrence: EventOccurrence(
+                    id: occurrenceID == 0 ? nil : occurrenceID,
+                    eventId: eventUID,
+                    startTime: startDate,
+                    endTime: endDate
+                ),
+                host: host
+            )
+        }
+    }
+
+    // MARK: - Buckets
+
+    /// Contiguous run of rows sharing an hour-of-day.
+    public struct HourRange: Equatable {
+        /// 0...23
+        public let hour: Int
+        public let range: Range<Int>
+    }
+
+    /// Day → hour ranges, the index-only counterpart of `observeEventsByDayThenHour`.
+    /// Rows must be in start-time order (as fetched). Slices reference the store, so
+    /// bucketing allocates only the range arrays.
+    public func dayHourRanges(calendar: Calendar = .current) -> [Date: [HourRange]] {
+        var result: [Date: [HourRange]] = [:]
+        var day: Date?
+        var dayEnd: TimeInterval = -.infinity
+        var hourStart: TimeInterval = .infinity
+        var hourEnd: TimeInterval = -.infinity
+        var hour = 0
+        var runStart = 0
+        var sections: [HourRange] = []
+
+        func flushHour(upTo end: Int) {
+            if end > runStart {
+                sections.append(HourRange(hour: hour, range: runStart..<end))
+            }
+            runStart = end
+        }
+        func flushDay(upTo end: Int) {
+            flushHour(upTo: end)
+            if let day, !sections.isEmpty {
+                result[day] = sections
+            }
+            sections = []
+        }
+
+        for index in startTimes.indices {
+            let start = startTimes[index]
+            if let currentDay = day, start >= currentDay.timeIntervalSince1970, start < dayEnd {
+                // Same day
+            } else {
+                flushDay(upTo: index)
+                let startOfDay = calendar.startOfDay(for: Date(timeIntervalSince1970: start))
+                day = startOfDay
+                dayEnd = (calendar.date(byAdding: .day, value: 1, to: startOfDay) ?? startOfDay).timeIntervalSince1970
+                hourStart = .infinity
+                hourEnd = -.infinity
+            }
+            if start >= hourStart, start < hourEnd {
+                // Same hour
+            } else {
+                flushHour(upTo: index)
+                let date = Date(timeIntervalSince1970: start)
+                hour = calendar.component(.hour, from: date)
+                let startOfHour = day.flatMap { calendar.date(byAdding: .hour, value: hour, to: $0) } ?? date
+                hourStart = startOfHour.timeIntervalSince1970
+                hourEnd = (calendar.date(byAdding: .hour, value: 1, to: startOfHour) ?? date).timeIntervalSince1970
+            }
+        }
+        flushDay(upTo: startTimes.count)
+        return result
+    }
+
+    /// Indices of occurrences overlapping `date`. Linear scan over two `Double` columns.
+    public func indicesHappening(at date: Date) -> [Int] {
+        let t = date.timeIntervalSince1970
+        return startTimes.indices.filter { startTimes[$0] <= t && t < endTimes[$0] }
+    }
+}
+
+// MARK: - Collection
+
+extension EventOccurrenceStore: RandomAccessCollection {
+    public var startIndex: Int { 0 }
+    public var endIndex: Int { occurrenceIDs.count }
+
+    public subscript(position: Int) -> Row {
+        Row(store: self, index: position)
+    }
+}
+
+// MARK: - String Interning
+
+struct StringInterner {
+    private(set) var strings: [String] = []
+    private var indices: [String: Int32] = [:]
+
+    /// Returns the table index for `string`, adding it on first sight.
+    mutating func intern(_ string: String) -> Int32 {
+        if let index = indices[string] {
+            return index
+        }
+        let index = Int32(strings.count)
+        strings.append(string)
+        indices[string] = index
+        return index
+    }
+}
@@ -0,0 +1,60 @@
+import Foundation
+import GRDB
+
+/// Position in a list's sort order: the sort key (name, or start time for events) and the
+/// unique tiebreaker of the last row seen. Opaque to callers; `ListWindow.next` carries it
+/// to say whether rows follow.
+public struct ListCursor: Hashable, Sendable {
+    let key: DatabaseValue
+    let tiebreaker: DatabaseValue
+
+    init(key: some DatabaseValueConvertible, tiebreaker: some DatabaseValueConvertible) {
+        self.key = key.databaseValue
+        self.tiebreaker = tiebreaker.databaseValue
+    }
+}
+
+/// How much of a filtered list to observe: the first `limit` rows. Lists grow `limit` as the
+/// user scrolls to extend the window in place, so each emission decodes only the rows
+/// loaded so far.
+public struct ListWindowRequest: Hashable, Sendable {
+    /// Start after this row instead of at the top. Internal: lists page by growing `limit`,
+    /// and a window that starts mid-list can't show rows inserted above it.
+    var after: ListCursor?
+    public var limit: Int
+
+    public init(limit: Int) {
+        self.init(after: nil, limit: limit)
+    }
+
+    init(after: ListCursor?, limit: Int) {
+        self.after = after
+        self.limit = max(1, limit)
+    }
+}
+
+/// One window of a filtered list, as `ListRow`s.
+public struct ListWindow<T> {
+    public let rows: [ListRow<T>]
+    /// Cursor for the window that follows this one; nil at the end of the list
+    public let next: ListCursor?
+
+    /// Whether rows follow this window
+    public var hasMore: Bool { next != nil }
+
+    public init(rows: [ListRow<T>], next: ListCursor?) {
+        self.rows = rows
+        self.next = next
+    }
+
+    /// Trims rows fetched with one extra (see `FilterQueryCompiler`) to `limit`, keeping the
+    /// extra row only as evidence that more follow
+    init(fetched: [ListRow<T>], limit: Int, cursor: (T) -> ListCursor) {
+        guard fetched.count > limit else {
+            self.init(rows: fetched, next: nil)
+            return
+        }
+        let rows = Array(fetched.prefix(limit))
+        self.init(rows: rows, next: rows.last.map { cursor($0.object) })
+    }
+}
@@ -0,0 +1,141 @@
+import Foundation
+import CoreLocation
+
+/// Minimal point feature for style-layer map rendering. Carries only what data-driven
+/// styling needs, so thousands of them stay cheap to build, cache and encode.
+public struct MapFeature: Hashable {
+    /// Object UID (occurrence UID for events, see `EventObjectOccurrence.uid`)
+    public let uid: String
+    public let objectType: DataObjectType
+    public let name: String
+    public let latitude: Double
+    public let longitude: Double
+    public let isFavorite: Bool
+    /// Event type code (e.g. "prty"); nil for non-events
+    public let eventTypeCode: String?
+    /// Occurrence start; nil for non-events
+    public let startDate: Date?
+    /// Occurrence end; nil for non-events
+    public let endDate: Date?
+
+    public init(
+        uid: String,
+        objectType: DataObjectType,
+        name: String,
+        latitude: Double,
+        longitude: Double,
+        isFavorite: Bool = false,
+        eventTypeCode: String? = nil,
+        startDate: Date? = nil,
+        endDate: Date? = nil
+    ) {
+        self.uid = uid
+        self.objectType = objectType
+        self.name = name
+        self.latitude = latitude
+        self.longitude = longitude
+        self.isFavorite = isFavorite
+        self.eventTypeCode = eventTypeCode
+        self.startDate = startDate
+        self.endDate = endDate
+    }
+
+    public var coordinate: CLLocationCoordinate2D {
+        CLLocationCoordinate2D(latitude: latitude, longitude: longitude)
+    }
+}
+
+/// A set of `MapFeature`s plus their GeoJSON `FeatureCollection` encoding, ready to hand
+/// to a map shape source.
+///
+/// Feature properties use short keys to keep the payload compact:
+/// - `id`: UID
+/// - `type`: `DataObjectType` raw value
+/// - `name`: display name
+/// - `fav`: 1 if favorited, else 0
+/// - `code`: event type code (events only)
+/// - `start` / `end`: occurrence bounds in epoch seconds (events only)
+public struct MapFeatureCollection {
+    public let features: [MapFeature]
+
+    /// UTF-8 GeoJSON `FeatureCollection`
+    public let geoJSON: Data
+
+    public init(features: [MapFeature]) {
+        self.init(features: features, encodedFeatures: [Self.encodeFeatures(features)])
+    }
+
+    /// Assemble from pre-encoded feature fragments (comma-separated feature objects, as
+    /// produced by `encodeFeatures`). Lets cached per-category encodings be reused as-is.
+    init(features: [MapFeature], encodedFeatures: [Data]) {
+        self.features = features
+        var data = Data(#"{"type":"FeatureCollection","features":["#.utf8)
+        var first = true
+        for fragment in encodedFeatures where !fragment.isEmpty {
+            if !first {
+                data.append(UInt8(ascii: ","))
+            }
+            data.append(fragment)
+            first = false
+        }
+        data.append(contentsOf: Array("]}".utf8))
+        self.geoJSON = data
+    }
+
+    /// Comma-separated GeoJSON `Feature` objects, without the enclosing array.
+    static func encodeFeatures(_ features: [MapFeature]) -> Data {
+        var json = ""
+        json.reserveCapacity(features.count * 160)
+        for (index, feature) in features.enumerated() {
+            if index > 0 {
+                json.append(",")
+            }
+            json.append(#"{"type":"Feature","geometry":{"type":"Point","coordinates":["#)
+            json.append(formatCoordinate(feature.longitude))
+            json.append(",")
+            json.append(formatCoordinate(feature.latitude))
+            json.append(#"]},"properties":{"id":"#)
+            appendEscaped(feature.uid, to: &json)
+            json.append(#","type":"#)
+            appendEscaped(feature.objectType.rawValue, to: &json)
+            json.append(#","name":"#)
+            appendEscaped(feature.name, to: &json)
+            json.append(feature.isFavorite ? #","fav":1"# : #","fav":0"#)
+            if let code = feature.eventTypeCode {
+                json.append(#","code":"#)
+                appendEscaped(code, to: &json)
+            }
+            if let startDate = feature.startDate {
+                json.append(#","start":\#(Int(startDate.timeIntervalSince1970))"#)
+            }
+            if let endDate = feature.endDate {
+                json.append(#","end":\#(Int(endDate.timeIntervalSince1970))"#)
+            }
+            json.append("}}")
+        }
+        return Data(json.utf8)
+    }
+
+    /// Six decimal places is ~10cm, plenty for map pins.
+    private static func formatCoordinate(_ value: Double) -> String {
+        String((value * 1_000_000).rounded() / 1_000_000)
+    }
+
+    private static func appendEscaped(_ string: String, to json: inout String) {
+        json.append("\"")
+        for scalar in string.unicodeScalars {
+            switch scalar {
+            case "\"": json.append("\\\"")
+            case "\\": json.append("\\\\")
+            case "\n": json.append("\\n")
+            case "\r": json.append("\\r")
+            case "\t": json.append("\\t")
+            case _ where scalar.value < 0x20:
+                json.append(String(format: "\\u%04x", scalar.value))
+            default:
+                json.unicodeScalars.append(scalar)
+            }
+        }
+        json.append("\"")
+    }
+}
@@ -0,0 +1,30 @@
+import Foundation
+
+/// Places and events around an area and time window, read in a single GRDB transaction.
+/// See `PlayaDB.fetchContextSnapshot(region:window:typeCodes:searchText:hostLimit:)`.
+public struct PlayaContextSnapshot {
+    /// Art in the region matching the search text, in `ArtFilter` order
+    public let art: [ArtObject]
+
+    /// Camps in the region matching the search text, in `CampFilter` order
+    public let camps: [CampObject]
+
+    /// Mutant vehicles matching the search text. Vehicles move, so the region is ignored.
+    public let mutantVehicles: [MutantVehicleObject]
+
+    /// Occurrences overlapping the window: events in the region, plus events hosted by or
+    /// located at the first `hostLimit` camps and art. Unique, sorted by start time.
+    public let occurrences: [EventObjectOccurrence]
+
+    public init(
+        art: [ArtObject],
+        camps: [CampObject],
+        mutantVehicles: [MutantVehicleObject],
+        occurrences: [EventObjectOccurrence]
+    ) {
+        self.art = art
+        self.camps = camps
+        self.mutantVehicles = mutantVehicles
+        self.occurrences = occurrences
+    }
+}
@@ -0,0 +1,15 @@
+import Foundation
+
+/// An object found by `PlayaDB.semanticSearch(_:types:limit:)`
+public struct SemanticSearchMatch {
+    /// `ArtObject`, `CampObject`, `EventObject` or `MutantVehicleObject`
+    public let object: any DataObject
+
+    /// Cosine similarity between the query and the object's embedding, at most 1
+    public let score: Float
+
+    public init(object: any DataObject, score: Float) {
+        self.object = object
+        self.score = score
+    }
+}
@@ -0,0 +1,39 @@
+import Foundation
+
+/// An object pre-formatted as on-device model tool output at each detail level, with the
+/// token cost of each. See `PlayaDB.toolRenderings(for:)`.
+public struct ToolRendering: Sendable {
+    /// How much of an object a tool result includes
+    public enum Detail: Int, CaseIterable, Comparable, Sendable {
+        /// Type, name and uid — for exploration steps scanning many items
+        case brief
+        /// Adds the start of the description
+        case normal
+        /// Full description, location, metadata and coordinates — for final selection
+        case full
+
+        public static func < (lhs: Detail, rhs: Detail) -> Bool {
+            lhs.rawValue < rhs.rawValue
+        }
+    }
+
+    /// Uid the model refers to the object by. Occurrences render their event's uid.
+    public let uid: String
+    private let texts: [String]
+    private let tokenCounts: [Int]
+
+    public init(uid: String, brief: String, normal: String, full: String) {
+        self.uid = uid
+        self.texts = [brief, normal, full]
+        self.tokenCounts = texts.map(TokenEstimator.estimate)
+    }
+
+    public func text(_ detail: Detail) -> String {
+        texts[detail.rawValue]
+    }
+
+    /// `TokenEstimator` count of `text(detail)`
+    public func tokens(_ detail: Detail) -> Int {
+        tokenCounts[detail.rawValue]
+    }
+}
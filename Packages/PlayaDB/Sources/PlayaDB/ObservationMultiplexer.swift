@@ -0,0 +1,159 @@
+import Foundation
+import GRDB
+
+/// Shares one database observation between subscribers asking for the same thing.
+///
+/// The first subscriber for a key starts the underlying observation; later subscribers join
+/// it and immediately receive its last value. The observation is cancelled when its last
+/// subscriber cancels, so each distinct query runs once per commit however many screens
+/// show it.
+final class ObservationMultiplexer: @unchecked Sendable {
+    /// Identifies a shared observation: the observing method plus its filter
+    struct Key: Hashable {
+        let kind: String
+        let filter: AnyHashable
+    }
+
+    private final class Entry {
+        var subscribers: [Int: Subscriber] = [:]
+        var lastValue: Any?
+        /// Incremented on every delivery
+        var version = 0
+        var token: PlayaDBObservationToken?
+    }
+
+    private struct Subscriber {
+        let onChange: (Any) -> Void
+        let onError: (Error) -> Void
+    }
+
+    private let lock = NSLock()
+    private var entries: [Key: Entry] = [:]
+    private var nextSubscriberID = 0
+
+    /// Number of underlying observations currently running
+    var activeCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries.count
+    }
+
+    /// Subscribes to the shared observation for `key`, starting it with `start` if needed.
+    /// Values are delivered on the main queue, like the observations they share.
+    func observe<Value>(
+        _ key: Key,
+        onChange: @escaping (Value) -> Void,
+        onError: @escaping (Error) -> Void,
+        start: (_ onChange: @escaping (Value) -> Void, _ onError: @escaping (Error) -> Void) -> PlayaDBObservationToken
+    ) -> PlayaDBObservationToken {
+        let subscriber = Subscriber(
+            onChange: { value in
+                guard let value = value as? Value else { return }
+                onChange(value)
+            },
+            onError: onError
+        )
+
+        lock.lock()
+        let id = nextSubscriberID
+        nextSubscriberID += 1
+        let entry: Entry
+        let isNew: Bool
+        if let existing = entries[key] {
+            entry = existing
+            isNew = false
+        } else {
+            entry = Entry()
+            entries[key] = entry
+            isNew = true
+        }
+        entry.subscribers[id] = subscriber
+        let hasReplay = entry.lastValue != nil
+        let version = entry.version
+        lock.unlock()
+
+        if isNew {
+            // Started outside the lock: the observation may deliver or fail synchronously
+            let token = start(
+                { [weak self, weak entry] value in
+                    guard let self, let entry else { return }
+                    self.deliver(value, to: entry)
+                },
+                { [weak self, weak entry] error in
+                    guard let self, let entry else { return }
+                    self.fail(error, entry: entry, key: key)
+                }
+            )
+            lock.lock()
+            let stillWanted = entries[key] === entry && !entry.subscribers.isEmpty
+            if stillWanted {
+                entry.token = token
+            }
+            lock.unlock()
+            if !stillWanted {
+                token.cancel()
+            }
+        } else if hasReplay {
+            DispatchQueue.main.async { [weak self, weak entry] in
+                guard let self, let entry,
+                      let replay = self.replayValue(for: id, entry: entry, subscribedAt: version) else { return }
+                subscriber.onChange(replay)
+            }
+        }
+
+        return PlayaDBObservationToken(AnyDatabaseCancellable { [weak self] in
+            self?.unsubscribe(id, key: key, entry: entry)
+        })
+    }
+
+    // MARK: - Private
+
+    private func deliver(_ value: Any, to entry: Entry) {
+        lock.lock()
+        entry.lastValue = value
+        entry.version += 1
+        let subscribers = Array(entry.subscribers.values)
+        lock.unlock()
+        for subscriber in subscribers {
+            subscriber.onChange(value)
+        }
+    }
+
+    /// The underlying observation stops after an error: forget it so the next subscriber
+    /// starts a fresh one.
+    private func fail(_ error: Error, entry: Entry, key: Key) {
+        lock.lock()
+        if entries[key] === entry {
+            entries[key] = nil
+        }
+        let subscribers = Array(entry.subscribers.values)
+        lock.unlock()
+        for subscriber in subscribers {
+            subscriber.onError(error)
+        }
+    }
+
+    /// The value to replay to a joining subscriber: nil if it unsubscribed, or if a delivery
+    /// since it joined already gave it a newer value than the one it would replay
+    private func replayValue(for id: Int, entry: Entry, subscribedAt version: Int) -> Any? {
+        lock.lock()
+        defer { lock.unlock() }
+        guard entry.subscribers[id] != nil, entry.version == version else { return nil }
+        return entry.lastValue
+    }
+
+    private func unsubscribe(_ id: Int, key: Key, entry: Entry) {
+        lock.lock()
+        entry.subscribers[id] = nil
+        var token: PlayaDBObservationToken?
+        if entry.subscribers.isEmpty {
+            token = entry.token
+            entry.token = nil
+            if entries[key] === entry {
+                entries[key] = nil
+            }
+        }
+        lock.unlock()
+        token?.cancel()
+    }
+}
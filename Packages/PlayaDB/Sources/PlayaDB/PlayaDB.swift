@@ -1,6 +1,18 @@
 import Foundation
 import CoreLocation
 import MapKit
+import PlayaAPI
+
+/// How a full import replaces the current content
+public enum PlayaDBImportMode: Sendable {
+    /// Delete and reinsert in one write transaction on the live database. Readers and
+    /// observations wait until the import finishes.
+    case inPlace
+    /// Build a new database file in the background, copy favorites, thumbnail colors and map
+    /// pins into it, then swap it in. Readers keep the old content until the swap, and a
+    /// crash mid-import leaves the live database untouched. In-memory databases import in place.
+    case shadow
+}
 
 /// Public interface for the PlayaDB database system
 public protocol PlayaDB {
@@ -60,6 +72,17 @@ public protocol PlayaDB {
     /// Search for objects using full-text search
     func searchObjects(_ query: String) async throws -> [any DataObject]
 
+    /// `objects` formatted for on-device model tool output at each detail level, with token
+    /// estimates, in the same order. Renderings are cached per object and rebuilt only when
+    /// the fields they show change, so repeated tool calls don't re-format.
+    func toolRenderings(for objects: [any DataObject]) -> [ToolRendering]
+
+    /// Objects closest in meaning to `query`, best first, by cosine similarity of on-device
+    /// sentence embeddings against the vectors shipped in the data pack. Finds matches that
+    /// share no words with the query (e.g. "somewhere to nap" → a chill dome). Empty when the
+    /// data has no embeddings or the embedding model isn't available on this device.
+    func semanticSearch(_ query: String, types: Set<DataObjectType>?, limit: Int) async throws -> [SemanticSearchMatch]
+
     // MARK: - Filtered Data Access
 
     /// Fetch art objects matching the specified filter criteria
@@ -100,6 +123,8 @@ public protocol PlayaDB {
     
     /// Observe art objects matching the specified filter criteria.
     /// Returns fully-inflated `ListRow`s with metadata and thumbnail colors.
+    /// Observers with equal filters share one underlying query (as do those of the other
+    /// filtered list observations); a late observer receives the latest rows right away.
     @discardableResult
     func observeArt(
         filter: ArtFilter,
@@ -146,6 +171,84 @@ public protocol PlayaDB {
         onError: @escaping (Error) -> Void
     ) -> PlayaDBObservationToken
 
+    /// Fetch event occurrences as a columnar `EventOccurrenceStore`: events and hosts are
+    /// shared by index rather than copied into every row. Same filter semantics as
+    /// `fetchEvents(filter:)`, ordered by start time.
+    func fetchEventOccurrenceStore(filter: EventFilter) async throws -> EventOccurrenceStore
+
+    /// Observe event occurrences as a columnar `EventOccurrenceStore`. Re-fires on event,
+    /// occurrence, metadata and thumbnail color changes. Use `EventOccurrenceStore.dayHourRanges()` for
+    /// day/hour bucketing without copying rows.
+    @discardableResult
+    func observeEventOccurrenceStore(
+        filter: EventFilter,
+        onChange: @escaping (EventOccurrenceStore) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken
+
+    // MARK: - List Windows
+
+    /// Observe one window of the art list for `filter`, in the same order as
+    /// `observeArt(filter:onChange:onError:)`. Only the window's rows are fetched and decoded,
+    /// so per-emission cost follows `window.limit` rather than the size of the result set.
+    /// Observers with equal filters and windows share one underlying query.
+    @discardableResult
+    func observeArt(
+        filter: ArtFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<ArtObject>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken
+
+    /// Observe one window of the camp list for `filter`, ordered by name
+    @discardableResult
+    func observeCamps(
+        filter: CampFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<CampObject>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken
+
+    /// Observe one window of the mutant vehicle list for `filter`, ordered by name
+    @discardableResult
+    func observeMutantVehicles(
+        filter: MutantVehicleFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<MutantVehicleObject>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken
+
+    /// Observe one window of the event occurrence list for `filter`, ordered by start time
+    @discardableResult
+    func observeEvents(
+        filter: EventFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<EventObjectOccurrence>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken
+
+    /// Number of art objects matching `filter`, counted without decoding them
+    func countArt(filter: ArtFilter) async throws -> Int
+
+    /// Number of camps matching `filter`
+    func countCamps(filter: CampFilter) async throws -> Int
+
+    /// Number of mutant vehicles matching `filter`
+    func countMutantVehicles(filter: MutantVehicleFilter) async throws -> Int
+
+    /// Number of event occurrences matching `filter`
+    func countEvents(filter: EventFilter) async throws -> Int
+
+    // MARK: - Map Features
+
+    /// Fetch point features for style-layer map rendering (one shape source + symbol layer
+    /// instead of per-object annotation views). Objects without a location are skipped.
+    ///
+    /// Results are cached per category and filter, and invalidated when a table feeding that
+    /// category changes (including favorite toggles). Time-relative event filters
+    /// (`happeningNow`, `startingWithinHours`, `includeExpired == false`) expire after a minute.
+    func fetchMapFeatures(filter: MapFeatureFilter) async throws -> MapFeatureCollection
+
     // MARK: - Single Object Fetch
 
     /// Fetch a single art object by UID
@@ -166,10 +269,34 @@ public protocol PlayaDB {
     /// Fetch event occurrences located at a specific art installation
     func fetchEvents(locatedAtArtUID: String) async throws -> [EventObjectOccurrence]
 
+    /// Fetch the object with `uid` (art, camp, event, event occurrence or mutant vehicle)
+    /// together with its metadata, thumbnail colors, host, host events and sibling
+    /// occurrences, all from one read transaction. Nothing is written during the read;
+    /// when `date` is non-nil the view is handed to `recordView(_:for:)`.
+    func fetchDetailBundle(uid: String, recordingViewAt date: Date?) async throws -> DetailBundle?
+
+    /// Fetch everything around `region` during `window` from one read transaction: art and
+    /// camps in the region matching `searchText`, mutant vehicles matching `searchText`, and
+    /// every occurrence overlapping `window` that is either in the region (narrowed to
+    /// `typeCodes`, or all types when none of those match) or hosted by / located at the
+    /// `hostLimit` camps and art nearest the region's center (the first ones by name without
+    /// a region). An empty window yields no occurrences.
+    func fetchContextSnapshot(
+        region: MKCoordinateRegion?,
+        window: DateInterval,
+        typeCodes: Set<String>?,
+        searchText: String?,
+        hostLimit: Int
+    ) async throws -> PlayaContextSnapshot
+
     // MARK: - Metadata Operations
 
     /// Fetch metadata for the specified object, creating a default record if needed.
     func metadata(for object: any DataObject) async throws -> ObjectMetadata
+
+    /// Fetch the stored metadata for the specified object without writing; nil if the
+    /// object has none yet (not favorited, no notes, never viewed).
+    func existingMetadata(for object: any DataObject) async throws -> ObjectMetadata?
     
     /// Get all favorited objects
     func getFavorites() async throws -> [any DataObject]
@@ -189,6 +316,13 @@ public protocol PlayaDB {
     /// Mark an object as viewed at the provided date (used for recents, etc.).
     func setLastViewed(_ date: Date, for object: any DataObject) async throws
 
+    /// Deferred `setLastViewed`: views are queued and written together shortly after,
+    /// keeping the latest date per object.
+    func recordView(_ date: Date, for object: any DataObject)
+
+    /// Write any views queued by `recordView(_:for:)` now (e.g. before backgrounding).
+    func flushPendingViews() async throws
+
     /// Fetch recently viewed objects, ordered by most recent first
     func fetchRecentlyViewed(limit: Int) async throws -> [any DataObject]
 
@@ -221,6 +355,17 @@ public protocol PlayaDB {
     /// Fetch all object IDs that have cached thumbnail colors.
     func fetchCachedColorObjectIDs() async throws -> Set<String>
 
+    // MARK: - Event Summary Cache
+
+    /// Cached AI overview of the events hosted by or located at `hostUID`. Nil when none was
+    /// saved for the host's current content and events, it has outlived the cache's maximum
+    /// age, or it was saved under a different `version`. A hit counts as a use for eviction.
+    func cachedEventSummary(hostUID: String, version: Int) async throws -> String?
+
+    /// Save an AI overview of the host's current events, evicting the least recently used
+    /// overviews beyond the cache limit.
+    func saveEventSummary(_ summary: String, hostUID: String, version: Int) async throws
+
     // MARK: - User Map Pins
 
     /// Save (insert or update) a user map pin.
@@ -241,8 +386,11 @@ public protocol PlayaDB {
     /// Import data from the PlayaAPI
     func importFromPlayaAPI() async throws
     
-    /// Import data from provided JSON data (for testing)
-    func importFromData(artData: Data, campData: Data, eventData: Data, mvData: Data?) async throws
+    /// Import data from provided JSON data
+    func importFromData(artData: Data, campData: Data, eventData: Data, mvData: Data?, mode: PlayaDBImportMode) async throws
+
+    /// Import from a binary data pack, decoding one record at a time
+    func importFromDataPack(_ pack: PlayaDataPack, mode: PlayaDBImportMode) async throws
     
     /// Get update information for all data types
     func getUpdateInfo() async throws -> [UpdateInfo]
@@ -250,7 +398,41 @@ public protocol PlayaDB {
     /// Observe update info changes reactively
     @discardableResult
     func observeUpdateInfo(onChange: @escaping ([UpdateInfo]) -> Void, onError: @escaping (Error) -> Void) -> PlayaDBObservationToken
+
+    // MARK: - Delta Updates
+
+    /// Content hashes of the currently imported objects, to send to the delta feed
+    func fetchDeltaManifest() async throws -> DeltaManifest
+
+    /// Apply changed and deleted objects in one transaction. Favorites and other
+    /// user metadata are kept for objects that still exist.
+    func applyDeltaPatch(_ patch: DeltaPatch) async throws
     
+    // MARK: - Year Archives
+
+    /// Years with a read-only archive. Filtered queries with one of these years
+    /// (`ArtFilter.year`, `CampFilter.year`, `EventFilter.year`, `MutantVehicleFilter.year`)
+    /// read from the archive once the year has left the current database.
+    func archivedYears() -> [Int]
+
+    /// Snapshot `year` into a read-only archive, optionally LZFSE-compressed. Full imports
+    /// do this automatically for any year they are about to replace.
+    func archiveYear(_ year: Int, compressed: Bool) async throws
+
+    // MARK: - Instrumentation
+
+    /// Whether query, observation and write timing is being recorded. Off by default.
+    var isInstrumentationEnabled: Bool { get }
+
+    /// Turns recording on or off. Turning it on starts a fresh set of stats. Each recorded
+    /// operation is also an `os_signpost` interval in the `com.iburnapp.PlayaDB` subsystem.
+    func setInstrumentationEnabled(_ enabled: Bool)
+
+    /// Latency, row counts, re-fire counts and queue wait recorded so far
+    func instrumentationStats() -> PlayaDBStats
+
+    func resetInstrumentationStats()
+
     // MARK: - Reactive Data Access
     
     /// All art objects (reactive)
@@ -304,10 +486,35 @@ public extension PlayaDB {
         observeMutantVehicles(filter: filter, onChange: onChange, onError: { _ in })
     }
 
+    /// Fetch the detail bundle for `uid`, recording a view of it now.
+    func fetchDetailBundle(uid: String) async throws -> DetailBundle? {
+        try await fetchDetailBundle(uid: uid, recordingViewAt: Date())
+    }
+
+    /// Bring the database up to date through the delta feed. Returns the applied patch,
+    /// or nil if nothing changed.
+    @discardableResult
+    func syncDelta(with client: DeltaFeedClient) async throws -> DeltaPatch? {
+        let local = try await fetchDeltaManifest()
+        guard let patch = try await client.fetchPatch(from: local) else { return nil }
+        try await applyDeltaPatch(patch)
+        return patch
+    }
+
     /// Convenience overload for importFromData without MV data
     func importFromData(artData: Data, campData: Data, eventData: Data) async throws {
         try await importFromData(artData: artData, campData: campData, eventData: eventData, mvData: nil)
     }
+
+    /// Convenience overload for an in-place importFromData
+    func importFromData(artData: Data, campData: Data, eventData: Data, mvData: Data?) async throws {
+        try await importFromData(artData: artData, campData: campData, eventData: eventData, mvData: mvData, mode: .inPlace)
+    }
+
+    /// Convenience overload for an in-place importFromDataPack
+    func importFromDataPack(_ pack: PlayaDataPack) async throws {
+        try await importFromDataPack(pack, mode: .inPlace)
+    }
 }
 
 // MARK: - Factory
@@ -1,5 +1,6 @@
 import Foundation
 import CoreLocation
+import CryptoKit
 import MapKit
 import GRDB
 import PlayaAPI
@@ -8,12 +9,38 @@ import PlayaAPI
 internal class PlayaDBImpl: PlayaDB {
     // MARK: - Database Connection
 
-    internal let dbQueue: DatabaseQueue  // Internal for testing
+    /// Current connection; replaced when a shadow import swaps in a new file
+    internal var dbQueue: DatabaseQueue { database.current }  // Internal for testing
+    private let database: SwappableDatabase
     private let dbPath: String
+    internal let mapFeatureCache = MapFeatureCache()  // Internal for testing
+    /// Embedding matrix for `semanticSearch`, loaded on first use
+    internal let semanticIndex = SemanticIndex()  // Internal for testing
+    /// Formatted model tool output per object
+    internal let toolRenderingCache = ToolRenderingCache()  // Internal for testing
+    internal let lastViewedRecorder = LastViewedRecorder()  // Internal for testing
+    /// De-duplicates filtered list observations with equal filters
+    internal let sharedObservations = ObservationMultiplexer()  // Internal for testing
+    /// Opt-in timing of queries, observation re-fires and writes
+    internal let instrumentation = QueryInstrumentation()  // Internal for testing
+    /// Past years, nil for in-memory databases
+    internal let archives: YearArchiveStore?
+    /// Years in the live content tables, so `reader(forYear:)` doesn't query on the
+    /// caller's thread. Kept current by `setupLiveYearsTracking()` and shadow swaps.
+    private let liveYears = LiveYears()
+
+    /// How long `recordView(_:for:)` waits before writing, so rapid paging coalesces
+    static let lastViewedFlushDelay: TimeInterval = 2
+    /// Most cached event summaries kept; the least recently used beyond this are evicted
+    internal var eventSummaryCacheLimit = 500  // Internal for testing
+    /// Age after which a cached event summary is regenerated even if nothing changed
+    internal var eventSummaryMaxAge: TimeInterval = 7 * 24 * 60 * 60  // Internal for testing
     
     // MARK: - Initialization
     
-    init(dbPath: String? = nil) throws {
+    /// - Parameter archiveDirectory: Where per-year archives live. Defaults to a
+    ///   `PlayaDBArchives` folder next to the database; in-memory databases have none.
+    init(dbPath: String? = nil, archiveDirectory: String? = nil) throws {
         // Use custom path or default to Documents directory
         if let customPath = dbPath {
             self.dbPath = customPath
@@ -21,21 +48,34 @@ internal class PlayaDBImpl: PlayaDB {
             let documentsPath = NSSearchPathForDirectoriesInDomains(.documentDirectory, .userDomainMask, true)[0]
             self.dbPath = "\(documentsPath)/PlayaDB.sqlite"
         }
+
+        // Archives ATTACH the live file, so they need one
+        if self.dbPath != ":memory:" {
+            let directory = archiveDirectory.map { URL(fileURLWithPath: $0, isDirectory: true) }
+                ?? URL(fileURLWithPath: self.dbPath).deletingLastPathComponent().appendingPathComponent("PlayaDBArchives", isDirectory: true)
+            self.archives = YearArchiveStore(directory: directory, liveDatabasePath: self.dbPath)
+        } else {
+            self.archives = nil
+        }
         
         // Create database queue
-        self.dbQueue = try DatabaseQueue(path: self.dbPath)
+        self.database = SwappableDatabase(try DatabaseQueue(path: self.dbPath))
         
         // Initialize database schema
-        try setupDatabase()
+        try setupDatabase(in: dbQueue)
+        liveYears.set(try dbQueue.read { db in try Self.fetchLiveYears(db) })
         
         // Setup reactive observations
         setupObservations()
+        setupMapFeatureInvalidation()
+        setupSemanticIndexInvalidation()
+        setupLiveYearsTracking()
     }
     
     // MARK: - Database Setup
     
-    private func setupDatabase() throws {
-        try dbQueue.write { db in
+    private func setupDatabase(in queue: DatabaseQueue) throws {
+        try queue.write { db in
             // Create art_objects table
             try db.execute(sql: """
                 CREATE TABLE IF NOT EXISTS art_objects (
@@ -203,6 +243,43 @@ internal class PlayaDBImpl: PlayaDB {
                 )
             """)
             
+            // Per-object content hashes of the imported API data, used to request delta updates
+            try db.execute(sql: """
+                CREATE TABLE IF NOT EXISTS object_content_hashes (
+                    object_type TEXT NOT NULL,
+                    object_id TEXT NOT NULL,
+                    hash TEXT NOT NULL,
+                    PRIMARY KEY (object_type, object_id)
+                )
+            """)
+
+            // Sentence embeddings from the data pack, for semantic search. `vector` holds
+            // the quantized components as signed bytes (see `PlayaEmbedding`).
+            try db.execute(sql: """
+                CREATE TABLE IF NOT EXISTS object_embeddings (
+                    object_type TEXT NOT NULL,
+                    object_id TEXT NOT NULL,
+                    revision INTEGER NOT NULL,
+                    vector BLOB NOT NULL,
+                    PRIMARY KEY (object_type, object_id)
+                )
+            """)
+
+            // Cached AI event overviews per host. `content_hash` covers the host and its
+            // events, so data updates invalidate them; `last_used` is an increasing counter
+            // ordering entries for LRU eviction.
+            try db.execute(sql: """
+                CREATE TABLE IF NOT EXISTS event_summaries (
+                    host_uid TEXT PRIMARY KEY,
+                    content_hash TEXT NOT NULL,
+                    version INTEGER NOT NULL,
+                    summary TEXT NOT NULL,
+                    created_at DATETIME NOT NULL,
+                    last_used INTEGER NOT NULL
+                )
+            """)
+            try db.execute(sql: "CREATE INDEX IF NOT EXISTS event_summaries_last_used ON event_summaries(last_used)")
+
             // Create thumbnail_colors table for cached extracted colors
             try db.execute(sql: """
                 CREATE TABLE IF NOT EXISTS thumbnail_colors (
@@ -532,7 +609,7 @@ internal class PlayaDBImpl: PlayaDB {
         // GPS; this is a pure spatial prefilter for region-scoped event queries.
         //
         // Migration: an earlier version added minT/maxT time columns. They were never queried
-        // (occurrenceIDsInRegion is spatial-only) and, for occurrences whose stored date
+        // (region queries are spatial-only) and, for occurrences whose stored date
         // strings don't parse via SQLite strftime (or whose end precedes start), produced
         // minT > maxT and tripped the rtree's (minT<=maxT) constraint — failing the seed
         // import outright. Drop that variant and recreate the index spatial-only.
@@ -597,24 +674,10 @@ internal class PlayaDBImpl: PlayaDB {
         }
     }
 
-    /// Occurrence ids whose host location falls within `region`, via the spatial R*Tree.
-    /// Time filtering stays in SQL. Used to push event region filtering into the query
-    /// instead of filtering rows client-side.
-    private func occurrenceIDsInRegion(_ db: Database, region: MKCoordinateRegion) throws -> [Int64] {
-        let minLat = region.center.latitude - region.span.latitudeDelta / 2
-        let maxLat = region.center.latitude + region.span.latitudeDelta / 2
-        let minLon = region.center.longitude - region.span.longitudeDelta / 2
-        let maxLon = region.center.longitude + region.span.longitudeDelta / 2
-        return try Int64.fetchAll(db, sql: """
-            SELECT id FROM event_occurrence_rtree
-            WHERE maxLat >= ? AND minLat <= ? AND maxLon >= ? AND minLon <= ?
-            """, arguments: [minLat, maxLat, minLon, maxLon])
-    }
-
     // MARK: - Data Access Methods
     
     func fetchArt() async throws -> [ArtObject] {
-        let art = try await dbQueue.read { db in
+        let art = try await timedRead("fetchArt()") { db in
             try ArtObject.fetchAll(db)
         }
         try await ensureMetadata(for: .art, ids: art.map(\.uid))
@@ -622,7 +685,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchCamps() async throws -> [CampObject] {
-        let camps = try await dbQueue.read { db in
+        let camps = try await timedRead("fetchCamps()") { db in
             try CampObject.fetchAll(db)
         }
         try await ensureMetadata(for: .camp, ids: camps.map(\.uid))
@@ -630,7 +693,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchEvents() async throws -> [EventObjectOccurrence] {
-        let events = try await dbQueue.read { db in
+        let events = try await timedRead("fetchEvents()") { db in
             let events = try EventObject.fetchAll(db)
             return try eventObjectOccurrences(for: events, db: db)
         }
@@ -639,7 +702,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchEvents(on date: Date) async throws -> [EventObjectOccurrence] {
-        return try await dbQueue.read { db in
+        return try await timedRead("fetchEvents(on:)") { db in
             let calendar = Calendar.current
             let dayStart = calendar.startOfDay(for: date)
             let dayEnd = calendar.date(byAdding: .day, value: 1, to: dayStart)!
@@ -655,7 +718,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchEvents(from startDate: Date, to endDate: Date) async throws -> [EventObjectOccurrence] {
-        return try await dbQueue.read { db in
+        return try await timedRead("fetchEvents(from:to:)") { db in
             let occurrences = try EventOccurrence
                 .filter(Column("start_time") < endDate && Column("end_time") > startDate)
                 .fetchAll(db)
@@ -665,7 +728,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchCurrentEvents(_ now: Date = Date()) async throws -> [EventObjectOccurrence] {
-        return try await dbQueue.read { db in
+        return try await timedRead("fetchCurrentEvents(_:)") { db in
             let occurrences = try EventOccurrence
                 .filter(Column("start_time") <= now && Column("end_time") > now)
                 .fetchAll(db)
@@ -675,7 +738,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchUpcomingEvents(within hours: Int = 24, from now: Date = Date()) async throws -> [EventObjectOccurrence] {
-        return try await dbQueue.read { db in
+        return try await timedRead("fetchUpcomingEvents(within:from:)") { db in
             let futureTime = now.addingTimeInterval(TimeInterval(hours * 3600))
 
             let occurrences = try EventOccurrence
@@ -688,7 +751,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func fetchObjects(in region: MKCoordinateRegion) async throws -> [any DataObject] {
-        let result = try await dbQueue.read { db -> ([ArtObject], [CampObject], [EventObject]) in
+        let result = try await timedRead("fetchObjects(in:)") { db -> ([ArtObject], [CampObject], [EventObject]) in
             // Calculate bounding box
             let minLat = region.center.latitude - region.span.latitudeDelta / 2
             let maxLat = region.center.latitude + region.span.latitudeDelta / 2
@@ -754,7 +817,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func searchObjects(_ query: String) async throws -> [any DataObject] {
-        let result = try await dbQueue.read { db -> ([ArtObject], [CampObject], [EventObject], [MutantVehicleObject]) in
+        let result = try await timedRead("searchObjects(_:)") { db -> ([ArtObject], [CampObject], [EventObject], [MutantVehicleObject]) in
             // Prepare search query for FTS5
             // Wrap in double quotes to treat as a phrase, escaping internal quotes
             let sanitized = query
@@ -819,10 +882,80 @@ internal class PlayaDBImpl: PlayaDB {
         return objects
     }
 
+    // MARK: - Tool Renderings
+
+    func toolRenderings(for objects: [any DataObject]) -> [ToolRendering] {
+        toolRenderingCache.renderings(for: objects)
+    }
+
+    // MARK: - Semantic Search
+
+    func semanticSearch(_ query: String, types: Set<DataObjectType>?, limit: Int) async throws -> [SemanticSearchMatch] {
+        let text = query.trimmingCharacters(in: .whitespacesAndNewlines)
+        guard !text.isEmpty, limit > 0 else { return [] }
+        #if canImport(NaturalLanguage)
+        let index = try await loadSemanticIndex()
+        guard !index.isEmpty,
+              let embedder = semanticIndex.embedder(revision: index.revision),
+              let vector = embedder.vector(for: text) else {
+            return []
+        }
+        return try await semanticSearch(vector: vector, types: types, limit: limit)
+        #else
+        return []
+        #endif
+    }
+
+    /// `semanticSearch` for an already embedded, unit-length query. Internal for testing.
+    func semanticSearch(vector: [Float], types: Set<DataObjectType>?, limit: Int) async throws -> [SemanticSearchMatch] {
+        let index = try await loadSemanticIndex()
+        let hits = index.nearest(to: vector, limit: limit, types: types)
+        guard !hits.isEmpty else { return [] }
+
+        let objects = try await timedRead("semanticSearch(_:types:limit:)") { db -> [String: any DataObject] in
+            var uidsByType: [DataObjectType: [String]] = [:]
+            for hit in hits {
+                uidsByType[index.types[hit.index], default: []].append(index.uids[hit.index])
+            }
+            var objects: [String: any DataObject] = [:]
+            for (type, uids) in uidsByType {
+                let fetched: [any DataObject]
+                switch type {
+                case .art: fetched = try ArtObject.fetchAll(db, keys: uids)
+                case .camp: fetched = try CampObject.fetchAll(db, keys: uids)
+                case .event: fetched = try EventObject.fetchAll(db, keys: uids)
+                case .mutantVehicle: fetched = try MutantVehicleObject.fetchAll(db, keys: uids)
+                }
+                fetched.forEach { objects["\(type.rawValue):\($0.uid)"] = $0 }
+            }
+            return objects
+        }
+
+        // Embeddings can outlive their objects after a delta update
+        let matches = hits.compactMap { hit -> SemanticSearchMatch? in
+            objects["\(index.types[hit.index].rawValue):\(index.uids[hit.index])"]
+                .map { SemanticSearchMatch(object: $0, score: hit.score) }
+        }
+        try await ensureMetadata(for: DataObjectType.allCases.map { type in
+            (type, matches.filter { $0.object.objectType == type }.map(\.object.uid))
+        })
+        return matches
+    }
+
+    private func loadSemanticIndex() async throws -> SemanticIndex.Snapshot {
+        if let cached = semanticIndex.cached() { return cached }
+        let generation = semanticIndex.currentGeneration()
+        let snapshot = try await timedRead("loadSemanticIndex()") { db in
+            try SemanticIndex.load(db)
+        }
+        semanticIndex.store(snapshot, generation: generation)
+        return snapshot
+    }
+
     // MARK: - Single Object Fetch
 
     func fetchArt(uid: String) async throws -> ArtObject? {
-        let art = try await dbQueue.read { db in
+        let art = try await timedRead("fetchArt(uid:)") { db in
             try ArtObject.filter(Column("uid") == uid).fetchOne(db)
         }
         if let art {
@@ -832,7 +965,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchCamp(uid: String) async throws -> CampObject? {
-        let camp = try await dbQueue.read { db in
+        let camp = try await timedRead("fetchCamp(uid:)") { db in
             try CampObject.filter(Column("uid") == uid).fetchOne(db)
         }
         if let camp {
@@ -842,7 +975,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchEvent(uid: String) async throws -> EventObject? {
-        let event = try await dbQueue.read { db in
+        let event = try await timedRead("fetchEvent(uid:)") { db in
             try EventObject.filter(Column("uid") == uid).fetchOne(db)
         }
         if let event {
@@ -852,7 +985,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchOccurrences(forEventUID uid: String) async throws -> [EventObjectOccurrence] {
-        let events = try await dbQueue.read { db -> [EventObjectOccurrence] in
+        let events = try await timedRead("fetchOccurrences(forEventUID:)") { db -> [EventObjectOccurrence] in
             guard let event = try EventObject.filter(Column("uid") == uid).fetchOne(db) else {
                 return []
             }
@@ -862,7 +995,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchEvents(hostedByCampUID campUID: String) async throws -> [EventObjectOccurrence] {
-        let events = try await dbQueue.read { db -> [EventObjectOccurrence] in
+        let events = try await timedRead("fetchEvents(hostedByCampUID:)") { db -> [EventObjectOccurrence] in
             let eventObjects = try EventObject
                 .filter(Column("hosted_by_camp") == campUID)
                 .fetchAll(db)
@@ -874,7 +1007,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchEvents(locatedAtArtUID artUID: String) async throws -> [EventObjectOccurrence] {
-        let events = try await dbQueue.read { db -> [EventObjectOccurrence] in
+        let events = try await timedRead("fetchEvents(locatedAtArtUID:)") { db -> [EventObjectOccurrence] in
             let eventObjects = try EventObject
                 .filter(Column("located_at_art") == artUID)
                 .fetchAll(db)
@@ -885,10 +1018,197 @@ internal class PlayaDBImpl: PlayaDB {
         return sorted
     }
 
+    // MARK: - Detail Bundle
+
+    func fetchDetailBundle(uid: String, recordingViewAt date: Date?) async throws -> DetailBundle? {
+        let bundle = try await timedRead("fetchDetailBundle(uid:recordingViewAt:)") { db in
+            try self.detailBundle(uid: uid, db: db)
+        }
+        if let bundle, let date {
+            recordView(date, for: bundle.object)
+        }
+        return bundle
+    }
+
+    /// Object lookup for `fetchDetailBundle`. Tries each object table, then falls back to
+    /// the synthesized `EventObjectOccurrence` UID (`<eventUID>_<occurrenceID>`).
+    private func detailObject(uid: String, db: Database) throws -> (any DataObject)? {
+        if let art = try ArtObject.filter(Column("uid") == uid).fetchOne(db) {
+            return art
+        }
+        if let camp = try CampObject.filter(Column("uid") == uid).fetchOne(db) {
+            return camp
+        }
+        if let event = try EventObject.filter(Column("uid") == uid).fetchOne(db) {
+            return event
+        }
+        if let mv = try MutantVehicleObject.filter(Column("uid") == uid).fetchOne(db) {
+            return mv
+        }
+        guard let separator = uid.lastIndex(of: "_"),
+              let occurrenceID = Int64(uid[uid.index(after: separator)...]),
+              let occurrence = try EventOccurrence
+                .filter(EventOccurrence.Columns.id == occurrenceID)
+                .filter(EventOccurrence.Columns.eventId == String(uid[..<separator]))
+                .fetchOne(db) else {
+            return nil
+        }
+        return try eventObjectOccurrences(for: [occurrence], db: db).first
+    }
+
+    private func detailBundle(uid: String, db: Database) throws -> DetailBundle? {
+        guard let object = try detailObject(uid: uid, db: db) else { return nil }
+
+        let metadata = try ObjectMetadata
+            .filter(ObjectMetadata.Columns.objectType == object.objectType.rawValue)
+            .filter(ObjectMetadata.Columns.objectId == object.uid)
+            .fetchOne(db)
+
+        var event: EventObject?
+        var host: (any PlaceDataObject)?
+        var hostEvents: [EventObjectOccurrence] = []
+        switch object {
+        case let occurrence as EventObjectOccurrence:
+            event = occurrence.event
+            host = occurrence.host
+        case let eventObject as EventObject:
+            event = eventObject
+            host = try batchResolveHosts(for: [eventObject], db: db)[eventObject.uid]
+        case let art as ArtObject:
+            hostEvents = try detailEvents(column: "located_at_art", uid: art.uid, db: db)
+        case let camp as CampObject:
+            hostEvents = try detailEvents(column: "hosted_by_camp", uid: camp.uid, db: db)
+        default:
+            break
+        }
+
+        var occurrences: [EventObjectOccurrence] = []
+        var colorsObjectID = object.uid
+        if let event {
+            occurrences = try eventObjectOccurrences(for: [event], db: db)
+                .sorted { $0.startDate < $1.startDate }
+            if let camp = host as? CampObject {
+                hostEvents = try detailEvents(column: "hosted_by_camp", uid: camp.uid, db: db)
+            } else if let art = host as? ArtObject {
+                hostEvents = try detailEvents(column: "located_at_art", uid: art.uid, db: db)
+            }
+            colorsObjectID = event.hostedByCamp ?? event.locatedAtArt ?? event.uid
+        }
+
+        let thumbnailColors = try ThumbnailColors
+            .filter(ThumbnailColors.Columns.objectId == colorsObjectID)
+            .fetchOne(db)
+
+        return DetailBundle(
+            object: object,
+            metadata: metadata,
+            thumbnailColors: thumbnailColors,
+            host: host,
+            hostEvents: hostEvents,
+            occurrences: occurrences
+        )
+    }
+
+    /// Occurrences of events whose `column` (`hosted_by_camp` / `located_at_art`) is `uid`, by start time.
+    private func detailEvents(column: String, uid: String, db: Database) throws -> [EventObjectOccurrence] {
+        let events = try EventObject.filter(Column(column) == uid).fetchAll(db)
+        return try eventObjectOccurrences(for: events, db: db)
+            .sorted { $0.startDate < $1.startDate }
+    }
+
+    // MARK: - Context Snapshot
+
+    func fetchContextSnapshot(
+        region: MKCoordinateRegion?,
+        window: DateInterval,
+        typeCodes: Set<String>?,
+        searchText: String?,
+        hostLimit: Int
+    ) async throws -> PlayaContextSnapshot {
+        let snapshot = try await timedRead("fetchContextSnapshot(region:window:typeCodes:searchText:hostLimit:)") { db in
+            try self.contextSnapshot(
+                region: region, window: window, typeCodes: typeCodes,
+                searchText: searchText, hostLimit: hostLimit, db: db
+            )
+        }
+        try await ensureMetadata(for: [
+            (.art, snapshot.art.map(\.uid)),
+            (.camp, snapshot.camps.map(\.uid)),
+            (.mutantVehicle, snapshot.mutantVehicles.map(\.uid)),
+            (.event, snapshot.occurrences.map { $0.event.uid }),
+        ])
+        return snapshot
+    }
+
+    private func contextSnapshot(
+        region: MKCoordinateRegion?,
+        window: DateInterval,
+        typeCodes: Set<String>?,
+        searchText: String?,
+        hostLimit: Int,
+        db: Database
+    ) throws -> PlayaContextSnapshot {
+        let art = try FilterQueryCompiler.compile(ArtFilter(region: region, searchText: searchText))
+            .fetchAll(ArtObject.self, db)
+        let camps = try FilterQueryCompiler.compile(CampFilter(region: region, searchText: searchText))
+            .fetchAll(CampObject.self, db)
+        let mutantVehicles = try FilterQueryCompiler.compile(MutantVehicleFilter(searchText: searchText))
+            .fetchAll(MutantVehicleObject.self, db)
+        guard window.duration > 0 else {
+            return PlayaContextSnapshot(art: art, camps: camps, mutantVehicles: mutantVehicles, occurrences: [])
+        }
+
+        // Events in the region, falling back to all types when the requested ones have none
+        var eventFilter = EventFilter.all
+        eventFilter.region = region
+        eventFilter.activeWindow = window
+        eventFilter.eventTypeCodes = typeCodes
+        var inRegion = try eventObjectOccurrences(filter: eventFilter, db: db)
+        if inRegion.isEmpty, typeCodes != nil {
+            eventFilter.eventTypeCodes = nil
+            inRegion = try eventObjectOccurrences(filter: eventFilter, db: db)
+        }
+
+        // Events at the nearest hosts, in one statement. These catch events the region join
+        // misses when the event itself has no GPS.
+        let center = region.map { CLLocation(latitude: $0.center.latitude, longitude: $0.center.longitude) }
+        let campUIDs = Self.nearest(camps, to: center, limit: hostLimit).map(\.uid)
+        let artUIDs = Self.nearest(art, to: center, limit: hostLimit).map(\.uid)
+        var atHosts: [EventObjectOccurrence] = []
+        if !campUIDs.isEmpty || !artUIDs.isEmpty {
+            let hostedEventUIDs = EventObject
+                .select(EventObject.Columns.uid)
+                .filter(campUIDs.contains(Column("hosted_by_camp")) || artUIDs.contains(Column("located_at_art")))
+            let occurrences = try EventOccurrence
+                .filter(hostedEventUIDs.contains(EventOccurrence.Columns.eventId))
+                .filter(EventOccurrence.Columns.startTime < window.end)
+                .filter(EventOccurrence.Columns.endTime > window.start)
+                .fetchAll(db)
+            atHosts = try eventObjectOccurrences(for: occurrences, db: db)
+        }
+
+        var seen = Set<String>()
+        let occurrences = (inRegion + atHosts)
+            .filter { seen.insert($0.uid).inserted }
+            .sorted { $0.startDate < $1.startDate }
+        return PlayaContextSnapshot(art: art, camps: camps, mutantVehicles: mutantVehicles, occurrences: occurrences)
+    }
+
+    /// The `limit` objects closest to `center`, nearest first, skipping objects without GPS;
+    /// the first `limit` in list order without a center
+    private static func nearest<T: DataObject>(_ objects: [T], to center: CLLocation?, limit: Int) -> [T] {
+        guard let center else { return Array(objects.prefix(limit)) }
+        return objects
+            .compactMap { object in object.location.map { (object, $0.distance(from: center)) } }
+            .sorted { $0.1 < $1.1 }
+            .prefix(limit)
+            .map(\.0)
+    }
+
     // MARK: - Mutant Vehicle Data Access
 
     func fetchMutantVehicles() async throws -> [MutantVehicleObject] {
-        let mvs = try await dbQueue.read { db in
+        let mvs = try await timedRead("fetchMutantVehicles()") { db in
             try MutantVehicleObject.fetchAll(db)
         }
         try await ensureMetadata(for: .mutantVehicle, ids: mvs.map(\.uid))
@@ -896,15 +1216,15 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchMutantVehicles(filter: MutantVehicleFilter) async throws -> [MutantVehicleObject] {
-        let mvs = try await dbQueue.read { db in
-            try self.mutantVehicleRequest(filter: filter).fetchAll(db)
+        let mvs = try await timedRead("fetchMutantVehicles(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.compile(filter).fetchAll(MutantVehicleObject.self, db)
         }
         try await ensureMetadata(for: .mutantVehicle, ids: mvs.map(\.uid))
         return mvs
     }
 
     func fetchMutantVehicle(uid: String) async throws -> MutantVehicleObject? {
-        let mv = try await dbQueue.read { db in
+        let mv = try await timedRead("fetchMutantVehicle(uid:)") { db in
             try MutantVehicleObject.filter(Column("uid") == uid).fetchOne(db)
         }
         if let mv {
@@ -914,7 +1234,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchMutantVehicleImageURLs() async throws -> [String: URL] {
-        try await dbQueue.read { db in
+        try await timedRead("fetchMutantVehicleImageURLs()") { db in
             let images = try MutantVehicleImage
                 .filter(MutantVehicleImage.Columns.thumbnailUrl != nil)
                 .fetchAll(db)
@@ -929,7 +1249,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchArtImageURLs() async throws -> [String: URL] {
-        try await dbQueue.read { db in
+        try await timedRead("fetchArtImageURLs()") { db in
             let images = try ArtImage
                 .filter(ArtImage.Columns.thumbnailUrl != nil)
                 .fetchAll(db)
@@ -944,7 +1264,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchCampImageURLs() async throws -> [String: URL] {
-        try await dbQueue.read { db in
+        try await timedRead("fetchCampImageURLs()") { db in
             let images = try CampImage
                 .filter(CampImage.Columns.thumbnailUrl != nil)
                 .fetchAll(db)
@@ -960,6 +1280,9 @@ internal class PlayaDBImpl: PlayaDB {
 
     // MARK: - Filtered Data Access (Internal Request Builders)
 
+    // Query-interface forms of the filters, for composing custom requests. Filtered fetches
+    // and observations run the equivalent statements from `FilterQueryCompiler`.
+
     /// Build an art query from filter options (internal - uses GRDB types)
     internal func artRequest(filter: ArtFilter) -> QueryInterfaceRequest<ArtObject> {
         var request = ArtObject.all()
@@ -1020,36 +1343,6 @@ internal class PlayaDBImpl: PlayaDB {
         return request.orderedByName()
     }
 
-    /// Build a mutant vehicle query from filter options
-    internal func mutantVehicleRequest(filter: MutantVehicleFilter) -> QueryInterfaceRequest<MutantVehicleObject> {
-        var request = MutantVehicleObject.all()
-
-        if let year = filter.year {
-            request = request.forYear(year)
-        }
-
-        if let searchText = filter.searchText {
-            request = request.matching(searchText: searchText)
-        }
-
-        if filter.onlyFavorites {
-            request = request.onlyFavorites(ofType: .mutantVehicle)
-        }
-
-        if let tag = filter.tag {
-            request = request.filter(sql: """
-                EXISTS (
-                    SELECT 1
-                    FROM mv_tags
-                    WHERE mv_tags.mv_id = mv_objects.uid
-                      AND mv_tags.tag = ?
-                )
-            """, arguments: [tag])
-        }
-
-        return request.orderedByName()
-    }
-
     /// Build an event occurrence query from filter options (internal - uses GRDB types).
     /// `matchingEventUIDs` constrains occurrences to events whose UIDs match an FTS query;
     /// pass `nil` to skip search filtering.
@@ -1097,161 +1390,74 @@ internal class PlayaDBImpl: PlayaDB {
         return request.orderedByStartTime()
     }
 
-    /// JOIN-based variant of `eventObjectOccurrences(filter:db:)` that fetches occurrence +
-    /// parent event + host (camp or art) in a single SQL JOIN. Replaces the prior
-    /// 4-sequential-query pattern (occurrences → events IN(…) → camps IN(…) → arts IN(…)).
-    ///
-    /// Pushes favorites / year / event-type filters into SQL. Region/bbox filter remains
-    /// client-side (sparse GPS on events; no spatial index payoff).
-    internal func eventObjectOccurrencesJoined(
+    /// Occurrence + parent event + host (camp or art) rows for `filter`, from one compiled
+    /// statement with every predicate in SQL (see `FilterQueryCompiler`).
+    internal func eventObjectOccurrences(
         filter: EventFilter,
+        window: ListWindowRequest? = nil,
         db: Database
     ) throws -> [EventObjectOccurrence] {
-        // FTS5 pre-resolve against event_objects_fts (same pattern as the non-joined helper).
-        let matchingEventUIDs: Set<String>?
-        if let searchText = filter.searchText, !searchText.isEmpty {
-            let uids = try EventObject.all()
-                .matching(searchText: searchText)
-                .select(EventObject.Columns.uid, as: String.self)
-                .fetchAll(db)
-            matchingEventUIDs = Set(uids)
-        } else {
-            matchingEventUIDs = nil
-        }
-
-        // Base occurrence query (date/time/notExpired/search constraints applied via existing helper).
-        // `forKey("event")` overrides GRDB's default scope key (destination type name) so the
-        // joined row exposes the EventObject row under `row.scopes["event"]`, matching
-        // EventOccurrenceJoinedRow.init(row:).
-        let eventAssociation = EventOccurrence.event.forKey("event")
-        var request = eventOccurrenceRequest(
-            filter: filter,
-            matchingEventUIDs: matchingEventUIDs
-        )
-        .including(required: eventAssociation
-            .including(optional: EventObject.hostedCamp)
-            .including(optional: EventObject.locatedArt))
-
-        // Push remaining filters into SQL.
-        if filter.onlyFavorites {
-            let predicate: SQL = SQL("""
-                EXISTS (
-                    SELECT 1 FROM object_metadata
-                    WHERE object_metadata.object_type = \(DataObjectType.event.rawValue)
-                      AND object_metadata.object_id = event_occurrences.event_id
-                      AND object_metadata.is_favorite = 1
-                )
-            """)
-            request = request.filter(predicate)
-        }
-        if let year = filter.year {
-            request = request.joining(required: eventAssociation
-                .filter(EventObject.Columns.year == year))
-        }
-        if let codes = filter.eventTypeCodes, !codes.isEmpty {
-            request = request.joining(required: eventAssociation
-                .filter(codes.contains(EventObject.Columns.eventTypeCode)))
-        }
-        // Region → indexed prefilter on occurrence ids (R*Tree), matching the non-joined path.
-        if let region = filter.region {
-            let regionIDs = try occurrenceIDsInRegion(db, region: region)
-            request = request.filter(regionIDs.contains(EventOccurrence.Columns.id))
-        }
-
-        let joined = try EventOccurrenceJoinedRow.fetchAll(db, request)
+        let joined = try FilterQueryCompiler.compile(filter, window: window)
+            .fetchAll(EventOccurrenceJoinedRow.self, db, adapter: FilterQueryCompiler.eventRowAdapter(db))
         return joined.map { $0.toEventObjectOccurrence() }
     }
 
-    private func eventObjectOccurrences(
+    /// Columnar counterpart of `eventObjectOccurrences(filter:db:)`: same filter semantics,
+    /// but events and hosts are fetched once and shared by index instead of copied per row.
+    internal func eventOccurrenceStore(
         filter: EventFilter,
         db: Database
-    ) throws -> [EventObjectOccurrence] {
-        // Pre-resolve FTS5 search to event UIDs against event_objects_fts (parent table).
-        // .matching(searchText:) keys off RowDecoder.databaseTableName + "_fts", and the
-        // events FTS table indexes EventObject columns (name/description/event_type_label/
-        // print_description), not EventOccurrence — so the match must run on EventObject.
-        let matchingEventUIDs: Set<String>?
-        if let searchText = filter.searchText, !searchText.isEmpty {
-            let uids = try EventObject.all()
-                .matching(searchText: searchText)
-                .select(EventObject.Columns.uid, as: String.self)
-                .fetchAll(db)
-            matchingEventUIDs = Set(uids)
-        } else {
-            matchingEventUIDs = nil
-        }
-
-        var occurrenceRequest = eventOccurrenceRequest(
-            filter: filter,
-            matchingEventUIDs: matchingEventUIDs
+    ) throws -> EventOccurrenceStore {
+        let occurrences = try FilterQueryCompiler.compile(filter, selecting: .occurrences)
+            .fetchAll(EventOccurrence.self, db)
+        guard !occurrences.isEmpty else { return EventOccurrenceStore() }
+
+        let favoriteIDs = try Set(
+            String.fetchAll(
+                db,
+                ObjectMetadata
+                    .select(ObjectMetadata.Columns.objectId)
+                    .filter(ObjectMetadata.Columns.objectType == DataObjectType.event.rawValue)
+                    .filter(ObjectMetadata.Columns.isFavorite == true)
+            )
         )
-        // Region → indexed prefilter on occurrence ids (R*Tree). Time/type stay exact below.
-        if let region = filter.region {
-            let regionIDs = try occurrenceIDsInRegion(db, region: region)
-            occurrenceRequest = occurrenceRequest.filter(regionIDs.contains(EventOccurrence.Columns.id))
-        }
-        let occurrences = try occurrenceRequest.fetchAll(db)
-
-        let pairs = try eventObjectOccurrences(for: occurrences, db: db)
-
-        let favoriteEventIds: Set<String>
-        if filter.onlyFavorites {
-            let metadata = try ObjectMetadata
-                .filter(ObjectMetadata.Columns.objectType == DataObjectType.event.rawValue)
-                .filter(ObjectMetadata.Columns.isFavorite == true)
-                .fetchAll(db)
-            favoriteEventIds = Set(metadata.map(\.objectId))
-        } else {
-            favoriteEventIds = []
-        }
-
-        return pairs.filter { pair in
-            let event = pair.event
-            let occurrence = pair.occurrence
-
-            if filter.onlyFavorites {
-                let occurrenceUID = "\(event.uid)_\(occurrence.id ?? 0)"
-                if !favoriteEventIds.contains(occurrenceUID) && !favoriteEventIds.contains(event.uid) {
-                    return false
-                }
-            }
-
-            if let year = filter.year, event.year != year {
-                return false
-            }
-
-            // Region is filtered in SQL via the occurrence R*Tree prefilter (see above).
-
-            if let allowedTypes = filter.eventTypeCodes, !allowedTypes.isEmpty {
-                if !allowedTypes.contains(event.eventTypeCode) {
-                    return false
-                }
-            }
+        let events = try EventObject
+            .filter(Set(occurrences.map(\.eventId)).contains(EventObject.Columns.uid))
+            .fetchAll(db)
+        let hosts = try batchResolveHosts(for: events, db: db)
+        let colors = try ThumbnailColors
+            .filter(events.map(\.uid).contains(ThumbnailColors.Columns.objectId))
+            .fetchAll(db)
 
-            return true
-        }
+        return EventOccurrenceStore(
+            occurrences: occurrences,
+            events: events,
+            hosts: hosts,
+            favoriteIDs: favoriteIDs,
+            thumbnailColors: Dictionary(colors.map { ($0.objectId, $0) }, uniquingKeysWith: { first, _ in first })
+        )
     }
 
     // MARK: - Filtered Data Access (Public API)
 
     func fetchArt(filter: ArtFilter) async throws -> [ArtObject] {
-        let art = try await dbQueue.read { db in
-            try artRequest(filter: filter).fetchAll(db)
+        let art = try await timedRead("fetchArt(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.compile(filter).fetchAll(ArtObject.self, db)
         }
         try await ensureMetadata(for: .art, ids: art.map(\.uid))
         return art
     }
 
     func fetchCamps(filter: CampFilter) async throws -> [CampObject] {
-        let camps = try await dbQueue.read { db in
-            try campRequest(filter: filter).fetchAll(db)
+        let camps = try await timedRead("fetchCamps(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.compile(filter).fetchAll(CampObject.self, db)
         }
         try await ensureMetadata(for: .camp, ids: camps.map(\.uid))
         return camps
     }
 
     func fetchEvents(filter: EventFilter) async throws -> [EventObjectOccurrence] {
-        let events = try await dbQueue.read { db in
+        let events = try await timedRead("fetchEvents(filter:)", from: reader(forYear: filter.year)) { db in
             try eventObjectOccurrences(filter: filter, db: db)
         }
         try await ensureMetadata(for: .event, ids: events.map { $0.event.uid })
@@ -1266,7 +1472,9 @@ internal class PlayaDBImpl: PlayaDB {
     ///   regions trigger re-evaluation. The fetch closure can read from any table freely.
     ///   When nil, GRDB auto-tracks all tables accessed in the fetch closure.
     private func observeListRows<T>(
+        _ name: StaticString,
         type: DataObjectType,
+        year: Int?,
         ids: @escaping ([T]) -> [String],
         regions: [any DatabaseRegionConvertible]? = nil,
         skipEnsureMetadata: Bool = false,
@@ -1275,7 +1483,7 @@ internal class PlayaDBImpl: PlayaDB {
         onError: @escaping (Error) -> Void
     ) -> PlayaDBObservationToken {
         let typeRaw = type.rawValue
-        let fetch: @Sendable (Database) throws -> [ListRow<T>] = { db in
+        let fetch: @Sendable (Database) throws -> [ListRow<T>] = instrumentation.observing(name) { db in
             let objects = try value(db)
             let objectIDs = ids(objects)
             guard !objectIDs.isEmpty else { return [] }
@@ -1303,28 +1511,79 @@ internal class PlayaDBImpl: PlayaDB {
             }
         }
 
+        let handleChange: ([ListRow<T>]) -> Void = { [weak self] rows in
+            if !skipEnsureMetadata {
+                let identifiers = ids(rows.map(\.object))
+                if !identifiers.isEmpty {
+                    Task {
+                        try? await self?.ensureMetadata(for: type, ids: identifiers)
+                    }
+                }
+            }
+            onChange(rows)
+        }
+
+        let reader: DatabaseQueue
+        do {
+            reader = try self.reader(forYear: year)
+        } catch {
+            onError(error)
+            return PlayaDBObservationToken(AnyDatabaseCancellable(cancel: {}))
+        }
+        if reader !== dbQueue {
+            return observeArchive(reader, fetch: fetch, onChange: handleChange, onError: onError)
+        }
+
         let observation: ValueObservation<ValueReducers.Fetch<[ListRow<T>]>>
         if let regions {
             observation = ValueObservation.tracking(regions: regions, fetch: fetch)
         } else {
             observation = ValueObservation.tracking(fetch)
         }
-        let cancellable = observation.start(
-            in: dbQueue,
-            onError: onError,
-            onChange: { [weak self] rows in
-                if !skipEnsureMetadata {
-                    let identifiers = ids(rows.map(\.object))
-                    if !identifiers.isEmpty {
-                        Task {
-                            try? await self?.ensureMetadata(for: type, ids: identifiers)
+        let cancellable = database.observe { queue in
+            observation.start(
+                in: queue,
+                onError: onError,
+                onChange: handleChange
+            )
+        }
+        return PlayaDBObservationToken(cancellable)
+    }
+
+    /// Archive rows never change, but their favorites and colors live in the current
+    /// database: re-read the archive whenever those user tables change.
+    private func observeArchive<Value>(
+        _ archive: DatabaseQueue,
+        fetch: @escaping @Sendable (Database) throws -> Value,
+        onChange: @escaping (Value) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        let generation = ObservationGeneration()
+        let observation = ValueObservation.tracking(regions: [ObjectMetadata.all(), ThumbnailColors.all()]) { _ in }
+        let cancellable = database.observe { queue in
+            observation.start(
+                in: queue,
+                onError: onError,
+                onChange: { _ in
+                    let current = generation.increment()
+                    archive.asyncRead { result in
+                        let value = Result { try fetch(result.get()) }
+                        DispatchQueue.main.async {
+                            // Drop results overtaken by a newer read or a cancel
+                            guard generation.value == current else { return }
+                            switch value {
+                            case .success(let value): onChange(value)
+                            case .failure(let error): onError(error)
+                            }
                         }
                     }
                 }
-                onChange(rows)
-            }
-        )
-        return PlayaDBObservationToken(cancellable)
+            )
+        }
+        return PlayaDBObservationToken(AnyDatabaseCancellable {
+            cancellable.cancel()
+            _ = generation.increment()
+        })
     }
 
     func observeArt(
@@ -1332,16 +1591,19 @@ internal class PlayaDBImpl: PlayaDB {
         onChange: @escaping ([ListRow<ArtObject>]) -> Void,
         onError: @escaping (Error) -> Void
     ) -> PlayaDBObservationToken {
-        observeListRows(
-            type: .art,
-            ids: { $0.map(\.uid) },
-            value: { [weak self, filter] db in
-                guard let self else { return [] }
-                return try self.artRequest(filter: filter).fetchAll(db)
-            },
-            onChange: onChange,
-            onError: onError
-        )
+        sharedObservations.observe(.init(kind: "art", filter: filter), onChange: onChange, onError: onError) { deliver, fail in
+            observeListRows(
+                "observeArt(filter:)",
+                type: .art,
+                year: filter.year,
+                ids: { $0.map(\.uid) },
+                value: { [filter] db in
+                    try FilterQueryCompiler.compile(filter).fetchAll(ArtObject.self, db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
     }
 
     func observeCamps(
@@ -1349,16 +1611,19 @@ internal class PlayaDBImpl: PlayaDB {
         onChange: @escaping ([ListRow<CampObject>]) -> Void,
         onError: @escaping (Error) -> Void
     ) -> PlayaDBObservationToken {
-        observeListRows(
-            type: .camp,
-            ids: { $0.map(\.uid) },
-            value: { [weak self, filter] db in
-                guard let self else { return [] }
-                return try self.campRequest(filter: filter).fetchAll(db)
-            },
-            onChange: onChange,
-            onError: onError
-        )
+        sharedObservations.observe(.init(kind: "camps", filter: filter), onChange: onChange, onError: onError) { deliver, fail in
+            observeListRows(
+                "observeCamps(filter:)",
+                type: .camp,
+                year: filter.year,
+                ids: { $0.map(\.uid) },
+                value: { [filter] db in
+                    try FilterQueryCompiler.compile(filter).fetchAll(CampObject.self, db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
     }
 
     func observeEvents(
@@ -1369,17 +1634,21 @@ internal class PlayaDBImpl: PlayaDB {
         // Explicitly scope observation to event tables only.
         // The fetch closure also JOINs camp_objects/art_objects for host data,
         // but changes to those tables should not trigger re-evaluation.
-        observeListRows(
-            type: .event,
-            ids: { $0.map { $0.event.uid } },
-            regions: [EventOccurrence.all(), EventObject.all(), Table("event_occurrence_rtree")],
-            value: { [weak self, filter] db in
-                guard let self else { return [] }
-                return try self.eventObjectOccurrences(filter: filter, db: db)
-            },
-            onChange: onChange,
-            onError: onError
-        )
+        sharedObservations.observe(.init(kind: "events", filter: filter), onChange: onChange, onError: onError) { deliver, fail in
+            observeListRows(
+                "observeEvents(filter:)",
+                type: .event,
+                year: filter.year,
+                ids: { $0.map { $0.event.uid } },
+                regions: [EventOccurrence.all(), EventObject.all(), Table("event_occurrence_rtree")],
+                value: { [weak self, filter] db in
+                    guard let self else { return [] }
+                    return try self.eventObjectOccurrences(filter: filter, db: db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
     }
 
     func observeMutantVehicles(
@@ -1387,16 +1656,76 @@ internal class PlayaDBImpl: PlayaDB {
         onChange: @escaping ([ListRow<MutantVehicleObject>]) -> Void,
         onError: @escaping (Error) -> Void
     ) -> PlayaDBObservationToken {
-        observeListRows(
-            type: .mutantVehicle,
-            ids: { $0.map(\.uid) },
-            value: { [weak self, filter] db in
-                guard let self else { return [] }
-                return try self.mutantVehicleRequest(filter: filter).fetchAll(db)
-            },
-            onChange: onChange,
-            onError: onError
+        sharedObservations.observe(.init(kind: "mutantVehicles", filter: filter), onChange: onChange, onError: onError) { deliver, fail in
+            observeListRows(
+                "observeMutantVehicles(filter:)",
+                type: .mutantVehicle,
+                year: filter.year,
+                ids: { $0.map(\.uid) },
+                value: { [filter] db in
+                    try FilterQueryCompiler.compile(filter).fetchAll(MutantVehicleObject.self, db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
+    }
+
+    func fetchEventOccurrenceStore(filter: EventFilter) async throws -> EventOccurrenceStore {
+        try await timedRead("fetchEventOccurrenceStore(filter:)", from: reader(forYear: filter.year)) { db in
+            try eventOccurrenceStore(filter: filter, db: db)
+        }
+    }
+
+    func observeEventOccurrenceStore(
+        filter: EventFilter,
+        onChange: @escaping (EventOccurrenceStore) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        sharedObservations.observe(.init(kind: "eventOccurrenceStore", filter: filter), onChange: onChange, onError: onError) { deliver, fail in
+            startEventOccurrenceStoreObservation(filter: filter, onChange: deliver, onError: fail)
+        }
+    }
+
+    private func startEventOccurrenceStoreObservation(
+        filter: EventFilter,
+        onChange: @escaping (EventOccurrenceStore) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        let fetch: @Sendable (Database) throws -> EventOccurrenceStore = instrumentation.observing("observeEventOccurrenceStore(filter:)") { [weak self, filter] db in
+            guard let self else { return EventOccurrenceStore() }
+            return try self.eventOccurrenceStore(filter: filter, db: db)
+        }
+        do {
+            let reader = try reader(forYear: filter.year)
+            if reader !== dbQueue {
+                return observeArchive(reader, fetch: fetch, onChange: onChange, onError: onError)
+            }
+        } catch {
+            onError(error)
+            return PlayaDBObservationToken(AnyDatabaseCancellable(cancel: {}))
+        }
+
+        // Same regions as observeEventsByDayThenHour: host edits don't reshuffle events, but
+        // favorite toggles and cached colors must refresh the rows.
+        let observation = ValueObservation.tracking(
+            regions: [
+                EventOccurrence.all(),
+                EventObject.all(),
+                ObjectMetadata.all(),
+                ThumbnailColors.all(),
+                Table("event_occurrence_rtree")
+            ],
+            fetch: fetch
         )
+        let cancellable = database.observe { queue in
+            observation.start(
+                in: queue,
+                onError: onError,
+                onChange: onChange
+            )
+        }
+        return PlayaDBObservationToken(cancellable)
     }
 
     func observeEventsByHour(
@@ -1422,8 +1751,11 @@ internal class PlayaDBImpl: PlayaDB {
         // would write 8000+ blank metadata rows, which the ObjectMetadata region would
         // immediately observe and re-fire the JOIN. Fetch already tolerates nil metadata
         // via `metaByID[uid]` so blank pre-population is unnecessary.
-        observeListRows(
+        let instrumentation = instrumentation
+        return observeListRows(
+            "observeEventsByDayThenHour(filter:)",
             type: .event,
+            year: filter.year,
             ids: { $0.map { $0.event.uid } },
             regions: [
                 EventOccurrence.all(),
@@ -1435,10 +1767,12 @@ internal class PlayaDBImpl: PlayaDB {
             skipEnsureMetadata: true,
             value: { [weak self, filter] db in
                 guard let self else { return [] }
-                return try self.eventObjectOccurrencesJoined(filter: filter, db: db)
+                return try self.eventObjectOccurrences(filter: filter, db: db)
             },
             onChange: { rows in
-                onChange(Self.bucketByDayThenHour(rows))
+                onChange(instrumentation.measure("bucketByDayThenHour", kind: .observation) {
+                    Self.bucketByDayThenHour(rows)
+                })
             },
             onError: onError
         )
@@ -1446,7 +1780,7 @@ internal class PlayaDBImpl: PlayaDB {
 
     /// Groups rows by start-time hour-of-day in the device's current calendar.
     /// Sections are sorted ascending; rows within a section preserve input order
-    /// (which is `orderedByStartTime` from `eventOccurrenceRequest`).
+    /// (start time, from the compiled event query).
     static func groupByHour(_ rows: [ListRow<EventObjectOccurrence>]) -> [EventHourSection] {
         let calendar = Calendar.current
         return Dictionary(grouping: rows, by: { calendar.component(.hour, from: $0.object.startDate) })
@@ -1523,90 +1857,493 @@ internal class PlayaDBImpl: PlayaDB {
         return result
     }
 
-    // MARK: - Thumbnail Colors
-
-    func saveThumbnailColors(_ colors: ThumbnailColors) async throws {
-        try await dbQueue.write { db in
-            var colors = colors
-            try colors.save(db, onConflict: .replace)
-        }
-    }
+    // MARK: - List Windows
 
-    func saveThumbnailColorsBatch(_ batch: [ThumbnailColors]) async throws {
-        try await dbQueue.write { db in
-            for var colors in batch {
-                try colors.save(db, onConflict: .replace)
-            }
-        }
+    /// Keyset cursors of the list orders in `FilterQueryCompiler`
+    private static func nameCursor(_ object: some DataObject) -> ListCursor {
+        ListCursor(key: object.name, tiebreaker: object.uid)
     }
 
-    func fetchThumbnailColors(objectId: String) async throws -> ThumbnailColors? {
-        try await dbQueue.read { db in
-            try ThumbnailColors
-                .filter(ThumbnailColors.Columns.objectId == objectId)
-                .fetchOne(db)
-        }
+    private static func startTimeCursor(_ occurrence: EventObjectOccurrence) -> ListCursor {
+        ListCursor(key: occurrence.occurrence.startTime, tiebreaker: occurrence.occurrence.id ?? 0)
     }
 
-    func fetchCachedColorObjectIDs() async throws -> Set<String> {
-        try await dbQueue.read { db in
+    /// `observeListRows` for one window: fetches `limit + 1` objects and trims the extra one
+    /// into the window's `next` cursor
+    private func observeListWindow<T>(
+        _ name: StaticString,
+        type: DataObjectType,
+        year: Int?,
+        window: ListWindowRequest,
+        ids: @escaping ([T]) -> [String],
+        cursor: @escaping (T) -> ListCursor,
+        regions: [any DatabaseRegionConvertible]? = nil,
+        value: @escaping @Sendable (Database) throws -> [T],
+        onChange: @escaping (ListWindow<T>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        observeListRows(
+            name,
+            type: type,
+            year: year,
+            ids: ids,
+            regions: regions,
+            value: value,
+            onChange: { rows in
+                onChange(ListWindow(fetched: rows, limit: window.limit, cursor: cursor))
+            },
+            onError: onError
+        )
+    }
+
+    func observeArt(
+        filter: ArtFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<ArtObject>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        let key: [AnyHashable] = [filter, window]
+        return sharedObservations.observe(.init(kind: "artWindow", filter: key), onChange: onChange, onError: onError) { deliver, fail in
+            observeListWindow(
+                "observeArt(filter:window:)",
+                type: .art,
+                year: filter.year,
+                window: window,
+                ids: { $0.map(\.uid) },
+                cursor: { Self.nameCursor($0) },
+                value: { [filter, window] db in
+                    try FilterQueryCompiler.compile(filter, window: window).fetchAll(ArtObject.self, db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
+    }
+
+    func observeCamps(
+        filter: CampFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<CampObject>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        let key: [AnyHashable] = [filter, window]
+        return sharedObservations.observe(.init(kind: "campsWindow", filter: key), onChange: onChange, onError: onError) { deliver, fail in
+            observeListWindow(
+                "observeCamps(filter:window:)",
+                type: .camp,
+                year: filter.year,
+                window: window,
+                ids: { $0.map(\.uid) },
+                cursor: { Self.nameCursor($0) },
+                value: { [filter, window] db in
+                    try FilterQueryCompiler.compile(filter, window: window).fetchAll(CampObject.self, db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
+    }
+
+    func observeMutantVehicles(
+        filter: MutantVehicleFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<MutantVehicleObject>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        let key: [AnyHashable] = [filter, window]
+        return sharedObservations.observe(.init(kind: "mutantVehiclesWindow", filter: key), onChange: onChange, onError: onError) { deliver, fail in
+            observeListWindow(
+                "observeMutantVehicles(filter:window:)",
+                type: .mutantVehicle,
+                year: filter.year,
+                window: window,
+                ids: { $0.map(\.uid) },
+                cursor: { Self.nameCursor($0) },
+                value: { [filter, window] db in
+                    try FilterQueryCompiler.compile(filter, window: window).fetchAll(MutantVehicleObject.self, db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
+    }
+
+    func observeEvents(
+        filter: EventFilter,
+        window: ListWindowRequest,
+        onChange: @escaping (ListWindow<EventObjectOccurrence>) -> Void,
+        onError: @escaping (Error) -> Void
+    ) -> PlayaDBObservationToken {
+        // Same regions as observeEvents(filter:): host edits don't trigger re-evaluation
+        let key: [AnyHashable] = [filter, window]
+        return sharedObservations.observe(.init(kind: "eventsWindow", filter: key), onChange: onChange, onError: onError) { deliver, fail in
+            observeListWindow(
+                "observeEvents(filter:window:)",
+                type: .event,
+                year: filter.year,
+                window: window,
+                ids: { $0.map { $0.event.uid } },
+                cursor: { Self.startTimeCursor($0) },
+                regions: [EventOccurrence.all(), EventObject.all(), Table("event_occurrence_rtree")],
+                value: { [weak self, filter, window] db in
+                    guard let self else { return [] }
+                    return try self.eventObjectOccurrences(filter: filter, window: window, db: db)
+                },
+                onChange: deliver,
+                onError: fail
+            )
+        }
+    }
+
+    func countArt(filter: ArtFilter) async throws -> Int {
+        try await timedRead("countArt(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.count(filter).fetchCount(db)
+        }
+    }
+
+    func countCamps(filter: CampFilter) async throws -> Int {
+        try await timedRead("countCamps(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.count(filter).fetchCount(db)
+        }
+    }
+
+    func countMutantVehicles(filter: MutantVehicleFilter) async throws -> Int {
+        try await timedRead("countMutantVehicles(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.count(filter).fetchCount(db)
+        }
+    }
+
+    func countEvents(filter: EventFilter) async throws -> Int {
+        try await timedRead("countEvents(filter:)", from: reader(forYear: filter.year)) { db in
+            try FilterQueryCompiler.count(filter).fetchCount(db)
+        }
+    }
+
+    // MARK: - Map Features
+
+    /// How long results for time-relative event filters stay cached.
+    static let relativeMapFeatureLifetime: TimeInterval = 60
+
+    func fetchMapFeatures(filter: MapFeatureFilter) async throws -> MapFeatureCollection {
+        var fragments: [MapFeatureCache.Fragment] = []
+        if let artFilter = filter.art {
+            fragments.append(try await mapFeatureFragment(type: .art, key: artFilter) { db, favorites in
+                try FilterQueryCompiler.compile(artFilter).fetchAll(ArtObject.self, db).compactMap { art in
+                    guard let lat = art.gpsLatitude, let lon = art.gpsLongitude else { return nil }
+                    return MapFeature(uid: art.uid, objectType: .art, name: art.name,
+                                      latitude: lat, longitude: lon,
+                                      isFavorite: favorites.contains(art.uid))
+                }
+            })
+        }
+        if let campFilter = filter.camps {
+            fragments.append(try await mapFeatureFragment(type: .camp, key: campFilter) { db, favorites in
+                try FilterQueryCompiler.compile(campFilter).fetchAll(CampObject.self, db).compactMap { camp in
+                    guard let lat = camp.gpsLatitude, let lon = camp.gpsLongitude else { return nil }
+                    return MapFeature(uid: camp.uid, objectType: .camp, name: camp.name,
+                                      latitude: lat, longitude: lon,
+                                      isFavorite: favorites.contains(camp.uid))
+                }
+            })
+        }
+        if let eventFilter = filter.events {
+            let isRelative = eventFilter.happeningNow
+                || eventFilter.startingWithinHours != nil
+                || !eventFilter.includeExpired
+            fragments.append(try await mapFeatureFragment(
+                type: .event,
+                key: eventFilter,
+                lifetime: isRelative ? Self.relativeMapFeatureLifetime : nil
+            ) { [weak self] db, favorites in
+                guard let self else { return [] }
+                return try self.eventObjectOccurrences(filter: eventFilter, db: db).compactMap { occurrence in
+                    // GPS is copied from the host at import; fall back to the host for rows that missed it
+                    guard let coordinate = (occurrence.location ?? occurrence.host?.location)?.coordinate else { return nil }
+                    return MapFeature(uid: occurrence.uid, objectType: .event, name: occurrence.name,
+                                      latitude: coordinate.latitude, longitude: coordinate.longitude,
+                                      isFavorite: favorites.contains(occurrence.event.uid) || favorites.contains(occurrence.uid),
+                                      eventTypeCode: occurrence.eventTypeCode,
+                                      startDate: occurrence.startDate,
+                                      endDate: occurrence.endDate)
+                }
+            })
+        }
+        return MapFeatureCollection(
+            features: fragments.flatMap(\.features),
+            encodedFeatures: fragments.map(\.encoded)
+        )
+    }
+
+    /// Cached features for one category, building and encoding them on a miss.
+    /// `build` receives the favorited object IDs of `type`, read in the same transaction.
+    private func mapFeatureFragment(
+        type: DataObjectType,
+        key: AnyHashable,
+        lifetime: TimeInterval? = nil,
+        build: @escaping @Sendable (Database, Set<String>) throws -> [MapFeature]
+    ) async throws -> MapFeatureCache.Fragment {
+        if let cached = mapFeatureCache.fragment(type: type, key: key) {
+            return cached
+        }
+        let generation = mapFeatureCache.generation(for: type)
+        let now = Date()
+        let features = try await timedRead("fetchMapFeatures(filter:)") { db in
+            let favorites = try Set(
+                String.fetchAll(
+                    db,
+                    ObjectMetadata
+                        .select(ObjectMetadata.Columns.objectId)
+                        .filter(ObjectMetadata.Columns.objectType == type.rawValue)
+                        .filter(ObjectMetadata.Columns.isFavorite == true)
+                )
+            )
+            return try build(db, favorites)
+        }
+        let fragment = MapFeatureCache.Fragment(
+            features: features,
+            encoded: MapFeatureCollection.encodeFeatures(features)
+        )
+        mapFeatureCache.store(
+            fragment,
+            type: type,
+            key: key,
+            generation: generation,
+            expiresAt: lifetime.map { now.addingTimeInterval($0) }
+        )
+        return fragment
+    }
+
+    /// Drops cached map features whenever a table feeding them commits a change. Event
+    /// locations fall back to the host camp/art, so those tables invalidate events too.
+    /// Only the favorite flag of `object_metadata` is tracked; last-viewed and notes writes
+    /// leave the cache alone.
+    private func setupMapFeatureInvalidation() {
+        let favorites = ObjectMetadata.select(ObjectMetadata.Columns.objectType, ObjectMetadata.Columns.isFavorite)
+        let dependencies: [(DataObjectType, [any DatabaseRegionConvertible])] = [
+            (.art, [ArtObject.all(), favorites]),
+            (.camp, [CampObject.all(), favorites]),
+            (.event, [EventObject.all(), EventOccurrence.all(), ArtObject.all(), CampObject.all(), favorites]),
+        ]
+        for (type, regions) in dependencies {
+            let cancellable = database.observe { [weak self] queue in
+                DatabaseRegionObservation(tracking: regions).start(
+                    in: queue,
+                    onError: { error in
+                        print("Error observing map feature tables: \(error)")
+                    },
+                    onChange: { [weak self] _ in
+                        self?.mapFeatureCache.invalidate([type])
+                    }
+                )
+            }
+            observations.append(cancellable)
+        }
+    }
+
+    /// Drops the loaded semantic index whenever `object_embeddings` commits a change, so the
+    /// next search reloads it.
+    private func setupSemanticIndexInvalidation() {
+        let cancellable = database.observe { [weak self] queue in
+            DatabaseRegionObservation(tracking: Table("object_embeddings").all()).start(
+                in: queue,
+                onError: { error in
+                    print("Error observing object embeddings: \(error)")
+                },
+                onChange: { [weak self] _ in
+                    self?.semanticIndex.invalidate()
+                }
+            )
+        }
+        observations.append(cancellable)
+    }
+
+    /// Re-reads the live years whenever a content table commits a change
+    private func setupLiveYearsTracking() {
+        let regions: [any DatabaseRegionConvertible] = [
+            ArtObject.select(Column("year")),
+            CampObject.select(Column("year")),
+            EventObject.select(Column("year")),
+            MutantVehicleObject.select(Column("year"))
+        ]
+        let cancellable = database.observe { [weak self] queue in
+            DatabaseRegionObservation(tracking: regions).start(
+                in: queue,
+                onError: { error in
+                    print("Error observing live years: \(error)")
+                },
+                onChange: { [weak self] db in
+                    do {
+                        self?.liveYears.set(try Self.fetchLiveYears(db))
+                    } catch {
+                        print("Error reading live years: \(error)")
+                    }
+                }
+            )
+        }
+        observations.append(cancellable)
+    }
+
+    // MARK: - Thumbnail Colors
+
+    func saveThumbnailColors(_ colors: ThumbnailColors) async throws {
+        try await timedWrite("saveThumbnailColors(_:)") { db in
+            var colors = colors
+            try colors.save(db, onConflict: .replace)
+        }
+    }
+
+    func saveThumbnailColorsBatch(_ batch: [ThumbnailColors]) async throws {
+        try await timedWrite("saveThumbnailColorsBatch(_:)") { db in
+            for var colors in batch {
+                try colors.save(db, onConflict: .replace)
+            }
+        }
+    }
+
+    func fetchThumbnailColors(objectId: String) async throws -> ThumbnailColors? {
+        try await timedRead("fetchThumbnailColors(objectId:)") { db in
+            try ThumbnailColors
+                .filter(ThumbnailColors.Columns.objectId == objectId)
+                .fetchOne(db)
+        }
+    }
+
+    func fetchCachedColorObjectIDs() async throws -> Set<String> {
+        try await timedRead("fetchCachedColorObjectIDs()") { db in
             let ids = try String.fetchAll(db, sql: "SELECT object_id FROM thumbnail_colors")
             return Set(ids)
         }
     }
 
+    // MARK: - Event Summary Cache
+
+    func cachedEventSummary(hostUID: String, version: Int) async throws -> String? {
+        let maxAge = eventSummaryMaxAge
+        return try await timedWrite("cachedEventSummary(hostUID:version:)") { db in
+            guard let row = try Row.fetchOne(
+                db,
+                sql: "SELECT content_hash, version, summary, created_at FROM event_summaries WHERE host_uid = ?",
+                arguments: [hostUID]
+            ) else { return nil }
+
+            let savedVersion: Int = row["version"]
+            let createdAt: Date = row["created_at"]
+            let savedHash: String = row["content_hash"]
+            let currentHash = try Self.eventSummaryContentHash(hostUID: hostUID, db: db)
+            guard savedVersion == version,
+                  createdAt > Date().addingTimeInterval(-maxAge),
+                  savedHash == currentHash else {
+                try db.execute(sql: "DELETE FROM event_summaries WHERE host_uid = ?", arguments: [hostUID])
+                return nil
+            }
+            try db.execute(sql: """
+                UPDATE event_summaries SET last_used = (SELECT MAX(last_used) + 1 FROM event_summaries)
+                WHERE host_uid = ?
+                """, arguments: [hostUID])
+            return row["summary"]
+        }
+    }
+
+    func saveEventSummary(_ summary: String, hostUID: String, version: Int) async throws {
+        let limit = eventSummaryCacheLimit
+        let maxAge = eventSummaryMaxAge
+        try await timedWrite("saveEventSummary(_:hostUID:version:)") { db in
+            let now = Date()
+            let contentHash = try Self.eventSummaryContentHash(hostUID: hostUID, db: db)
+            try db.execute(sql: """
+                INSERT OR REPLACE INTO event_summaries (host_uid, content_hash, version, summary, created_at, last_used)
+                VALUES (?, ?, ?, ?, ?, (SELECT IFNULL(MAX(last_used), 0) + 1 FROM event_summaries))
+                """, arguments: [hostUID, contentHash, version, summary, now])
+            try db.execute(sql: "DELETE FROM event_summaries WHERE created_at <= ?", arguments: [now.addingTimeInterval(-maxAge)])
+            try db.execute(sql: """
+                DELETE FROM event_summaries WHERE host_uid NOT IN (
+                    SELECT host_uid FROM event_summaries ORDER BY last_used DESC LIMIT ?
+                )
+                """, arguments: [limit])
+        }
+    }
+
+    /// Digest of the host's content hash and those of the events it hosts or locates, so any
+    /// import or delta touching them changes it
+    private static func eventSummaryContentHash(hostUID: String, db: Database) throws -> String {
+        var parts = try String.fetchAll(
+            db,
+            sql: "SELECT hash FROM object_content_hashes WHERE object_id = ? AND object_type IN (?, ?, ?)",
+            arguments: [hostUID, DataObjectType.art.rawValue, DataObjectType.camp.rawValue, DataObjectType.event.rawValue]
+        )
+        let events = try Row.fetchCursor(db, sql: """
+            SELECT event_objects.uid, object_content_hashes.hash
+            FROM event_objects
+            LEFT JOIN object_content_hashes
+                ON object_content_hashes.object_type = ? AND object_content_hashes.object_id = event_objects.uid
+            WHERE event_objects.hosted_by_camp = ? OR event_objects.located_at_art = ?
+            ORDER BY event_objects.uid
+            """, arguments: [DataObjectType.event.rawValue, hostUID, hostUID])
+        while let row = try events.next() {
+            let uid: String = row[0]
+            let hash: String? = row[1]
+            parts.append("\(uid):\(hash ?? "")")
+        }
+        let digest = SHA256.hash(data: Data(parts.joined(separator: "\n").utf8))
+        return digest.prefix(8).map { String(format: "%02x", $0) }.joined()
+    }
+
     // MARK: - User Map Pins
 
     func saveUserMapPin(_ pin: UserMapPin) async throws {
-        try await dbQueue.write { db in
+        try await timedWrite("saveUserMapPin(_:)") { db in
             var pin = pin
             try pin.save(db, onConflict: .replace)
         }
     }
 
     func deleteUserMapPin(id: String) async throws {
-        _ = try await dbQueue.write { db in
+        _ = try await timedWrite("deleteUserMapPin(id:)") { db in
             try UserMapPin.deleteOne(db, key: id)
         }
     }
 
     func fetchUserMapPins() async throws -> [UserMapPin] {
-        try await dbQueue.read { db in
+        try await timedRead("fetchUserMapPins()") { db in
             try UserMapPin.order(UserMapPin.Columns.createdDate).fetchAll(db)
         }
     }
 
     func observeUserMapPins(onChange: @escaping ([UserMapPin]) -> Void) -> PlayaDBObservationToken {
-        let observation = ValueObservation.tracking { db in
+        let observation = ValueObservation.tracking(instrumentation.observing("observeUserMapPins") { db in
             try UserMapPin.order(UserMapPin.Columns.createdDate).fetchAll(db)
-        }
-        let cancellable = observation.start(
-            in: dbQueue,
-            onError: { error in
-                print("UserMapPin observation error: \(error)")
-            },
-            onChange: { pins in
-                DispatchQueue.main.async {
-                    onChange(pins)
+        })
+        let cancellable = database.observe { queue in
+            observation.start(
+                in: queue,
+                onError: { error in
+                    print("UserMapPin observation error: \(error)")
+                },
+                onChange: { pins in
+                    DispatchQueue.main.async {
+                        onChange(pins)
+                    }
                 }
-            }
-        )
+            )
+        }
         return PlayaDBObservationToken(cancellable)
     }
 
     func observeUpdateInfo(onChange: @escaping ([UpdateInfo]) -> Void, onError: @escaping (Error) -> Void) -> PlayaDBObservationToken {
-        let observation = ValueObservation.tracking { db in
+        let observation = ValueObservation.tracking(instrumentation.observing("observeUpdateInfo") { db in
             try UpdateInfo.fetchAll(db)
-        }
-        let cancellable = observation.start(
-            in: dbQueue,
-            onError: onError,
-            onChange: { infos in
-                DispatchQueue.main.async {
-                    onChange(infos)
+        })
+        let cancellable = database.observe { queue in
+            observation.start(
+                in: queue,
+                onError: onError,
+                onChange: { infos in
+                    DispatchQueue.main.async {
+                        onChange(infos)
+                    }
                 }
-            }
-        )
+            )
+        }
         return PlayaDBObservationToken(cancellable)
     }
 
@@ -1620,7 +2357,7 @@ internal class PlayaDBImpl: PlayaDB {
         let nonEmpty = items.filter { !$0.1.isEmpty }
         guard !nonEmpty.isEmpty else { return }
 
-        try await dbQueue.write { db in
+        try await timedWrite("ensureMetadata(for:)") { db in
             let now = Date()
             for (type, ids) in nonEmpty {
                 let uniqueIds = Set(ids)
@@ -1717,22 +2454,25 @@ internal class PlayaDBImpl: PlayaDB {
 
     func metadata(for object: any DataObject) async throws -> ObjectMetadata {
         try await ensureMetadata(for: object.objectType, ids: [object.uid])
+        guard let metadata = try await existingMetadata(for: object) else {
+            throw PlayaDBError.metadataNotFound
+        }
+        return metadata
+    }
 
-        return try await dbQueue.read { db in
-            guard let metadata = try ObjectMetadata
+    func existingMetadata(for object: any DataObject) async throws -> ObjectMetadata? {
+        try await timedRead("existingMetadata(for:)") { db in
+            try ObjectMetadata
                 .filter(ObjectMetadata.Columns.objectType == object.objectType.rawValue)
                 .filter(ObjectMetadata.Columns.objectId == object.uid)
-                .fetchOne(db) else {
-                throw PlayaDBError.metadataNotFound
-            }
-            return metadata
+                .fetchOne(db)
         }
     }
 
     // MARK: - Metadata Operations
     
     func getFavorites() async throws -> [any DataObject] {
-        return try await dbQueue.read { db in
+        return try await timedRead("getFavorites()") { db in
             let favoriteMetadata = try ObjectMetadata
                 .filter(Column("is_favorite") == true)
                 .fetchAll(db)
@@ -1768,7 +2508,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
     
     func toggleFavorite(_ object: any DataObject) async throws {
-        try await dbQueue.write { db in
+        try await timedWrite("toggleFavorite(_:)") { db in
             let objectType = object.objectType.rawValue
             let objectId = object.uid
 
@@ -1793,7 +2533,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func setFavorite(_ isFavorite: Bool, for object: any DataObject) async throws {
-        try await dbQueue.write { db in
+        try await timedWrite("setFavorite(_:for:)") { db in
             let objectType = object.objectType.rawValue
             let objectId = object.uid
 
@@ -1819,7 +2559,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func isFavorite(_ object: any DataObject) async throws -> Bool {
-        try await dbQueue.read { db in
+        try await timedRead("isFavorite(_:)") { db in
             let objectType = object.objectType.rawValue
             let objectId = object.uid
 
@@ -1835,7 +2575,7 @@ internal class PlayaDBImpl: PlayaDB {
     func setUserNotes(_ notes: String?, for object: any DataObject) async throws {
         try await ensureMetadata(for: object.objectType, ids: [object.uid])
 
-        try await dbQueue.write { db in
+        try await timedWrite("setUserNotes(_:for:)") { db in
             guard var metadata = try ObjectMetadata
                 .filter(ObjectMetadata.Columns.objectType == object.objectType.rawValue)
                 .filter(ObjectMetadata.Columns.objectId == object.uid)
@@ -1851,41 +2591,65 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func setLastViewed(_ date: Date, for object: any DataObject) async throws {
-        // For event occurrences, track the parent event so recently viewed lookups work.
-        // EventObjectOccurrence has a synthesized UID that won't match the EventObject table.
-        let trackingUID: String
-        let trackingType: DataObjectType
-        if let occ = object as? EventObjectOccurrence {
-            trackingUID = occ.event.uid
-            trackingType = .event
-        } else {
-            trackingUID = object.uid
-            trackingType = object.objectType
+        let key = Self.viewTrackingKey(for: object)
+        try await timedWrite("setLastViewed(_:for:)") { db in
+            try Self.applyView(date, to: key, db: db)
         }
+    }
 
-        try await ensureMetadata(for: trackingType, ids: [trackingUID])
-
-        try await dbQueue.write { db in
-            guard var metadata = try ObjectMetadata
-                .filter(ObjectMetadata.Columns.objectType == trackingType.rawValue)
-                .filter(ObjectMetadata.Columns.objectId == trackingUID)
-                .fetchOne(db) else {
-                throw PlayaDBError.metadataNotFound
+    func recordView(_ date: Date, for object: any DataObject) {
+        let key = Self.viewTrackingKey(for: object)
+        guard lastViewedRecorder.record(date, type: key.type, uid: key.uid) else { return }
+        Task { [weak self] in
+            try? await Task.sleep(nanoseconds: UInt64(Self.lastViewedFlushDelay * 1_000_000_000))
+            do {
+                try await self?.flushPendingViews()
+            } catch {
+                print("Failed to flush last-viewed dates: \(error)")
             }
+        }
+    }
 
-            if metadata.firstViewed == nil {
-                metadata.firstViewed = date
+    func flushPendingViews() async throws {
+        let pending = lastViewedRecorder.drain()
+        guard !pending.isEmpty else { return }
+        try await timedWrite("flushPendingViews()") { db in
+            for (key, date) in pending {
+                try Self.applyView(date, to: key, db: db)
             }
-            metadata.lastViewed = date
-            metadata.updatedAt = Date()
-            try metadata.update(db)
         }
     }
-    
+
+    /// For event occurrences, track the parent event so recently viewed lookups work.
+    /// EventObjectOccurrence has a synthesized UID that won't match the EventObject table.
+    private static func viewTrackingKey(for object: any DataObject) -> LastViewedRecorder.Key {
+        if let occ = object as? EventObjectOccurrence {
+            return LastViewedRecorder.Key(type: .event, uid: occ.event.uid)
+        }
+        return LastViewedRecorder.Key(type: object.objectType, uid: object.uid)
+    }
+
+    /// Sets first/last viewed, inserting the metadata row if it doesn't exist yet.
+    private static func applyView(_ date: Date, to key: LastViewedRecorder.Key, db: Database) throws {
+        let now = Date()
+        var metadata = try ObjectMetadata
+            .filter(ObjectMetadata.Columns.objectType == key.type.rawValue)
+            .filter(ObjectMetadata.Columns.objectId == key.uid)
+            .fetchOne(db)
+            ?? ObjectMetadata(objectType: key.type.rawValue, objectId: key.uid, createdAt: now, updatedAt: now)
+
+        if metadata.firstViewed == nil {
+            metadata.firstViewed = date
+        }
+        metadata.lastViewed = date
+        metadata.updatedAt = now
+        try metadata.save(db)
+    }
+
     // MARK: - Recently Viewed & Favorite Events
 
     func fetchRecentlyViewed(limit: Int) async throws -> [any DataObject] {
-        try await dbQueue.read { db in
+        try await timedRead("fetchRecentlyViewed(limit:)") { db in
             let metadataRows = try ObjectMetadata
                 .filter(ObjectMetadata.Columns.lastViewed != nil)
                 .order(ObjectMetadata.Columns.lastViewed.desc)
@@ -1934,7 +2698,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchRecentlyViewedWithDates(limit: Int) async throws -> [(object: any DataObject, firstViewed: Date?, lastViewed: Date)] {
-        try await dbQueue.read { db in
+        try await timedRead("fetchRecentlyViewedWithDates(limit:)") { db in
             let metadataRows = try ObjectMetadata
                 .filter(ObjectMetadata.Columns.lastViewed != nil)
                 .order(ObjectMetadata.Columns.lastViewed.desc)
@@ -1985,7 +2749,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func clearLastViewed(for object: any DataObject) async throws {
-        try await dbQueue.write { db in
+        try await timedWrite("clearLastViewed(for:)") { db in
             guard var metadata = try ObjectMetadata
                 .filter(ObjectMetadata.Columns.objectType == object.objectType.rawValue)
                 .filter(ObjectMetadata.Columns.objectId == object.uid)
@@ -1998,7 +2762,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func clearAllRecentlyViewed() async throws {
-        try await dbQueue.write { db in
+        try await timedWrite("clearAllRecentlyViewed()") { db in
             try db.execute(sql: """
                 UPDATE object_metadata SET last_viewed = NULL, updated_at = ?
                 WHERE last_viewed IS NOT NULL
@@ -2007,7 +2771,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func fetchFavoriteEvents() async throws -> [EventObjectOccurrence] {
-        let events = try await dbQueue.read { db -> [EventObjectOccurrence] in
+        let events = try await timedRead("fetchFavoriteEvents()") { db -> [EventObjectOccurrence] in
             let favoriteMetadata = try ObjectMetadata
                 .filter(ObjectMetadata.Columns.isFavorite == true)
                 .filter(ObjectMetadata.Columns.objectType == DataObjectType.event.rawValue)
@@ -2032,7 +2796,7 @@ internal class PlayaDBImpl: PlayaDB {
 
     func fetchObjects(byUIDs uids: [String]) async throws -> [any DataObject] {
         guard !uids.isEmpty else { return [] }
-        return try await dbQueue.read { db in
+        return try await timedRead("fetchObjects(byUIDs:)") { db in
             let uidSet = Set(uids)
             var objects: [any DataObject] = []
             objects += try ArtObject.filter(uidSet.contains(Column("uid"))).fetchAll(db)
@@ -2054,114 +2818,80 @@ internal class PlayaDBImpl: PlayaDB {
         try await importFromData(artData: artData, campData: campData, eventData: eventData)
     }
     
-    func importFromData(artData: Data, campData: Data, eventData: Data, mvData: Data?) async throws {
+    func importFromData(artData: Data, campData: Data, eventData: Data, mvData: Data?, mode: PlayaDBImportMode) async throws {
         let apiParser = APIParserFactory.create()
+
+        // Parse before taking the write lock
+        let apiArtObjects = try apiParser.parseArt(from: artData)
+        let apiCampObjects = try apiParser.parseCamps(from: campData)
+        let apiEventObjects = try apiParser.parseEvents(from: eventData)
+        let apiMVObjects = try mvData.map { try apiParser.parseMutantVehicles(from: $0) } ?? []
+        // Skip duplicate events in data (keep first occurrence)
+        let uniqueEvents = Self.uniqueEvents(apiEventObjects)
+        let manifest = try DeltaManifest(
+            version: "",
+            art: apiArtObjects,
+            camps: apiCampObjects,
+            events: uniqueEvents,
+            mutantVehicles: apiMVObjects
+        )
+
+        // A data pack ships embeddings precomputed; JSON data is embedded here, but only for
+        // objects whose content changed since the last import or that lack a current vector
+        let local = try await fetchDeltaManifest()
+        let embedded = try await embeddedRevisions()
+        let embeddings = Self.embeddings(
+            art: apiArtObjects,
+            camps: apiCampObjects,
+            events: uniqueEvents,
+            mutantVehicles: apiMVObjects
+        ) { type, uid, revision in
+            embedded[type]?[uid] != revision || manifest.hashes(of: type)[uid] != local.hashes(of: type)[uid]
+        }
+        // Vectors of removed or changed objects; mutant vehicles that aren't replaced keep theirs
+        let staleEmbeddings = embedded
+            .filter { type, _ in type != .mutantVehicle || mvData != nil }
+            .map { type, revisions in
+                let incoming = manifest.hashes(of: type)
+                let current = local.hashes(of: type)
+                return (type, revisions.keys.filter { incoming[$0] == nil || incoming[$0] != current[$0] })
+            }
+
+        try await archiveReplacedYears(
+            incomingYear: apiArtObjects.first?.year ?? apiCampObjects.first?.year ?? apiEventObjects.first?.year
+        )
         
-        try await dbQueue.write { db in
+        try await performImport(mode: mode, replacesMutantVehicles: mvData != nil) { db in
             // Clear update_info first (required for re-imports — primary key conflict otherwise)
             try UpdateInfo.deleteAll(db)
 
             // Step 1: Import art objects first
-            let apiArtObjects = try apiParser.parseArt(from: artData)
-
             // Clear existing art data
             try ArtImage.deleteAll(db)
             try ArtObject.deleteAll(db)
             
             for apiArt in apiArtObjects {
-                var artObject = try self.convertArtObject(from: apiArt)
-                try artObject.insert(db)
-                
-                // Insert art images
-                for apiImage in apiArt.images {
-                    var artImage = ArtImage(
-                        id: nil,
-                        artId: apiArt.uid.value,
-                        thumbnailUrl: apiImage.thumbnailUrl,
-                        galleryRef: apiImage.galleryRef
-                    )
-                    try artImage.insert(db)
-                }
+                try self.insertArt(apiArt, db: db)
             }
             
             // Step 2: Import camp objects
-            let apiCampObjects = try apiParser.parseCamps(from: campData)
-            
             // Clear existing camp data
             try CampImage.deleteAll(db)
             try CampObject.deleteAll(db)
             
             for apiCamp in apiCampObjects {
-                var campObject = try self.convertCampObject(from: apiCamp)
-                try campObject.insert(db)
-                
-                // Insert camp images
-                for apiImage in apiCamp.images {
-                    var campImage = CampImage(
-                        id: nil,
-                        campId: apiCamp.uid.value,
-                        thumbnailUrl: apiImage.thumbnailUrl
-                    )
-                    try campImage.insert(db)
-                }
+                try self.insertCamp(apiCamp, db: db)
             }
             
             // Step 3: Import events with relationship resolution
-            let apiEventObjects = try apiParser.parseEvents(from: eventData)
-            
             // Clear existing event data
             try EventOccurrence.deleteAll(db)
             try EventObject.deleteAll(db)
             
-            // Track unique events to handle duplicates in data
-            var processedEventUIDs = Set<String>()
             var correctedOccurrenceCount = 0
 
-            for apiEvent in apiEventObjects {
-                // Skip duplicate events (keep first occurrence)
-                if processedEventUIDs.contains(apiEvent.uid.value) {
-                    print("Warning: Skipping duplicate event UID: \(apiEvent.uid.value)")
-                    continue
-                }
-                processedEventUIDs.insert(apiEvent.uid.value)
-
-                var eventObject = try self.convertEventObject(from: apiEvent)
-
-                // Resolve camp relationship and copy GPS coordinates
-                if let campId = apiEvent.hostedByCamp?.value {
-                    if let campObject = try CampObject.fetchOne(db, key: campId) {
-                        eventObject.gpsLatitude = campObject.gpsLatitude
-                        eventObject.gpsLongitude = campObject.gpsLongitude
-                    }
-                }
-
-                // Resolve art relationship and copy GPS coordinates
-                if let artId = apiEvent.locatedAtArt?.value {
-                    if let artObject = try ArtObject.fetchOne(db, key: artId) {
-                        eventObject.gpsLatitude = artObject.gpsLatitude
-                        eventObject.gpsLongitude = artObject.gpsLongitude
-                    }
-                }
-
-                try eventObject.insert(db)
-
-                // Insert event occurrences with time correction
-                for apiOccurrence in apiEvent.occurrenceSet {
-                    let corrected = Self.correctedOccurrenceTimes(
-                        startTime: apiOccurrence.startTime,
-                        endTime: apiOccurrence.endTime
-                    )
-                    if corrected.endTime != apiOccurrence.endTime {
-                        correctedOccurrenceCount += 1
-                    }
-                    var eventOccurrence = EventOccurrence(
-                        id: nil,
-                        eventId: apiEvent.uid.value,
-                        startTime: corrected.startTime,
-                        endTime: corrected.endTime
-                    )
-                    try eventOccurrence.insert(db)
-                }
+            for apiEvent in uniqueEvents {
+                correctedOccurrenceCount += try self.insertEvent(apiEvent, db: db)
             }
 
             if correctedOccurrenceCount > 0 {
@@ -2169,136 +2899,790 @@ internal class PlayaDBImpl: PlayaDB {
             }
             
             // Step 3b: Import mutant vehicles (if data provided)
-            var mvCount = 0
-            if let mvData = mvData {
-                let apiMVObjects = try apiParser.parseMutantVehicles(from: mvData)
-                mvCount = apiMVObjects.count
-
+            if mvData != nil {
                 // Clear existing MV data
                 try MutantVehicleTag.deleteAll(db)
                 try MutantVehicleImage.deleteAll(db)
                 try MutantVehicleObject.deleteAll(db)
 
                 for apiMV in apiMVObjects {
-                    var mvObject = self.convertMutantVehicleObject(from: apiMV)
-                    mvObject.tagsText = apiMV.tags.isEmpty ? nil : apiMV.tags.joined(separator: " ")
-                    try mvObject.insert(db)
-
-                    for apiImage in apiMV.images {
-                        var mvImage = MutantVehicleImage(
-                            mvId: apiMV.uid.value,
-                            thumbnailUrl: apiImage.thumbnailUrl
-                        )
-                        try mvImage.insert(db)
-                    }
-
-                    for tagString in apiMV.tags {
-                        var mvTag = MutantVehicleTag(
-                            mvId: apiMV.uid.value,
-                            tag: tagString
-                        )
-                        try mvTag.insert(db)
-                    }
+                    try self.insertMutantVehicle(apiMV, db: db)
                 }
             }
+            let mvCount = apiMVObjects.count
 
-            // Step 4: Rebuild FTS indexes (in case triggers weren't created yet)
-            try db.execute(sql: "INSERT INTO art_objects_fts(art_objects_fts) VALUES('rebuild')")
-            try db.execute(sql: "INSERT INTO camp_objects_fts(camp_objects_fts) VALUES('rebuild')")
-            try db.execute(sql: "INSERT INTO event_objects_fts(event_objects_fts) VALUES('rebuild')")
-            if mvData != nil {
-                try db.execute(sql: "INSERT INTO mv_objects_fts(mv_objects_fts) VALUES('rebuild')")
+            // Step 3c: Update embeddings of new and changed objects; unchanged ones keep theirs
+            for (type, uids) in staleEmbeddings {
+                try Self.deleteEmbeddings(type: type, uids: uids, db: db)
             }
-            
-            // Step 4b: Rebuild spatial index
-            // Clear existing spatial data
-            try db.execute(sql: "DELETE FROM spatial_index")
-            try db.execute(sql: "DELETE FROM spatial_objects")
-            
-            // Re-insert all objects with GPS coordinates
-            let spatialArt = try ArtObject.filter(Column("gps_latitude") != nil).fetchAll(db)
-            for art in spatialArt {
-                if let lat = art.gpsLatitude, let lon = art.gpsLongitude {
-                    try db.execute(sql: "INSERT INTO spatial_objects (object_type, object_uid) VALUES (?, ?)", 
-                                  arguments: ["art", art.uid])
-                    let spatialId = db.lastInsertedRowID
-                    try db.execute(sql: "INSERT INTO spatial_index (id, minLat, maxLat, minLon, maxLon) VALUES (?, ?, ?, ?, ?)",
-                                  arguments: [spatialId, lat, lat, lon, lon])
+            for embedding in embeddings {
+                try self.insertEmbedding(embedding, db: db)
+            }
+
+            // Step 4-5: Rebuild indexes, record hashes and import info
+            try self.finishImport(
+                manifest: manifest,
+                counts: [
+                    .art: apiArtObjects.count,
+                    .camp: apiCampObjects.count,
+                    .event: apiEventObjects.count,
+                    .mutantVehicle: mvCount
+                ],
+                includesMutantVehicles: mvData != nil,
+                db: db
+            )
+        }
+    }
+
+    func importFromDataPack(_ pack: PlayaDataPack, mode: PlayaDBImportMode) async throws {
+        guard let artSection = pack.section(.art),
+              let campSection = pack.section(.camps),
+              let eventSection = pack.section(.events) else {
+            throw PlayaDBError.importError("Data pack is missing art, camp or event data")
+        }
+        let mvSection = pack.section(.mutantVehicles)
+        let embeddingSection = pack.section(.embeddings)
+
+        try await archiveReplacedYears(
+            incomingYear: (artSection.first ?? campSection.first ?? eventSection.first)?.double(at: "year").map { Int($0) }
+        )
+
+        try await performImport(mode: mode, replacesMutantVehicles: mvSection != nil) { db in
+            try UpdateInfo.deleteAll(db)
+            try ArtImage.deleteAll(db)
+            try ArtObject.deleteAll(db)
+            try CampImage.deleteAll(db)
+            try CampObject.deleteAll(db)
+            try EventOccurrence.deleteAll(db)
+            try EventObject.deleteAll(db)
+            if mvSection != nil {
+                try MutantVehicleTag.deleteAll(db)
+                try MutantVehicleImage.deleteAll(db)
+                try MutantVehicleObject.deleteAll(db)
+            }
+
+            // Walk records one at a time; only the current object is decoded
+            var manifest = DeltaManifest(version: "")
+            try artSection.forEach(as: Art.self) { apiArt in
+                try self.insertArt(apiArt, db: db)
+                manifest.art[apiArt.uid.value] = try DeltaManifest.contentHash(apiArt)
+            }
+            try campSection.forEach(as: Camp.self) { apiCamp in
+                try self.insertCamp(apiCamp, db: db)
+                manifest.camps[apiCamp.uid.value] = try DeltaManifest.contentHash(apiCamp)
+            }
+            var correctedOccurrenceCount = 0
+            try eventSection.forEach(as: Event.self) { apiEvent in
+                // Skip duplicate events in data (keep first occurrence)
+                guard manifest.events[apiEvent.uid.value] == nil else {
+                    print("Warning: Skipping duplicate event UID: \(apiEvent.uid.value)")
+                    return
                 }
+                correctedOccurrenceCount += try self.insertEvent(apiEvent, db: db)
+                manifest.events[apiEvent.uid.value] = try DeltaManifest.contentHash(apiEvent)
             }
-            
-            let spatialCamps = try CampObject.filter(Column("gps_latitude") != nil).fetchAll(db)
-            for camp in spatialCamps {
-                if let lat = camp.gpsLatitude, let lon = camp.gpsLongitude {
-                    try db.execute(sql: "INSERT INTO spatial_objects (object_type, object_uid) VALUES (?, ?)", 
-                                  arguments: ["camp", camp.uid])
-                    let spatialId = db.lastInsertedRowID
-                    try db.execute(sql: "INSERT INTO spatial_index (id, minLat, maxLat, minLon, maxLon) VALUES (?, ?, ?, ?, ?)",
-                                  arguments: [spatialId, lat, lat, lon, lon])
+            if correctedOccurrenceCount > 0 {
+                print("PlayaDB: Corrected \(correctedOccurrenceCount) event occurrence times during import")
+            }
+            try mvSection?.forEach(as: MutantVehicle.self) { apiMV in
+                try self.insertMutantVehicle(apiMV, db: db)
+                manifest.mutantVehicles[apiMV.uid.value] = try DeltaManifest.contentHash(apiMV)
+            }
+            if let embeddingSection {
+                try db.execute(sql: "DELETE FROM object_embeddings")
+                try embeddingSection.forEach(as: PlayaEmbedding.self) { embedding in
+                    try self.insertEmbedding(embedding, db: db)
                 }
             }
-            
-            let spatialEvents = try EventObject.filter(Column("gps_latitude") != nil).fetchAll(db)
-            for event in spatialEvents {
-                if let lat = event.gpsLatitude, let lon = event.gpsLongitude {
-                    try db.execute(sql: "INSERT INTO spatial_objects (object_type, object_uid) VALUES (?, ?)", 
-                                  arguments: ["event", event.uid])
-                    let spatialId = db.lastInsertedRowID
-                    try db.execute(sql: "INSERT INTO spatial_index (id, minLat, maxLat, minLon, maxLon) VALUES (?, ?, ?, ?, ?)",
-                                  arguments: [spatialId, lat, lat, lon, lon])
+
+            try self.finishImport(
+                manifest: manifest,
+                counts: [
+                    .art: artSection.count,
+                    .camp: campSection.count,
+                    .event: eventSection.count,
+                    .mutantVehicle: mvSection?.count ?? 0
+                ],
+                includesMutantVehicles: mvSection != nil,
+                db: db
+            )
+        }
+    }
+
+    /// Sentence embeddings, computed on device, of the objects `needsEmbedding` picks given
+    /// the model revision; empty without the model
+    private static func embeddings(
+        art: [Art],
+        camps: [Camp],
+        events: [Event],
+        mutantVehicles: [MutantVehicle],
+        where needsEmbedding: (_ type: DataObjectType, _ uid: String, _ revision: Int) -> Bool = { _, _, _ in true }
+    ) -> [PlayaEmbedding] {
+        #if canImport(NaturalLanguage)
+        guard let embedder = PlayaTextEmbedder() else { return [] }
+        let revision = embedder.revision
+        return embedder.embeddings(
+            art: art.filter { needsEmbedding(.art, $0.uid.value, revision) },
+            camps: camps.filter { needsEmbedding(.camp, $0.uid.value, revision) },
+            events: events.filter { needsEmbedding(.event, $0.uid.value, revision) },
+            mutantVehicles: mutantVehicles.filter { needsEmbedding(.mutantVehicle, $0.uid.value, revision) }
+        )
+        #else
+        return []
+        #endif
+    }
+
+    /// Model revision of each stored embedding, by object type and uid
+    private func embeddedRevisions() async throws -> [DataObjectType: [String: Int]] {
+        try await timedRead("embeddedRevisions()") { db in
+            var revisions: [DataObjectType: [String: Int]] = [:]
+            let rows = try Row.fetchCursor(db, sql: "SELECT object_type, object_id, revision FROM object_embeddings")
+            while let row = try rows.next() {
+                guard let type = DataObjectType(rawValue: row["object_type"]) else { continue }
+                revisions[type, default: [:]][row["object_id"]] = row["revision"]
+            }
+            return revisions
+        }
+    }
+
+    private static func deleteEmbeddings(type: DataObjectType, uids: [String], db: Database) throws {
+        guard !uids.isEmpty else { return }
+        try db.execute(
+            sql: "DELETE FROM object_embeddings WHERE object_type = ? AND object_id IN (\(databaseQuestionMarks(count: uids.count)))",
+            arguments: StatementArguments([type.rawValue] + uids)
+        )
+    }
+
+    private func insertEmbedding(_ embedding: PlayaEmbedding, db: Database) throws {
+        guard let vector = embedding.quantized else { return }
+        try db.execute(
+            sql: "INSERT OR REPLACE INTO object_embeddings (object_type, object_id, revision, vector) VALUES (?, ?, ?, ?)",
+            arguments: [embedding.objectType, embedding.uid, embedding.revision, vector]
+        )
+    }
+
+    /// Runs the write of a full import. In place, `body` runs in one transaction on the live
+    /// database; in shadow mode it runs against a new file that is then swapped in.
+    private func performImport(
+        mode: PlayaDBImportMode,
+        replacesMutantVehicles: Bool,
+        _ body: @escaping @Sendable (Database) throws -> Void
+    ) async throws {
+        guard mode == .shadow, dbPath != ":memory:" else {
+            try await dbQueue.write(body)
+            return
+        }
+        let shadowURL = URL(fileURLWithPath: dbPath + "-shadow")
+        let livePath = dbPath
+        try await Task.detached(priority: .utility) { [self] in
+            let fileManager = FileManager.default
+            // Leftovers from an interrupted import; the live file was never touched
+            try? fileManager.removeItem(at: shadowURL)
+            try? fileManager.removeItem(atPath: shadowURL.path + "-journal")
+            do {
+                var configuration = Configuration()
+                configuration.busyMode = .timeout(5)
+                let shadow = try DatabaseQueue(path: shadowURL.path, configuration: configuration)
+                try setupDatabase(in: shadow)
+                try shadow.writeWithoutTransaction { db in
+                    try Self.copyLiveObjects(from: livePath, includingMutantVehicles: !replacesMutantVehicles, db: db)
+                    try db.inTransaction {
+                        try body(db)
+                        return .commit
+                    }
                 }
+                try shadow.close()
+
+                var shadowYears: Set<Int> = []
+                try database.replace(
+                    with: shadowURL,
+                    migrating: { db in
+                        try Self.copyUserTables(db)
+                        shadowYears = try Self.fetchLiveYears(db, schema: "shadow")
+                    },
+                    didReplace: {
+                        liveYears.set(shadowYears)
+                        archives?.closeReaders()
+                        mapFeatureCache.invalidate(DataObjectType.allCases)
+                        semanticIndex.invalidate()
+                    }
+                )
+            } catch {
+                try? fileManager.removeItem(at: shadowURL)
+                throw error
             }
-            
-            // Step 4d: Rebuild the occurrence spatio-temporal index.
-            try rebuildOccurrenceRTree(db)
+        }.value
+    }
+
+    /// Tables holding user data, copied into a shadow import's new file at swap time
+    static let shadowMigratedTables = ["object_metadata", "thumbnail_colors", "user_map_pins", "event_summaries"]
+
+    /// Copies user data from the live database (`main`) into the shadow file (`shadow`)
+    private static func copyUserTables(_ db: Database) throws {
+        for table in shadowMigratedTables {
+            let columns = try db.columns(in: table, in: "shadow")
+                .map { $0.name.quotedDatabaseIdentifier }
+                .joined(separator: ", ")
+            try db.execute(sql: "INSERT INTO shadow.\(table) (\(columns)) SELECT \(columns) FROM main.\(table)")
+        }
+    }
+
+    /// Imports keep the embeddings of unchanged objects, and imports without mutant vehicle
+    /// data keep the current vehicles; a shadow import has to bring those (with the vehicles'
+    /// content hashes) over from the live file. The import then drops stale embeddings.
+    private static func copyLiveObjects(from livePath: String, includingMutantVehicles: Bool, db: Database) throws {
+        try db.execute(sql: "ATTACH DATABASE ? AS live", arguments: [livePath])
+        defer { try? db.execute(sql: "DETACH DATABASE live") }
+        try db.inTransaction {
+            let tables = ["object_embeddings"] + (includingMutantVehicles ? ["mv_objects", "mv_images", "mv_tags"] : [])
+            for table in tables {
+                let columns = try db.columns(in: table, in: "main")
+                    .map { $0.name.quotedDatabaseIdentifier }
+                    .joined(separator: ", ")
+                try db.execute(sql: "INSERT INTO main.\(table) (\(columns)) SELECT \(columns) FROM live.\(table)")
+            }
+            if includingMutantVehicles {
+                try db.execute(sql: """
+                    INSERT INTO main.object_content_hashes (object_type, object_id, hash)
+                    SELECT object_type, object_id, hash FROM live.object_content_hashes WHERE object_type = ?
+                    """, arguments: [DataObjectType.mutantVehicle.rawValue])
+            }
+            return .commit
+        }
+    }
 
-            // Step 5: Update import info
-            let now = Date()
+    /// Shared tail of a full import: rebuilds the search and spatial indexes, replaces the
+    /// content hashes and writes fresh update info.
+    private func finishImport(
+        manifest: DeltaManifest,
+        counts: [DataObjectType: Int],
+        includesMutantVehicles: Bool,
+        db: Database
+    ) throws {
+        // Step 4: Rebuild FTS indexes (in case triggers weren't created yet)
+        try db.execute(sql: "INSERT INTO art_objects_fts(art_objects_fts) VALUES('rebuild')")
+        try db.execute(sql: "INSERT INTO camp_objects_fts(camp_objects_fts) VALUES('rebuild')")
+        try db.execute(sql: "INSERT INTO event_objects_fts(event_objects_fts) VALUES('rebuild')")
+        if includesMutantVehicles {
+            try db.execute(sql: "INSERT INTO mv_objects_fts(mv_objects_fts) VALUES('rebuild')")
+        }
+        
+        // Step 4b: Rebuild spatial index
+        // Clear existing spatial data
+        try db.execute(sql: "DELETE FROM spatial_index")
+        try db.execute(sql: "DELETE FROM spatial_objects")
+        
+        // Re-insert all objects with GPS coordinates
+        let spatialArt = try ArtObject.filter(Column("gps_latitude") != nil).fetchAll(db)
+        for art in spatialArt {
+            if let lat = art.gpsLatitude, let lon = art.gpsLongitude {
+                try Self.insertSpatialEntry(type: "art", uid: art.uid, latitude: lat, longitude: lon, db: db)
+            }
+        }
+        
+        let spatialCamps = try CampObject.filter(Column("gps_latitude") != nil).fetchAll(db)
+        for camp in spatialCamps {
+            if let lat = camp.gpsLatitude, let lon = camp.gpsLongitude {
+                try Self.insertSpatialEntry(type: "camp", uid: camp.uid, latitude: lat, longitude: lon, db: db)
+            }
+        }
+        
+        let spatialEvents = try EventObject.filter(Column("gps_latitude") != nil).fetchAll(db)
+        for event in spatialEvents {
+            if let lat = event.gpsLatitude, let lon = event.gpsLongitude {
+                try Self.insertSpatialEntry(type: "event", uid: event.uid, latitude: lat, longitude: lon, db: db)
+            }
+        }
+        
+        // Step 4d: Rebuild the occurrence spatio-temporal index.
+        try rebuildOccurrenceRTree(db)
+
+        // Step 4e: Record content hashes so later updates can be fetched as deltas
+        try db.execute(sql: "DELETE FROM object_content_hashes WHERE object_type IN (?, ?, ?)",
+                       arguments: [DataObjectType.art.rawValue, DataObjectType.camp.rawValue, DataObjectType.event.rawValue])
+        if includesMutantVehicles {
+            try db.execute(sql: "DELETE FROM object_content_hashes WHERE object_type = ?",
+                           arguments: [DataObjectType.mutantVehicle.rawValue])
+        }
+        try Self.saveContentHashes(manifest, db: db)
+
+        // Step 5: Update import info
+        let now = Date()
+
+        var artUpdateInfo = UpdateInfo(
+            dataType: DataObjectType.art.rawValue,
+            lastUpdated: now,
+            totalCount: counts[.art] ?? 0,
+            createdAt: now,
+            fetchStatus: "complete",
+            fetchDate: now,
+            ingestionDate: now
+        )
+        try artUpdateInfo.insert(db)
+
+        var campUpdateInfo = UpdateInfo(
+            dataType: DataObjectType.camp.rawValue,
+            lastUpdated: now,
+            totalCount: counts[.camp] ?? 0,
+            createdAt: now,
+            fetchStatus: "complete",
+            fetchDate: now,
+            ingestionDate: now
+        )
+        try campUpdateInfo.insert(db)
+
+        var eventUpdateInfo = UpdateInfo(
+            dataType: DataObjectType.event.rawValue,
+            lastUpdated: now,
+            totalCount: counts[.event] ?? 0,
+            createdAt: now,
+            fetchStatus: "complete",
+            fetchDate: now,
+            ingestionDate: now
+        )
+        try eventUpdateInfo.insert(db)
 
-            var artUpdateInfo = UpdateInfo(
-                dataType: DataObjectType.art.rawValue,
+        if includesMutantVehicles {
+            var mvUpdateInfo = UpdateInfo(
+                dataType: DataObjectType.mutantVehicle.rawValue,
                 lastUpdated: now,
-                totalCount: apiArtObjects.count,
+                totalCount: counts[.mutantVehicle] ?? 0,
                 createdAt: now,
                 fetchStatus: "complete",
                 fetchDate: now,
                 ingestionDate: now
             )
-            try artUpdateInfo.insert(db)
+            try mvUpdateInfo.insert(db)
+        }
+    }
 
-            var campUpdateInfo = UpdateInfo(
-                dataType: DataObjectType.camp.rawValue,
-                lastUpdated: now,
-                totalCount: apiCampObjects.count,
-                createdAt: now,
-                fetchStatus: "complete",
-                fetchDate: now,
-                ingestionDate: now
+    // MARK: - Delta Updates
+
+    func fetchDeltaManifest() async throws -> DeltaManifest {
+        try await timedRead("fetchDeltaManifest()") { db in
+            var hashes: [String: [String: String]] = [:]
+            let rows = try Row.fetchCursor(db, sql: "SELECT object_type, object_id, hash FROM object_content_hashes")
+            while let row = try rows.next() {
+                let type: String = row["object_type"]
+                let uid: String = row["object_id"]
+                hashes[type, default: [:]][uid] = row["hash"]
+            }
+            let version = try String.fetchOne(db, sql: """
+                SELECT version FROM update_info WHERE version IS NOT NULL ORDER BY last_updated DESC LIMIT 1
+                """) ?? ""
+            return DeltaManifest(
+                version: version,
+                art: hashes[DataObjectType.art.rawValue] ?? [:],
+                camps: hashes[DataObjectType.camp.rawValue] ?? [:],
+                events: hashes[DataObjectType.event.rawValue] ?? [:],
+                mutantVehicles: hashes[DataObjectType.mutantVehicle.rawValue] ?? [:]
             )
-            try campUpdateInfo.insert(db)
+        }
+    }
 
-            var eventUpdateInfo = UpdateInfo(
-                dataType: DataObjectType.event.rawValue,
-                lastUpdated: now,
-                totalCount: apiEventObjects.count,
-                createdAt: now,
-                fetchStatus: "complete",
-                fetchDate: now,
-                ingestionDate: now
+    func applyDeltaPatch(_ patch: DeltaPatch) async throws {
+        guard !patch.isEmpty else { return }
+        let events = Self.uniqueEvents(patch.events)
+        let hashes = try DeltaManifest(
+            version: patch.version,
+            art: patch.art,
+            camps: patch.camps,
+            events: events,
+            mutantVehicles: patch.mutantVehicles
+        )
+        // Every object in a patch changed, so all of them are re-embedded
+        let embeddings = Self.embeddings(
+            art: patch.art,
+            camps: patch.camps,
+            events: events,
+            mutantVehicles: patch.mutantVehicles
+        )
+
+        try await timedWrite("applyDeltaPatch(_:)") { db in
+            // Remove old rows for changed and deleted objects. Delete triggers keep the
+            // FTS, spatial and occurrence indexes in sync; metadata (favorites, notes) is
+            // keyed separately and survives.
+            let artUIDs = patch.art.map(\.uid.value) + patch.deleted.art
+            if !artUIDs.isEmpty {
+                try ArtImage.filter(artUIDs.contains(Column("art_id"))).deleteAll(db)
+                try ArtObject.filter(keys: artUIDs).deleteAll(db)
+            }
+            let campUIDs = patch.camps.map(\.uid.value) + patch.deleted.camps
+            if !campUIDs.isEmpty {
+                try CampImage.filter(campUIDs.contains(Column("camp_id"))).deleteAll(db)
+                try CampObject.filter(keys: campUIDs).deleteAll(db)
+            }
+            let eventUIDs = events.map(\.uid.value) + patch.deleted.events
+            if !eventUIDs.isEmpty {
+                try EventOccurrence.filter(eventUIDs.contains(Column("event_id"))).deleteAll(db)
+                try EventObject.filter(keys: eventUIDs).deleteAll(db)
+            }
+            let mvUIDs = patch.mutantVehicles.map(\.uid.value) + patch.deleted.mutantVehicles
+            if !mvUIDs.isEmpty {
+                try MutantVehicleTag.filter(mvUIDs.contains(Column("mv_id"))).deleteAll(db)
+                try MutantVehicleImage.filter(mvUIDs.contains(Column("mv_id"))).deleteAll(db)
+                try MutantVehicleObject.filter(keys: mvUIDs).deleteAll(db)
+            }
+
+            // Insert in dependency order so events can copy their host's location
+            for apiArt in patch.art {
+                try self.insertArt(apiArt, db: db)
+            }
+            for apiCamp in patch.camps {
+                try self.insertCamp(apiCamp, db: db)
+            }
+            for apiEvent in events {
+                _ = try self.insertEvent(apiEvent, db: db)
+            }
+            for apiMV in patch.mutantVehicles {
+                try self.insertMutantVehicle(apiMV, db: db)
+            }
+
+            // Unchanged events whose host moved or was removed carry a stale location
+            try self.refreshEventLocations(
+                hostCampUIDs: campUIDs,
+                hostArtUIDs: artUIDs,
+                excluding: Set(events.map(\.uid.value)),
+                db: db
             )
-            try eventUpdateInfo.insert(db)
 
-            if mvData != nil {
-                var mvUpdateInfo = UpdateInfo(
-                    dataType: DataObjectType.mutantVehicle.rawValue,
-                    lastUpdated: now,
-                    totalCount: mvCount,
-                    createdAt: now,
-                    fetchStatus: "complete",
-                    fetchDate: now,
-                    ingestionDate: now
+            // Update content hashes
+            try Self.saveContentHashes(hashes, db: db)
+            let deletions: [(DataObjectType, [String])] = [
+                (.art, patch.deleted.art),
+                (.camp, patch.deleted.camps),
+                (.event, patch.deleted.events),
+                (.mutantVehicle, patch.deleted.mutantVehicles)
+            ]
+            for (type, uids) in deletions where !uids.isEmpty {
+                try db.execute(
+                    sql: "DELETE FROM object_content_hashes WHERE object_type = ? AND object_id IN (\(databaseQuestionMarks(count: uids.count)))",
+                    arguments: StatementArguments([type.rawValue] + uids)
                 )
-                try mvUpdateInfo.insert(db)
+            }
+
+            // Replace embeddings of changed objects and drop those of deleted ones
+            try Self.deleteEmbeddings(type: .art, uids: artUIDs, db: db)
+            try Self.deleteEmbeddings(type: .camp, uids: campUIDs, db: db)
+            try Self.deleteEmbeddings(type: .event, uids: eventUIDs, db: db)
+            try Self.deleteEmbeddings(type: .mutantVehicle, uids: mvUIDs, db: db)
+            for embedding in embeddings {
+                try self.insertEmbedding(embedding, db: db)
+            }
+
+            // Update import info for the touched types
+            let now = Date()
+            let touched: [(DataObjectType, String, Bool)] = [
+                (.art, "art_objects", !artUIDs.isEmpty),
+                (.camp, "camp_objects", !campUIDs.isEmpty),
+                (.event, "event_objects", !eventUIDs.isEmpty),
+                (.mutantVehicle, "mv_objects", !mvUIDs.isEmpty)
+            ]
+            for (type, table, changed) in touched where changed {
+                try db.execute(sql: """
+                    UPDATE update_info
+                    SET last_updated = ?, ingestion_date = ?, version = ?,
+                        total_count = (SELECT COUNT(*) FROM \(table))
+                    WHERE data_type = ?
+                    """, arguments: [now, now, patch.version, type.rawValue])
+            }
+        }
+    }
+
+    /// Re-copies host GPS onto events hosted by the given camps or art, skipping events that
+    /// were just reinserted. There are no update triggers on the spatial tables, so moved
+    /// events are re-indexed here.
+    private func refreshEventLocations(
+        hostCampUIDs: [String],
+        hostArtUIDs: [String],
+        excluding excluded: Set<String>,
+        db: Database
+    ) throws {
+        guard !hostCampUIDs.isEmpty || !hostArtUIDs.isEmpty else { return }
+        let affected = try EventObject
+            .filter(hostCampUIDs.contains(Column("hosted_by_camp")) || hostArtUIDs.contains(Column("located_at_art")))
+            .fetchAll(db)
+            .filter { !excluded.contains($0.uid) }
+
+        var moved = false
+        for var event in affected {
+            var latitude: Double?
+            var longitude: Double?
+            if let campId = event.hostedByCamp, let camp = try CampObject.fetchOne(db, key: campId) {
+                latitude = camp.gpsLatitude
+                longitude = camp.gpsLongitude
+            }
+            if let artId = event.locatedAtArt, let art = try ArtObject.fetchOne(db, key: artId) {
+                latitude = art.gpsLatitude
+                longitude = art.gpsLongitude
+            }
+            guard latitude != event.gpsLatitude || longitude != event.gpsLongitude else { continue }
+
+            event.gpsLatitude = latitude
+            event.gpsLongitude = longitude
+            try event.update(db)
+            try db.execute(sql: """
+                DELETE FROM spatial_index WHERE id = (
+                    SELECT spatial_id FROM spatial_objects WHERE object_type = 'event' AND object_uid = ?
+                )
+                """, arguments: [event.uid])
+            try db.execute(sql: "DELETE FROM spatial_objects WHERE object_type = 'event' AND object_uid = ?",
+                           arguments: [event.uid])
+            if let latitude, let longitude {
+                try Self.insertSpatialEntry(type: "event", uid: event.uid, latitude: latitude, longitude: longitude, db: db)
+            }
+            moved = true
+        }
+        if moved {
+            try rebuildOccurrenceRTree(db)
+        }
+    }
+
+    // MARK: - Year Archives
+
+    func archivedYears() -> [Int] {
+        archives?.archivedYears() ?? []
+    }
+
+    func archiveYear(_ year: Int, compressed: Bool) async throws {
+        guard let archives else {
+            throw PlayaDBError.databaseError("Year archives need a file-backed database")
+        }
+        let live = dbQueue
+        try await Task.detached(priority: .utility) {
+            try archives.archive(year: year, from: live, compressed: compressed)
+        }.value
+    }
+
+    /// Connection serving `year`: its archive if one exists and the year is no longer in the
+    /// live database, otherwise the live database. A year still live keeps reading there even
+    /// if it was archived, since data updates only land in the live database.
+    internal func reader(forYear year: Int?) throws -> DatabaseQueue {
+        guard let year, let archives, !liveYears.contains(year), archives.hasArchive(year: year),
+              let archive = try archives.reader(for: year) else {
+            return dbQueue
+        }
+        return archive
+    }
+
+    /// Years with rows in the content tables of `schema`
+    private static func fetchLiveYears(_ db: Database, schema: String = "main") throws -> Set<Int> {
+        try Set(Int.fetchAll(db, sql: """
+            SELECT year FROM \(schema).art_objects UNION SELECT year FROM \(schema).camp_objects
+            UNION SELECT year FROM \(schema).event_objects UNION SELECT year FROM \(schema).mv_objects
+            """))
+    }
+
+    /// Before a full import replaces the content tables, archives any other year still in
+    /// them so it stays browsable. An existing archive is rewritten when the live data was
+    /// updated after it was taken.
+    private func archiveReplacedYears(incomingYear: Int?) async throws {
+        guard let archives, let incomingYear else { return }
+        let lastUpdated = try await dbQueue.read { db in
+            try Date.fetchOne(db, sql: "SELECT MAX(last_updated) FROM update_info")
+        }
+        for year in liveYears.value.sorted() where year != incomingYear {
+            if let archived = archives.archiveDate(year: year), lastUpdated.map({ archived >= $0 }) ?? true {
+                continue
+            }
+            print("PlayaDB: Archiving \(year) before importing \(incomingYear)")
+            try await archiveYear(year, compressed: false)
+        }
+    }
+
+    // MARK: - Instrumentation
+
+    var isInstrumentationEnabled: Bool {
+        instrumentation.isEnabled
+    }
+
+    func setInstrumentationEnabled(_ enabled: Bool) {
+        instrumentation.isEnabled = enabled
+    }
+
+    func instrumentationStats() -> PlayaDBStats {
+        instrumentation.snapshot()
+    }
+
+    func resetInstrumentationStats() {
+        instrumentation.reset()
+    }
+
+    /// `read` on `reader` (the current database by default), recorded under `name`
+    /// while instrumentation is enabled
+    private func timedRead<T>(
+        _ name: StaticString,
+        from reader: DatabaseQueue? = nil,
+        _ body: @escaping @Sendable (Database) throws -> T
+    ) async throws -> T {
+        let reader = reader ?? dbQueue
+        guard instrumentation.isEnabled else {
+            return try await reader.read(body)
+        }
+        let instrumentation = instrumentation
+        let requestedAt = QueryInstrumentation.now()
+        return try await reader.read { db in
+            try instrumentation.measure(name, kind: .query, requestedAt: requestedAt) {
+                try body(db)
+            }
+        }
+    }
+
+    /// `write` on the current database, recorded under `name` with the rows it changed
+    /// while instrumentation is enabled. Queue wait is the time spent behind other writes
+    /// and reads, e.g. an in-place import.
+    private func timedWrite<T>(
+        _ name: StaticString,
+        _ body: @escaping @Sendable (Database) throws -> T
+    ) async throws -> T {
+        guard instrumentation.isEnabled else {
+            return try await dbQueue.write(body)
+        }
+        let instrumentation = instrumentation
+        let requestedAt = QueryInstrumentation.now()
+        return try await dbQueue.write { db in
+            let changesBefore = db.totalChangesCount
+            return try instrumentation.measure(
+                name,
+                kind: .write,
+                requestedAt: requestedAt,
+                rows: { _ in db.totalChangesCount - changesBefore }
+            ) {
+                try body(db)
+            }
+        }
+    }
+
+    // MARK: - Import Helpers
+
+    private func insertArt(_ apiArt: Art, db: Database) throws {
+        var artObject = try convertArtObject(from: apiArt)
+        try artObject.insert(db)
+
+        for apiImage in apiArt.images {
+            var artImage = ArtImage(
+                id: nil,
+                artId: apiArt.uid.value,
+                thumbnailUrl: apiImage.thumbnailUrl,
+                galleryRef: apiImage.galleryRef
+            )
+            try artImage.insert(db)
+        }
+    }
+
+    private func insertCamp(_ apiCamp: Camp, db: Database) throws {
+        var campObject = try convertCampObject(from: apiCamp)
+        try campObject.insert(db)
+
+        for apiImage in apiCamp.images {
+            var campImage = CampImage(
+                id: nil,
+                campId: apiCamp.uid.value,
+                thumbnailUrl: apiImage.thumbnailUrl
+            )
+            try campImage.insert(db)
+        }
+    }
+
+    /// Inserts an event and its occurrences, copying GPS from its host camp (or art, which
+    /// wins). Hosts must already be inserted. Returns the number of corrected occurrence times.
+    private func insertEvent(_ apiEvent: Event, db: Database) throws -> Int {
+        var eventObject = try convertEventObject(from: apiEvent)
+
+        // Resolve camp relationship and copy GPS coordinates
+        if let campId = apiEvent.hostedByCamp?.value {
+            if let campObject = try CampObject.fetchOne(db, key: campId) {
+                eventObject.gpsLatitude = campObject.gpsLatitude
+                eventObject.gpsLongitude = campObject.gpsLongitude
+            }
+        }
+
+        // Resolve art relationship and copy GPS coordinates
+        if let artId = apiEvent.locatedAtArt?.value {
+            if let artObject = try ArtObject.fetchOne(db, key: artId) {
+                eventObject.gpsLatitude = artObject.gpsLatitude
+                eventObject.gpsLongitude = artObject.gpsLongitude
+            }
+        }
+
+        try eventObject.insert(db)
+
+        // Insert event occurrences with time correction
+        var correctedCount = 0
+        for apiOccurrence in apiEvent.occurrenceSet {
+            let corrected = Self.correctedOccurrenceTimes(
+                startTime: apiOccurrence.startTime,
+                endTime: apiOccurrence.endTime
+            )
+            if corrected.endTime != apiOccurrence.endTime {
+                correctedCount += 1
+            }
+            var eventOccurrence = EventOccurrence(
+                id: nil,
+                eventId: apiEvent.uid.value,
+                startTime: corrected.startTime,
+                endTime: corrected.endTime
+            )
+            try eventOccurrence.insert(db)
+        }
+        return correctedCount
+    }
+
+    private func insertMutantVehicle(_ apiMV: MutantVehicle, db: Database) throws {
+        var mvObject = convertMutantVehicleObject(from: apiMV)
+        mvObject.tagsText = apiMV.tags.isEmpty ? nil : apiMV.tags.joined(separator: " ")
+        try mvObject.insert(db)
+
+        for apiImage in apiMV.images {
+            var mvImage = MutantVehicleImage(
+                mvId: apiMV.uid.value,
+                thumbnailUrl: apiImage.thumbnailUrl
+            )
+            try mvImage.insert(db)
+        }
+
+        for tagString in apiMV.tags {
+            var mvTag = MutantVehicleTag(
+                mvId: apiMV.uid.value,
+                tag: tagString
+            )
+            try mvTag.insert(db)
+        }
+    }
+
+    /// Events with duplicate UIDs in the source data, keeping the first
+    private static func uniqueEvents(_ events: [Event]) -> [Event] {
+        var seen = Set<String>()
+        return events.filter { event in
+            guard seen.insert(event.uid.value).inserted else {
+                print("Warning: Skipping duplicate event UID: \(event.uid.value)")
+                return false
+            }
+            return true
+        }
+    }
+
+    private static func insertSpatialEntry(type: String, uid: String, latitude: Double, longitude: Double, db: Database) throws {
+        try db.execute(sql: "INSERT INTO spatial_objects (object_type, object_uid) VALUES (?, ?)",
+                       arguments: [type, uid])
+        let spatialId = db.lastInsertedRowID
+        try db.execute(sql: "INSERT INTO spatial_index (id, minLat, maxLat, minLon, maxLon) VALUES (?, ?, ?, ?, ?)",
+                       arguments: [spatialId, latitude, latitude, longitude, longitude])
+    }
+
+    private static func saveContentHashes(_ manifest: DeltaManifest, db: Database) throws {
+        let groups: [(DataObjectType, [String: String])] = [
+            (.art, manifest.art),
+            (.camp, manifest.camps),
+            (.event, manifest.events),
+            (.mutantVehicle, manifest.mutantVehicles)
+        ]
+        let statement = try db.cachedStatement(sql: """
+            INSERT OR REPLACE INTO object_content_hashes (object_type, object_id, hash) VALUES (?, ?, ?)
+            """)
+        for (type, hashes) in groups {
+            for (uid, hash) in hashes {
+                try statement.execute(arguments: [type.rawValue, uid, hash])
             }
         }
     }
@@ -2445,7 +3829,7 @@ internal class PlayaDBImpl: PlayaDB {
     }
 
     func getUpdateInfo() async throws -> [UpdateInfo] {
-        return try await dbQueue.read { db in
+        return try await timedRead("getUpdateInfo()") { db in
             try UpdateInfo.fetchAll(db)
         }
     }
@@ -2482,100 +3866,110 @@ internal class PlayaDBImpl: PlayaDB {
     
     private func setupObservations() {
         // Observe art objects
-        let artObservation = ValueObservation.tracking { db in
+        let artObservation = ValueObservation.tracking(instrumentation.observing("allArt") { db in
             try ArtObject.fetchAll(db)
-        }
-        let artCancellable = artObservation.start(
-            in: dbQueue,
-            onError: { error in
-                print("Error observing art objects: \(error)")
-            },
-            onChange: { [weak self] artObjects in
-                if !artObjects.isEmpty {
-                    Task {
-                        try? await self?.ensureMetadata(for: .art, ids: artObjects.map(\.uid))
+        })
+        let artCancellable = database.observe { [weak self] queue in
+            artObservation.start(
+                in: queue,
+                onError: { error in
+                    print("Error observing art objects: \(error)")
+                },
+                onChange: { [weak self] artObjects in
+                    if !artObjects.isEmpty {
+                        Task {
+                            try? await self?.ensureMetadata(for: .art, ids: artObjects.map(\.uid))
+                        }
                     }
+                    self?._allArt = artObjects
                 }
-                self?._allArt = artObjects
-            }
-        )
+            )
+        }
         
         // Observe camp objects
-        let campObservation = ValueObservation.tracking { db in
+        let campObservation = ValueObservation.tracking(instrumentation.observing("allCamps") { db in
             try CampObject.fetchAll(db)
-        }
-        let campCancellable = campObservation.start(
-            in: dbQueue,
-            onError: { error in
-                print("Error observing camp objects: \(error)")
-            },
-            onChange: { [weak self] campObjects in
-                if !campObjects.isEmpty {
-                    Task {
-                        try? await self?.ensureMetadata(for: .camp, ids: campObjects.map(\.uid))
+        })
+        let campCancellable = database.observe { [weak self] queue in
+            campObservation.start(
+                in: queue,
+                onError: { error in
+                    print("Error observing camp objects: \(error)")
+                },
+                onChange: { [weak self] campObjects in
+                    if !campObjects.isEmpty {
+                        Task {
+                            try? await self?.ensureMetadata(for: .camp, ids: campObjects.map(\.uid))
+                        }
                     }
+                    self?._allCamps = campObjects
                 }
-                self?._allCamps = campObjects
-            }
-        )
+            )
+        }
         
         // Observe event objects with occurrences.
         // Explicit regions: only re-fire on event table changes, not camp/art
         // (the fetch closure JOINs camp/art for host data but those shouldn't trigger re-evaluation).
         let eventObservation = ValueObservation.tracking(
             regions: [EventObject.all(), EventOccurrence.all()],
-            fetch: { [self] db in
+            fetch: instrumentation.observing("allEvents") { [self] db in
                 let events = try EventObject.fetchAll(db)
                 return try eventObjectOccurrences(for: events, db: db)
             }
         )
-        let eventCancellable = eventObservation.start(
-            in: dbQueue,
-            onError: { error in
-                print("Error observing events: \(error)")
-            },
-            onChange: { [weak self] eventObjectOccurrences in
-                if !eventObjectOccurrences.isEmpty {
-                    Task {
-                        try? await self?.ensureMetadata(for: .event, ids: eventObjectOccurrences.map { $0.event.uid })
+        let eventCancellable = database.observe { [weak self] queue in
+            eventObservation.start(
+                in: queue,
+                onError: { error in
+                    print("Error observing events: \(error)")
+                },
+                onChange: { [weak self] eventObjectOccurrences in
+                    if !eventObjectOccurrences.isEmpty {
+                        Task {
+                            try? await self?.ensureMetadata(for: .event, ids: eventObjectOccurrences.map { $0.event.uid })
+                        }
                     }
+                    self?._allEvents = eventObjectOccurrences
                 }
-                self?._allEvents = eventObjectOccurrences
-            }
-        )
+            )
+        }
         
         // Observe mutant vehicle objects
-        let mvObservation = ValueObservation.tracking { db in
+        let mvObservation = ValueObservation.tracking(instrumentation.observing("allMutantVehicles") { db in
             try MutantVehicleObject.fetchAll(db)
-        }
-        let mvCancellable = mvObservation.start(
-            in: dbQueue,
-            onError: { error in
-                print("Error observing mutant vehicles: \(error)")
-            },
-            onChange: { [weak self] mvObjects in
-                if !mvObjects.isEmpty {
-                    Task {
-                        try? await self?.ensureMetadata(for: .mutantVehicle, ids: mvObjects.map(\.uid))
+        })
+        let mvCancellable = database.observe { [weak self] queue in
+            mvObservation.start(
+                in: queue,
+                onError: { error in
+                    print("Error observing mutant vehicles: \(error)")
+                },
+                onChange: { [weak self] mvObjects in
+                    if !mvObjects.isEmpty {
+                        Task {
+                            try? await self?.ensureMetadata(for: .mutantVehicle, ids: mvObjects.map(\.uid))
+                        }
                     }
+                    self?._allMutantVehicles = mvObjects
                 }
-                self?._allMutantVehicles = mvObjects
-            }
-        )
+            )
+        }
 
         // Observe favorites
-        let favoritesObservation = ValueObservation.tracking { db in
+        let favoritesObservation = ValueObservation.tracking(instrumentation.observing("favorites") { db in
             try ObjectMetadata.filter(Column("is_favorite") == true).fetchAll(db)
+        })
+        let favoritesCancellable = database.observe { [weak self] queue in
+            favoritesObservation.start(
+                in: queue,
+                onError: { error in
+                    print("Error observing favorites: \(error)")
+                },
+                onChange: { [weak self] favoriteMetadata in
+                    self?._favorites = favoriteMetadata
+                }
+            )
         }
-        let favoritesCancellable = favoritesObservation.start(
-            in: dbQueue,
-            onError: { error in
-                print("Error observing favorites: \(error)")
-            },
-            onChange: { [weak self] favoriteMetadata in
-                self?._favorites = favoriteMetadata
-            }
-        )
         
         // Store cancellables
         observations = [
@@ -2588,6 +3982,62 @@ internal class PlayaDBImpl: PlayaDB {
     }
 }
 
+/// Years in the live database, read from any thread
+private final class LiveYears: @unchecked Sendable {
+    private let lock = NSLock()
+    private var years: Set<Int> = []
+
+    var value: Set<Int> {
+        lock.lock()
+        defer { lock.unlock() }
+        return years
+    }
+
+    func contains(_ year: Int) -> Bool {
+        value.contains(year)
+    }
+
+    func set(_ years: Set<Int>) {
+        lock.lock()
+        defer { lock.unlock() }
+        self.years = years
+    }
+}
+
+/// Counter used to drop stale asynchronous observation results
+private final class ObservationGeneration: @unchecked Sendable {
+    private let lock = NSLock()
+    private var current = 0
+
+    var value: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return current
+    }
+
+    @discardableResult
+    func increment() -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        current += 1
+        return current
+    }
+}
+
+// MARK: - Content Hashes
+
+private extension DeltaManifest {
+    /// Content hashes of one object type, by uid
+    func hashes(of type: DataObjectType) -> [String: String] {
+        switch type {
+        case .art: return art
+        case .camp: return camps
+        case .event: return events
+        case .mutantVehicle: return mutantVehicles
+        }
+    }
+}
+
 // MARK: - Error Types
 
 enum PlayaDBError: Error {
@@ -7,9 +7,9 @@ import MapKit
 extension QueryInterfaceRequest where RowDecoder: DataObjectColumnProviding {
     private static var columns: RowDecoder.ColumnSet.Type { RowDecoder.columnSet }
 
-    /// Order by name
+    /// Order by name, ties broken by uid
     public func orderedByName() -> Self {
-        order(Self.columns.name.asc)
+        order(Self.columns.name.asc, Self.columns.uid.asc)
     }
 
     /// Filter by year
@@ -117,7 +117,7 @@ extension QueryInterfaceRequest where RowDecoder == EventOccurrence {
 
     /// Order by start time.
     public func orderedByStartTime() -> Self {
-        order(EventOccurrence.Columns.startTime.asc)
+        order(EventOccurrence.Columns.startTime.asc, EventOccurrence.Columns.id.asc)
     }
 }
 
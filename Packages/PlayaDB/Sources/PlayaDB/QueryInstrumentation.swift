@@ -0,0 +1,177 @@
+import Foundation
+import GRDB
+import os
+
+/// Timing recorded for one named PlayaDB operation while instrumentation is enabled
+public struct PlayaDBOperationStats: Sendable, Hashable {
+    public enum Kind: String, Sendable {
+        /// A one-shot fetch
+        case query
+        /// One evaluation of an observation, counted each time it re-fires
+        case observation
+        /// A write transaction
+        case write
+    }
+
+    public let name: String
+    public let kind: Kind
+    /// Calls, or re-fires for observations
+    public let count: Int
+    public let totalDuration: TimeInterval
+    public let maxDuration: TimeInterval
+    /// Rows returned, or rows changed for writes
+    public let rows: Int
+    /// Time spent waiting for the database queue, e.g. behind an import's write lock
+    public let totalWait: TimeInterval
+    public let maxWait: TimeInterval
+
+    public var averageDuration: TimeInterval {
+        count > 0 ? totalDuration / Double(count) : 0
+    }
+}
+
+/// Snapshot of everything recorded since instrumentation was enabled or last reset
+public struct PlayaDBStats: Sendable {
+    /// Operations by total time spent, most expensive first
+    public let operations: [PlayaDBOperationStats]
+    public let since: Date
+
+    public static let empty = PlayaDBStats(operations: [], since: Date())
+}
+
+/// Opt-in latency, row-count and queue-wait recording for PlayaDB, with an `os_signpost`
+/// interval per operation under the `com.iburnapp.PlayaDB` subsystem.
+///
+/// Disabled by default. When disabled, `measure` is a lock-protected flag check followed by
+/// the body, so instrumented call sites cost nothing measurable.
+final class QueryInstrumentation: @unchecked Sendable {
+    private struct Key: Hashable {
+        let name: String
+        let kind: PlayaDBOperationStats.Kind
+    }
+
+    private struct Entry {
+        var count = 0
+        var totalDuration: UInt64 = 0
+        var maxDuration: UInt64 = 0
+        var rows = 0
+        var totalWait: UInt64 = 0
+        var maxWait: UInt64 = 0
+    }
+
+    private let signposter = OSSignposter(subsystem: "com.iburnapp.PlayaDB", category: "Queries")
+    private let lock = NSLock()
+    private var enabled = false
+    private var entries: [Key: Entry] = [:]
+    private var since = Date()
+
+    var isEnabled: Bool {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return enabled
+        }
+        set {
+            lock.lock()
+            if newValue && !enabled {
+                entries = [:]
+                since = Date()
+            }
+            enabled = newValue
+            lock.unlock()
+        }
+    }
+
+    /// Uptime in nanoseconds, for `requestedAt`
+    static func now() -> UInt64 {
+        DispatchTime.now().uptimeNanoseconds
+    }
+
+    /// Runs `body`, recording its duration and row count under `name`.
+    /// - Parameters:
+    ///   - requestedAt: When the caller asked for the database, so the time spent queued
+    ///     behind other work is recorded as wait.
+    ///   - rows: Row count of the result; defaults to the count of collection results.
+    func measure<T>(
+        _ name: StaticString,
+        kind: PlayaDBOperationStats.Kind,
+        requestedAt: UInt64? = nil,
+        rows: ((T) -> Int)? = nil,
+        _ body: () throws -> T
+    ) rethrows -> T {
+        guard isEnabled else { return try body() }
+
+        let start = Self.now()
+        let state = signposter.beginInterval(name, id: signposter.makeSignpostID())
+        defer { signposter.endInterval(name, state) }
+
+        let value = try body()
+        let end = Self.now()
+        let count = rows?(value) ?? (value as? any Collection)?.count ?? 0
+        record(
+            Key(name: "\(name)", kind: kind),
+            duration: end - start,
+            wait: requestedAt.map { start > $0 ? start - $0 : 0 } ?? 0,
+            rows: count
+        )
+        return value
+    }
+
+    /// Wraps an observation's fetch so each re-fire is measured
+    func observing<T>(
+        _ name: StaticString,
+        _ fetch: @escaping @Sendable (Database) throws -> T
+    ) -> @Sendable (Database) throws -> T {
+        { [self] db in
+            try measure(name, kind: .observation) { try fetch(db) }
+        }
+    }
+
+    func snapshot() -> PlayaDBStats {
+        lock.lock()
+        defer { lock.unlock() }
+        let operations = entries.map { key, entry in
+            PlayaDBOperationStats(
+                name: key.name,
+                kind: key.kind,
+                count: entry.count,
+                totalDuration: Self.seconds(entry.totalDuration),
+                maxDuration: Self.seconds(entry.maxDuration),
+                rows: entry.rows,
+                totalWait: Self.seconds(entry.totalWait),
+                maxWait: Self.seconds(entry.maxWait)
+            )
+        }
+        return PlayaDBStats(
+            operations: operations.sorted { $0.totalDuration > $1.totalDuration },
+            since: since
+        )
+    }
+
+    func reset() {
+        lock.lock()
+        entries = [:]
+        since = Date()
+        lock.unlock()
+    }
+
+    // MARK: - Private
+
+    private func record(_ key: Key, duration: UInt64, wait: UInt64, rows: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard enabled else { return }
+        var entry = entries[key] ?? Entry()
+        entry.count += 1
+        entry.totalDuration += duration
+        entry.maxDuration = max(entry.maxDuration, duration)
+        entry.rows += rows
+        entry.totalWait += wait
+        entry.maxWait = max(entry.maxWait, wait)
+        entries[key] = entry
+    }
+
+    private static func seconds(_ nanoseconds: UInt64) -> TimeInterval {
+        TimeInterval(nanoseconds) / 1_000_000_000
+    }
+}
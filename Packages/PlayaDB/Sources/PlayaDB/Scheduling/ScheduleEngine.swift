@@ -0,0 +1,446 @@
+import Foundation
+import CoreLocation
+
+/// Builds a non-overlapping itinerary from favorited event occurrences.
+///
+/// The plan is a weighted interval schedule where two occurrences are compatible only if
+/// there's time to walk from the first host to the second. Occurrences are projected onto a
+/// local plane once, so each travel check is a `hypot`. Any pair separated by more than the
+/// longest possible walk between the candidates is compatible without a distance check, so
+/// the DP uses the classic `p(j)` binary search plus a short window of near neighbours:
+/// O(n log n + n·k) for k occurrences ending within one max-walk of each start.
+///
+/// Each event counts once: when the optimum takes several occurrences of one event, the one
+/// least contended by other events is kept, its siblings are excluded and the plan is
+/// recomputed (a few rounds at most).
+public struct ScheduleEngine {
+
+    public struct Options {
+        /// Walking speed in meters per second (~4.5 km/h)
+        public var walkingSpeed: Double
+        /// Extra slack added to every transfer between two located occurrences
+        public var transferBuffer: TimeInterval
+        /// Only occurrences overlapping this interval are scheduled
+        public var window: DateInterval?
+        /// All-day occurrences conflict with everything; leave them out of the plan
+        public var excludeAllDay: Bool
+        /// Cap on `Itinerary.alternatives`
+        public var maxAlternatives: Int
+
+        public init(
+            walkingSpeed: Double = 1.25,
+            transferBuffer: TimeInterval = 5 * 60,
+            window: DateInterval? = nil,
+            excludeAllDay: Bool = true,
+            maxAlternatives: Int = 20
+        ) {
+            self.walkingSpeed = walkingSpeed
+            self.transferBuffer = transferBuffer
+            self.window = window
+            self.excludeAllDay = excludeAllDay
+            self.maxAlternatives = maxAlternatives
+        }
+    }
+
+    /// Scheduling input, decoupled from `EventObjectOccurrence` so callers can plan over
+    /// anything with a time span.
+    public struct Candidate: Hashable {
+        /// Occurrence UID
+        public let uid: String
+        /// Occurrences sharing an event UID are interchangeable; at most one is scheduled
+        public let eventUID: String
+        public let start: Date
+        public let end: Date
+        public let latitude: Double?
+        public let longitude: Double?
+        public let weight: Double
+
+        public init(
+            uid: String,
+            eventUID: String,
+            start: Date,
+            end: Date,
+            coordinate: CLLocationCoordinate2D? = nil,
+            weight: Double = 1
+        ) {
+            self.uid = uid
+            self.eventUID = eventUID
+            self.start = start
+            self.end = end
+            self.latitude = coordinate?.latitude
+            self.longitude = coordinate?.longitude
+            self.weight = weight
+        }
+    }
+
+    public let options: Options
+
+    public init(options: Options = Options()) {
+        self.options = options
+    }
+
+    // MARK: - Planning
+
+    /// Plan over event occurrences. Location is the event's GPS, falling back to its host.
+    public func plan(
+        _ occurrences: [EventObjectOccurrence],
+        weight: (EventObjectOccurrence) -> Double = { _ in 1 }
+    ) -> Itinerary {
+        let candidates = occurrences.compactMap { occurrence -> Candidate? in
+            if options.excludeAllDay && occurrence.allDay { return nil }
+            return Candidate(
+                uid: occurrence.uid,
+                eventUID: occurrence.event.uid,
+                start: occurrence.startDate,
+                end: occurrence.endDate,
+                coordinate: (occurrence.location ?? occurrence.host?.location)?.coordinate,
+                weight: weight(occurrence)
+            )
+        }
+        return plan(candidates: candidates)
+    }
+
+    public func plan(candidates input: [Candidate]) -> Itinerary {
+        var candidates = input.filter { $0.end > $0.start && $0.weight > 0 }
+        if let window = options.window {
+            candidates = candidates.filter { $0.start < window.end && $0.end > window.start }
+        }
+        guard !candidates.isEmpty else {
+            return Itinerary(items: [], conflicts: [], alternatives: [], unscheduledEventUIDs: [])
+        }
+        let space = Space(candidates: candidates, options: options)
+        let conflicts = space.conflicts()
+
+        // Weight of other-event candidates each candidate blocks.
+        var contention = [Double](repeating: 0, count: space.candidates.count)
+        for conflict in conflicts {
+            contention[conflict.first] += space.weights[conflict.second]
+            contention[conflict.second] += space.weights[conflict.first]
+        }
+
+        // Solve, then exclude siblings of events picked more than once and re-solve.
+        var excluded = Set<Int>()
+        var chosen = space.solve(excluding: excluded)
+        for _ in 0..<8 {
+            var picksByEvent: [String: [Int]] = [:]
+            for index in chosen {
+                picksByEvent[space.candidates[index].eventUID, default: []].append(index)
+            }
+            let repeated = picksByEvent.filter { $0.value.count > 1 }
+            guard !repeated.isEmpty else { break }
+            for (eventUID, picks) in repeated {
+                // Chosen picks are in end order, so ties keep the earliest.
+                guard let keep = picks.min(by: { contention[$0] < contention[$1] }) else { continue }
+                for sibling in space.indicesByEvent[eventUID, default: []] where sibling != keep {
+                    excluded.insert(sibling)
+                }
+            }
+            chosen = space.solve(excluding: excluded)
+        }
+        // Guarantee one-per-event even if the loop cap was hit.
+        var seenEvents = Set<String>()
+        chosen = chosen.filter { seenEvents.insert(space.candidates[$0].eventUID).inserted }
+
+        return space.itinerary(chosen: chosen, conflicts: conflicts, maxAlternatives: options.maxAlternatives)
+    }
+}
+
+// MARK: - Results
+
+/// Output of `ScheduleEngine.plan`.
+public struct Itinerary {
+    public struct Item {
+        public let candidate: ScheduleEngine.Candidate
+        /// Walking time to the next item (including the transfer buffer), nil for the last
+        /// item or when either end has no location
+        public let travelToNext: TimeInterval?
+    }
+
+    /// Scheduled occurrences, sorted by start
+    public let items: [Item]
+
+    /// Every pair of candidates from different events that can't both be attended
+    public let conflicts: [ScheduleConflict]
+
+    /// Swaps that bring an unscheduled occurrence into the plan, best first
+    public let alternatives: [ScheduleAlternative]
+
+    /// Events with no occurrence in the plan
+    public let unscheduledEventUIDs: Set<String>
+
+    public var totalWeight: Double {
+        items.reduce(0) { $0 + $1.candidate.weight }
+    }
+}
+
+public struct ScheduleConflict: Hashable {
+    public enum Kind: Hashable {
+        /// Time ranges overlap
+        case overlap
+        /// Back to back, but not enough time to walk between them
+        case travel(required: TimeInterval)
+    }
+
+    /// Starts first
+    public let first: ScheduleEngine.Candidate
+    public let second: ScheduleEngine.Candidate
+    public let kind: Kind
+}
+
+public struct ScheduleAlternative {
+    /// Unscheduled occurrence that could be attended
+    public let candidate: ScheduleEngine.Candidate
+    /// Scheduled occurrences that would have to be dropped
+    public let replaces: [ScheduleEngine.Candidate]
+    /// Change in total weight if the swap is made (negative means a worse plan)
+    public let weightDelta: Double
+}
+
+// MARK: - Solver
+
+private extension ScheduleEngine {
+    /// Candidates in end-time order with projected coordinates and precomputed search bounds.
+    struct Space {
+        let candidates: [Candidate]
+        let starts: [TimeInterval]
+        let ends: [TimeInterval]
+        let weights: [Double]
+        /// Local-plane meters, NaN when unlocated
+        let xs: [Double]
+        let ys: [Double]
+        let indicesByEvent: [String: [Int]]
+        let walkingSpeed: Double
+        let transferBuffer: TimeInterval
+        /// Upper bound on any transfer between two candidates
+        let maxTravel: TimeInterval
+
+        init(candidates unsorted: [Candidate], options: Options) {
+            let candidates = unsorted.sorted { ($0.end, $0.start, $0.uid) < ($1.end, $1.start, $1.uid) }
+            self.candidates = candidates
+            starts = candidates.map { $0.start.timeIntervalSince1970 }
+            ends = candidates.map { $0.end.timeIntervalSince1970 }
+            weights = candidates.map(\.weight)
+            walkingSpeed = max(options.walkingSpeed, 0.1)
+            transferBuffer = options.transferBuffer
+
+            // Equirectangular projection around the mean latitude; error is negligible at
+            // city scale and it turns every distance into a hypot.
+            let located = candidates.compactMap { c in c.latitude.flatMap { lat in c.longitude.map { (lat, $0) } } }
+            let meanLatitude = located.isEmpty ? 0 : located.map(\.0).reduce(0, +) / Double(located.count)
+            let metersPerDegree = 111_320.0
+            let lonScale = cos(meanLatitude * .pi / 180) * metersPerDegree
+            var xs: [Double] = []
+            var ys: [Double] = []
+            xs.reserveCapacity(candidates.count)
+            ys.reserveCapacity(candidates.count)
+            var minX = Double.infinity, maxX = -Double.infinity
+            var minY = Double.infinity, maxY = -Double.infinity
+            for candidate in candidates {
+                if let lat = candidate.latitude, let lon = candidate.longitude {
+                    let x = lon * lonScale
+                    let y = lat * metersPerDegree
+                    xs.append(x)
+                    ys.append(y)
+                    minX = min(minX, x); maxX = max(maxX, x)
+                    minY = min(minY, y); maxY = max(maxY, y)
+                } else {
+                    xs.append(.nan)
+                    ys.append(.nan)
+                }
+            }
+            self.xs = xs
+            self.ys = ys
+            if located.count >= 2 {
+                maxTravel = hypot(maxX - minX, maxY - minY) / walkingSpeed + options.transferBuffer
+            } else {
+                maxTravel = located.isEmpty ? 0 : options.transferBuffer
+            }
+
+            var indicesByEvent: [String: [Int]] = [:]
+            for (index, candidate) in candidates.enumerated() {
+                indicesByEvent[candidate.eventUID, default: []].append(index)
+            }
+            self.indicesByEvent = indicesByEvent
+        }
+
+        /// Seconds needed to get from `i` to `j`. Unlocated candidates need no transfer.
+        func travel(_ i: Int, _ j: Int) -> TimeInterval {
+            let dx = xs[i] - xs[j]
+            let dy = ys[i] - ys[j]
+            guard !dx.isNaN, !dy.isNaN else { return 0 }
+            return hypot(dx, dy) / walkingSpeed + transferBuffer
+        }
+
+        /// Whether `i` can be attended and then `j` (i must end before j starts)
+        func canFollow(_ i: Int, _ j: Int) -> Bool {
+            ends[i] + travel(i, j) <= starts[j]
+        }
+
+        /// Number of candidates ending at or before `time`
+        func countEnding(atOrBefore time: TimeInterval) -> Int {
+            var low = 0, high = ends.count
+            while low < high {
+                let mid = (low + high) / 2
+                if ends[mid] <= time { low = mid + 1 } else { high = mid }
+            }
+            return low
+        }
+
+        /// Weighted interval scheduling with travel. Returns chosen indices in end order.
+        func solve(excluding excluded: Set<Int>) -> [Int] {
+            let n = candidates.count
+            var best = [Double](repeating: 0, count: n)
+            var predecessor = [Int](repeating: -1, count: n)
+            // prefixBest[k] / prefixArg[k]: best chain among candidates 0...k and where it ends
+            var prefixBest = [Double](repeating: 0, count: n)
+            var prefixArg = [Int](repeating: -1, count: n)
+
+            for j in 0..<n {
+                if !excluded.contains(j) {
+                    // Everything ending before start - maxTravel is reachable regardless of place.
+                    let farCount = countEnding(atOrBefore: starts[j] - maxTravel)
+                    var bestPrevious = 0.0
+                    var bestPreviousIndex = -1
+                    if farCount > 0 {
+                        bestPrevious = prefixBest[farCount - 1]
+                        bestPreviousIndex = prefixArg[farCount - 1]
+                    }
+                    var i = farCount
+                    while i < j, ends[i] <= starts[j] {
+                        if !excluded.contains(i), best[i] > bestPrevious, canFollow(i, j) {
+                            bestPrevious = best[i]
+                            bestPreviousIndex = i
+                        }
+                        i += 1
+                    }
+                    best[j] = weights[j] + bestPrevious
+                    predecessor[j] = bestPreviousIndex
+                }
+                let previousBest = j > 0 ? prefixBest[j - 1] : 0
+                if !excluded.contains(j), best[j] > previousBest {
+                    prefixBest[j] = best[j]
+                    prefixArg[j] = j
+                } else {
+                    prefixBest[j] = previousBest
+                    prefixArg[j] = j > 0 ? prefixArg[j - 1] : -1
+                }
+            }
+
+            var chain: [Int] = []
+            var cursor = prefixArg[n - 1]
+            while cursor >= 0 {
+                chain.append(cursor)
+                cursor = predecessor[cursor]
+            }
+            return chain.reversed()
+        }
+
+        struct IndexedConflict {
+            /// Starts first
+            let first: Int
+            let second: Int
+            let kind: ScheduleConflict.Kind
+        }
+
+        /// Every conflicting pair from different events. Sweeps in start order, comparing
+        /// against candidates that may still block.
+        func conflicts() -> [IndexedConflict] {
+            let byStart = candidates.indices.sorted { (starts[$0], ends[$0]) < (starts[$1], ends[$1]) }
+            var conflicts: [IndexedConflict] = []
+            var active: [Int] = []
+            for b in byStart {
+                active.removeAll { ends[$0] + maxTravel <= starts[b] }
+                // Occurrences of the same event are alternatives to each other, not conflicts.
+                for a in active where candidates[a].eventUID != candidates[b].eventUID {
+                    if let kind = conflict(a, b) {
+                        conflicts.append(IndexedConflict(first: a, second: b, kind: kind))
+                    }
+                }
+                active.append(b)
+            }
+            return conflicts
+        }
+
+        /// Conflict between `a` and `b`, ordered so the earlier start comes first.
+        func conflict(_ a: Int, _ b: Int) -> ScheduleConflict.Kind? {
+            let (first, second) = (starts[a], ends[a]) <= (starts[b], ends[b]) ? (a, b) : (b, a)
+            if starts[second] < ends[first] {
+                return .overlap
+            }
+            let required = travel(first, second)
+            if ends[first] + required > starts[second] {
+                return .travel(required: required)
+            }
+            return nil
+        }
+
+        func itinerary(chosen: [Int], conflicts: [IndexedConflict], maxAlternatives: Int) -> Itinerary {
+            let byStart = candidates.indices.sorted { (starts[$0], ends[$0]) < (starts[$1], ends[$1]) }
+
+            let plan = chosen.sorted { starts[$0] < starts[$1] }
+            let items = plan.enumerated().map { offset, index -> Itinerary.Item in
+                var travelToNext: TimeInterval?
+                if offset + 1 < plan.count {
+                    let next = plan[offset + 1]
+                    if !xs[index].isNaN, !xs[next].isNaN {
+                        travelToNext = travel(index, next)
+                    }
+                }
+                return Itinerary.Item(candidate: candidates[index], travelToNext: travelToNext)
+            }
+
+            let scheduledEvents = Set(plan.map { candidates[$0].eventUID })
+            let unscheduledEvents = Set(candidates.map(\.eventUID)).subtracting(scheduledEvents)
+
+            // Swapping in u means dropping every planned item it conflicts with; with those
+            // gone, u is compatible with the rest of the plan by construction.
+            let planStarts = plan.map { starts[$0] }
+            var alternatives: [ScheduleAlternative] = []
+            for u in byStart where unscheduledEvents.contains(candidates[u].eventUID) {
+                // Only planned items starting before u ends (+ walk) can conflict with it.
+                var high = 0, upper = planStarts.count
+                let limit = ends[u] + maxTravel
+                while high < upper {
+                    let mid = (high + upper) / 2
+                    if planStarts[mid] < limit { high = mid + 1 } else { upper = mid }
+                }
+                var blockers: [Int] = []
+                for p in plan[0..<high] where ends[p] + maxTravel > starts[u] && conflict(p, u) != nil {
+                    blockers.append(p)
+                }
+                let delta = weights[u] - blockers.reduce(0) { $0 + weights[$1] }
+                alternatives.append(ScheduleAlternative(
+                    candidate: candidates[u],
+                    replaces: blockers.map { candidates[$0] },
+                    weightDelta: delta
+                ))
+            }
+            alternatives.sort { ($0.weightDelta, $1.replaces.count) > ($1.weightDelta, $0.replaces.count) }
+            if alternatives.count > maxAlternatives {
+                alternatives.removeSubrange(maxAlternatives...)
+            }
+
+            return Itinerary(
+                items: items,
+                conflicts: conflicts.map {
+                    ScheduleConflict(first: candidates[$0.first], second: candidates[$0.second], kind: $0.kind)
+                },
+                alternatives: alternatives,
+                unscheduledEventUIDs: unscheduledEvents
+            )
+        }
+    }
+}
+
+// MARK: - PlayaDB Convenience
+
+public extension PlayaDB {
+    /// Plan an itinerary over all favorited event occurrences.
+    func planFavoriteItinerary(
+        options: ScheduleEngine.Options = ScheduleEngine.Options(),
+        weight: @escaping (EventObjectOccurrence) -> Double = { _ in 1 }
+    ) async throws -> Itinerary {
+        let favorites = try await fetchFavoriteEvents()
+        return ScheduleEngine(options: options).plan(favorites, weight: weight)
+    }
+}
@@ -0,0 +1,142 @@
+import Foundation
+import Accelerate
+import GRDB
+import PlayaAPI
+
+/// In-memory copy of the `object_embeddings` table for brute-force cosine search.
+///
+/// The table holds a few thousand 512-component vectors, so scoring every row is one
+/// matrix–vector product (a few milliseconds) and needs no approximate index. The matrix is
+/// loaded on first search and dropped when the table changes (see
+/// `PlayaDBImpl.setupSemanticIndexInvalidation`); a generation counter guards against
+/// storing a load that raced an invalidating write.
+final class SemanticIndex: @unchecked Sendable {
+    struct Snapshot: Sendable {
+        /// Embedding model revision the rows came from
+        let revision: Int
+        let dimension: Int
+        let types: [DataObjectType]
+        let uids: [String]
+        /// Row-major `uids.count × dimension`, each row unit length
+        let matrix: [Float]
+
+        static let empty = Snapshot(revision: 0, dimension: 0, types: [], uids: [], matrix: [])
+
+        var isEmpty: Bool { uids.isEmpty }
+
+        /// Rows most similar to the unit-length `query`, best first. Empty when the
+        /// dimensions don't match.
+        func nearest(
+            to query: [Float],
+            limit: Int,
+            types allowed: Set<DataObjectType>? = nil
+        ) -> [(index: Int, score: Float)] {
+            guard !isEmpty, limit > 0, query.count == dimension else { return [] }
+            var scores = [Float](repeating: 0, count: uids.count)
+            vDSP_mmul(matrix, 1, query, 1, &scores, 1, vDSP_Length(uids.count), 1, vDSP_Length(dimension))
+
+            // Bounded insertion keeps the best `limit`; cheaper than sorting every score
+            var best: [(index: Int, score: Float)] = []
+            best.reserveCapacity(limit + 1)
+            for (index, score) in scores.enumerated() {
+                if let allowed, !allowed.contains(types[index]) { continue }
+                if best.count == limit {
+                    guard score > best[limit - 1].score else { continue }
+                    best.removeLast()
+                }
+                let position = best.firstIndex { $0.score < score } ?? best.count
+                best.insert((index, score), at: position)
+            }
+            return best
+        }
+    }
+
+    private let lock = NSLock()
+    /// isolate access with `lock`
+    private var snapshot: Snapshot?
+    /// isolate access with `lock`
+    private var generation = 0
+    #if canImport(NaturalLanguage)
+    /// isolate access with `lock`
+    private var embedder: PlayaTextEmbedder?
+    #endif
+
+    func cached() -> Snapshot? {
+        lock.lock()
+        defer { lock.unlock() }
+        return snapshot
+    }
+
+    /// Capture before loading, pass back to `store`.
+    func currentGeneration() -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return generation
+    }
+
+    func store(_ snapshot: Snapshot, generation: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard self.generation == generation else { return }
+        self.snapshot = snapshot
+    }
+
+    func invalidate() {
+        lock.lock()
+        defer { lock.unlock() }
+        snapshot = nil
+        generation += 1
+    }
+
+    #if canImport(NaturalLanguage)
+    /// Query embedder for `revision`, loaded once; nil when that model isn't on this device
+    func embedder(revision: Int) -> PlayaTextEmbedder? {
+        lock.lock()
+        defer { lock.unlock() }
+        if let embedder, embedder.revision == revision { return embedder }
+        embedder = PlayaTextEmbedder(revision: revision)
+        return embedder
+    }
+    #endif
+
+    /// Reads and dequantizes every embedding. Rows from a different model revision or
+    /// dimension than the first (e.g. after a partial update) are skipped.
+    static func load(_ db: Database) throws -> Snapshot {
+        let rows = try Row.fetchCursor(db, sql: """
+            SELECT object_type, object_id, revision, vector FROM object_embeddings
+            ORDER BY object_type, object_id
+            """)
+        var revision: Int?
+        var dimension = 0
+        var types: [DataObjectType] = []
+        var uids: [String] = []
+        var matrix: [Float] = []
+        var row = [Float]()
+        while let next = try rows.next() {
+            guard let type = DataObjectType(rawValue: next["object_type"]) else { continue }
+            let vector: Data = next["vector"]
+            let rowRevision: Int = next["revision"]
+            if revision == nil {
+                revision = rowRevision
+                dimension = vector.count
+                row = [Float](repeating: 0, count: dimension)
+            }
+            guard rowRevision == revision, vector.count == dimension, dimension > 0 else { continue }
+
+            vector.withUnsafeBytes { bytes in
+                vDSP_vflt8(bytes.bindMemory(to: Int8.self).baseAddress!, 1, &row, 1, vDSP_Length(dimension))
+            }
+            var norm: Float = 0
+            vDSP_svesq(row, 1, &norm, vDSP_Length(dimension))
+            guard norm > 0 else { continue }
+            var scale = 1 / norm.squareRoot()
+            vDSP_vsmul(row, 1, &scale, &row, 1, vDSP_Length(dimension))
+
+            types.append(type)
+            uids.append(next["object_id"])
+            matrix.append(contentsOf: row)
+        }
+        guard let revision else { return .empty }
+        return Snapshot(revision: revision, dimension: dimension, types: types, uids: uids, matrix: matrix)
+    }
+}
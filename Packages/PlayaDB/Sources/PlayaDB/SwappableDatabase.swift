@@ -0,0 +1,135 @@
+import Foundation
+import GRDB
+
+/// The live database connection, replaceable by a database file built elsewhere.
+///
+/// A shadow import writes a complete database next to the live one and then calls
+/// `replace(with:migrating:)`, which copies the latest user data across, renames the new
+/// file over the old one and opens it before letting the old connection go. Observations started through `observe(_:)` are
+/// cancelled for the swap and restarted on the new connection, so subscribers keep their
+/// last values until the swap and then receive values from the new file without
+/// re-subscribing.
+final class SwappableDatabase: @unchecked Sendable {
+    private final class Observer {
+        let start: (DatabaseQueue) -> DatabaseCancellable
+        var cancellable: DatabaseCancellable?
+
+        init(start: @escaping (DatabaseQueue) -> DatabaseCancellable) {
+            self.start = start
+        }
+    }
+
+    private let lock = NSLock()
+    private var queue: DatabaseQueue
+    private var observers: [Int: Observer] = [:]
+    private var nextObserverID = 0
+
+    init(_ queue: DatabaseQueue) {
+        self.queue = queue
+    }
+
+    /// Current connection. Blocks while a swap is in its final phase.
+    var current: DatabaseQueue {
+        lock.lock()
+        defer { lock.unlock() }
+        return queue
+    }
+
+    /// Starts an observation on the current connection and restarts it after every swap.
+    func observe(_ start: @escaping (DatabaseQueue) -> DatabaseCancellable) -> AnyDatabaseCancellable {
+        lock.lock()
+        defer { lock.unlock() }
+        let id = nextObserverID
+        nextObserverID += 1
+        let observer = Observer(start: start)
+        observer.cancellable = start(queue)
+        observers[id] = observer
+        return AnyDatabaseCancellable { [weak self] in
+            self?.removeObserver(id)
+        }
+    }
+
+    /// Replaces the live database file with `replacement`.
+    ///
+    /// `migrating` runs in a transaction on the live connection with `replacement` ATTACHed as
+    /// `shadow`, after all previously queued writes; it copies user data into the new file.
+    /// The old connection then turns read-only, so a write racing the swap fails instead of
+    /// being lost, and is closed only once the new file is open. If the swap fails part way the
+    /// old connection keeps serving: read-write if its file is still in place, read-only if the
+    /// new file already replaced it. `didReplace` runs once the new file is in place, before
+    /// observations restart.
+    func replace(
+        with replacement: URL,
+        migrating: (Database) throws -> Void,
+        didReplace: () -> Void = {}
+    ) throws {
+        lock.lock()
+        defer { lock.unlock() }
+        let old = queue
+        let path = old.path
+
+        for observer in observers.values {
+            observer.cancellable?.cancel()
+            observer.cancellable = nil
+        }
+
+        do {
+            try old.writeWithoutTransaction { db in
+                try db.execute(sql: "ATTACH DATABASE ? AS shadow", arguments: [replacement.path])
+                do {
+                    try db.inTransaction {
+                        try migrating(db)
+                        return .commit
+                    }
+                } catch {
+                    try? db.execute(sql: "DETACH DATABASE shadow")
+                    throw error
+                }
+                try db.execute(sql: "DETACH DATABASE shadow")
+                try db.execute(sql: "PRAGMA query_only = 1")
+            }
+            // rename(2) is atomic: the path holds either the complete old or the complete new
+            // file. The old connection keeps reading its own (now unlinked) file.
+            guard rename(replacement.path, path) == 0 else {
+                throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+            }
+        } catch {
+            // Keep serving the old file
+            try? old.writeWithoutTransaction { db in
+                try db.execute(sql: "PRAGMA query_only = 0")
+            }
+            restartObservers()
+            throw error
+        }
+
+        let reopened: DatabaseQueue
+        do {
+            reopened = try DatabaseQueue(path: path)
+        } catch {
+            // The old file is gone; the old connection stays read-only so nothing written to
+            // it is lost, and the next launch opens the new file.
+            restartObservers()
+            throw error
+        }
+        queue = reopened
+        try? old.close()
+        didReplace()
+        restartObservers()
+    }
+
+    // MARK: - Private
+
+    /// Expects `lock` to be held
+    private func restartObservers() {
+        for observer in observers.values {
+            observer.cancellable?.cancel()
+            observer.cancellable = observer.start(queue)
+        }
+    }
+
+    private func removeObserver(_ id: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+        observers.removeValue(forKey: id)?.cancellable?.cancel()
+    }
+}
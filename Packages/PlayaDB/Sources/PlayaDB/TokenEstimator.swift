@@ -0,0 +1,55 @@
+import Foundation
+
+/// Conservative token counts for the on-device language model's ~4K context window.
+///
+/// `characters / 4` undercounts the text tools actually return: uids, GPS coordinates and
+/// punctuation-separated fields tokenize far denser than prose. This walks the text once,
+/// pricing each whitespace-separated word by what it's made of:
+///
+/// - letters: one token per 5 letters, at least one (common words are single tokens)
+/// - digits: one token each (coordinates and times split per digit or pair)
+/// - identifiers mixing letters and digits (uids): one token per 2 characters
+/// - punctuation and symbols: one token each
+/// - other non-ASCII scalars (emoji, CJK): two tokens each
+public enum TokenEstimator {
+    public static func estimate(_ text: String) -> Int {
+        var tokens = 0
+        var letters = 0
+        var digits = 0
+        func endWord() {
+            if letters > 0 && digits > 0 {
+                tokens += (letters + digits + 1) / 2
+            } else {
+                tokens += (letters + 4) / 5 + digits
+            }
+            letters = 0
+            digits = 0
+        }
+        for scalar in text.unicodeScalars {
+            switch scalar.value {
+            case 0x30...0x39:
+                digits += 1
+            case 0x41...0x5A, 0x61...0x7A:
+                letters += 1
+            case 0x09, 0x0A, 0x0D, 0x20:
+                endWord()
+            case 0x21...0x7E:
+                // Punctuation splits words: "art:" is a word and a colon
+                endWord()
+                tokens += 1
+            default:
+                if scalar.properties.isAlphabetic && scalar.value < 0x3000 {
+                    // Accented Latin, Greek, Cyrillic
+                    letters += 1
+                } else if scalar.properties.isWhitespace {
+                    endWord()
+                } else {
+                    endWord()
+                    tokens += 2
+                }
+            }
+        }
+        endWord()
+        return tokens
+    }
+}
@@ -0,0 +1,158 @@
+import Foundation
+
+/// Renderings of objects as model tool output, keyed by object uid.
+///
+/// Each entry remembers the fields it was rendered from. A lookup extracts those fields from
+/// the object it's given (cheap: no string building) and re-renders only when they differ,
+/// so updated objects never get a stale rendering and no table observation is needed. The
+/// cache is dropped wholesale once it outgrows `limit`.
+final class ToolRenderingCache: @unchecked Sendable {
+    /// Everything a rendering is built from
+    struct Source: Hashable {
+        struct Field: Hashable {
+            let label: String
+            let value: String
+        }
+
+        /// "art", "camp", "event" or "vehicle"
+        let kind: String
+        let uid: String
+        let name: String
+        let description: String?
+        let start: Date?
+        let end: Date?
+        /// Extra labelled values shown at full detail
+        let fields: [Field]
+        let latitude: Double?
+        let longitude: Double?
+    }
+
+    private struct Entry {
+        let source: Source
+        let rendering: ToolRendering
+    }
+
+    private let limit: Int
+    private let lock = NSLock()
+    /// isolate access with `lock`
+    private var entries: [String: Entry] = [:]
+
+    init(limit: Int = 5000) {
+        self.limit = limit
+    }
+
+    func renderings(for objects: [any DataObject]) -> [ToolRendering] {
+        objects.map { object in
+            guard let source = Self.source(for: object) else {
+                return ToolRendering(uid: object.uid, brief: "unknown object", normal: "unknown object", full: "unknown object")
+            }
+            lock.lock()
+            let cached = entries[object.uid]
+            lock.unlock()
+            if let cached, cached.source == source {
+                return cached.rendering
+            }
+
+            let rendering = Self.render(source)
+            lock.lock()
+            if entries.count >= limit {
+                entries.removeAll(keepingCapacity: true)
+            }
+            entries[object.uid] = Entry(source: source, rendering: rendering)
+            lock.unlock()
+            return rendering
+        }
+    }
+
+    // MARK: - Rendering
+
+    /// Festival-local clock time, e.g. "9:30 PM"
+    private static let timeFormatter: DateFormatter = {
+        let formatter = DateFormatter()
+        formatter.dateFormat = "h:mm a"
+        formatter.timeZone = TimeZone(identifier: "America/Los_Angeles")
+        return formatter
+    }()
+
+    static func source(for object: any DataObject) -> Source? {
+        typealias Field = Source.Field
+        if let art = object as? ArtObject {
+            return Source(
+                kind: "art", uid: art.uid, name: art.name, description: art.description, start: nil, end: nil,
+                fields: [
+                    art.artist.map { Field(label: "artist", value: $0) },
+                    art.category.map { Field(label: "category", value: $0) },
+                    art.locationString.map { Field(label: "location", value: $0) },
+                ].compactMap { $0 },
+                latitude: art.gpsLatitude, longitude: art.gpsLongitude
+            )
+        } else if let camp = object as? CampObject {
+            return Source(
+                kind: "camp", uid: camp.uid, name: camp.name, description: camp.description, start: nil, end: nil,
+                fields: [
+                    camp.locationString.map { Field(label: "location", value: $0) },
+                    camp.hometown.map { Field(label: "hometown", value: $0) },
+                ].compactMap { $0 },
+                latitude: camp.gpsLatitude, longitude: camp.gpsLongitude
+            )
+        } else if let occurrence = object as? EventObjectOccurrence {
+            let event = occurrence.event
+            return Source(
+                kind: "event", uid: event.uid, name: event.name, description: event.description,
+                start: occurrence.startDate, end: occurrence.endDate,
+                fields: [
+                    Field(label: "type", value: event.eventTypeLabel),
+                    event.hostedByCamp.map { Field(label: "host", value: $0) },
+                ].compactMap { $0 },
+                latitude: event.gpsLatitude, longitude: event.gpsLongitude
+            )
+        } else if let event = object as? EventObject {
+            return Source(
+                kind: "event", uid: event.uid, name: event.name, description: event.description, start: nil, end: nil,
+                fields: [
+                    Field(label: "type", value: event.eventTypeLabel),
+                    event.hostedByCamp.map { Field(label: "host", value: $0) },
+                ].compactMap { $0 },
+                latitude: nil, longitude: nil
+            )
+        } else if let mv = object as? MutantVehicleObject {
+            return Source(
+                kind: "vehicle", uid: mv.uid, name: mv.name, description: mv.description, start: nil, end: nil,
+                fields: [
+                    mv.artist.map { Field(label: "artist", value: $0) },
+                    mv.tagsText.map { Field(label: "tags", value: $0) },
+                ].compactMap { $0 },
+                latitude: nil, longitude: nil
+            )
+        }
+        return nil
+    }
+
+    static func render(_ source: Source) -> ToolRendering {
+        let uid = "(uid: \(source.uid))"
+        let time = source.start.map { timeFormatter.string(from: $0) }
+        let title = time.map { "\(source.kind): \(source.name) at \($0)" } ?? "\(source.kind): \(source.name)"
+
+        // Occurrence lines carry a time, so they get a shorter description
+        let summaryLength = time == nil ? 80 : 60
+        let summary = source.description.map { String($0.prefix(summaryLength)) } ?? "no description"
+
+        var full = ["\(source.kind): \(source.name)"]
+        if let time {
+            full.append("time: \(time)-\(source.end.map { timeFormatter.string(from: $0) } ?? "?")")
+        }
+        if let description = source.description { full.append("desc: \(description)") }
+        full += source.fields.map { "\($0.label): \($0.value)" }
+        if let latitude = source.latitude, let longitude = source.longitude {
+            full.append("gps: \(latitude),\(longitude)")
+        }
+        full.append(uid)
+
+        return ToolRendering(
+            uid: source.uid,
+            brief: "\(title) \(uid)",
+            normal: "\(title) - \(summary) \(uid)",
+            full: full.joined(separator: " | ")
+        )
+    }
+}
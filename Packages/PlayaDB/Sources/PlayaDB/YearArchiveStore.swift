@@ -0,0 +1,174 @@
+import Foundation
+import GRDB
+
+/// Read-only per-year archives of the content tables, so past years stay browsable while the
+/// live database (and its FTS/R*Tree indexes) only holds the current year.
+///
+/// Each archive is a standalone SQLite file (`PlayaDB-<year>.sqlite`, optionally LZFSE
+/// compressed as `.sqlite.lzfse`) with the live schema minus the user tables. Archives are
+/// opened on demand with the live database ATTACHed as `live`: SQLite resolves unqualified
+/// table names in `main` first, so the regular request builders read objects from the archive
+/// and favorites, notes and thumbnail colors from the live database.
+final class YearArchiveStore {
+    /// Tables that stay in the live database only
+    static let userTables = ["object_metadata", "thumbnail_colors", "user_map_pins", "object_content_hashes"]
+
+    let directory: URL
+    private let liveDatabasePath: String
+    private let cacheDirectory: URL
+    private let lock = NSLock()
+    private var readers: [Int: DatabaseQueue] = [:]
+
+    init(directory: URL, liveDatabasePath: String, cacheDirectory: URL? = nil) {
+        self.directory = directory
+        self.liveDatabasePath = liveDatabasePath
+        self.cacheDirectory = cacheDirectory ?? directory.appendingPathComponent(".decompressed", isDirectory: true)
+    }
+
+    // MARK: - Lookup
+
+    /// Years with an archive file, ascending
+    func archivedYears() -> [Int] {
+        let names = (try? FileManager.default.contentsOfDirectory(atPath: directory.path)) ?? []
+        let years = names.compactMap { name -> Int? in
+            guard name.hasPrefix("PlayaDB-") else { return nil }
+            let stem = name.dropFirst("PlayaDB-".count)
+            if stem.hasSuffix(".sqlite") { return Int(stem.dropLast(".sqlite".count)) }
+            if stem.hasSuffix(".sqlite.lzfse") { return Int(stem.dropLast(".sqlite.lzfse".count)) }
+            return nil
+        }
+        return Array(Set(years)).sorted()
+    }
+
+    func hasArchive(year: Int) -> Bool {
+        let fileManager = FileManager.default
+        return fileManager.fileExists(atPath: plainURL(year).path)
+            || fileManager.fileExists(atPath: compressedURL(year).path)
+    }
+
+    /// When the archive for `year` was written, nil if there is none
+    func archiveDate(year: Int) -> Date? {
+        [plainURL(year), compressedURL(year)].lazy
+            .compactMap { try? $0.resourceValues(forKeys: [.contentModificationDateKey]).contentModificationDate }
+            .first
+    }
+
+    /// Read-only connection to the archive for `year`, opened (and decompressed) on first use.
+    /// Returns nil when there's no archive for that year.
+    func reader(for year: Int) throws -> DatabaseQueue? {
+        lock.lock()
+        defer { lock.unlock() }
+        if let reader = readers[year] { return reader }
+        guard let url = try archiveFileURL(year) else { return nil }
+
+        var configuration = Configuration()
+        configuration.readonly = true
+        configuration.busyMode = .timeout(2)
+        let livePath = liveDatabasePath
+        configuration.prepareDatabase { db in
+            // Attached with the main connection's read-only flag
+            try db.execute(sql: "ATTACH DATABASE ? AS live", arguments: [livePath])
+        }
+        let reader = try DatabaseQueue(path: url.path, configuration: configuration)
+        readers[year] = reader
+        return reader
+    }
+
+    /// Closes open archive connections. Call after the live file is replaced: their `live`
+    /// attachment still points at the old file.
+    func closeReaders() {
+        lock.lock()
+        defer { lock.unlock() }
+        for reader in readers.values {
+            try? reader.close()
+        }
+        readers.removeAll()
+    }
+
+    // MARK: - Writing
+
+    /// Snapshots `year` from the live database into a new archive, replacing any existing one.
+    func archive(year: Int, from live: DatabaseQueue, compressed: Bool) throws {
+        let fileManager = FileManager.default
+        try fileManager.createDirectory(at: directory, withIntermediateDirectories: true)
+        let workURL = directory.appendingPathComponent("PlayaDB-\(year).sqlite.tmp")
+        try? fileManager.removeItem(at: workURL)
+
+        try live.writeWithoutTransaction { db in
+            try db.execute(sql: "VACUUM INTO ?", arguments: [workURL.path])
+        }
+
+        let archive = try DatabaseQueue(path: workURL.path)
+        try archive.write { db in
+            for table in Self.userTables {
+                try db.execute(sql: "DROP TABLE IF EXISTS \(table)")
+            }
+            // Keep only the archived year. Delete triggers keep the FTS and spatial
+            // indexes consistent.
+            try db.execute(sql: """
+                DELETE FROM event_occurrences WHERE event_id IN (SELECT uid FROM event_objects WHERE year != ?);
+                DELETE FROM event_objects WHERE year != ?;
+                DELETE FROM art_images WHERE art_id IN (SELECT uid FROM art_objects WHERE year != ?);
+                DELETE FROM art_objects WHERE year != ?;
+                DELETE FROM camp_images WHERE camp_id IN (SELECT uid FROM camp_objects WHERE year != ?);
+                DELETE FROM camp_objects WHERE year != ?;
+                DELETE FROM mv_images WHERE mv_id IN (SELECT uid FROM mv_objects WHERE year != ?);
+                DELETE FROM mv_tags WHERE mv_id IN (SELECT uid FROM mv_objects WHERE year != ?);
+                DELETE FROM mv_objects WHERE year != ?;
+                """, arguments: StatementArguments(Array(repeating: year, count: 9)))
+        }
+        try archive.writeWithoutTransaction { db in
+            try db.execute(sql: "VACUUM")
+        }
+        try archive.close()
+
+        lock.lock()
+        defer { lock.unlock() }
+        if let reader = readers.removeValue(forKey: year) {
+            try reader.close()
+        }
+        try? fileManager.removeItem(at: plainURL(year))
+        try? fileManager.removeItem(at: compressedURL(year))
+        try? fileManager.removeItem(at: decompressedURL(year))
+
+        if compressed {
+            let data = try Data(contentsOf: workURL)
+            try (data as NSData).compressed(using: .lzfse).write(to: compressedURL(year), options: .atomic)
+            try fileManager.removeItem(at: workURL)
+        } else {
+            try fileManager.moveItem(at: workURL, to: plainURL(year))
+        }
+    }
+
+    // MARK: - Private
+
+    private func plainURL(_ year: Int) -> URL {
+        directory.appendingPathComponent("PlayaDB-\(year).sqlite")
+    }
+
+    private func compressedURL(_ year: Int) -> URL {
+        directory.appendingPathComponent("PlayaDB-\(year).sqlite.lzfse")
+    }
+
+    private func decompressedURL(_ year: Int) -> URL {
+        cacheDirectory.appendingPathComponent("PlayaDB-\(year).sqlite")
+    }
+
+    /// Uncompressed archive file for `year`, decompressing a compressed archive once
+    private func archiveFileURL(_ year: Int) throws -> URL? {
+        let fileManager = FileManager.default
+        if fileManager.fileExists(atPath: plainURL(year).path) {
+            return plainURL(year)
+        }
+        guard fileManager.fileExists(atPath: compressedURL(year).path) else { return nil }
+
+        let target = decompressedURL(year)
+        if !fileManager.fileExists(atPath: target.path) {
+            let compressed = try Data(contentsOf: compressedURL(year), options: .alwaysMapped)
+            let data = try (compressed as NSData).decompressed(using: .lzfse) as Data
+            try fileManager.createDirectory(at: cacheDirectory, withIntermediateDirectories: true)
+            try data.write(to: target, options: .atomic)
+        }
+        return target
+    }
+}
@@ -0,0 +1,102 @@
+import XCTest
+import CoreLocation
+import MapKit
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for the single-transaction area/time context snapshot.
+final class ContextSnapshotTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private let artUID = "a2IVI000000yWeZ2AU"
+    private let eventUID = "78ZvNxSeeZQbaeHuughD"
+
+    /// Around the art, which has GPS. The event's host camp is not in the mock data.
+    private let region = MKCoordinateRegion(
+        center: CLLocationCoordinate2D(latitude: 40.79179890754886, longitude: -119.1976993927176),
+        span: MKCoordinateSpan(latitudeDelta: 0.02, longitudeDelta: 0.02)
+    )
+
+    /// 2025-08-28 11:30–14:00 PDT, covering the event's 12:00–13:30 occurrence
+    private let window = DateInterval(
+        start: Date(timeIntervalSince1970: 1_756_405_800),
+        end: Date(timeIntervalSince1970: 1_756_414_800)
+    )
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testMatchesIndividualFetches() async throws {
+        let snapshot = try await playaDB.fetchContextSnapshot(
+            region: nil, window: window, typeCodes: nil, searchText: nil, hostLimit: 10
+        )
+        let art = try await playaDB.fetchArt(filter: ArtFilter())
+        let camps = try await playaDB.fetchCamps(filter: CampFilter())
+        let mvs = try await playaDB.fetchMutantVehicles(filter: MutantVehicleFilter())
+        XCTAssertEqual(snapshot.art.map(\.uid), art.map(\.uid))
+        XCTAssertEqual(snapshot.camps.map(\.uid), camps.map(\.uid))
+        XCTAssertEqual(snapshot.mutantVehicles.map(\.uid), mvs.map(\.uid))
+        XCTAssertEqual(snapshot.occurrences.map { $0.event.uid }, [eventUID])
+    }
+
+    func testWindowBoundsOccurrences() async throws {
+        let later = DateInterval(start: window.end, duration: 3600)
+        let snapshot = try await playaDB.fetchContextSnapshot(
+            region: nil, window: later, typeCodes: nil, searchText: nil, hostLimit: 10
+        )
+        XCTAssertTrue(snapshot.occurrences.isEmpty)
+
+        let empty = try await playaDB.fetchContextSnapshot(
+            region: nil, window: DateInterval(start: window.start, duration: 0),
+            typeCodes: nil, searchText: nil, hostLimit: 10
+        )
+        XCTAssertTrue(empty.occurrences.isEmpty)
+        XCTAssertFalse(empty.art.isEmpty)
+    }
+
+    func testUnmatchedTypeCodesFallBackToAllTypes() async throws {
+        let snapshot = try await playaDB.fetchContextSnapshot(
+            region: nil, window: window, typeCodes: ["no-such-type"], searchText: nil, hostLimit: 10
+        )
+        XCTAssertEqual(snapshot.occurrences.map { $0.event.uid }, [eventUID])
+    }
+
+    func testIncludesEventsAtHostsOutsideRegionIndex() async throws {
+        // Move the event to the art without refreshing the spatial index, as for events
+        // whose location isn't in the region join
+        try await playaDB.dbQueue.write { db in
+            try db.execute(
+                sql: "UPDATE event_objects SET hosted_by_camp = NULL, located_at_art = ? WHERE uid = ?",
+                arguments: [self.artUID, self.eventUID]
+            )
+        }
+
+        let snapshot = try await playaDB.fetchContextSnapshot(
+            region: region, window: window, typeCodes: nil, searchText: nil, hostLimit: 10
+        )
+        XCTAssertEqual(snapshot.art.map(\.uid), [artUID])
+        XCTAssertEqual(snapshot.occurrences.map { $0.event.uid }, [eventUID])
+        XCTAssertEqual(snapshot.occurrences.first?.host?.uid, artUID)
+
+        let noHosts = try await playaDB.fetchContextSnapshot(
+            region: region, window: window, typeCodes: nil, searchText: nil, hostLimit: 0
+        )
+        XCTAssertTrue(noHosts.occurrences.isEmpty)
+    }
+}
@@ -0,0 +1,166 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPI
+import PlayaAPITestHelpers
+
+/// Tests for delta updates against `DeltaFeedFixtureServer`.
+final class DeltaUpdateTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+    private var server: DeltaFeedFixtureServer!
+    private var client: DeltaFeedClient!
+
+    private let eventUID = "78ZvNxSeeZQbaeHuughD"
+    private let hostCampUID = "a1XVI000009t6XR2AY"
+    private let artUID = "a2IVI000000yWeZ2AU"
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        server = try DeltaFeedFixtureServer.mock()
+        client = DeltaFeedClient(transport: server)
+
+        let files = try server.fullFiles()
+        try await playaDB.importFromData(
+            artData: files.art,
+            campData: files.camps,
+            eventData: files.events,
+            mvData: files.mutantVehicles
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        server = nil
+        client = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    /// Round-trips `object` through the API JSON format with `change` applied.
+    private func modified<T: Codable>(_ object: T, _ change: (inout [String: Any]) -> Void) throws -> T {
+        let data = try PlayaAPI.createEncoder().encode(object)
+        var json = try XCTUnwrap(JSONSerialization.jsonObject(with: data) as? [String: Any])
+        change(&json)
+        return try PlayaAPI.createDecoder().decode(T.self, from: JSONSerialization.data(withJSONObject: json))
+    }
+
+    private func mockEvent() throws -> Event {
+        let events = try APIParserFactory.create().parseEvents(from: MockAPIData.eventJSON)
+        return try XCTUnwrap(events.first { $0.uid.value == eventUID })
+    }
+
+    // MARK: - Tests
+
+    func testImportRecordsManifestMatchingServer() async throws {
+        let manifest = try await playaDB.fetchDeltaManifest()
+        XCTAssertFalse(manifest.events.isEmpty)
+        XCTAssertFalse(manifest.mutantVehicles.isEmpty)
+
+        let patch = try await playaDB.syncDelta(with: client)
+        XCTAssertNil(patch, "Freshly imported data should need no changes")
+        XCTAssertTrue(server.patchRequests.isEmpty)
+    }
+
+    func testEditedEventFetchesOnlyThatObject() async throws {
+        let fullSize = try server.fullFiles()
+        let fullBytes = fullSize.art.count + fullSize.camps.count + fullSize.events.count + fullSize.mutantVehicles.count
+
+        server.upsert(try modified(mockEvent()) { $0["description"] = "Tarot readings, now with tea" })
+        server.resetStats()
+
+        let patch = try await playaDB.syncDelta(with: client)
+
+        XCTAssertEqual(patch?.events.map(\.uid.value), [eventUID])
+        XCTAssertEqual(server.patchRequests, [DeltaObjectIDs(events: [eventUID])])
+        XCTAssertLessThan(server.bytesServed, fullBytes)
+
+        let event = try await playaDB.fetchEvent(uid: eventUID)
+        XCTAssertEqual(event?.description, "Tarot readings, now with tea")
+        let occurrences = try await playaDB.fetchOccurrences(forEventUID: eventUID)
+        XCTAssertFalse(occurrences.isEmpty, "Occurrences are re-imported with the event")
+
+        let searchResults = try await playaDB.searchObjects("tea")
+        XCTAssertTrue(searchResults.contains { $0.uid == eventUID }, "FTS follows the updated description")
+
+        let again = try await playaDB.syncDelta(with: client)
+        XCTAssertNil(again)
+    }
+
+    func testFavoritesSurviveUpdate() async throws {
+        let event = try await playaDB.fetchEvent(uid: eventUID)
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(event))
+
+        server.upsert(try modified(mockEvent()) { $0["title"] = "Tarot Card Reading (Renamed)" })
+        try await playaDB.syncDelta(with: client)
+
+        let updated = try await playaDB.fetchEvent(uid: eventUID)
+        XCTAssertEqual(updated?.name, "Tarot Card Reading (Renamed)")
+        let isFavorite = try await playaDB.isFavorite(try XCTUnwrap(updated))
+        XCTAssertTrue(isFavorite)
+    }
+
+    func testDeletedObjectIsRemoved() async throws {
+        server.removeArt(uid: artUID)
+        server.resetStats()
+
+        let patch = try await playaDB.syncDelta(with: client)
+
+        XCTAssertEqual(patch?.deleted.art, [artUID])
+        XCTAssertTrue(server.patchRequests.isEmpty, "Deletions come from the manifest alone")
+        let art = try await playaDB.fetchArt(uid: artUID)
+        XCTAssertNil(art)
+
+        let spatialCount = try await playaDB.dbQueue.read { db in
+            try Int.fetchOne(db, sql: "SELECT COUNT(*) FROM spatial_objects WHERE object_uid = ?", arguments: [self.artUID])
+        }
+        XCTAssertEqual(spatialCount, 0)
+
+        let manifest = try await playaDB.fetchDeltaManifest()
+        XCTAssertNil(manifest.art[artUID])
+    }
+
+    func testHostCampMoveUpdatesEventLocation() async throws {
+        let before = try await playaDB.fetchEvent(uid: eventUID)
+        XCTAssertNil(before?.gpsLatitude, "Mock event's host camp isn't in the mock data")
+
+        server.upsert(Camp(
+            uid: CampID(hostCampUID),
+            name: "Tarot Camp",
+            year: 2025,
+            location: CampLocation(gpsLatitude: 40.786, gpsLongitude: -119.206)
+        ))
+        let patch = try await playaDB.syncDelta(with: client)
+        XCTAssertEqual(patch?.camps.map(\.uid.value), [hostCampUID])
+        XCTAssertTrue(patch?.events.isEmpty ?? false)
+
+        let after = try await playaDB.fetchEvent(uid: eventUID)
+        XCTAssertEqual(after?.gpsLatitude, 40.786)
+        XCTAssertEqual(after?.gpsLongitude, -119.206)
+
+        let counts = try await playaDB.dbQueue.read { db -> (spatial: Int, occurrences: Int) in
+            let spatial = try Int.fetchOne(db, sql: """
+                SELECT COUNT(*) FROM spatial_objects WHERE object_type = 'event' AND object_uid = ?
+                """, arguments: [self.eventUID]) ?? 0
+            let occurrences = try Int.fetchOne(db, sql: """
+                SELECT COUNT(*) FROM event_occurrence_rtree r
+                JOIN event_occurrences o ON o.id = r.id WHERE o.event_id = ?
+                """, arguments: [self.eventUID]) ?? 0
+            return (spatial, occurrences)
+        }
+        XCTAssertEqual(counts.spatial, 1)
+        XCTAssertGreaterThan(counts.occurrences, 0)
+    }
+
+    func testUpdateInfoTracksPatchVersion() async throws {
+        server.upsert(try modified(mockEvent()) { $0["description"] = "Changed" })
+        let patch = try await playaDB.syncDelta(with: client)
+
+        let info = try await playaDB.getUpdateInfo()
+        let eventInfo = info.first { $0.dataType == DataObjectType.event.rawValue }
+        XCTAssertEqual(eventInfo?.version, patch?.version)
+        let manifest = try await playaDB.fetchDeltaManifest()
+        XCTAssertEqual(manifest.version, patch?.version)
+    }
+}
@@ -0,0 +1,159 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for `fetchDetailBundle(uid:recordingViewAt:)` and the coalesced last-viewed writes.
+final class DetailBundleTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private var dbQueue: DatabaseQueue {
+        playaDB.dbQueue
+    }
+
+    private let baseDate = Date(timeIntervalSince1970: 1_756_123_200)
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    private func insertEvent(uid: String, hostedByCamp: String?, starts: [TimeInterval]) async throws {
+        try await dbQueue.write { db in
+            var event = EventObject(
+                uid: uid,
+                name: "Event \(uid)",
+                year: 2025,
+                eventTypeLabel: "Music/Party",
+                eventTypeCode: "prty",
+                hostedByCamp: hostedByCamp
+            )
+            try event.insert(db)
+            for start in starts {
+                let startDate = baseDate.addingTimeInterval(start)
+                var occurrence = EventOccurrence(eventId: uid, startTime: startDate, endTime: startDate.addingTimeInterval(3600))
+                try occurrence.insert(db)
+            }
+        }
+    }
+
+    private func colors(for objectId: String) -> ThumbnailColors {
+        ThumbnailColors(
+            objectId: objectId,
+            bgRed: 0, bgGreen: 0, bgBlue: 0, bgAlpha: 1,
+            primaryRed: 1, primaryGreen: 1, primaryBlue: 1, primaryAlpha: 1,
+            secondaryRed: 0.5, secondaryGreen: 0.5, secondaryBlue: 0.5, secondaryAlpha: 1,
+            detailRed: 0.2, detailGreen: 0.2, detailBlue: 0.2, detailAlpha: 1
+        )
+    }
+
+    private func metadataCount() async throws -> Int {
+        try await dbQueue.read { db in
+            try ObjectMetadata.fetchCount(db)
+        }
+    }
+
+    // MARK: - Tests
+
+    func testCampBundleIncludesHostedEventsAndColors() async throws {
+        let camps = try await playaDB.fetchCamps()
+        let camp = try XCTUnwrap(camps.first)
+        try await insertEvent(uid: "bundle-late", hostedByCamp: camp.uid, starts: [7200])
+        try await insertEvent(uid: "bundle-early", hostedByCamp: camp.uid, starts: [0])
+        try await playaDB.saveThumbnailColors(colors(for: camp.uid))
+
+        let fetched = try await playaDB.fetchDetailBundle(uid: camp.uid, recordingViewAt: nil)
+        let bundle = try XCTUnwrap(fetched)
+
+        XCTAssertEqual(bundle.object.uid, camp.uid)
+        XCTAssertNil(bundle.host)
+        XCTAssertEqual(bundle.thumbnailColors?.objectId, camp.uid)
+        XCTAssertEqual(bundle.hostEvents.map(\.event.uid), ["bundle-early", "bundle-late"])
+        XCTAssertTrue(bundle.occurrences.isEmpty)
+    }
+
+    func testOccurrenceBundleResolvesHostSiblingsAndHostColors() async throws {
+        let camps = try await playaDB.fetchCamps()
+        let camp = try XCTUnwrap(camps.first)
+        try await insertEvent(uid: "bundle-recurring", hostedByCamp: camp.uid, starts: [3600, 0, 86_400])
+        try await insertEvent(uid: "bundle-neighbor", hostedByCamp: camp.uid, starts: [1800])
+        try await playaDB.saveThumbnailColors(colors(for: camp.uid))
+        let occurrences = try await playaDB.fetchOccurrences(forEventUID: "bundle-recurring")
+        let occurrence = try XCTUnwrap(occurrences.last)
+
+        let fetched = try await playaDB.fetchDetailBundle(uid: occurrence.uid, recordingViewAt: nil)
+        let bundle = try XCTUnwrap(fetched)
+
+        XCTAssertEqual(bundle.object.uid, occurrence.uid)
+        XCTAssertTrue(bundle.object is EventObjectOccurrence)
+        XCTAssertEqual(bundle.host?.uid, camp.uid)
+        XCTAssertEqual(bundle.thumbnailColors?.objectId, camp.uid)
+        XCTAssertEqual(bundle.occurrences.count, 3)
+        XCTAssertEqual(bundle.occurrences.map(\.startDate), bundle.occurrences.map(\.startDate).sorted())
+        XCTAssertEqual(Set(bundle.hostEvents.map(\.event.uid)), ["bundle-recurring", "bundle-neighbor"])
+    }
+
+    func testUnknownUIDReturnsNil() async throws {
+        let missing = try await playaDB.fetchDetailBundle(uid: "does-not-exist", recordingViewAt: nil)
+        XCTAssertNil(missing)
+        let missingOccurrence = try await playaDB.fetchDetailBundle(uid: "does-not-exist_42", recordingViewAt: nil)
+        XCTAssertNil(missingOccurrence)
+    }
+
+    func testBundleReadDoesNotWriteMetadata() async throws {
+        try await dbQueue.write { db in
+            var art = ArtObject(uid: "bundle-art", name: "Unviewed", year: 2025)
+            try art.insert(db)
+        }
+        let before = try await metadataCount()
+
+        let fetched = try await playaDB.fetchDetailBundle(uid: "bundle-art", recordingViewAt: nil)
+        XCTAssertNil(try XCTUnwrap(fetched).metadata)
+
+        let after = try await metadataCount()
+        XCTAssertEqual(after, before)
+    }
+
+    func testRecordedViewsCoalesceIntoOneFlush() async throws {
+        let arts = try await playaDB.fetchArt()
+        let art = try XCTUnwrap(arts.first)
+        try await insertEvent(uid: "bundle-viewed", hostedByCamp: nil, starts: [0, 3600])
+        let occurrences = try await playaDB.fetchOccurrences(forEventUID: "bundle-viewed")
+
+        let first = baseDate
+        let second = baseDate.addingTimeInterval(60)
+        _ = try await playaDB.fetchDetailBundle(uid: art.uid, recordingViewAt: first)
+        _ = try await playaDB.fetchDetailBundle(uid: art.uid, recordingViewAt: second)
+        for occurrence in occurrences {
+            _ = try await playaDB.fetchDetailBundle(uid: occurrence.uid, recordingViewAt: first)
+        }
+
+        // Nothing is written until the flush
+        let pendingMetadata = try await playaDB.fetchDetailBundle(uid: art.uid, recordingViewAt: nil)?.metadata
+        XCTAssertNil(pendingMetadata?.lastViewed)
+        XCTAssertFalse(playaDB.lastViewedRecorder.isEmpty)
+
+        try await playaDB.flushPendingViews()
+        XCTAssertTrue(playaDB.lastViewedRecorder.isEmpty)
+
+        let artMetadata = try await playaDB.fetchDetailBundle(uid: art.uid, recordingViewAt: nil)?.metadata
+        XCTAssertEqual(artMetadata?.lastViewed, second)
+        XCTAssertEqual(artMetadata?.firstViewed, second)
+
+        // Occurrence views are tracked against the parent event
+        let recent = try await playaDB.fetchRecentlyViewed(limit: 10)
+        XCTAssertEqual(recent.map(\.uid), [art.uid, "bundle-viewed"])
+    }
+}
@@ -0,0 +1,179 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for the columnar `EventOccurrenceStore` and its parity with the row-based APIs.
+final class EventOccurrenceStoreTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private var dbQueue: DatabaseQueue {
+        playaDB.dbQueue
+    }
+
+    /// Noon UTC, Aug 25 2025
+    private let baseDate = Date(timeIntervalSince1970: 1_756_123_200)
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    private func insertEvent(
+        uid: String,
+        code: String = "prty",
+        label: String = "Music/Party and Dance",
+        hostedByCamp: String? = nil,
+        starts: [TimeInterval]
+    ) async throws {
+        let startDates = starts.map { baseDate.addingTimeInterval($0) }
+        try await dbQueue.write { db in
+            var event = EventObject(
+                uid: uid,
+                name: "Event \(uid)",
+                year: 2025,
+                eventTypeLabel: label,
+                eventTypeCode: code,
+                hostedByCamp: hostedByCamp
+            )
+            try event.insert(db)
+            for start in startDates {
+                var occurrence = EventOccurrence(eventId: uid, startTime: start, endTime: start.addingTimeInterval(3600))
+                try occurrence.insert(db)
+            }
+        }
+    }
+
+    /// Favorites an event, or one occurrence when given an occurrence uid
+    private func setFavorite(objectID: String) async throws {
+        try await dbQueue.write { db in
+            var metadata = ObjectMetadata(objectType: DataObjectType.event.rawValue, objectId: objectID, isFavorite: true)
+            try metadata.save(db)
+        }
+    }
+
+    // MARK: - Tests
+
+    func testStoreMatchesRowBasedFetch() async throws {
+        let campUID = try await playaDB.fetchCamps().first?.uid
+        try await insertEvent(uid: "store-a", hostedByCamp: campUID, starts: [0, 86_400])
+        try await insertEvent(uid: "store-b", code: "work", label: "Class/Workshop", starts: [1800])
+
+        let filter = EventFilter()
+        let rows = try await playaDB.fetchEvents(filter: filter)
+        let store = try await playaDB.fetchEventOccurrenceStore(filter: filter)
+
+        XCTAssertEqual(store.count, rows.count)
+        XCTAssertEqual(store.map(\.uid), rows.map(\.uid))
+        XCTAssertEqual(store.map(\.startDate), rows.map(\.startDate))
+        XCTAssertEqual(store.map(\.eventTypeCode), rows.map(\.eventTypeCode))
+        XCTAssertEqual(store.map(\.hostName), rows.map(\.hostName))
+
+        let materialized = try XCTUnwrap(store.first { $0.eventUID == "store-a" }?.materialize())
+        XCTAssertEqual(materialized.uid, rows.first { $0.event.uid == "store-a" }?.uid)
+        XCTAssertEqual(materialized.hostName, rows.first { $0.event.uid == "store-a" }?.hostName)
+    }
+
+    func testEventsAndHostsAreSharedAcrossOccurrences() async throws {
+        let camps = try await playaDB.fetchCamps()
+        let campUID = try XCTUnwrap(camps.first?.uid)
+        try await insertEvent(uid: "shared-a", hostedByCamp: campUID, starts: [0, 3600, 7200])
+        try await insertEvent(uid: "shared-b", hostedByCamp: campUID, starts: [0])
+
+        var filter = EventFilter()
+        filter.searchText = "shared"
+        let store = try await playaDB.fetchEventOccurrenceStore(filter: filter)
+
+        XCTAssertEqual(store.count, 4)
+        XCTAssertEqual(store.events.count, 2)
+        XCTAssertEqual(store.hosts.count, 1)
+        XCTAssertEqual(store.eventHostIndices, [0, 0])
+        XCTAssertEqual(store.strings.filter { $0 == "prty" }.count, 1)
+        XCTAssertEqual(Set(store.eventTypeCodeIndices).count, 1)
+    }
+
+    func testFiltersAndFavorites() async throws {
+        try await insertEvent(uid: "fav-party", starts: [0])
+        try await insertEvent(uid: "plain-workshop", code: "work", label: "Class/Workshop", starts: [0])
+        try await setFavorite(objectID: "fav-party")
+
+        let favorites = try await playaDB.fetchEventOccurrenceStore(filter: EventFilter(onlyFavorites: true))
+        XCTAssertEqual(favorites.map(\.eventUID), ["fav-party"])
+        XCTAssertTrue(favorites[0].isFavorite)
+
+        let workshops = try await playaDB.fetchEventOccurrenceStore(filter: EventFilter(eventTypeCodes: ["work"]))
+        XCTAssertTrue(workshops.contains { $0.eventUID == "plain-workshop" })
+        XCTAssertFalse(workshops.contains { $0.eventUID == "fav-party" })
+        XCTAssertFalse(workshops.contains { $0.isFavorite })
+    }
+
+    func testOccurrenceFavoritesAreKeyedPerOccurrence() async throws {
+        try await insertEvent(uid: "occurrence-fav", starts: [0, 86_400])
+        let before = try await playaDB.fetchEventOccurrenceStore(filter: EventFilter())
+        let second = try XCTUnwrap(before.filter { $0.eventUID == "occurrence-fav" }.last)
+        try await setFavorite(objectID: second.uid)
+
+        let store = try await playaDB.fetchEventOccurrenceStore(filter: EventFilter())
+        XCTAssertEqual(store.filter { $0.eventUID == "occurrence-fav" }.map(\.isFavorite), [false, true])
+
+        let favorites = try await playaDB.fetchEventOccurrenceStore(filter: EventFilter(onlyFavorites: true))
+        XCTAssertEqual(favorites.map(\.uid), [second.uid])
+        XCTAssertTrue(favorites.allSatisfy(\.isFavorite))
+    }
+
+    func testDayHourRangesMatchRowBuckets() async throws {
+        try await insertEvent(uid: "bucket-a", starts: [0, 60, 3600, 86_400])
+        try await insertEvent(uid: "bucket-b", starts: [120, 90_000])
+
+        let filter = EventFilter()
+        let rows = try await playaDB.fetchEvents(filter: filter)
+        let listRows = rows.map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) }
+        let expected = PlayaDBImpl.bucketByDayThenHour(listRows)
+
+        let store = try await playaDB.fetchEventOccurrenceStore(filter: filter)
+        let ranges = store.dayHourRanges()
+
+        XCTAssertEqual(Set(ranges.keys), Set(expected.keys))
+        for (day, sections) in expected {
+            let storeSections = try XCTUnwrap(ranges[day])
+            XCTAssertEqual(storeSections.map(\.hour), sections.map(\.hour))
+            XCTAssertEqual(
+                storeSections.map { $0.range.map { store[$0].uid } },
+                sections.map { $0.rows.map(\.object.uid) }
+            )
+        }
+    }
+
+    func testObservationRefiresOnFavoriteToggle() async throws {
+        try await insertEvent(uid: "observe-fav", starts: [0])
+        let favorited = expectation(description: "Favorite reflected in store")
+
+        let token = playaDB.observeEventOccurrenceStore(
+            filter: EventFilter(),
+            onChange: { store in
+                if store.contains(where: { $0.eventUID == "observe-fav" && $0.isFavorite }) {
+                    favorited.fulfill()
+                }
+            },
+            onError: { error in
+                XCTFail("Observation error: \(error)")
+            }
+        )
+        defer { token.cancel() }
+
+        try await setFavorite(objectID: "observe-fav")
+        await fulfillment(of: [favorited], timeout: 2.0)
+    }
+}
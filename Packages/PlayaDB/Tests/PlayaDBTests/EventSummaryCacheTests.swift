@@ -0,0 +1,86 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for the persistent, content-keyed LRU cache of AI event overviews.
+final class EventSummaryCacheTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private let eventUID = "78ZvNxSeeZQbaeHuughD"
+    private let artUID = "a2IVI000000yWeZ2AU"
+    private let campUID = "a1XVI000008zSaf2AE"
+    private var hostUID: String!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+        hostUID = try await playaDB.dbQueue.read { [eventUID] db in
+            try String.fetchOne(db, sql: "SELECT hosted_by_camp FROM event_objects WHERE uid = ?", arguments: [eventUID])
+        }
+        XCTAssertNotNil(hostUID)
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testRoundTrip() async throws {
+        let missing = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 1)
+        XCTAssertNil(missing)
+
+        try await playaDB.saveEventSummary("Tarot all week", hostUID: hostUID, version: 1)
+        let cached = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 1)
+        XCTAssertEqual(cached, "Tarot all week")
+    }
+
+    func testOtherVersionMisses() async throws {
+        try await playaDB.saveEventSummary("Tarot all week", hostUID: hostUID, version: 1)
+        let cached = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 2)
+        XCTAssertNil(cached)
+    }
+
+    func testChangedEventInvalidates() async throws {
+        try await playaDB.saveEventSummary("Tarot all week", hostUID: hostUID, version: 1)
+        try await playaDB.dbQueue.write { [eventUID] db in
+            try db.execute(
+                sql: "UPDATE object_content_hashes SET hash = 'changed' WHERE object_type = 'event' AND object_id = ?",
+                arguments: [eventUID]
+            )
+        }
+        let cached = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 1)
+        XCTAssertNil(cached)
+    }
+
+    func testExpiredEntryMisses() async throws {
+        try await playaDB.saveEventSummary("Tarot all week", hostUID: hostUID, version: 1)
+        playaDB.eventSummaryMaxAge = 0
+        let cached = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 1)
+        XCTAssertNil(cached)
+    }
+
+    func testEvictsLeastRecentlyUsed() async throws {
+        playaDB.eventSummaryCacheLimit = 2
+        try await playaDB.saveEventSummary("host", hostUID: hostUID, version: 1)
+        try await playaDB.saveEventSummary("art", hostUID: artUID, version: 1)
+        // Using the oldest entry makes the art overview the least recently used
+        _ = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 1)
+        try await playaDB.saveEventSummary("camp", hostUID: campUID, version: 1)
+
+        let host = try await playaDB.cachedEventSummary(hostUID: hostUID, version: 1)
+        let art = try await playaDB.cachedEventSummary(hostUID: artUID, version: 1)
+        let camp = try await playaDB.cachedEventSummary(hostUID: campUID, version: 1)
+        XCTAssertEqual(host, "host")
+        XCTAssertNil(art)
+        XCTAssertEqual(camp, "camp")
+    }
+}
@@ -0,0 +1,121 @@
+import XCTest
+import CoreLocation
+import MapKit
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for compiling filters into single cached SQL statements.
+final class FilterQueryCompilerTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private var dbQueue: DatabaseQueue { playaDB.dbQueue }
+
+    private let region = MKCoordinateRegion(
+        center: CLLocationCoordinate2D(latitude: 40.7864, longitude: -119.2065),
+        span: MKCoordinateSpan(latitudeDelta: 0.2, longitudeDelta: 0.2)
+    )
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Shape
+
+    func testSQLDependsOnShapeNotValues() {
+        let a = FilterQueryCompiler.compile(EventFilter(year: 2025, searchText: "yoga", eventTypeCodes: ["work"]))
+        let b = FilterQueryCompiler.compile(EventFilter(year: 2024, searchText: "dance", eventTypeCodes: ["prty", "food", "work"]))
+        XCTAssertEqual(a.sql, b.sql)
+        XCTAssertNotEqual(a.arguments, b.arguments)
+
+        let c = FilterQueryCompiler.compile(EventFilter(year: 2025))
+        XCTAssertNotEqual(a.sql, c.sql)
+    }
+
+    func testTimeFiltersBindReferenceDate() {
+        let now = Date(timeIntervalSince1970: 1_756_000_000)
+        let earlier = FilterQueryCompiler.compile(EventFilter(happeningNow: true), now: now.addingTimeInterval(-3600))
+        let later = FilterQueryCompiler.compile(EventFilter(happeningNow: true), now: now)
+        XCTAssertEqual(earlier.sql, later.sql)
+        XCTAssertNotEqual(earlier.arguments, later.arguments)
+    }
+
+    // MARK: - Equivalence
+
+    func testArtMatchesQueryInterfaceRequest() async throws {
+        let art = try await playaDB.fetchArt()
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(art.first))
+        let filters = [
+            ArtFilter(),
+            ArtFilter(year: 2025, region: region, searchText: "curiosity"),
+            ArtFilter(searchText: "no such words"),
+            ArtFilter(onlyWithEvents: true),
+            ArtFilter(onlyFavorites: true),
+        ]
+        for filter in filters {
+            let (compiled, built) = try await dbQueue.read { db in
+                (
+                    try FilterQueryCompiler.compile(filter).fetchAll(ArtObject.self, db).map(\.uid),
+                    try self.playaDB.artRequest(filter: filter).fetchAll(db).map(\.uid)
+                )
+            }
+            XCTAssertEqual(compiled, built, "\(filter)")
+        }
+    }
+
+    func testCampMatchesQueryInterfaceRequest() async throws {
+        let filters = [CampFilter(), CampFilter(year: 2025, searchText: "camp"), CampFilter(region: region)]
+        for filter in filters {
+            let (compiled, built) = try await dbQueue.read { db in
+                (
+                    try FilterQueryCompiler.compile(filter).fetchAll(CampObject.self, db).map(\.uid),
+                    try self.playaDB.campRequest(filter: filter).fetchAll(db).map(\.uid)
+                )
+            }
+            XCTAssertEqual(compiled, built, "\(filter)")
+        }
+    }
+
+    func testMutantVehicleTagFilter() async throws {
+        let all = try await playaDB.fetchMutantVehicles(filter: MutantVehicleFilter())
+        XCTAssertFalse(all.isEmpty)
+        let none = try await playaDB.fetchMutantVehicles(filter: MutantVehicleFilter(tag: "no-such-tag"))
+        XCTAssertTrue(none.isEmpty)
+    }
+
+    func testEventsDecodeJoinedRows() async throws {
+        let all = try await playaDB.fetchEvents()
+        let compiled = try await playaDB.fetchEvents(filter: EventFilter())
+        XCTAssertEqual(compiled.map(\.uid), all.sorted { $0.startDate < $1.startDate }.map(\.uid))
+        XCTAssertEqual(compiled.first?.event.uid, "78ZvNxSeeZQbaeHuughD")
+
+        let typed = try await playaDB.fetchEvents(filter: EventFilter(eventTypeCodes: ["no-such-type"]))
+        XCTAssertTrue(typed.isEmpty)
+        let otherYear = try await playaDB.fetchEvents(filter: EventFilter(year: 1999))
+        XCTAssertTrue(otherYear.isEmpty)
+    }
+
+    func testEventFavoritesMatchEventOrSingleOccurrence() async throws {
+        let occurrences = try await playaDB.fetchEvents(filter: EventFilter())
+        let occurrence = try XCTUnwrap(occurrences.first)
+        try await dbQueue.write { db in
+            var metadata = ObjectMetadata(objectType: DataObjectType.event.rawValue, objectId: occurrence.uid, isFavorite: true)
+            try metadata.save(db)
+        }
+
+        let favorites = try await playaDB.fetchEvents(filter: EventFilter(onlyFavorites: true))
+        XCTAssertEqual(favorites.map(\.uid), [occurrence.uid])
+    }
+}
@@ -0,0 +1,148 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for keyset-paged list windows and counts.
+final class ListWindowTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    /// Art sharing one name, so windows have to page through ties by uid
+    private func insertArt(year: Int, names: [(uid: String, name: String)]) async throws {
+        try await playaDB.dbQueue.write { db in
+            for (uid, name) in names {
+                var art = ArtObject(uid: uid, name: name, year: year)
+                try art.insert(db)
+            }
+        }
+    }
+
+    /// First emission of a window observation
+    private func firstWindow<T>(
+        _ observe: (_ onChange: @escaping (ListWindow<T>) -> Void, _ onError: @escaping (Error) -> Void) -> PlayaDBObservationToken
+    ) async throws -> ListWindow<T> {
+        var token: PlayaDBObservationToken?
+        defer { token?.cancel() }
+        return try await withCheckedThrowingContinuation { continuation in
+            var resumed = false
+            token = observe({ window in
+                guard !resumed else { return }
+                resumed = true
+                continuation.resume(returning: window)
+            }, { error in
+                guard !resumed else { return }
+                resumed = true
+                continuation.resume(throwing: error)
+            })
+        }
+    }
+
+    private func artWindow(_ filter: ArtFilter, _ request: ListWindowRequest) async throws -> ListWindow<ArtObject> {
+        try await firstWindow { onChange, onError in
+            playaDB.observeArt(filter: filter, window: request, onChange: onChange, onError: onError)
+        }
+    }
+
+    private func eventWindow(_ filter: EventFilter, _ request: ListWindowRequest) async throws -> ListWindow<EventObjectOccurrence> {
+        try await firstWindow { onChange, onError in
+            playaDB.observeEvents(filter: filter, window: request, onChange: onChange, onError: onError)
+        }
+    }
+
+    // MARK: - Tests
+
+    func testArtPagesCoverListWithoutGapsOrDuplicates() async throws {
+        try await insertArt(year: 2030, names: [
+            ("art-z", "Zephyr"),
+            ("art-c", "Same Name"),
+            ("art-a", "Same Name"),
+            ("art-b", "Same Name"),
+            ("art-0", "Arch"),
+        ])
+        let filter = ArtFilter(year: 2030)
+
+        var paged: [String] = []
+        var request = ListWindowRequest(limit: 2)
+        var windows = 0
+        while true {
+            let window = try await artWindow(filter, request)
+            XCTAssertLessThanOrEqual(window.rows.count, 2)
+            paged += window.rows.map(\.object.uid)
+            windows += 1
+            guard let next = window.next else { break }
+            request = ListWindowRequest(after: next, limit: 2)
+        }
+
+        XCTAssertEqual(paged, ["art-0", "art-a", "art-b", "art-c", "art-z"])
+        XCTAssertEqual(windows, 3)
+        let all = try await playaDB.fetchArt(filter: filter)
+        XCTAssertEqual(all.map(\.uid), paged)
+        let count = try await playaDB.countArt(filter: filter)
+        XCTAssertEqual(count, 5)
+    }
+
+    func testGrowingWindowExtendsInPlace() async throws {
+        try await insertArt(year: 2030, names: (0..<6).map { ("art-\($0)", "Piece \($0)") })
+        let filter = ArtFilter(year: 2030)
+
+        let small = try await artWindow(filter, ListWindowRequest(limit: 2))
+        let grown = try await artWindow(filter, ListWindowRequest(limit: 4))
+        let everything = try await artWindow(filter, ListWindowRequest(limit: 50))
+
+        XCTAssertTrue(small.hasMore)
+        XCTAssertEqual(Array(grown.rows.prefix(2)).map(\.object.uid), small.rows.map(\.object.uid))
+        XCTAssertEqual(grown.rows.count, 4)
+        XCTAssertEqual(everything.rows.count, 6)
+        XCTAssertFalse(everything.hasMore, "No cursor past the last row")
+    }
+
+    func testEventPagesFollowStartTime() async throws {
+        let filter = EventFilter()
+        let all = try await playaDB.fetchEvents(filter: filter)
+        XCTAssertFalse(all.isEmpty)
+
+        var paged: [String] = []
+        var request = ListWindowRequest(limit: 1)
+        while true {
+            let window = try await eventWindow(filter, request)
+            paged += window.rows.map(\.object.uid)
+            guard let next = window.next else { break }
+            request = ListWindowRequest(after: next, limit: 1)
+        }
+
+        XCTAssertEqual(paged, all.map(\.uid))
+        let count = try await playaDB.countEvents(filter: filter)
+        XCTAssertEqual(count, all.count)
+    }
+
+    func testWindowSQLDependsOnShapeNotCursor() {
+        let first = FilterQueryCompiler.compile(ArtFilter(year: 2025), window: ListWindowRequest(limit: 10))
+        let after = ListCursor(key: "Temple", tiebreaker: "a1")
+        let later = FilterQueryCompiler.compile(ArtFilter(year: 2025), window: ListWindowRequest(after: after, limit: 10))
+        let otherCursor = FilterQueryCompiler.compile(
+            ArtFilter(year: 2024),
+            window: ListWindowRequest(after: ListCursor(key: "Man", tiebreaker: "b2"), limit: 50)
+        )
+        XCTAssertNotEqual(first.sql, later.sql)
+        XCTAssertEqual(later.sql, otherCursor.sql)
+        XCTAssertTrue(FilterQueryCompiler.count(ArtFilter(year: 2025)).sql.hasPrefix("SELECT COUNT(*)"))
+    }
+}
@@ -0,0 +1,171 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for `fetchMapFeatures(filter:)` GeoJSON export and its per-table cache invalidation.
+final class MapFeatureTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private var dbQueue: DatabaseQueue {
+        playaDB.dbQueue
+    }
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    private func insertArt(uid: String, name: String, latitude: Double?, longitude: Double?) async throws {
+        try await dbQueue.write { db in
+            var art = ArtObject(uid: uid, name: name, year: 2025, gpsLatitude: latitude, gpsLongitude: longitude)
+            try art.insert(db)
+        }
+    }
+
+    private func insertEvent(uid: String, locatedAtArt: String?, start: Date, end: Date) async throws {
+        try await dbQueue.write { db in
+            var event = EventObject(
+                uid: uid,
+                name: "Event \(uid)",
+                year: 2025,
+                eventTypeLabel: "Music/Party",
+                eventTypeCode: "prty",
+                locatedAtArt: locatedAtArt
+            )
+            try event.insert(db)
+            var occurrence = EventOccurrence(eventId: uid, startTime: start, endTime: end)
+            try occurrence.insert(db)
+        }
+    }
+
+    private func setFavorite(_ type: DataObjectType, id: String) async throws {
+        try await dbQueue.write { db in
+            var metadata = ObjectMetadata(objectType: type.rawValue, objectId: id, isFavorite: true)
+            try metadata.save(db)
+        }
+    }
+
+    private func decode(_ collection: MapFeatureCollection) throws -> [[String: Any]] {
+        let json = try XCTUnwrap(JSONSerialization.jsonObject(with: collection.geoJSON) as? [String: Any])
+        XCTAssertEqual(json["type"] as? String, "FeatureCollection")
+        return try XCTUnwrap(json["features"] as? [[String: Any]])
+    }
+
+    // MARK: - Tests
+
+    func testGeoJSONContainsLocatedObjectsWithStylingProperties() async throws {
+        try await insertArt(uid: "art-located", name: "Quote \"Tower\"", latitude: 40.7864, longitude: -119.2065)
+        try await insertArt(uid: "art-unlocated", name: "Nowhere", latitude: nil, longitude: nil)
+
+        let collection = try await playaDB.fetchMapFeatures(filter: MapFeatureFilter(art: ArtFilter()))
+        let features = try decode(collection)
+
+        XCTAssertEqual(features.count, collection.features.count)
+        XCTAssertFalse(collection.features.contains { $0.uid == "art-unlocated" })
+
+        let feature = try XCTUnwrap(features.first {
+            ($0["properties"] as? [String: Any])?["id"] as? String == "art-located"
+        })
+        let properties = try XCTUnwrap(feature["properties"] as? [String: Any])
+        XCTAssertEqual(properties["type"] as? String, "art")
+        XCTAssertEqual(properties["name"] as? String, "Quote \"Tower\"")
+        XCTAssertEqual(properties["fav"] as? Int, 0)
+        let coordinates = try XCTUnwrap((feature["geometry"] as? [String: Any])?["coordinates"] as? [Double])
+        XCTAssertEqual(coordinates[0], -119.2065, accuracy: 0.000001)
+        XCTAssertEqual(coordinates[1], 40.7864, accuracy: 0.000001)
+    }
+
+    func testEventFeaturesUseHostLocationAndCarryTypeCode() async throws {
+        try await insertArt(uid: "art-host", name: "Host", latitude: 40.78, longitude: -119.21)
+        let start = Date(timeIntervalSince1970: 1_756_000_000)
+        try await insertEvent(uid: "event-at-art", locatedAtArt: "art-host", start: start, end: start.addingTimeInterval(3600))
+
+        let collection = try await playaDB.fetchMapFeatures(filter: MapFeatureFilter(events: EventFilter()))
+        let feature = try XCTUnwrap(collection.features.first { $0.objectType == .event })
+
+        XCTAssertEqual(feature.latitude, 40.78, accuracy: 0.000001)
+        XCTAssertEqual(feature.eventTypeCode, "prty")
+        XCTAssertEqual(feature.startDate, start)
+
+        let properties = try XCTUnwrap(try decode(collection)
+            .compactMap { $0["properties"] as? [String: Any] }
+            .first { $0["id"] as? String == feature.uid })
+        XCTAssertEqual(properties["code"] as? String, "prty")
+        XCTAssertEqual(properties["start"] as? Int, 1_756_000_000)
+    }
+
+    func testCombinedFilterConcatenatesCategories() async throws {
+        try await insertArt(uid: "art-combined", name: "Combined", latitude: 40.78, longitude: -119.21)
+        try await insertEvent(uid: "event-combined", locatedAtArt: "art-combined", start: Date(), end: Date().addingTimeInterval(60))
+
+        let collection = try await playaDB.fetchMapFeatures(filter: MapFeatureFilter(art: ArtFilter(), events: EventFilter()))
+
+        XCTAssertEqual(try decode(collection).count, collection.features.count)
+        XCTAssertTrue(collection.features.contains { $0.uid == "art-combined" })
+        XCTAssertTrue(collection.features.contains { $0.objectType == .event })
+    }
+
+    func testFavoriteToggleInvalidatesCachedFeatures() async throws {
+        try await insertArt(uid: "art-fav", name: "Fav", latitude: 40.78, longitude: -119.21)
+        let filter = MapFeatureFilter(art: ArtFilter())
+
+        let before = try await playaDB.fetchMapFeatures(filter: filter)
+        XCTAssertEqual(before.features.first { $0.uid == "art-fav" }?.isFavorite, false)
+
+        try await setFavorite(.art, id: "art-fav")
+
+        let after = try await playaDB.fetchMapFeatures(filter: filter)
+        XCTAssertEqual(after.features.first { $0.uid == "art-fav" }?.isFavorite, true)
+    }
+
+    func testCacheIsInvalidatedOnlyForChangedType() async throws {
+        try await insertArt(uid: "art-cached", name: "Cached", latitude: 40.78, longitude: -119.21)
+        _ = try await playaDB.fetchMapFeatures(filter: MapFeatureFilter(art: ArtFilter(), camps: CampFilter()))
+
+        XCTAssertNotNil(playaDB.mapFeatureCache.fragment(type: .art, key: ArtFilter()))
+        XCTAssertNotNil(playaDB.mapFeatureCache.fragment(type: .camp, key: CampFilter()))
+
+        try await insertArt(uid: "art-new", name: "New", latitude: 40.77, longitude: -119.22)
+
+        XCTAssertNil(playaDB.mapFeatureCache.fragment(type: .art, key: ArtFilter()))
+        XCTAssertNotNil(playaDB.mapFeatureCache.fragment(type: .camp, key: CampFilter()))
+
+        let refreshed = try await playaDB.fetchMapFeatures(filter: MapFeatureFilter(art: ArtFilter()))
+        XCTAssertTrue(refreshed.features.contains { $0.uid == "art-new" })
+    }
+
+    func testRelativeEventFilterExpires() async throws {
+        let cache = MapFeatureCache()
+        let fragment = MapFeatureCache.Fragment(features: [], encoded: Data())
+        let now = Date()
+        cache.store(fragment, type: .event, key: EventFilter(happeningNow: true), generation: 0,
+                    expiresAt: now.addingTimeInterval(PlayaDBImpl.relativeMapFeatureLifetime))
+
+        XCTAssertNotNil(cache.fragment(type: .event, key: EventFilter(happeningNow: true), now: now))
+        XCTAssertNil(cache.fragment(type: .event, key: EventFilter(happeningNow: true),
+                                    now: now.addingTimeInterval(PlayaDBImpl.relativeMapFeatureLifetime + 1)))
+    }
+
+    func testStaleGenerationIsNotStored() {
+        let cache = MapFeatureCache()
+        let generation = cache.generation(for: .art)
+        cache.invalidate([.art])
+        cache.store(MapFeatureCache.Fragment(features: [], encoded: Data()), type: .art, key: ArtFilter(),
+                    generation: generation, expiresAt: nil)
+
+        XCTAssertNil(cache.fragment(type: .art, key: ArtFilter()))
+    }
+}
@@ -1,4 +1,5 @@
 import XCTest
+import GRDB
 @testable import PlayaDB
 import PlayaAPITestHelpers
 
@@ -43,4 +44,22 @@ final class MetadataUpdateTests: XCTestCase {
         let metadata = try await playaDB.metadata(for: art)
         XCTAssertEqual(metadata.lastViewed, date)
     }
+
+    func testExistingMetadataDoesNotCreateRows() async throws {
+        let arts = try await playaDB.fetchArt()
+        let art = try XCTUnwrap(arts.first)
+        let impl = try XCTUnwrap(playaDB as? PlayaDBImpl)
+        try await impl.dbQueue.write { db in
+            _ = try ObjectMetadata.deleteAll(db)
+        }
+
+        let missing = try await playaDB.existingMetadata(for: art)
+        XCTAssertNil(missing)
+        let count = try await impl.dbQueue.read { db in try ObjectMetadata.fetchCount(db) }
+        XCTAssertEqual(count, 0)
+
+        try await playaDB.setUserNotes("hello", for: art)
+        let stored = try await playaDB.existingMetadata(for: art)
+        XCTAssertEqual(stored?.userNotes, "hello")
+    }
 }
@@ -0,0 +1,128 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for sharing filtered observations between subscribers with equal filters.
+final class ObservationMultiplexerTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testEqualFiltersShareOneObservation() async throws {
+        let first = expectation(description: "first subscriber")
+        let second = expectation(description: "second subscriber")
+        let tokenA = playaDB.observeArt(filter: ArtFilter(), onChange: { _ in first.fulfill() }, onError: { XCTFail("\($0)") })
+        let tokenB = playaDB.observeArt(filter: ArtFilter(), onChange: { _ in second.fulfill() }, onError: { XCTFail("\($0)") })
+        XCTAssertEqual(playaDB.sharedObservations.activeCount, 1)
+
+        let tokenC = playaDB.observeArt(filter: ArtFilter(onlyFavorites: true), onChange: { _ in }, onError: { _ in })
+        let tokenD = playaDB.observeCamps(filter: CampFilter(), onChange: { _ in }, onError: { _ in })
+        XCTAssertEqual(playaDB.sharedObservations.activeCount, 3)
+
+        await fulfillment(of: [first, second], timeout: 5)
+        tokenA.cancel()
+        XCTAssertEqual(playaDB.sharedObservations.activeCount, 3)
+        tokenB.cancel()
+        tokenC.cancel()
+        tokenD.cancel()
+        XCTAssertEqual(playaDB.sharedObservations.activeCount, 0)
+    }
+
+    func testLateSubscriberReceivesLastValue() async throws {
+        let initial = expectation(description: "initial value")
+        let token = playaDB.observeArt(filter: ArtFilter(), onChange: { _ in initial.fulfill() }, onError: { XCTFail("\($0)") })
+        await fulfillment(of: [initial], timeout: 5)
+
+        let replayed = expectation(description: "replayed value")
+        var rows: [ListRow<ArtObject>] = []
+        let late = playaDB.observeArt(filter: ArtFilter(), onChange: { value in
+            rows = value
+            replayed.fulfill()
+        }, onError: { XCTFail("\($0)") })
+        await fulfillment(of: [replayed], timeout: 5)
+
+        XCTAssertEqual(rows.map(\.object.uid), ["a2IVI000000yWeZ2AU"])
+        token.cancel()
+        late.cancel()
+    }
+
+    func testChangesFanOutToAllSubscribers() async throws {
+        var favoritesA: [Bool?] = []
+        var favoritesB: [Bool?] = []
+        let updatedA = expectation(description: "A sees favorite")
+        let updatedB = expectation(description: "B sees favorite")
+        let tokenA = playaDB.observeArt(filter: ArtFilter(), onChange: { rows in
+            favoritesA.append(rows.first?.metadata?.isFavorite)
+            if rows.first?.metadata?.isFavorite == true { updatedA.fulfill() }
+        }, onError: { XCTFail("\($0)") })
+        let tokenB = playaDB.observeArt(filter: ArtFilter(), onChange: { rows in
+            favoritesB.append(rows.first?.metadata?.isFavorite)
+            if rows.first?.metadata?.isFavorite == true { updatedB.fulfill() }
+        }, onError: { XCTFail("\($0)") })
+
+        let art = try await playaDB.fetchArt()
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(art.first))
+        await fulfillment(of: [updatedA, updatedB], timeout: 5)
+
+        XCTAssertEqual(favoritesA.last, true)
+        XCTAssertEqual(favoritesB.last, true)
+        tokenA.cancel()
+        tokenB.cancel()
+    }
+
+    func testCancelledLateSubscriberIsNotReplayed() async throws {
+        let initial = expectation(description: "initial value")
+        let token = playaDB.observeArt(filter: ArtFilter(), onChange: { _ in initial.fulfill() }, onError: { XCTFail("\($0)") })
+        await fulfillment(of: [initial], timeout: 5)
+
+        let late = playaDB.observeArt(filter: ArtFilter(), onChange: { _ in XCTFail("Cancelled subscriber received a value") }, onError: { _ in })
+        late.cancel()
+
+        let drained = expectation(description: "main queue drained")
+        DispatchQueue.main.async { drained.fulfill() }
+        await fulfillment(of: [drained], timeout: 5)
+        token.cancel()
+    }
+
+    func testReplayIsSkippedAfterNewerDelivery() async throws {
+        let multiplexer = ObservationMultiplexer()
+        let key = ObservationMultiplexer.Key(kind: "test", filter: 0)
+        var send: ((Int) -> Void)?
+        let first = multiplexer.observe(key, onChange: { (_: Int) in }, onError: { _ in }) { onChange, _ in
+            send = onChange
+            return PlayaDBObservationToken(AnyDatabaseCancellable {})
+        }
+        send?(1)
+
+        // Joins while 1 is the last value, then 2 arrives before the replay runs
+        var received: [Int] = []
+        let late = multiplexer.observe(key, onChange: { (value: Int) in received.append(value) }, onError: { _ in }) { _, _ in
+            XCTFail("Joining subscribers share the running observation")
+            return PlayaDBObservationToken(AnyDatabaseCancellable {})
+        }
+        send?(2)
+
+        let drained = expectation(description: "main queue drained")
+        DispatchQueue.main.async { drained.fulfill() }
+        await fulfillment(of: [drained], timeout: 5)
+        XCTAssertEqual(received, [2])
+        first.cancel()
+        late.cancel()
+    }
+}
@@ -631,4 +631,53 @@ final class PlayaDBImportTests: XCTestCase {
         let favsAfter = try await playaDB.getFavorites()
         XCTAssertFalse(favsAfter.contains(where: { $0.uid == art.uid }))
     }
+
+    // MARK: - Data Pack Import Tests
+
+    func testDataPackImportMatchesJSONImport() async throws {
+        var writer = PlayaDataPackWriter()
+        try writer.addJSON(MockAPIData.artJSON, as: .art)
+        try writer.addJSON(MockAPIData.campJSON, as: .camps)
+        try writer.addJSON(MockAPIData.eventJSON, as: .events)
+        try writer.addJSON(MockAPIData.mutantVehicleJSON, as: .mutantVehicles)
+        let pack = try PlayaDataPack(data: writer.encoded())
+
+        try await playaDB.importFromDataPack(pack)
+        let packManifest = try await playaDB.fetchDeltaManifest()
+        let packArt = try await playaDB.fetchArt()
+        let packEvents = try await playaDB.fetchEvents()
+        let packMVs = try await playaDB.fetchMutantVehicles()
+
+        let jsonDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await jsonDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+        let jsonManifest = try await jsonDB.fetchDeltaManifest()
+        let jsonArt = try await jsonDB.fetchArt()
+        let jsonEvents = try await jsonDB.fetchEvents()
+
+        XCTAssertEqual(packManifest, jsonManifest, "Both paths should store identical objects")
+        XCTAssertEqual(packArt.map(\.uid), jsonArt.map(\.uid))
+        XCTAssertEqual(packEvents.map(\.startDate), jsonEvents.map(\.startDate))
+        XCTAssertEqual(packMVs.count, 2)
+
+        let updateInfo = try await playaDB.getUpdateInfo()
+        XCTAssertEqual(Set(updateInfo.map(\.dataType)), Set(DataObjectType.allCases.map(\.rawValue)))
+    }
+
+    func testDataPackImportRequiresCoreSections() async throws {
+        var writer = PlayaDataPackWriter()
+        try writer.addJSON(MockAPIData.artJSON, as: .art)
+        let pack = try PlayaDataPack(data: writer.encoded())
+
+        do {
+            try await playaDB.importFromDataPack(pack)
+            XCTFail("Expected an import error")
+        } catch {}
+        let updateInfo = try await playaDB.getUpdateInfo()
+        XCTAssertTrue(updateInfo.isEmpty)
+    }
 }
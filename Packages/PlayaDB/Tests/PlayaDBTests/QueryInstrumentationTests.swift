@@ -0,0 +1,85 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for opt-in query, observation and write instrumentation.
+final class QueryInstrumentationTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    private func operation(_ name: String, _ kind: PlayaDBOperationStats.Kind) -> PlayaDBOperationStats? {
+        playaDB.instrumentationStats().operations.first { $0.name == name && $0.kind == kind }
+    }
+
+    // MARK: - Tests
+
+    func testDisabledRecordsNothing() async throws {
+        XCTAssertFalse(playaDB.isInstrumentationEnabled)
+        _ = try await playaDB.fetchArt()
+        XCTAssertTrue(playaDB.instrumentationStats().operations.isEmpty)
+    }
+
+    func testQueriesRecordCountAndRows() async throws {
+        playaDB.setInstrumentationEnabled(true)
+        let art = try await playaDB.fetchArt()
+        _ = try await playaDB.fetchArt()
+
+        let stats = try XCTUnwrap(operation("fetchArt()", .query))
+        XCTAssertEqual(stats.count, 2)
+        XCTAssertEqual(stats.rows, art.count * 2)
+        XCTAssertGreaterThan(stats.totalDuration, 0)
+        XCTAssertGreaterThanOrEqual(stats.maxDuration, stats.averageDuration)
+
+        playaDB.resetInstrumentationStats()
+        XCTAssertNil(operation("fetchArt()", .query))
+    }
+
+    func testWritesRecordChangedRows() async throws {
+        playaDB.setInstrumentationEnabled(true)
+        let art = try await playaDB.fetchArt()
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(art.first))
+
+        let stats = try XCTUnwrap(operation("setFavorite(_:for:)", .write))
+        XCTAssertEqual(stats.count, 1)
+        XCTAssertGreaterThanOrEqual(stats.rows, 1)
+    }
+
+    func testObservationRefiresAreCounted() async throws {
+        playaDB.setInstrumentationEnabled(true)
+        let initial = expectation(description: "initial value")
+        initial.assertForOverFulfill = false
+        let favorited = expectation(description: "favorite re-fire")
+        favorited.assertForOverFulfill = false
+        let token = playaDB.observeArt(filter: ArtFilter(), onChange: { rows in
+            if rows.first?.metadata?.isFavorite == true {
+                favorited.fulfill()
+            } else {
+                initial.fulfill()
+            }
+        }, onError: { XCTFail("\($0)") })
+        await fulfillment(of: [initial], timeout: 5)
+
+        let art = try await playaDB.fetchArt()
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(art.first))
+        await fulfillment(of: [favorited], timeout: 5)
+
+        let stats = try XCTUnwrap(operation("observeArt(filter:)", .observation))
+        XCTAssertGreaterThanOrEqual(stats.count, 2)
+        token.cancel()
+    }
+}
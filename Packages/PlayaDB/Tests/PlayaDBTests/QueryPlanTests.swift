@@ -0,0 +1,540 @@
+import XCTest
+import CoreLocation
+import MapKit
+import GRDB
+import SQLite3
+@testable import PlayaDB
+import iBurn2025APIData
+
+/// Query-plan regression tests. Runs `EXPLAIN QUERY PLAN` for every filter combination and
+/// every statement the public `PlayaDB` queries issue, and asserts they keep using the
+/// indexes, R*Trees and FTS tables they were written for. Runs against the real 2025 data,
+/// imported once for the whole suite, and reports scan counters for the common filters.
+///
+/// Plans are asserted on what's stable across SQLite versions and planner heuristics: which
+/// tables are read end to end, and whether the virtual tables are consulted with their
+/// constraints. Index names in `SEARCH` lines are free to change.
+final class QueryPlanTests: XCTestCase {
+    private static var sharedDB: PlayaDBImpl?
+    private static var sharedFixtures: Fixtures?
+
+    private var playaDB: PlayaDBImpl!
+    private var fixtures: Fixtures!
+
+    private var dbQueue: DatabaseQueue { playaDB.dbQueue }
+
+    /// Thursday afternoon of the 2025 event, so time filters match real occurrences
+    private let now = Date(timeIntervalSince1970: 1_756_400_000)
+
+    /// Center Camp and the inner streets around it
+    private let region = MKCoordinateRegion(
+        center: CLLocationCoordinate2D(latitude: 40.7864, longitude: -119.2065),
+        span: MKCoordinateSpan(latitudeDelta: 0.02, longitudeDelta: 0.02)
+    )
+
+    /// Objects picked from the real data for lookups, plus the user data that makes the
+    /// metadata queries non-empty
+    private struct Fixtures {
+        let art: ArtObject
+        let camp: CampObject
+        let event: EventObject
+        let occurrence: EventObjectOccurrence
+        let mutantVehicle: MutantVehicleObject
+        let mutantVehicleTag: String
+        let hostArtUID: String
+    }
+
+    override func setUp() async throws {
+        try await super.setUp()
+        if Self.sharedDB == nil {
+            let playaDB = try PlayaDBImpl(dbPath: ":memory:")
+            try await playaDB.importFromData(
+                artData: try iBurn2025APIData.DataFile.art.loadData(),
+                campData: try iBurn2025APIData.DataFile.camp.loadData(),
+                eventData: try iBurn2025APIData.DataFile.event.loadData(),
+                mvData: try iBurn2025APIData.DataFile.mv.loadData()
+            )
+            Self.sharedFixtures = try await Self.makeFixtures(playaDB)
+            Self.sharedDB = playaDB
+        }
+        playaDB = Self.sharedDB
+        fixtures = Self.sharedFixtures
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        fixtures = nil
+        try await super.tearDown()
+    }
+
+    private static func makeFixtures(_ playaDB: PlayaDBImpl) async throws -> Fixtures {
+        let (campUID, artUID, tag) = try await playaDB.dbQueue.read { db in
+            (
+                try String.fetchOne(db, sql: "SELECT hosted_by_camp FROM event_objects WHERE hosted_by_camp IS NOT NULL LIMIT 1"),
+                try String.fetchOne(db, sql: "SELECT located_at_art FROM event_objects WHERE located_at_art IS NOT NULL LIMIT 1"),
+                try String.fetchOne(db, sql: "SELECT tag FROM mv_tags LIMIT 1")
+            )
+        }
+        let fetchedCamp = try await playaDB.fetchCamp(uid: try XCTUnwrap(campUID))
+        let camp = try XCTUnwrap(fetchedCamp)
+        let hosted = try await playaDB.fetchEvents(hostedByCampUID: camp.uid)
+        let occurrence = try XCTUnwrap(hosted.first)
+        let allArt = try await playaDB.fetchArt()
+        let art = try XCTUnwrap(allArt.first)
+        let mutantVehicles = try await playaDB.fetchMutantVehicles()
+        let mutantVehicle = try XCTUnwrap(mutantVehicles.first)
+
+        for object in [art, camp, occurrence.event, mutantVehicle] as [any DataObject] {
+            try await playaDB.setFavorite(true, for: object)
+        }
+        try await playaDB.setLastViewed(Date(), for: art)
+        try await playaDB.saveUserMapPin(UserMapPin(id: "pin", title: "Home", latitude: 40.78, longitude: -119.2, pinType: "home"))
+
+        return Fixtures(
+            art: art,
+            camp: camp,
+            event: occurrence.event,
+            occurrence: occurrence,
+            mutantVehicle: mutantVehicle,
+            mutantVehicleTag: try XCTUnwrap(tag),
+            hostArtUID: try XCTUnwrap(artUID)
+        )
+    }
+
+    // MARK: - Filter Combinations
+
+    func testArtFilterPlans() async throws {
+        let filters = combinations(of: ArtFilter(), [
+            { $0.year = 2025 },
+            { $0.region = self.region },
+            { $0.searchText = "fire" },
+            { $0.onlyFavorites = true },
+            { $0.onlyWithEvents = true },
+        ])
+        let plans = try await explain(filters.map { FilterQueryCompiler.compile($0) })
+        XCTAssertEqual(plans.count, 32)
+
+        for (filter, plan) in zip(filters, plans) {
+            assertCommonInvariants(plan, "\(filter)")
+            assertPlaceFilterPlan(plan, table: "art_objects", region: filter.region != nil, search: filter.searchText != nil)
+        }
+    }
+
+    func testCampFilterPlans() async throws {
+        let filters = combinations(of: CampFilter(), [
+            { $0.year = 2025 },
+            { $0.region = self.region },
+            { $0.searchText = "coffee" },
+            { $0.onlyFavorites = true },
+        ])
+        let plans = try await explain(filters.map { FilterQueryCompiler.compile($0) })
+
+        for (filter, plan) in zip(filters, plans) {
+            assertCommonInvariants(plan, "\(filter)")
+            assertPlaceFilterPlan(plan, table: "camp_objects", region: filter.region != nil, search: filter.searchText != nil)
+        }
+    }
+
+    func testMutantVehicleFilterPlans() async throws {
+        let filters = combinations(of: MutantVehicleFilter(), [
+            { $0.year = 2025 },
+            { $0.searchText = "dragon" },
+            { $0.onlyFavorites = true },
+            { $0.tag = "fire" },
+        ])
+        let plans = try await explain(filters.map { FilterQueryCompiler.compile($0) })
+
+        for (filter, plan) in zip(filters, plans) {
+            let label = "\(filter)"
+            assertCommonInvariants(plan, label)
+            if filter.searchText != nil {
+                XCTAssertTrue(plan.matchesFTS("mv_objects_fts"), "FTS bypassed for \(label)\n\(plan)")
+                XCTAssertEqual(plan.fullScans, [], "Full scan despite FTS for \(label)\n\(plan)")
+            }
+            XCTAssertFalse(plan.fullScans.contains("mv_tags"), "Scans mv_tags for \(label)\n\(plan)")
+        }
+    }
+
+    func testEventFilterPlans() async throws {
+        // One time constraint at most, as in `EventFilter`: none, not expired, now, soon
+        let timeModes: [(inout EventFilter) -> Void] = [
+            { _ in },
+            { $0.includeExpired = false },
+            { $0.happeningNow = true },
+            { $0.startingWithinHours = 2 },
+        ]
+        let filters = timeModes.flatMap { mode -> [EventFilter] in
+            var base = EventFilter()
+            mode(&base)
+            return combinations(of: base, [
+                { $0.startDate = self.now },
+                { $0.endDate = self.now.addingTimeInterval(86_400) },
+                { $0.activeWindow = DateInterval(start: self.now, duration: 7200) },
+                { $0.searchText = "yoga" },
+                { $0.region = self.region },
+                { $0.onlyFavorites = true },
+                { $0.year = 2025 },
+                { $0.eventTypeCodes = ["work", "prty"] },
+            ])
+        }
+        XCTAssertEqual(filters.count, 1024)
+
+        for selection in [FilterQueryCompiler.EventSelection.joined, .occurrences] {
+            let plans = try await explain(filters.map { FilterQueryCompiler.compile($0, selecting: selection, now: now) })
+            for (filter, plan) in zip(filters, plans) {
+                let label = "\(selection) \(filter)"
+                assertCommonInvariants(plan, label)
+
+                if filter.region != nil {
+                    // Every bound is a constraint on the R*Tree, not a filter on its output
+                    let index = plan.virtualTableIndex("event_occurrence_rtree")
+                    XCTAssertTrue(index?.hasPrefix("2:") == true && index!.count > 2,
+                                  "R*Tree unconstrained for \(label)\n\(plan)")
+                }
+                if filter.searchText != nil {
+                    XCTAssertTrue(plan.matchesFTS("event_objects_fts"), "FTS bypassed for \(label)\n\(plan)")
+                }
+                let hasTimeBound = filter.happeningNow || filter.startingWithinHours != nil
+                    || filter.startDate != nil || filter.endDate != nil || filter.activeWindow != nil
+                if hasTimeBound || filter.region != nil || filter.searchText != nil {
+                    XCTAssertEqual(plan.fullScans, [], "Full scan despite an indexed predicate for \(label)\n\(plan)")
+                }
+                // Hosts are looked up by primary key from each row
+                XCTAssertFalse(plan.fullScans.contains("camp_objects"), "Scans camps for \(label)\n\(plan)")
+                XCTAssertFalse(plan.fullScans.contains("art_objects"), "Scans art for \(label)\n\(plan)")
+            }
+        }
+    }
+
+    // MARK: - Public Queries
+
+    func testListQueryPlans() async throws {
+        try await assertPlans("fetchArt", scanning: ["art_objects"]) { _ = try await self.playaDB.fetchArt() }
+        try await assertPlans("fetchCamps", scanning: ["camp_objects"]) { _ = try await self.playaDB.fetchCamps() }
+        try await assertPlans("fetchEvents", scanning: ["event_objects"]) { _ = try await self.playaDB.fetchEvents() }
+        try await assertPlans("fetchMutantVehicles", scanning: ["mv_objects"]) { _ = try await self.playaDB.fetchMutantVehicles() }
+        try await assertPlans("fetchArtImageURLs", scanning: ["art_images"]) { _ = try await self.playaDB.fetchArtImageURLs() }
+        try await assertPlans("fetchCampImageURLs", scanning: ["camp_images"]) { _ = try await self.playaDB.fetchCampImageURLs() }
+        try await assertPlans("fetchMutantVehicleImageURLs", scanning: ["mv_images"]) { _ = try await self.playaDB.fetchMutantVehicleImageURLs() }
+        try await assertPlans("fetchCachedColorObjectIDs", scanning: ["thumbnail_colors"]) { _ = try await self.playaDB.fetchCachedColorObjectIDs() }
+        try await assertPlans("fetchUserMapPins", scanning: ["user_map_pins"]) { _ = try await self.playaDB.fetchUserMapPins() }
+        try await assertPlans("getUpdateInfo", scanning: ["update_info"]) { _ = try await self.playaDB.getUpdateInfo() }
+        try await assertPlans("fetchDeltaManifest", scanning: ["object_content_hashes", "update_info"]) {
+            _ = try await self.playaDB.fetchDeltaManifest()
+        }
+        try await assertPlans("fetchMapFeatures", scanning: ["art_objects", "camp_objects", "event_occurrences", "event_objects"]) {
+            _ = try await self.playaDB.fetchMapFeatures(filter: MapFeatureFilter(art: ArtFilter(), camps: CampFilter(), events: EventFilter()))
+        }
+        try await assertPlans("fetchEventOccurrenceStore", scanning: ["event_occurrences", "event_objects"]) {
+            _ = try await self.playaDB.fetchEventOccurrenceStore(filter: EventFilter())
+        }
+    }
+
+    func testTimeQueryPlans() async throws {
+        try await assertPlans("fetchEvents(on:)") { _ = try await self.playaDB.fetchEvents(on: self.now) }
+        try await assertPlans("fetchEvents(from:to:)") {
+            _ = try await self.playaDB.fetchEvents(from: self.now, to: self.now.addingTimeInterval(7200))
+        }
+        try await assertPlans("fetchCurrentEvents") { _ = try await self.playaDB.fetchCurrentEvents(self.now) }
+        try await assertPlans("fetchUpcomingEvents") { _ = try await self.playaDB.fetchUpcomingEvents(within: 2, from: self.now) }
+    }
+
+    func testSpatialAndSearchQueryPlans() async throws {
+        let plans = try await assertPlans("fetchObjects(in:)") { _ = try await self.playaDB.fetchObjects(in: self.region) }
+        XCTAssertTrue(plans.contains { $0.virtualTableIndex("spatial_index") != nil }, "R*Tree bypassed\n\(plans)")
+
+        let searchPlans = try await assertPlans("searchObjects") { _ = try await self.playaDB.searchObjects("fire") }
+        for table in ["art_objects_fts", "camp_objects_fts", "event_objects_fts", "mv_objects_fts"] {
+            XCTAssertTrue(searchPlans.contains { $0.matchesFTS(table) }, "\(table) bypassed\n\(searchPlans)")
+        }
+    }
+
+    func testLookupQueryPlans() async throws {
+        let fixtures = self.fixtures!
+        try await assertPlans("fetchArt(uid:)") { _ = try await self.playaDB.fetchArt(uid: fixtures.art.uid) }
+        try await assertPlans("fetchCamp(uid:)") { _ = try await self.playaDB.fetchCamp(uid: fixtures.camp.uid) }
+        try await assertPlans("fetchEvent(uid:)") { _ = try await self.playaDB.fetchEvent(uid: fixtures.event.uid) }
+        try await assertPlans("fetchMutantVehicle(uid:)") { _ = try await self.playaDB.fetchMutantVehicle(uid: fixtures.mutantVehicle.uid) }
+        try await assertPlans("fetchOccurrences(forEventUID:)") { _ = try await self.playaDB.fetchOccurrences(forEventUID: fixtures.event.uid) }
+        try await assertPlans("fetchEvents(hostedByCampUID:)") { _ = try await self.playaDB.fetchEvents(hostedByCampUID: fixtures.camp.uid) }
+        try await assertPlans("fetchEvents(locatedAtArtUID:)") { _ = try await self.playaDB.fetchEvents(locatedAtArtUID: fixtures.hostArtUID) }
+        try await assertPlans("fetchThumbnailColors") { _ = try await self.playaDB.fetchThumbnailColors(objectId: fixtures.art.uid) }
+        try await assertPlans("fetchObjects(byUIDs:)") {
+            _ = try await self.playaDB.fetchObjects(byUIDs: [fixtures.art.uid, fixtures.camp.uid, fixtures.event.uid])
+        }
+        for uid in [fixtures.art.uid, fixtures.camp.uid, fixtures.event.uid, fixtures.occurrence.uid, fixtures.mutantVehicle.uid] {
+            try await assertPlans("fetchDetailBundle(\(uid))") { _ = try await self.playaDB.fetchDetailBundle(uid: uid) }
+        }
+    }
+
+    func testMetadataQueryPlans() async throws {
+        let art = fixtures.art
+        try await assertPlans("metadata(for:)") { _ = try await self.playaDB.metadata(for: art) }
+        try await assertPlans("isFavorite") { _ = try await self.playaDB.isFavorite(art) }
+        try await assertPlans("getFavorites") { _ = try await self.playaDB.getFavorites() }
+        try await assertPlans("fetchFavoriteEvents") { _ = try await self.playaDB.fetchFavoriteEvents() }
+        // Walks idx_object_metadata_last_viewed newest first and stops at the limit
+        try await assertPlans("fetchRecentlyViewed", scanning: ["object_metadata"]) {
+            _ = try await self.playaDB.fetchRecentlyViewed(limit: 20)
+        }
+        try await assertPlans("fetchRecentlyViewedWithDates", scanning: ["object_metadata"]) {
+            _ = try await self.playaDB.fetchRecentlyViewedWithDates(limit: 20)
+        }
+    }
+
+    // MARK: - Real Data Counters
+
+    /// Reports rows returned and rows stepped through by full scans for the filters the app
+    /// uses most. Indexed filters must not walk the table they filter.
+    func testRealDataScanCounters() async throws {
+        let (occurrenceCount, artCount, campCount) = try await dbQueue.read { db in
+            (
+                try EventOccurrence.fetchCount(db),
+                try ArtObject.fetchCount(db),
+                try CampObject.fetchCount(db)
+            )
+        }
+        let window = DateInterval(start: now, duration: 7200)
+        let cases: [(label: String, query: CompiledFilterQuery, indexedOver: Int?)] = [
+            ("art all", FilterQueryCompiler.compile(ArtFilter()), nil),
+            ("art region", FilterQueryCompiler.compile(ArtFilter(region: region)), artCount),
+            ("art search", FilterQueryCompiler.compile(ArtFilter(searchText: "fire")), artCount),
+            ("art favorites", FilterQueryCompiler.compile(ArtFilter(onlyFavorites: true)), nil),
+            ("camps all", FilterQueryCompiler.compile(CampFilter()), nil),
+            ("camps region", FilterQueryCompiler.compile(CampFilter(region: region)), campCount),
+            ("camps search", FilterQueryCompiler.compile(CampFilter(searchText: "coffee")), campCount),
+            ("mvs tag", FilterQueryCompiler.compile(MutantVehicleFilter(tag: fixtures.mutantVehicleTag)), nil),
+            ("events all", FilterQueryCompiler.compile(EventFilter(), now: now), nil),
+            ("events upcoming", FilterQueryCompiler.compile(EventFilter.upcoming, now: now), nil),
+            ("events now", FilterQueryCompiler.compile(EventFilter.happening, now: now), occurrenceCount),
+            ("events soon", FilterQueryCompiler.compile(EventFilter.startingSoon(hours: 2), now: now), occurrenceCount),
+            ("events day", FilterQueryCompiler.compile(EventFilter.forDay(now), now: now), occurrenceCount),
+            ("events window", FilterQueryCompiler.compile(EventFilter(activeWindow: window), now: now), occurrenceCount),
+            ("events region+window", FilterQueryCompiler.compile(EventFilter(region: region, activeWindow: window), now: now), occurrenceCount),
+            ("events search", FilterQueryCompiler.compile(EventFilter(searchText: "yoga"), now: now), occurrenceCount),
+            ("events types", FilterQueryCompiler.compile(EventFilter(eventTypeCodes: ["work"]), now: now), nil),
+            ("events favorites", FilterQueryCompiler.compile(EventFilter(onlyFavorites: true), now: now), nil),
+        ]
+
+        let counters = try await dbQueue.read { db in
+            try cases.map { try ScanCounters(db, $0.query) }
+        }
+        var report = ["table sizes: \(occurrenceCount) occurrences, \(artCount) art, \(campCount) camps"]
+        for (testCase, counter) in zip(cases, counters) {
+            report.append("\(testCase.label): \(counter)")
+            if let tableSize = testCase.indexedOver {
+                XCTAssertLessThan(counter.fullScanSteps, tableSize, "\(testCase.label) walked the table of \(tableSize): \(counter)")
+            }
+        }
+        // Counters for comparing plans across changes, kept with the test results
+        let attachment = XCTAttachment(string: report.joined(separator: "\n"))
+        attachment.name = "Query plan scan counters"
+        attachment.lifetime = .keepAlways
+        add(attachment)
+    }
+
+    // MARK: - Helpers
+
+    /// Every subset of `options` applied to `base`
+    private func combinations<Filter>(of base: Filter, _ options: [(inout Filter) -> Void]) -> [Filter] {
+        (0..<(1 << options.count)).map { mask in
+            var filter = base
+            for (index, option) in options.enumerated() where mask & (1 << index) != 0 {
+                option(&filter)
+            }
+            return filter
+        }
+    }
+
+    private func explain(_ queries: [CompiledFilterQuery]) async throws -> [QueryPlan] {
+        try await dbQueue.read { db in
+            let tables = try QueryPlan.tables(db)
+            return try queries.map { try QueryPlan(db, sql: $0.sql, arguments: $0.arguments, tables: tables) }
+        }
+    }
+
+    /// Rules every query follows: at most one table is read end to end (the one driving the
+    /// query), and favorites are always looked up through the metadata primary key.
+    private func assertCommonInvariants(_ plan: QueryPlan, _ label: String, file: StaticString = #filePath, line: UInt = #line) {
+        XCTAssertLessThanOrEqual(plan.fullScans.count, 1, "Nested full scans for \(label)\n\(plan)", file: file, line: line)
+        XCTAssertFalse(plan.fullScans.contains("object_metadata"), "Scans object_metadata for \(label)\n\(plan)", file: file, line: line)
+    }
+
+    private func assertPlaceFilterPlan(
+        _ plan: QueryPlan,
+        table: String,
+        region: Bool,
+        search: Bool,
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) {
+        if region {
+            XCTAssertNotNil(plan.virtualTableIndex("spatial_index"), "R*Tree bypassed\n\(plan)", file: file, line: line)
+        }
+        if search {
+            XCTAssertTrue(plan.matchesFTS("\(table)_fts"), "FTS bypassed\n\(plan)", file: file, line: line)
+        }
+        if region || search {
+            XCTAssertEqual(plan.fullScans, [], "Full scan despite an indexed predicate\n\(plan)", file: file, line: line)
+        }
+    }
+
+    /// Runs `call` while tracing the connection, then checks the plan of every `SELECT` it
+    /// issued. Only the tables in `scanning` may be read end to end, and one per statement.
+    @discardableResult
+    private func assertPlans(
+        _ label: String,
+        scanning allowed: Set<String> = [],
+        file: StaticString = #filePath,
+        line: UInt = #line,
+        _ call: () async throws -> Void
+    ) async throws -> [QueryPlan] {
+        let log = StatementLog()
+        dbQueue.inDatabase { db in
+            db.trace(options: .statement) { event in
+                if case let .statement(statement) = event {
+                    log.append(statement.expandedSQL)
+                }
+            }
+        }
+        do {
+            try await call()
+        } catch {
+            dbQueue.inDatabase { db in db.trace(options: .statement, nil) }
+            throw error
+        }
+        dbQueue.inDatabase { db in db.trace(options: .statement, nil) }
+
+        // Empty `IN` lists compile to `WHERE 0`, which returns without reading anything
+        let selects = log.statements.filter { sql in
+            let trimmed = sql.trimmingCharacters(in: .whitespacesAndNewlines).uppercased()
+            return (trimmed.hasPrefix("SELECT") || trimmed.hasPrefix("WITH"))
+                && !trimmed.contains("SQLITE_MASTER") && !trimmed.contains("SQLITE_SCHEMA")
+                && !trimmed.hasSuffix(" WHERE 0")
+        }
+        XCTAssertFalse(selects.isEmpty, "\(label) issued no queries", file: file, line: line)
+
+        let plans = try await dbQueue.read { db in
+            let tables = try QueryPlan.tables(db)
+            return try selects.map { try QueryPlan(db, sql: $0, tables: tables) }
+        }
+        for plan in plans {
+            XCTAssertLessThanOrEqual(plan.fullScans.count, 1, "Nested full scans in \(label)\n\(plan)", file: file, line: line)
+            let unexpected = Set(plan.fullScans).subtracting(allowed)
+            XCTAssertTrue(unexpected.isEmpty, "\(label) scans \(unexpected.sorted())\n\(plan)", file: file, line: line)
+        }
+        return plans
+    }
+}
+
+// MARK: - Plan Inspection
+
+/// `EXPLAIN QUERY PLAN` output of one statement
+private struct QueryPlan: CustomStringConvertible {
+    /// Aliases used by the spatial subqueries
+    private static let aliases = ["si": "spatial_index", "so": "spatial_objects"]
+
+    let sql: String
+    let details: [String]
+    private let tables: Set<String>
+
+    /// Ordinary tables of the schema, i.e. what a `SCAN` line can read end to end
+    static func tables(_ db: Database) throws -> Set<String> {
+        Set(try String.fetchAll(db, sql: """
+            SELECT name FROM sqlite_master WHERE type = 'table' AND sql NOT LIKE 'CREATE VIRTUAL TABLE%'
+            """))
+    }
+
+    init(_ db: Database, sql: String, arguments: StatementArguments = StatementArguments(), tables: Set<String>) throws {
+        self.sql = sql
+        self.tables = tables
+        details = try Row.fetchAll(db, sql: "EXPLAIN QUERY PLAN " + sql, arguments: arguments).map { row -> String in row["detail"] }
+    }
+
+    /// Tables read end to end, with or without walking an index
+    var fullScans: [String] {
+        details.compactMap { detail in
+            guard !detail.contains("VIRTUAL TABLE"),
+                  let table = table(in: detail, verb: "SCAN"),
+                  tables.contains(table) else { return nil }
+            return table
+        }
+    }
+
+    /// The `idxNum:idxStr` a virtual table was queried with, or nil if it isn't queried
+    func virtualTableIndex(_ table: String) -> String? {
+        for detail in details where self.table(in: detail, verb: "SCAN") == table || self.table(in: detail, verb: "SEARCH") == table {
+            guard let range = detail.range(of: "VIRTUAL TABLE INDEX ") else { continue }
+            return String(detail[range.upperBound...])
+        }
+        return nil
+    }
+
+    /// Whether an FTS5 table is queried with a constraint rather than walked whole
+    func matchesFTS(_ table: String) -> Bool {
+        guard let index = virtualTableIndex(table) else { return false }
+        return index != "0:"
+    }
+
+    var description: String {
+        ([sql] + details.map { "  \($0)" }).joined(separator: "\n")
+    }
+
+    /// Table named by a `SCAN`/`SEARCH` line, in both the current (`SCAN t`) and the pre-3.36
+    /// (`SCAN TABLE t AS a`) formats
+    private func table(in detail: String, verb: String) -> String? {
+        var words = detail.split(separator: " ").map(String.init)[...]
+        guard words.popFirst() == verb else { return nil }
+        if words.first == "TABLE" {
+            words = words.dropFirst()
+        }
+        guard let name = words.first else { return nil }
+        return Self.aliases[name] ?? name
+    }
+}
+
+/// Statements seen by a connection trace
+private final class StatementLog: @unchecked Sendable {
+    private let lock = NSLock()
+    private var recorded: [String] = []
+
+    var statements: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return recorded
+    }
+
+    func append(_ sql: String) {
+        lock.lock()
+        recorded.append(sql)
+        lock.unlock()
+    }
+}
+
+/// SQLite's per-statement counters after running a query to completion. The system SQLite
+/// doesn't expose per-loop scan status, so full-scan steps stand in for rows examined by
+/// table walks; index and R*Tree lookups don't count toward them.
+private struct ScanCounters: CustomStringConvertible {
+    let rows: Int
+    let fullScanSteps: Int
+    let sorts: Int
+    let virtualMachineSteps: Int
+
+    init(_ db: Database, _ query: CompiledFilterQuery) throws {
+        // A fresh statement, so the counters start at zero
+        let statement = try db.makeStatement(sql: query.sql)
+        let cursor = try Row.fetchCursor(statement, arguments: query.arguments)
+        var rows = 0
+        while try cursor.next() != nil {
+            rows += 1
+        }
+        self.rows = rows
+        fullScanSteps = Int(sqlite3_stmt_status(statement.sqliteStatement, SQLITE_STMTSTATUS_FULLSCAN_STEP, 0))
+        sorts = Int(sqlite3_stmt_status(statement.sqliteStatement, SQLITE_STMTSTATUS_SORT, 0))
+        virtualMachineSteps = Int(sqlite3_stmt_status(statement.sqliteStatement, SQLITE_STMTSTATUS_VM_STEP, 0))
+    }
+
+    var description: String {
+        "\(rows) rows, \(fullScanSteps) full-scan steps, \(sorts) sorts, \(virtualMachineSteps) VM steps"
+    }
+}
@@ -0,0 +1,161 @@
+import XCTest
+import CoreLocation
+@testable import PlayaDB
+
+final class ScheduleEngineTests: XCTestCase {
+    private let base = Date(timeIntervalSince1970: 1_756_123_200)
+    /// Near 3:00 & Esplanade; one degree of longitude here is ~84 km
+    private let origin = CLLocationCoordinate2D(latitude: 40.7864, longitude: -119.2065)
+
+    private func candidate(
+        _ uid: String,
+        event: String? = nil,
+        start: TimeInterval,
+        end: TimeInterval,
+        metersEast: Double? = nil,
+        weight: Double = 1
+    ) -> ScheduleEngine.Candidate {
+        let coordinate = metersEast.map {
+            CLLocationCoordinate2D(
+                latitude: origin.latitude,
+                longitude: origin.longitude + $0 / (111_320 * cos(origin.latitude * .pi / 180))
+            )
+        }
+        return ScheduleEngine.Candidate(
+            uid: uid,
+            eventUID: event ?? uid,
+            start: base.addingTimeInterval(start),
+            end: base.addingTimeInterval(end),
+            coordinate: coordinate,
+            weight: weight
+        )
+    }
+
+    func testPicksHeaviestNonOverlappingSet() {
+        let engine = ScheduleEngine(options: .init(transferBuffer: 0))
+        let itinerary = engine.plan(candidates: [
+            candidate("a", start: 0, end: 3600, weight: 1),
+            candidate("b", start: 1800, end: 5400, weight: 5),
+            candidate("c", start: 3600, end: 7200, weight: 1),
+            candidate("d", start: 5400, end: 9000, weight: 2),
+        ])
+
+        XCTAssertEqual(itinerary.items.map(\.candidate.uid), ["b", "d"])
+        XCTAssertEqual(itinerary.totalWeight, 7)
+        XCTAssertEqual(itinerary.unscheduledEventUIDs, ["a", "c"])
+        XCTAssertTrue(itinerary.conflicts.contains { $0.first.uid == "a" && $0.second.uid == "b" && $0.kind == .overlap })
+    }
+
+    func testWalkingTimeMakesBackToBackEventsConflict() {
+        let engine = ScheduleEngine(options: .init(walkingSpeed: 1, transferBuffer: 0))
+        // 1.2 km apart at 1 m/s needs 20 minutes; only 10 minutes between them.
+        let itinerary = engine.plan(candidates: [
+            candidate("near", start: 0, end: 3600, metersEast: 0),
+            candidate("far", start: 4200, end: 7200, metersEast: 1200),
+        ])
+
+        XCTAssertEqual(itinerary.items.count, 1)
+        guard case .travel(let required)? = itinerary.conflicts.first?.kind else {
+            return XCTFail("Expected a travel conflict")
+        }
+        XCTAssertEqual(required, 1200, accuracy: 5)
+
+        // With a 30 minute gap both fit.
+        let relaxed = engine.plan(candidates: [
+            candidate("near", start: 0, end: 3600, metersEast: 0),
+            candidate("far", start: 5400, end: 7200, metersEast: 1200),
+        ])
+        XCTAssertEqual(relaxed.items.count, 2)
+        XCTAssertEqual(relaxed.items.first?.travelToNext ?? 0, 1200, accuracy: 5)
+        XCTAssertTrue(relaxed.conflicts.isEmpty)
+    }
+
+    func testRecurringEventIsScheduledOnce() {
+        let engine = ScheduleEngine(options: .init(transferBuffer: 0))
+        let itinerary = engine.plan(candidates: [
+            candidate("yoga-1", event: "yoga", start: 0, end: 3600),
+            candidate("yoga-2", event: "yoga", start: 86_400, end: 90_000),
+            candidate("yoga-3", event: "yoga", start: 172_800, end: 176_400),
+            candidate("talk", start: 1800, end: 5400),
+        ])
+
+        let events = itinerary.items.map(\.candidate.eventUID)
+        XCTAssertEqual(events.filter { $0 == "yoga" }.count, 1)
+        XCTAssertTrue(events.contains("talk"))
+        XCTAssertTrue(itinerary.unscheduledEventUIDs.isEmpty)
+        XCTAssertFalse(itinerary.conflicts.contains { $0.first.eventUID == $0.second.eventUID })
+    }
+
+    func testAlternativesListBlockingItems() {
+        let engine = ScheduleEngine(options: .init(transferBuffer: 0))
+        let itinerary = engine.plan(candidates: [
+            candidate("keep", start: 0, end: 7200, weight: 3),
+            candidate("swap", start: 3600, end: 5400, weight: 2),
+        ])
+
+        let alternative = itinerary.alternatives.first
+        XCTAssertEqual(alternative?.candidate.uid, "swap")
+        XCTAssertEqual(alternative?.replaces.map(\.uid), ["keep"])
+        XCTAssertEqual(alternative?.weightDelta, -1)
+    }
+
+    func testWindowExcludesOccurrencesOutsideIt() {
+        let engine = ScheduleEngine(options: .init(window: DateInterval(start: base, duration: 3600)))
+        let itinerary = engine.plan(candidates: [
+            candidate("inside", start: 600, end: 1200),
+            candidate("outside", start: 7200, end: 9000),
+        ])
+        XCTAssertEqual(itinerary.items.map(\.candidate.uid), ["inside"])
+        XCTAssertFalse(itinerary.unscheduledEventUIDs.contains("outside"))
+    }
+
+    /// A festival week of favorites, the same on every run
+    private func thousandFavorites() -> [ScheduleEngine.Candidate] {
+        var generator = SeededGenerator(seed: 0x5CED)
+        return (0..<1000).map { index -> ScheduleEngine.Candidate in
+            let start = TimeInterval(Int.random(in: 0..<(7 * 86_400), using: &generator) / 900 * 900)
+            let duration = TimeInterval(Int.random(in: 2...12, using: &generator) * 15 * 60)
+            return candidate(
+                "occ-\(index)",
+                event: "event-\(index % 700)",
+                start: start,
+                end: start + duration,
+                metersEast: Double.random(in: -2500...2500, using: &generator),
+                weight: Double.random(in: 1...3, using: &generator)
+            )
+        }
+    }
+
+    func testThousandFavoritesPlanFeasibly() {
+        let itinerary = ScheduleEngine().plan(candidates: thousandFavorites())
+
+        XCTAssertFalse(itinerary.items.isEmpty)
+        // Plan must be feasible: no overlaps and enough walking time between items.
+        for (item, next) in zip(itinerary.items, itinerary.items.dropFirst()) {
+            XCTAssertLessThanOrEqual(item.candidate.end.addingTimeInterval(item.travelToNext ?? 0), next.candidate.start)
+        }
+    }
+
+    /// Budget is 50 ms in release; compare baselines rather than asserting wall time
+    func testThousandFavoritesPlanPerformance() {
+        let candidates = thousandFavorites()
+        let engine = ScheduleEngine()
+        measure {
+            _ = engine.plan(candidates: candidates)
+        }
+    }
+}
+
+/// SplitMix64, so generated inputs are the same on every run
+private struct SeededGenerator: RandomNumberGenerator {
+    var state: UInt64
+    init(seed: UInt64) { state = seed }
+
+    mutating func next() -> UInt64 {
+        state &+= 0x9E37_79B9_7F4A_7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+        z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+        return z ^ (z >> 31)
+    }
+}
@@ -0,0 +1,151 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPI
+import PlayaAPITestHelpers
+
+/// Tests for the embedding import and brute-force cosine index behind semantic search.
+final class SemanticSearchTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private let artUID = "a2IVI000000yWeZ2AU"
+    private let campUID = "a1XVI000008zSaf2AE"
+    private let eventUID = "78ZvNxSeeZQbaeHuughD"
+    private let mvUID = "a6BVI000000Le0r2AC"
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+
+        // Four orthogonal-ish directions, one per object
+        var writer = PlayaDataPackWriter()
+        try writer.addJSON(MockAPIData.artJSON, as: .art)
+        try writer.addJSON(MockAPIData.campJSON, as: .camps)
+        try writer.addJSON(MockAPIData.eventJSON, as: .events)
+        try writer.addJSON(MockAPIData.mutantVehicleJSON, as: .mutantVehicles)
+        try writer.add([
+            PlayaEmbedding(objectType: "art", uid: artUID, revision: 1, values: [1, 0, 0, 0]),
+            PlayaEmbedding(objectType: "camp", uid: campUID, revision: 1, values: [0.6, 0.8, 0, 0]),
+            PlayaEmbedding(objectType: "event", uid: eventUID, revision: 1, values: [0, 0, 1, 0]),
+            PlayaEmbedding(objectType: "mutantVehicle", uid: mvUID, revision: 1, values: [0, 0, 0, 1]),
+            PlayaEmbedding(objectType: "art", uid: "deleted-art", revision: 1, values: [0.9, 0.1, 0, 0]),
+        ], as: .embeddings)
+        try await playaDB.importFromDataPack(PlayaDataPack(data: writer.encoded()))
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testNearestObjectsBestFirst() async throws {
+        let matches = try await playaDB.semanticSearch(vector: [1, 0, 0, 0], types: nil, limit: 2)
+
+        // "deleted-art" scores second but has no object, so it's dropped
+        XCTAssertEqual(matches.map(\.object.uid), [artUID])
+        XCTAssertEqual(try XCTUnwrap(matches.first?.score), 1, accuracy: 0.01)
+
+        let wider = try await playaDB.semanticSearch(vector: [1, 0, 0, 0], types: nil, limit: 3)
+        XCTAssertEqual(wider.map(\.object.uid), [artUID, campUID])
+        XCTAssertEqual(wider[1].score, 0.6, accuracy: 0.01)
+        XCTAssertTrue(wider[1].object is CampObject)
+    }
+
+    func testTypeFilter() async throws {
+        let matches = try await playaDB.semanticSearch(vector: [0.5, 0, 0.5, 0.5], types: [.event, .mutantVehicle], limit: 10)
+        XCTAssertEqual(Set(matches.map(\.object.uid)), [eventUID, mvUID])
+        XCTAssertTrue(matches.contains { $0.object is EventObject })
+    }
+
+    func testDimensionMismatchFindsNothing() async throws {
+        let matches = try await playaDB.semanticSearch(vector: [1, 0, 0], types: nil, limit: 10)
+        XCTAssertTrue(matches.isEmpty)
+    }
+
+    func testIndexReloadsWhenEmbeddingsChange() async throws {
+        _ = try await playaDB.semanticSearch(vector: [1, 0, 0, 0], types: nil, limit: 1)
+        XCTAssertNotNil(playaDB.semanticIndex.cached())
+
+        // Point the event at the art's direction
+        try await playaDB.dbQueue.write { db in
+            try db.execute(
+                sql: "UPDATE object_embeddings SET vector = ? WHERE object_id = ?",
+                arguments: [PlayaEmbedding.quantize([1, 0, 0, 0]), self.eventUID]
+            )
+        }
+        XCTAssertNil(playaDB.semanticIndex.cached())
+
+        let matches = try await playaDB.semanticSearch(vector: [1, 0, 0, 0], types: [.event], limit: 1)
+        XCTAssertEqual(matches.map(\.object.uid), [eventUID])
+        XCTAssertEqual(try XCTUnwrap(matches.first?.score), 1, accuracy: 0.01)
+    }
+
+    func testJSONImportEmbedsObjects() async throws {
+        #if canImport(NaturalLanguage)
+        try XCTSkipIf(PlayaTextEmbedder() == nil, "No sentence embedding model on this machine")
+        let jsonDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await jsonDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+
+        let types = try await jsonDB.dbQueue.read { db in
+            try String.fetchSet(db, sql: "SELECT object_type FROM object_embeddings")
+        }
+        XCTAssertEqual(types, ["art", "camp", "event", "mutantVehicle"])
+        #else
+        throw XCTSkip("NaturalLanguage unavailable")
+        #endif
+    }
+
+    func testJSONReimportKeepsUnchangedEmbeddings() async throws {
+        #if canImport(NaturalLanguage)
+        // Stored vectors from another model revision would be recomputed
+        if let revision = PlayaTextEmbedder()?.revision {
+            try await playaDB.dbQueue.write { db in
+                try db.execute(sql: "UPDATE object_embeddings SET revision = ?", arguments: [revision])
+            }
+        }
+        #endif
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+
+        let uids = try await playaDB.dbQueue.read { db in
+            try String.fetchSet(db, sql: "SELECT object_id FROM object_embeddings")
+        }
+        // "deleted-art" has no object and is dropped; the rest keep the pack's vectors
+        XCTAssertEqual(uids, [artUID, campUID, eventUID, mvUID])
+        let matches = try await playaDB.semanticSearch(vector: [0, 0, 1, 0], types: [.event], limit: 1)
+        XCTAssertEqual(try XCTUnwrap(matches.first?.score), 1, accuracy: 0.01)
+    }
+
+    func testDeltaPatchDropsDeletedEmbeddings() async throws {
+        try await playaDB.applyDeltaPatch(DeltaPatch(version: "2", deleted: DeltaObjectIDs(camps: [campUID])))
+
+        let types = try await playaDB.dbQueue.read { db in
+            try String.fetchSet(db, sql: "SELECT object_type FROM object_embeddings")
+        }
+        XCTAssertFalse(types.contains("camp"))
+        XCTAssertTrue(types.contains("art"))
+    }
+
+    func testNearestKeepsBestWithinLimit() {
+        let snapshot = SemanticIndex.Snapshot(
+            revision: 1,
+            dimension: 1,
+            types: [.art, .camp, .art, .event, .art],
+            uids: ["a", "b", "c", "d", "e"],
+            matrix: [0.1, 0.9, 0.5, 0.7, 0.3]
+        )
+        XCTAssertEqual(snapshot.nearest(to: [1], limit: 3).map(\.index), [1, 3, 2])
+        XCTAssertEqual(snapshot.nearest(to: [1], limit: 2, types: [.art]).map(\.index), [2, 4])
+        XCTAssertTrue(snapshot.nearest(to: [1], limit: 0).isEmpty)
+    }
+}
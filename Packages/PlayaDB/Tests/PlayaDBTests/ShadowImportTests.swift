@@ -0,0 +1,145 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for shadow-database imports and the atomic swap.
+final class ShadowImportTests: XCTestCase {
+    private var directory: URL!
+    private var dbPath: String!
+    private var playaDB: PlayaDBImpl!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        dbPath = directory.appendingPathComponent("PlayaDB.sqlite").path
+        playaDB = try PlayaDBImpl(dbPath: dbPath)
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: MockAPIData.mutantVehicleJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try? FileManager.default.removeItem(at: directory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    /// Mock art with a different UID, so the swap is visible
+    private var renamedArtJSON: Data {
+        let json = String(decoding: MockAPIData.artJSON, as: UTF8.self)
+        return Data(json.replacingOccurrences(of: "a2IVI000000yWeZ2AU", with: "a2IVI000000yWeZ2AU-new").utf8)
+    }
+
+    private func shadowImport(artData: Data = MockAPIData.artJSON, mvData: Data? = nil) async throws {
+        try await playaDB.importFromData(
+            artData: artData,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON,
+            mvData: mvData,
+            mode: .shadow
+        )
+    }
+
+    // MARK: - Tests
+
+    func testShadowImportReplacesContent() async throws {
+        try await shadowImport(artData: renamedArtJSON)
+
+        let art = try await playaDB.fetchArt()
+        XCTAssertEqual(art.map(\.uid), ["a2IVI000000yWeZ2AU-new"])
+        let search = try await playaDB.fetchArt(filter: ArtFilter(searchText: "curiosity"))
+        XCTAssertEqual(search.map(\.uid), ["a2IVI000000yWeZ2AU-new"])
+        XCTAssertFalse(FileManager.default.fileExists(atPath: dbPath + "-shadow"))
+
+        // The swapped-in file is what a fresh launch opens
+        let reopened = try PlayaDBImpl(dbPath: dbPath)
+        let reopenedArt = try await reopened.fetchArt()
+        XCTAssertEqual(reopenedArt.map(\.uid), ["a2IVI000000yWeZ2AU-new"])
+    }
+
+    func testShadowImportKeepsUserData() async throws {
+        let art = try await playaDB.fetchArt()
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(art.first))
+        try await playaDB.saveUserMapPin(UserMapPin(id: "pin", title: "Home", latitude: 40.78, longitude: -119.2, pinType: "home"))
+        try await playaDB.saveThumbnailColors(ThumbnailColors(
+            objectId: "a2IVI000000yWeZ2AU",
+            bgRed: 0.1, bgGreen: 0.2, bgBlue: 0.3, bgAlpha: 1,
+            primaryRed: 0.4, primaryGreen: 0.5, primaryBlue: 0.6, primaryAlpha: 1,
+            secondaryRed: 0.7, secondaryGreen: 0.8, secondaryBlue: 0.9, secondaryAlpha: 1,
+            detailRed: 0, detailGreen: 0, detailBlue: 0, detailAlpha: 1
+        ))
+
+        try await shadowImport()
+
+        let favorites = try await playaDB.fetchArt(filter: ArtFilter(onlyFavorites: true))
+        XCTAssertEqual(favorites.map(\.uid), ["a2IVI000000yWeZ2AU"])
+        let pins = try await playaDB.fetchUserMapPins()
+        XCTAssertEqual(pins.map(\.id), ["pin"])
+        let colors = try await playaDB.fetchThumbnailColors(objectId: "a2IVI000000yWeZ2AU")
+        XCTAssertEqual(colors?.bgGreen, 0.2)
+    }
+
+    func testShadowImportWithoutMutantVehiclesKeepsExistingOnes() async throws {
+        let before = try await playaDB.fetchMutantVehicles()
+        XCTAssertFalse(before.isEmpty)
+
+        try await shadowImport()
+
+        let after = try await playaDB.fetchMutantVehicles()
+        XCTAssertEqual(Set(after.map(\.uid)), Set(before.map(\.uid)))
+        let manifest = try await playaDB.fetchDeltaManifest()
+        XCTAssertEqual(Set(manifest.mutantVehicles.keys), Set(before.map(\.uid)))
+    }
+
+    func testObservationsFollowTheSwap() async throws {
+        var received: [[String]] = []
+        let initial = expectation(description: "initial value")
+        let swapped = expectation(description: "value after swap")
+        let token = playaDB.observeArt(filter: ArtFilter(), onChange: { rows in
+            received.append(rows.map(\.object.uid))
+            if received.count == 1 { initial.fulfill() }
+            if rows.map(\.object.uid) == ["a2IVI000000yWeZ2AU-new"] { swapped.fulfill() }
+        }, onError: { XCTFail("\($0)") })
+        await fulfillment(of: [initial], timeout: 5)
+
+        try await shadowImport(artData: renamedArtJSON)
+        await fulfillment(of: [swapped], timeout: 5)
+        token.cancel()
+
+        XCTAssertEqual(received.first, ["a2IVI000000yWeZ2AU"])
+    }
+
+    func testFailedSwapKeepsServingTheLiveFile() throws {
+        struct MigrationFailed: Error {}
+        let database = SwappableDatabase(try DatabaseQueue(path: dbPath))
+        let replacement = directory.appendingPathComponent("replacement.sqlite")
+        try DatabaseQueue(path: replacement.path).close()
+
+        XCTAssertThrowsError(try database.replace(with: replacement, migrating: { _ in throw MigrationFailed() }))
+
+        // Still the live file, and still writable
+        try database.current.write { db in
+            try db.execute(sql: "UPDATE art_objects SET name = 'Renamed'")
+        }
+        let names = try database.current.read { db in try String.fetchAll(db, sql: "SELECT name FROM art_objects") }
+        XCTAssertEqual(names, ["Renamed"])
+        XCTAssertTrue(FileManager.default.fileExists(atPath: replacement.path))
+    }
+
+    func testStaleShadowFileIsDiscarded() async throws {
+        // A stray shadow file from a crashed import is discarded, not swapped in
+        try Data("not a database".utf8).write(to: URL(fileURLWithPath: dbPath + "-shadow"))
+
+        try await shadowImport(artData: renamedArtJSON)
+
+        let art = try await playaDB.fetchArt()
+        XCTAssertEqual(art.map(\.uid), ["a2IVI000000yWeZ2AU-new"])
+    }
+}
@@ -0,0 +1,80 @@
+import XCTest
+@testable import PlayaDB
+import PlayaAPI
+import PlayaAPITestHelpers
+
+/// Tests for the token estimator and the cached tool renderings built on it.
+final class ToolRenderingTests: XCTestCase {
+    private var playaDB: PlayaDBImpl!
+
+    private let artUID = "a2IVI000000yWeZ2AU"
+
+    override func setUp() async throws {
+        try await super.setUp()
+        playaDB = try PlayaDBImpl(dbPath: ":memory:")
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try await super.tearDown()
+    }
+
+    // MARK: - Token Estimator
+
+    func testEstimatorPricesIdentifiersAboveCharacterHeuristic() {
+        XCTAssertEqual(TokenEstimator.estimate(""), 0)
+        XCTAssertEqual(TokenEstimator.estimate("the art"), 2)
+
+        let uid = "(uid: a2IVI000000yWeZ2AU)"
+        XCTAssertGreaterThan(TokenEstimator.estimate(uid), uid.count / 4)
+        let gps = "gps: 40.78123,-119.20456"
+        XCTAssertGreaterThan(TokenEstimator.estimate(gps), gps.count / 4)
+    }
+
+    // MARK: - Renderings
+
+    func testRenderingsIncreaseInDetail() async throws {
+        let art = try XCTUnwrap(try await playaDB.fetchArt(uid: artUID))
+        let rendering = try XCTUnwrap(playaDB.toolRenderings(for: [art]).first)
+
+        XCTAssertEqual(rendering.uid, artUID)
+        XCTAssertEqual(rendering.text(.brief), "art: \(art.name) (uid: \(artUID))")
+        XCTAssertTrue(rendering.text(.full).hasSuffix("(uid: \(artUID))"))
+        XCTAssertLessThan(rendering.tokens(.brief), rendering.tokens(.normal))
+        XCTAssertLessThanOrEqual(rendering.tokens(.normal), rendering.tokens(.full))
+    }
+
+    func testEventOccurrenceRendersEventUIDWithTime() async throws {
+        let occurrence = try XCTUnwrap(try await playaDB.fetchEvents().first)
+        let rendering = try XCTUnwrap(playaDB.toolRenderings(for: [occurrence]).first)
+
+        XCTAssertEqual(rendering.uid, occurrence.event.uid)
+        XCTAssertTrue(rendering.text(.brief).hasPrefix("event: \(occurrence.name) at "))
+        XCTAssertTrue(rendering.text(.full).contains("time: "))
+    }
+
+    func testChangedFieldsRerender() async throws {
+        var art = try XCTUnwrap(try await playaDB.fetchArt(uid: artUID))
+        let original = try XCTUnwrap(playaDB.toolRenderings(for: [art]).first)
+        XCTAssertEqual(playaDB.toolRenderings(for: [art]).first?.text(.full), original.text(.full))
+
+        art.description = "Updated description"
+        let updated = try XCTUnwrap(playaDB.toolRenderings(for: [art]).first)
+        XCTAssertTrue(updated.text(.normal).contains("Updated description"))
+        XCTAssertNotEqual(updated.text(.full), original.text(.full))
+    }
+
+    func testCacheClearsPastLimit() {
+        let cache = ToolRenderingCache(limit: 2)
+        let objects = (0..<3).map { ArtObject(uid: "art-\($0)", name: "Art \($0)", year: 2025) }
+
+        let renderings = cache.renderings(for: objects)
+        XCTAssertEqual(renderings.map(\.uid), ["art-0", "art-1", "art-2"])
+        XCTAssertEqual(renderings[2].text(.normal), "art: Art 2 - no description (uid: art-2)")
+    }
+}
@@ -0,0 +1,156 @@
+import XCTest
+import GRDB
+@testable import PlayaDB
+import PlayaAPITestHelpers
+
+/// Tests for per-year archives and year-routed queries.
+final class YearArchiveTests: XCTestCase {
+    private var directory: URL!
+    private var playaDB: PlayaDBImpl!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        playaDB = try PlayaDBImpl(dbPath: directory.appendingPathComponent("PlayaDB.sqlite").path)
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+    }
+
+    override func tearDown() async throws {
+        playaDB = nil
+        try? FileManager.default.removeItem(at: directory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Helpers
+
+    /// Mock JSON moved to another year, with suffixed UIDs so both years can coexist
+    private func mockData(year: Int) -> (art: Data, camps: Data, events: Data) {
+        func shift(_ data: Data) -> Data {
+            var json = String(decoding: data, as: UTF8.self)
+            json = json.replacingOccurrences(of: "\"year\": 2025", with: "\"year\": \(year)")
+            for uid in ["a2IVI000000yWeZ2AU", "a1XVI000008zSaf2AE", "78ZvNxSeeZQbaeHuughD"] {
+                json = json.replacingOccurrences(of: uid, with: "\(uid)-\(year)")
+            }
+            return Data(json.utf8)
+        }
+        return (shift(MockAPIData.artJSON), shift(MockAPIData.campJSON), shift(MockAPIData.eventJSON))
+    }
+
+    private func importYear(_ year: Int) async throws {
+        let data = mockData(year: year)
+        try await playaDB.importFromData(artData: data.art, campData: data.camps, eventData: data.events)
+    }
+
+    // MARK: - Tests
+
+    func testImportingNewYearArchivesPreviousYear() async throws {
+        try await importYear(2026)
+
+        XCTAssertEqual(playaDB.archivedYears(), [2025])
+
+        let current = try await playaDB.fetchArt(filter: ArtFilter(year: 2026))
+        XCTAssertEqual(current.map(\.uid), ["a2IVI000000yWeZ2AU-2026"])
+        let archived = try await playaDB.fetchArt(filter: ArtFilter(year: 2025))
+        XCTAssertEqual(archived.map(\.uid), ["a2IVI000000yWeZ2AU"])
+        let archivedCamps = try await playaDB.fetchCamps(filter: CampFilter(year: 2025))
+        XCTAssertEqual(archivedCamps.map(\.uid), ["a1XVI000008zSaf2AE"])
+
+        // The live database only holds the current year
+        let liveArtCount = try await playaDB.dbQueue.read { db in try ArtObject.fetchCount(db) }
+        XCTAssertEqual(liveArtCount, 1)
+        let liveFTSCount = try await playaDB.dbQueue.read { db in
+            try Int.fetchOne(db, sql: "SELECT COUNT(*) FROM art_objects_fts") ?? 0
+        }
+        XCTAssertEqual(liveFTSCount, 1)
+    }
+
+    func testArchivedSearchUsesArchiveIndexes() async throws {
+        try await importYear(2026)
+
+        let results = try await playaDB.fetchArt(filter: ArtFilter(year: 2025, searchText: "curiosity"))
+        XCTAssertEqual(results.map(\.uid), ["a2IVI000000yWeZ2AU"])
+    }
+
+    func testArchivedFavoritesComeFromLiveDatabase() async throws {
+        let art = try await playaDB.fetchArt()
+        try await playaDB.setFavorite(true, for: try XCTUnwrap(art.first))
+        try await importYear(2026)
+
+        let favorites = try await playaDB.fetchArt(filter: ArtFilter(year: 2025, onlyFavorites: true))
+        XCTAssertEqual(favorites.map(\.uid), ["a2IVI000000yWeZ2AU"])
+
+        let expectation = expectation(description: "archive observation")
+        var rows: [ListRow<ArtObject>] = []
+        let token = playaDB.observeArt(filter: ArtFilter(year: 2025), onChange: { value in
+            rows = value
+            expectation.fulfill()
+        }, onError: { XCTFail("\($0)") })
+        await fulfillment(of: [expectation], timeout: 5)
+        token.cancel()
+
+        XCTAssertEqual(rows.first?.metadata?.isFavorite, true)
+    }
+
+    func testCompressedArchiveIsReadable() async throws {
+        try await playaDB.archiveYear(2025, compressed: true)
+        try await importYear(2026)
+
+        let files = try FileManager.default.contentsOfDirectory(atPath: directory.appendingPathComponent("PlayaDBArchives").path)
+        XCTAssertTrue(files.contains("PlayaDB-2025.sqlite.lzfse"))
+        XCTAssertFalse(files.contains("PlayaDB-2025.sqlite"))
+
+        let events = try await playaDB.fetchEvents(filter: EventFilter(year: 2025, includeExpired: true))
+        XCTAssertEqual(Set(events.map { $0.event.uid }), ["78ZvNxSeeZQbaeHuughD"])
+    }
+
+    func testArchivesAreReadOnly() async throws {
+        try await importYear(2026)
+
+        let archive = try XCTUnwrap(playaDB.archives?.reader(for: 2025))
+        XCTAssertThrowsError(try archive.write { db in
+            try db.execute(sql: "DELETE FROM art_objects")
+        })
+        let userTables = try archive.read { db in
+            try Int.fetchOne(db, sql: "SELECT COUNT(*) FROM main.sqlite_master WHERE name = 'object_metadata'") ?? 0
+        }
+        XCTAssertEqual(userTables, 0)
+    }
+
+    func testArchivedLiveYearKeepsReadingLiveDatabase() async throws {
+        try await playaDB.archiveYear(2025, compressed: false)
+        // A data update after the snapshot
+        try await playaDB.dbQueue.write { db in
+            try db.execute(sql: "UPDATE art_objects SET name = 'Renamed' WHERE uid = 'a2IVI000000yWeZ2AU'")
+        }
+
+        let art = try await playaDB.fetchArt(filter: ArtFilter(year: 2025))
+        XCTAssertEqual(art.map(\.name), ["Renamed"])
+    }
+
+    func testReimportingSameYearDoesNotArchive() async throws {
+        try await playaDB.importFromData(
+            artData: MockAPIData.artJSON,
+            campData: MockAPIData.campJSON,
+            eventData: MockAPIData.eventJSON
+        )
+        XCTAssertTrue(playaDB.archivedYears().isEmpty)
+    }
+
+    func testImportRearchivesYearUpdatedSinceArchive() async throws {
+        try await playaDB.archiveYear(2025, compressed: false)
+        // A data update after the snapshot
+        try await playaDB.dbQueue.write { db in
+            try db.execute(sql: "UPDATE art_objects SET name = 'Renamed' WHERE uid = 'a2IVI000000yWeZ2AU'")
+            try db.execute(sql: "UPDATE update_info SET last_updated = ?", arguments: [Date().addingTimeInterval(60)])
+        }
+        try await importYear(2026)
+
+        let art = try await playaDB.fetchArt(filter: ArtFilter(year: 2025))
+        XCTAssertEqual(art.map(\.name), ["Renamed"])
+    }
+}
@@ -43,11 +43,14 @@ final class FoundationModelSearchService: AISearchService {
     func search(_ query: String) async throws -> [AISearchResult] {
         guard isAvailable else { return [] }
 
+        // The model often repeats a call with the same arguments while refining results
+        let executor = ToolExecutor()
+        defer { executor.logSummary("AISearch") }
         let tools: [any Tool] = [
-            SearchByKeywordTool(playaDB: playaDB),
-            FetchArtTool(playaDB: playaDB),
-            FetchCampsTool(playaDB: playaDB),
-            FetchMutantVehiclesTool(playaDB: playaDB),
+            executor.wrap(SearchByKeywordTool(playaDB: playaDB)),
+            executor.wrap(FetchArtTool(playaDB: playaDB)),
+            executor.wrap(FetchCampsTool(playaDB: playaDB)),
+            executor.wrap(FetchMutantVehiclesTool(playaDB: playaDB)),
         ]
 
         let session = LanguageModelSession(
@@ -62,7 +65,7 @@ final class FoundationModelSearchService: AISearchService {
         )
 
         let response = try await session.respond(
-            to: Prompt(query),
+            to: Prompt(await seededPrompt(for: query)),
             generating: AISearchResponse.self
         )
 
@@ -70,6 +73,22 @@ final class FoundationModelSearchService: AISearchService {
             AISearchResult(uid: $0.uid, reason: $0.reason)
         }
     }
+
+    /// The query plus its nearest embedding matches, so the model can often rank
+    /// candidates without a tool round trip
+    private func seededPrompt(for query: String) async -> String {
+        let candidates = (try? await playaDB.semanticSearch(query, types: nil, limit: 8)) ?? []
+        guard !candidates.isEmpty else { return query }
+        let lines = candidates.map {
+            "- \($0.object.name) (\($0.object.objectType.displayName), uid: \($0.object.uid))"
+        }
+        return """
+            \(query)
+
+            Possibly related by meaning:
+            \(lines.joined(separator: "\n"))
+            """
+    }
 }
 
 @available(iOS 26, *)
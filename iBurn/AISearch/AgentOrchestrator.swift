@@ -17,6 +17,8 @@ import FoundationModels
 ///
 /// Each workflow step gets its own `LanguageModelSession` with only the tools
 /// needed for that step. This keeps each step well within the ~4K token budget.
+/// Each workflow run gets its own `ToolExecutor`, so tool calls repeated across its
+/// steps and retries run once.
 @available(iOS 26, *)
 final class AgentOrchestrator: @unchecked Sendable {
     let playaDB: PlayaDB
@@ -87,6 +89,8 @@ final class AgentOrchestrator: @unchecked Sendable {
         onProgress: @escaping (WorkflowProgress) -> Void
     ) async throws -> W.Result {
         let now = startDate ?? Date.present
+        let tools = ToolExecutor()
+        defer { tools.logSummary(workflow.name) }
         let context = WorkflowContext(
             playaDB: playaDB,
             location: locationProvider.currentLocation,
@@ -96,38 +100,44 @@ final class AgentOrchestrator: @unchecked Sendable {
             windowStart: window?.start,
             windowEnd: window?.end,
             vibe: vibe,
-            lean: lean
+            lean: lean,
+            tools: tools
         )
         return try await workflow.execute(context: context, onProgress: onProgress)
     }
 
     // MARK: - Tool Factory
 
-    /// Create search tools at a specific detail level
-    func makeSearchTools(detailLevel: ToolDetailLevel = .normal) -> [any Tool] {
+    /// Create search tools at a specific detail level, memoized by `executor` when given
+    func makeSearchTools(detailLevel: ToolDetailLevel = .normal, executor: ToolExecutor? = nil) -> [any Tool] {
         [
-            SearchByKeywordTool(playaDB: playaDB, detailLevel: detailLevel),
-            FetchArtTool(playaDB: playaDB, detailLevel: detailLevel),
-            FetchCampsTool(playaDB: playaDB, detailLevel: detailLevel),
-            FetchMutantVehiclesTool(playaDB: playaDB, detailLevel: detailLevel),
+            executed(SearchByKeywordTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(FetchArtTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(FetchCampsTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(FetchMutantVehiclesTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
         ]
     }
 
-    func makeEventTools(detailLevel: ToolDetailLevel = .normal) -> [any Tool] {
+    func makeEventTools(detailLevel: ToolDetailLevel = .normal, executor: ToolExecutor? = nil) -> [any Tool] {
         [
-            FetchUpcomingEventsTool(playaDB: playaDB, detailLevel: detailLevel),
-            FetchEventsByTypeTool(playaDB: playaDB, detailLevel: detailLevel),
-            FetchEventsByCampTool(playaDB: playaDB, detailLevel: detailLevel),
+            executed(FetchUpcomingEventsTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(FetchEventsByTypeTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(FetchEventsByCampTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
         ]
     }
 
-    func makeDiscoveryTools(detailLevel: ToolDetailLevel = .normal) -> [any Tool] {
-        var tools: [any Tool] = [
-            GetFavoritesTool(playaDB: playaDB, detailLevel: detailLevel),
-            GetViewHistoryTool(playaDB: playaDB, detailLevel: detailLevel),
+    func makeDiscoveryTools(detailLevel: ToolDetailLevel = .normal, executor: ToolExecutor? = nil) -> [any Tool] {
+        [
+            executed(GetFavoritesTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(GetViewHistoryTool(playaDB: playaDB, detailLevel: detailLevel), by: executor),
+            executed(FetchObjectDetailsTool(playaDB: playaDB), by: executor),
         ]
-        tools.append(FetchObjectDetailsTool(playaDB: playaDB))
-        return tools
+    }
+
+    private func executed<T: Tool>(_ tool: T, by executor: ToolExecutor?) -> any Tool
+    where T.Output == String, T.Arguments: ConvertibleToGeneratedContent {
+        guard let executor else { return tool }
+        return executor.wrap(tool)
     }
 }
 
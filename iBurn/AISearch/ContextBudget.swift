@@ -7,19 +7,33 @@
 //
 
 import Foundation
+import PlayaDB
+
+/// Controls how much information tools return per item to manage context window budget
+typealias ToolDetailLevel = ToolRendering.Detail
 
 /// Tracks token budget for LLM context windows.
 /// Apple Foundation Models have ~4K token limit.
 /// We reserve ~500 tokens for system overhead, leaving ~3500 for content.
 struct ContextBudget {
     static let maxTokens = 3500
+    /// Budget for a single tool result, so a step can make several calls and still answer
+    static let toolResultTokens = 600
+    /// Room left for the model's own response after a prompt
+    static let responseReserveTokens = 500
+
+    let limit: Int
     private(set) var used: Int = 0
 
-    var remaining: Int { Self.maxTokens - used }
+    init(limit: Int = maxTokens) {
+        self.limit = limit
+    }
+
+    var remaining: Int { limit - used }
 
-    /// Rough estimate: ~4 characters per token
+    /// See `TokenEstimator`
     static func estimateTokens(_ text: String) -> Int {
-        max(1, text.count / 4)
+        max(1, TokenEstimator.estimate(text))
     }
 
     /// Allocate text within the budget, truncating if needed
@@ -29,12 +43,65 @@ struct ContextBudget {
             used += tokens
             return text
         }
-        let charLimit = remaining * 4
-        used = Self.maxTokens
+        // Keep the same fraction of characters as of tokens
+        let charLimit = text.count * max(remaining, 0) / tokens
+        used = limit
         if charLimit <= 0 { return "" }
         return String(text.prefix(charLimit)) + "..."
     }
 
+    /// Choose which renderings to include, and at what detail, to fit the remaining budget.
+    ///
+    /// Every item that fits is included at `.brief`, most relevant first, before any item is
+    /// upgraded; then the most relevant items are upgraded a level at a time while the budget
+    /// allows. Lines come back in the original order.
+    /// - Parameters:
+    ///   - relevance: Score per rendering, higher first. Defaults to the given order.
+    ///   - maxDetail: Most detail to use for any item
+    mutating func pack(
+        _ renderings: [ToolRendering],
+        relevance: [Double]? = nil,
+        maxDetail: ToolDetailLevel = .full
+    ) -> [String] {
+        var ranked = Array(renderings.indices)
+        if let relevance {
+            let score = { (index: Int) in index < relevance.count ? relevance[index] : 0 }
+            // Equal scores keep their given order
+            ranked.sort { score($0) != score($1) ? score($0) > score($1) : $0 < $1 }
+        }
+
+        // One token per newline joining the lines
+        var detail: [Int: ToolDetailLevel] = [:]
+        for index in ranked {
+            let cost = renderings[index].tokens(.brief) + 1
+            guard cost <= remaining else { break }
+            used += cost
+            detail[index] = .brief
+        }
+        for level in ToolDetailLevel.allCases where level > .brief && level <= maxDetail {
+            for index in ranked {
+                guard let current = detail[index] else { break }
+                let delta = renderings[index].tokens(level) - renderings[index].tokens(current)
+                if delta <= remaining {
+                    used += max(delta, 0)
+                    detail[index] = level
+                }
+            }
+        }
+
+        return detail.keys.sorted().map { renderings[$0].text(detail[$0]!) }
+    }
+
+    /// How many of `lines`, in order, fit in `budget` tokens
+    static func fittingCount(_ lines: [String], budget: Int) -> Int {
+        var total = 0
+        for (count, line) in lines.enumerated() {
+            total += estimateTokens(line) + 1
+            if total > budget { return count }
+        }
+        return lines.count
+    }
+
     /// Check if there's room for approximately this many items at a given detail level
     func canFit(itemCount: Int, detailLevel: ToolDetailLevel) -> Bool {
         let tokensPerItem: Int
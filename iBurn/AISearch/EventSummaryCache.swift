@@ -2,23 +2,42 @@
 //  EventSummaryCache.swift
 //  iBurn
 //
-//  In-memory cache for AI-generated event summaries, keyed by host UID.
+//  Persistent cache for AI-generated event overviews, keyed by host UID.
 //
 
 import Foundation
+@preconcurrency import PlayaDB
 
-/// Actor-based RAM cache for AI event summaries.
-/// Thread-safe and matches the async/await calling pattern used by the workflow pipeline.
-actor EventSummaryCache {
-    static let shared = EventSummaryCache()
+/// AI event overviews stored in PlayaDB, so they survive relaunches.
+///
+/// Entries are keyed by host UID plus a hash of the host and its events, so a data update
+/// regenerates them; PlayaDB also expires old entries and evicts the least recently used.
+/// Only the LLM overview is cached. Schedule tips depend on the current time and are
+/// rebuilt from the events on every read.
+struct EventSummaryCache: Sendable {
+    /// Bump when the overview prompt or validation changes, so old overviews are regenerated
+    static let version = 1
 
-    private var cache: [String: EventSummaryContent] = [:]
+    private let playaDB: PlayaDB
 
-    func get(_ hostUID: String) -> EventSummaryContent? {
-        cache[hostUID]
+    init(playaDB: PlayaDB) {
+        self.playaDB = playaDB
     }
 
-    func set(_ hostUID: String, content: EventSummaryContent) {
-        cache[hostUID] = content
+    func overview(for hostUID: String) async -> String? {
+        do {
+            return try await playaDB.cachedEventSummary(hostUID: hostUID, version: Self.version)
+        } catch {
+            print("Error reading cached event summary: \(error)")
+            return nil
+        }
+    }
+
+    func setOverview(_ overview: String, for hostUID: String) async {
+        do {
+            try await playaDB.saveEventSummary(overview, hostUID: hostUID, version: Self.version)
+        } catch {
+            print("Error caching event summary: \(error)")
+        }
     }
 }
@@ -0,0 +1,74 @@
+//
+//  EventSummaryPrewarmer.swift
+//  iBurn
+//
+//  Background generation of event overviews for favorited hosts.
+//
+
+#if canImport(FoundationModels)
+import Foundation
+import FoundationModels
+@preconcurrency import PlayaDB
+
+/// Fills `EventSummaryCache` for favorited camps and art, and the hosts of favorited events,
+/// so their detail screens show an overview instantly.
+///
+/// Runs hosts one at a time, skipping any with a cached overview for their current events.
+/// Call from a low-priority task; cancelling it stops after the current host.
+@available(iOS 26, *)
+enum EventSummaryPrewarmer {
+    /// Most overviews generated per run, to bound on-device model time
+    static let maxHostsPerRun = 20
+
+    static func prewarmFavoriteHosts(playaDB: PlayaDB) async {
+        guard SystemLanguageModel.default.isAvailable else { return }
+
+        let favorites: [any DataObject]
+        do {
+            favorites = try await playaDB.getFavorites()
+        } catch {
+            print("EventSummaryPrewarmer: failed to fetch favorites: \(error)")
+            return
+        }
+
+        // Favorited hosts first, then hosts of favorited events
+        var hosts: [any DataObject] = favorites.filter { $0 is CampObject || $0 is ArtObject }
+        var seen = Set(hosts.map(\.uid))
+        for case let event as EventObject in favorites {
+            guard let hostUID = event.hostedByCamp ?? event.locatedAtArt, seen.insert(hostUID).inserted else { continue }
+            if let camp = try? await playaDB.fetchCamp(uid: hostUID) {
+                hosts.append(camp)
+            } else if let art = try? await playaDB.fetchArt(uid: hostUID) {
+                hosts.append(art)
+            }
+        }
+
+        let cache = EventSummaryCache(playaDB: playaDB)
+        var generated = 0
+        for host in hosts {
+            guard !Task.isCancelled, generated < maxHostsPerRun else { break }
+            guard await cache.overview(for: host.uid) == nil else { continue }
+
+            let events: [EventObjectOccurrence]
+            if host is CampObject {
+                events = (try? await playaDB.fetchEvents(hostedByCampUID: host.uid)) ?? []
+            } else {
+                events = (try? await playaDB.fetchEvents(locatedAtArtUID: host.uid)) ?? []
+            }
+            guard !events.isEmpty else { continue }
+
+            _ = await generateEventCollectionSummary(
+                events: events,
+                hostName: host.name,
+                hostUID: host.uid,
+                hostDescription: host.description,
+                cache: cache
+            )
+            generated += 1
+        }
+        if generated > 0 {
+            print("EventSummaryPrewarmer: generated \(generated) event overviews")
+        }
+    }
+}
+#endif
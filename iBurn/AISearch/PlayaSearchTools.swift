@@ -14,117 +14,22 @@ import FoundationModels
 import GRDB
 @preconcurrency import PlayaDB
 
-// MARK: - Detail Level
-
-/// Controls how much information tools return per item to manage context window budget
-enum ToolDetailLevel: String {
-    /// Name + uid only (~15 tokens/item) — for exploration steps scanning many items
-    case brief
-    /// Name + short desc + uid (~30 tokens/item) — default behavior
-    case normal
-    /// Name + full desc + location + metadata + uid (~80 tokens/item) — for final selection
-    case full
-}
-
 // MARK: - Formatting Helpers
 
-func formatObject(_ obj: Any, detail: ToolDetailLevel) -> String {
-    // Extract common fields via concrete type casts (avoids DataObject protocol name conflict)
-    let name: String
-    let uid: String
-    let typeName: String
-
-    if let art = obj as? ArtObject {
-        name = art.name; uid = art.uid; typeName = "art"
-    } else if let camp = obj as? CampObject {
-        name = camp.name; uid = camp.uid; typeName = "camp"
-    } else if let event = obj as? EventObject {
-        name = event.name; uid = event.uid; typeName = "event"
-    } else if let mv = obj as? MutantVehicleObject {
-        name = mv.name; uid = mv.uid; typeName = "mutantVehicle"
-    } else {
-        return "unknown object"
-    }
-
-    switch detail {
-    case .brief:
-        return "\(typeName): \(name) (uid: \(uid))"
-    case .normal:
-        var desc: String = "no description"
-        if let d = (obj as? ArtObject)?.description { desc = String(d.prefix(80)) }
-        else if let d = (obj as? CampObject)?.description { desc = String(d.prefix(80)) }
-        else if let d = (obj as? EventObject)?.description { desc = String(d.prefix(80)) }
-        else if let d = (obj as? MutantVehicleObject)?.description { desc = String(d.prefix(80)) }
-        return "\(typeName): \(name) - \(desc) (uid: \(uid))"
-    case .full:
-        return formatObjectFull(obj)
-    }
+/// Packs `objects`, most relevant first, into one tool result of at most
+/// `ContextBudget.toolResultTokens` using PlayaDB's cached renderings
+func packedToolResult(_ objects: [any DataObject], playaDB: PlayaDB, maxDetail: ToolDetailLevel) -> String {
+    var budget = ContextBudget(limit: ContextBudget.toolResultTokens)
+    return budget.pack(playaDB.toolRenderings(for: objects), maxDetail: maxDetail).joined(separator: "\n")
 }
 
-func formatObjectFull(_ obj: Any) -> String {
-    if let art = obj as? ArtObject {
-        var parts = ["art: \(art.name)"]
-        if let desc = art.description { parts.append("desc: \(desc)") }
-        if let artist = art.artist { parts.append("artist: \(artist)") }
-        if let category = art.category { parts.append("category: \(category)") }
-        if let loc = art.locationString { parts.append("location: \(loc)") }
-        if let lat = art.gpsLatitude, let lon = art.gpsLongitude { parts.append("gps: \(lat),\(lon)") }
-        parts.append("(uid: \(art.uid))")
-        return parts.joined(separator: " | ")
-    } else if let camp = obj as? CampObject {
-        var parts = ["camp: \(camp.name)"]
-        if let desc = camp.description { parts.append("desc: \(desc)") }
-        if let loc = camp.locationString { parts.append("location: \(loc)") }
-        if let hometown = camp.hometown { parts.append("hometown: \(hometown)") }
-        if let lat = camp.gpsLatitude, let lon = camp.gpsLongitude { parts.append("gps: \(lat),\(lon)") }
-        parts.append("(uid: \(camp.uid))")
-        return parts.joined(separator: " | ")
-    } else if let event = obj as? EventObject {
-        var parts = ["event: \(event.name)"]
-        if let desc = event.description { parts.append("desc: \(desc)") }
-        parts.append("type: \(event.eventTypeLabel)")
-        if let camp = event.hostedByCamp { parts.append("host: \(camp)") }
-        parts.append("(uid: \(event.uid))")
-        return parts.joined(separator: " | ")
-    } else if let mv = obj as? MutantVehicleObject {
-        var parts = ["vehicle: \(mv.name)"]
-        if let desc = mv.description { parts.append("desc: \(desc)") }
-        if let artist = mv.artist { parts.append("artist: \(artist)") }
-        if let tags = mv.tagsText { parts.append("tags: \(tags)") }
-        parts.append("(uid: \(mv.uid))")
-        return parts.joined(separator: " | ")
-    }
-    return "unknown object"
-}
-
-private func formatEventOccurrence(_ occ: EventObjectOccurrence, detail: ToolDetailLevel, formatter: DateFormatter) -> String {
-    let time = formatter.string(from: occ.startDate)
-    switch detail {
-    case .brief:
-        return "event: \(occ.event.name) at \(time) (uid: \(occ.event.uid))"
-    case .normal:
-        let desc = occ.event.description?.prefix(60) ?? ""
-        return "event: \(occ.event.name) at \(time) - \(desc) (uid: \(occ.event.uid))"
-    case .full:
-        let desc = occ.event.description ?? "no description"
-        let endTime = formatter.string(from: occ.endDate)
-        var parts = ["event: \(occ.event.name)", "time: \(time)-\(endTime)", "type: \(occ.event.eventTypeLabel)"]
-        parts.append("desc: \(desc)")
-        if let camp = occ.event.hostedByCamp { parts.append("host: \(camp)") }
-        if let lat = occ.event.gpsLatitude, let lon = occ.event.gpsLongitude {
-            parts.append("gps: \(lat),\(lon)")
-        }
-        parts.append("(uid: \(occ.event.uid))")
-        return parts.joined(separator: " | ")
-    }
-}
-
-private func makeTimeFormatter() -> DateFormatter {
+/// Festival-local clock time, e.g. "9:30 PM"
+private let toolTimeFormatter: DateFormatter = {
     let formatter = DateFormatter()
     formatter.dateFormat = "h:mm a"
     formatter.timeZone = TimeZone(identifier: "America/Los_Angeles")
     return formatter
-}
+}()
 
 // MARK: - Search by Keyword (FTS5)
 
@@ -145,7 +50,7 @@ struct SearchByKeywordTool: Tool {
     func call(arguments: Arguments) async throws -> String {
         let results = try await playaDB.searchObjects(arguments.query)
         if results.isEmpty { return "No results found." }
-        return results.prefix(15).map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        return packedToolResult(Array(results.prefix(15)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -170,7 +75,7 @@ struct FetchArtTool: Tool {
         filter.searchText = arguments.keyword
         let results = try await playaDB.fetchArt(filter: filter)
         if results.isEmpty { return "No art found." }
-        return results.prefix(10).map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        return packedToolResult(Array(results.prefix(10)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -195,7 +100,7 @@ struct FetchCampsTool: Tool {
         filter.searchText = arguments.keyword
         let results = try await playaDB.fetchCamps(filter: filter)
         if results.isEmpty { return "No camps found." }
-        return results.prefix(10).map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        return packedToolResult(Array(results.prefix(10)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -220,7 +125,7 @@ struct FetchMutantVehiclesTool: Tool {
         filter.searchText = arguments.keyword
         let results = try await playaDB.fetchMutantVehicles(filter: filter)
         if results.isEmpty { return "No vehicles found." }
-        return results.prefix(10).map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        return packedToolResult(Array(results.prefix(10)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -243,7 +148,7 @@ struct GetFavoritesTool: Tool {
     func call(arguments: Arguments) async throws -> String {
         let favorites = try await playaDB.getFavorites()
         if favorites.isEmpty { return "No favorites yet." }
-        return favorites.prefix(20).map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        return packedToolResult(Array(favorites.prefix(20)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -268,10 +173,7 @@ struct FetchUpcomingEventsTool: Tool {
             within: arguments.withinHours, from: Date()
         )
         if events.isEmpty { return "No upcoming events found." }
-        let formatter = makeTimeFormatter()
-        return events.prefix(15).map {
-            formatEventOccurrence($0, detail: detailLevel, formatter: formatter)
-        }.joined(separator: "\n")
+        return packedToolResult(Array(events.prefix(15)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -304,7 +206,10 @@ struct FetchNearbyObjectsTool: Tool {
         )
         let objects = try await playaDB.fetchObjects(in: region)
         if objects.isEmpty { return "Nothing found nearby." }
-        return objects.prefix(15).map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        // Nearest first, so the closest get the detail when the budget runs short
+        let here = CLLocation(latitude: center.latitude, longitude: center.longitude)
+        let nearest = DistanceEngine.sorted(objects, byDistanceFrom: here) { $0.location }
+        return packedToolResult(Array(nearest.prefix(15)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -329,10 +234,7 @@ struct FetchEventsByCampTool: Tool {
     func call(arguments: Arguments) async throws -> String {
         let events = try await playaDB.fetchEvents(hostedByCampUID: arguments.campUID)
         if events.isEmpty { return "No events found for this camp." }
-        let formatter = makeTimeFormatter()
-        return events.prefix(10).map {
-            formatEventOccurrence($0, detail: detailLevel, formatter: formatter)
-        }.joined(separator: "\n")
+        return packedToolResult(Array(events.prefix(10)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -355,10 +257,7 @@ struct FetchEventsAtArtTool: Tool {
     func call(arguments: Arguments) async throws -> String {
         let events = try await playaDB.fetchEvents(locatedAtArtUID: arguments.artUID)
         if events.isEmpty { return "No events found at this art." }
-        let formatter = makeTimeFormatter()
-        return events.prefix(10).map {
-            formatEventOccurrence($0, detail: detailLevel, formatter: formatter)
-        }.joined(separator: "\n")
+        return packedToolResult(Array(events.prefix(10)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -388,10 +287,7 @@ struct FetchEventsByTypeTool: Tool {
         }
         let events = try await playaDB.fetchEvents(filter: filter)
         if events.isEmpty { return "No events found for type '\(arguments.eventTypeCode)'." }
-        let formatter = makeTimeFormatter()
-        return events.prefix(15).map {
-            formatEventOccurrence($0, detail: detailLevel, formatter: formatter)
-        }.joined(separator: "\n")
+        return packedToolResult(Array(events.prefix(15)), playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -412,16 +308,16 @@ struct FetchObjectDetailsTool: Tool {
 
     func call(arguments: Arguments) async throws -> String {
         if let art = try await playaDB.fetchArt(uid: arguments.uid) {
-            return formatObjectFull(art)
+            return packedToolResult([art], playaDB: playaDB, maxDetail: .full)
         }
         if let camp = try await playaDB.fetchCamp(uid: arguments.uid) {
-            return formatObjectFull(camp)
+            return packedToolResult([camp], playaDB: playaDB, maxDetail: .full)
         }
         if let event = try await playaDB.fetchEvent(uid: arguments.uid) {
-            return formatObjectFull(event)
+            return packedToolResult([event], playaDB: playaDB, maxDetail: .full)
         }
         if let mv = try await playaDB.fetchMutantVehicle(uid: arguments.uid) {
-            return formatObjectFull(mv)
+            return packedToolResult([mv], playaDB: playaDB, maxDetail: .full)
         }
         return "Object not found for uid: \(arguments.uid)"
     }
@@ -447,7 +343,7 @@ struct GetViewHistoryTool: Tool {
         let limit = arguments.limit ?? 10
         let objects = try await playaDB.fetchRecentlyViewed(limit: limit)
         if objects.isEmpty { return "No recently viewed items." }
-        return objects.map { formatObject($0, detail: detailLevel) }.joined(separator: "\n")
+        return packedToolResult(objects, playaDB: playaDB, maxDetail: detailLevel)
     }
 }
 
@@ -478,10 +374,9 @@ struct GetLocationHistoryTool: Tool {
                 .fetchAll(db)
         }
         if breadcrumbs.isEmpty { return "No location history found." }
-        let formatter = makeTimeFormatter()
         return breadcrumbs.enumerated().compactMap { idx, crumb -> String? in
             guard idx % 5 == 0 else { return nil } // Sample every 5th point
-            let time = formatter.string(from: crumb.timestamp)
+            let time = toolTimeFormatter.string(from: crumb.timestamp)
             return "\(time): \(crumb.coordinate.latitude),\(crumb.coordinate.longitude)"
         }.joined(separator: "\n")
     }
@@ -507,11 +402,12 @@ struct CalculateDistanceTool: Tool {
     }
 
     func call(arguments: Arguments) async throws -> String {
-        let from = CLLocation(latitude: arguments.fromLatitude, longitude: arguments.fromLongitude)
-        let to = CLLocation(latitude: arguments.toLatitude, longitude: arguments.toLongitude)
-        let meters = from.distance(from: to)
-        let walkMinutes = Int(ceil(meters / 67.0)) // ~4 km/h on playa dust
-        return "Distance: \(Int(meters))m, walk time: ~\(walkMinutes) min"
+        let from = CLLocationCoordinate2D(latitude: arguments.fromLatitude, longitude: arguments.fromLongitude)
+        let to = CLLocationCoordinate2D(latitude: arguments.toLatitude, longitude: arguments.toLongitude)
+        let meters = PlayaRouter.shared.distance(from: from, to: to)
+        let walkMinutes = PlayaTravelMode.walking.minutes(for: meters)
+        let bikeMinutes = PlayaTravelMode.biking.minutes(for: meters)
+        return "Distance along streets: \(Int(meters))m, walk time: ~\(walkMinutes) min, bike time: ~\(bikeMinutes) min"
     }
 }
 
@@ -203,7 +203,8 @@ final class RightNowViewModel: ObservableObject {
     }
 
     private func completeCurrentStep() {
-        guard let idx = steps.lastIndex(where: { $0.state == .running }) else { return }
+        // Concurrent steps complete in the order they started
+        guard let idx = steps.firstIndex(where: { $0.state == .running }) else { return }
         steps[idx].state = .completed
     }
 
@@ -0,0 +1,168 @@
+//
+//  ToolExecutor.swift
+//  iBurn
+//
+//  Memoized, concurrent tool and query execution for one AI session.
+//
+
+import Foundation
+
+/// Runs the tool calls and PlayaDB queries of one AI session (a workflow run or a search),
+/// memoizing results by tool name and arguments.
+///
+/// Concurrent calls with the same key share one execution, so steps can start independent
+/// work with `async let` and let retries and repeated model tool calls hit the memo instead
+/// of the database. Failures aren't memoized. Latency is recorded per tool for `summary()`.
+final class ToolExecutor: @unchecked Sendable {
+    struct Latency: Sendable {
+        /// Executions, excluding memo hits
+        var calls = 0
+        var memoHits = 0
+        var totalSeconds: Double = 0
+        var maxSeconds: Double = 0
+
+        var averageSeconds: Double { calls > 0 ? totalSeconds / Double(calls) : 0 }
+    }
+
+    /// A shared execution and the callers still waiting on it
+    private final class Execution {
+        let task: Task<Any, Error>
+        /// Callers that haven't been cancelled; isolate access with `lock`
+        var waiters = 0
+        /// Set once a caller got the result; isolate access with `lock`
+        var isFinished = false
+
+        init(task: Task<Any, Error>) {
+            self.task = task
+        }
+    }
+
+    private let lock = NSLock()
+    /// isolate access with `lock`
+    private var results: [String: Execution] = [:]
+    /// isolate access with `lock`
+    private var latencies: [String: Latency] = [:]
+
+    /// Result of `tool` for `arguments`, executing `work` only if no call with the same key has
+    /// succeeded or is in flight. The result type is part of the key, so callers that give one
+    /// tool name different result types never share an execution. An execution whose callers
+    /// have all been cancelled is cancelled too.
+    func run<T>(
+        _ tool: String,
+        arguments: String = "",
+        _ work: @escaping () async throws -> T
+    ) async throws -> T {
+        let key = "\(tool)|\(T.self)|\(arguments)"
+        lock.lock()
+        let execution: Execution
+        if let existing = results[key] {
+            latencies[tool, default: Latency()].memoHits += 1
+            execution = existing
+        } else {
+            execution = Execution(task: Task {
+                let start = CFAbsoluteTimeGetCurrent()
+                defer { self.record(tool, seconds: CFAbsoluteTimeGetCurrent() - start) }
+                return try await work()
+            })
+            results[key] = execution
+        }
+        execution.waiters += 1
+        lock.unlock()
+
+        do {
+            let value = try await withTaskCancellationHandler {
+                try await execution.task.value
+            } onCancel: {
+                self.cancel(execution, key: key)
+            }
+            lock.lock()
+            execution.isFinished = true
+            lock.unlock()
+            // `T` is part of the key, so only `work` returning `T` populates the task
+            return value as! T
+        } catch {
+            lock.lock()
+            if results[key] === execution {
+                results[key] = nil
+            }
+            lock.unlock()
+            throw error
+        }
+    }
+
+    /// Latency per tool name so far
+    func summary() -> [String: Latency] {
+        lock.lock()
+        defer { lock.unlock() }
+        return latencies
+    }
+
+    /// Print per-tool latency, slowest first
+    func logSummary(_ label: String) {
+        #if DEBUG
+        let lines = summary()
+            .sorted { $0.value.totalSeconds > $1.value.totalSeconds }
+            .map { tool, latency in
+                String(format: "%@: %d calls, %d memo hits, avg %.0f ms, max %.0f ms",
+                       tool, latency.calls, latency.memoHits,
+                       latency.averageSeconds * 1000, latency.maxSeconds * 1000)
+            }
+        guard !lines.isEmpty else { return }
+        print("[\(label)] tool latency:\n  " + lines.joined(separator: "\n  "))
+        #endif
+    }
+
+    /// Drops a cancelled caller, cancelling the execution once no caller is left waiting
+    private func cancel(_ execution: Execution, key: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        execution.waiters -= 1
+        guard execution.waiters == 0, !execution.isFinished else { return }
+        execution.task.cancel()
+        if results[key] === execution {
+            results[key] = nil
+        }
+    }
+
+    private func record(_ tool: String, seconds: Double) {
+        lock.lock()
+        defer { lock.unlock() }
+        var latency = latencies[tool, default: Latency()]
+        latency.calls += 1
+        latency.totalSeconds += seconds
+        latency.maxSeconds = max(latency.maxSeconds, seconds)
+        latencies[tool] = latency
+    }
+}
+
+#if canImport(FoundationModels)
+import FoundationModels
+
+/// A tool whose calls go through a `ToolExecutor`, memoized by the JSON of their arguments
+@available(iOS 26, *)
+struct ExecutedTool<Base: Tool>: Tool where Base.Output == String, Base.Arguments: ConvertibleToGeneratedContent {
+    typealias Arguments = Base.Arguments
+
+    let base: Base
+    let executor: ToolExecutor
+
+    var name: String { base.name }
+    var description: String { base.description }
+    var parameters: GenerationSchema { base.parameters }
+    var includesSchemaInInstructions: Bool { base.includesSchemaInInstructions }
+
+    func call(arguments: Arguments) async throws -> String {
+        try await executor.run(name, arguments: arguments.generatedContent.jsonString) {
+            try await base.call(arguments: arguments)
+        }
+    }
+}
+
+@available(iOS 26, *)
+extension ToolExecutor {
+    /// `tool` with its calls memoized and timed by this executor
+    func wrap<T: Tool>(_ tool: T) -> ExecutedTool<T> where T.Output == String, T.Arguments: ConvertibleToGeneratedContent {
+        ExecutedTool(base: tool, executor: self)
+    }
+}
+#endif
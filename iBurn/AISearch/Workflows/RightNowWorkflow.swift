@@ -97,7 +97,52 @@ func gatherRightNowCandidates(
     includeHappeningNow: Bool,
     perBucketCap: Int = 10
 ) async throws -> (now: [RNCandidate], next: [RNCandidate]) {
-    let codes = eventTypeCodes(forVibe: vibe)
+    let snapshot = try await fetchRightNowSnapshot(
+        playaDB: playaDB, region: region, now: now,
+        windowStart: windowStart, windowEnd: windowEnd, vibe: vibe
+    )
+    return rightNowCandidates(
+        from: snapshot, origin: origin, now: now, vibe: vibe, lean: lean,
+        favoriteUIDs: favoriteUIDs, includeHappeningNow: includeHappeningNow,
+        perBucketCap: perBucketCap
+    )
+}
+
+/// One read for the area: camps & art matching the vibe (event hosts, and the fallback
+/// when no events exist), mutant vehicles, and every occurrence overlapping the window —
+/// both the region-scoped events and those hosted by the nearest matched camps / art,
+/// which surfaces "the camp that's serving coffee right now" even when the event's host
+/// GPS isn't populated.
+func fetchRightNowSnapshot(
+    playaDB: PlayaDB,
+    region: MKCoordinateRegion?,
+    now: Date,
+    windowStart: Date,
+    windowEnd: Date,
+    vibe: String
+) async throws -> PlayaContextSnapshot {
+    let trimmedVibe = vibe.trimmingCharacters(in: .whitespacesAndNewlines)
+    let windowFloor = max(windowStart, now)
+    return try await playaDB.fetchContextSnapshot(
+        region: region,
+        window: DateInterval(start: windowFloor, end: max(windowFloor, windowEnd)),
+        typeCodes: eventTypeCodes(forVibe: vibe),
+        searchText: trimmedVibe.isEmpty ? nil : trimmedVibe,
+        hostLimit: 10
+    )
+}
+
+/// Split a `fetchRightNowSnapshot` result into "now" and "next" candidates.
+func rightNowCandidates(
+    from snapshot: PlayaContextSnapshot,
+    origin: CLLocationCoordinate2D,
+    now: Date,
+    vibe: String,
+    lean: DiscoveryLean,
+    favoriteUIDs: Set<String>,
+    includeHappeningNow: Bool,
+    perBucketCap: Int = 10
+) -> (now: [RNCandidate], next: [RNCandidate]) {
     let trimmedVibe = vibe.trimmingCharacters(in: .whitespacesAndNewlines)
     let excludeFavorites = (lean == .surprise)
     let formatter = brcTimeFormatter()
@@ -105,9 +150,10 @@ func gatherRightNowCandidates(
     func keep(_ uid: String) -> Bool {
         excludeFavorites ? !favoriteUIDs.contains(uid) : true
     }
+    let routes = PlayaRouter.shared.routes(from: origin)
     func walk(_ coord: CLLocationCoordinate2D?) -> Int? {
         guard let coord else { return nil }
-        return playaWalkMinutes(from: origin, to: coord)
+        return routes.minutes(to: coord, mode: .walking)
     }
     func eventCandidate(_ occ: EventObjectOccurrence) -> RNCandidate {
         let coord = eventCoordinate(occ)
@@ -118,55 +164,16 @@ func gatherRightNowCandidates(
         )
     }
 
-    // Camps & art matching the vibe in the area. They serve double duty: they're event
-    // hosts (we expand them to their events below) and the fallback when no events exist.
-    var artFilter = ArtFilter.all
-    artFilter.region = region
-    if !trimmedVibe.isEmpty { artFilter.searchText = trimmedVibe }
-    let artInArea = try await playaDB.fetchArt(filter: artFilter)
-
-    var campFilter = CampFilter.all
-    campFilter.region = region
-    if !trimmedVibe.isEmpty { campFilter.searchText = trimmedVibe }
-    let campsInArea = try await playaDB.fetchCamps(filter: campFilter)
-
-    // Collect candidate event occurrences from multiple sources:
-    //  (a) the region-scoped event query (catches events whose host GPS is in the join),
-    //  (b) events hosted by the matched camps / art — this catches events the region query
-    //      misses when the event's host GPS isn't populated, and is what surfaces "the camp
-    //      that's serving coffee right now" as its actual event.
-    func regionQuery(_ typeCodes: Set<String>?) async throws -> [EventObjectOccurrence] {
-        let floor = max(windowStart, now)
-        guard floor < windowEnd else { return [] }
-        var filter = EventFilter.all
-        filter.region = region
-        // Overlap window, not start-bounded: also surfaces events already underway at `floor`.
-        // The prior startDate/endDate prefilter dropped them before the client-side overlap
-        // gate below ever saw them.
-        filter.activeWindow = DateInterval(start: floor, end: windowEnd)
-        filter.eventTypeCodes = typeCodes
-        return try await playaDB.fetchEvents(filter: filter)
-    }
-    var occurrences: [EventObjectOccurrence] = []
-    var regionOccs = try await regionQuery(codes)
-    if regionOccs.isEmpty, codes != nil { regionOccs = try await regionQuery(nil) }
-    occurrences += regionOccs
-    for camp in campsInArea.prefix(10) {
-        occurrences += (try? await playaDB.fetchEvents(hostedByCampUID: camp.uid)) ?? []
-    }
-    for art in artInArea.prefix(10) {
-        occurrences += (try? await playaDB.fetchEvents(locatedAtArtUID: art.uid)) ?? []
-    }
+    let artInArea = snapshot.art
+    let campsInArea = snapshot.camps
 
-    // Classify occurrences that overlap the window (and haven't ended) into now / next.
-    let windowFloor = max(windowStart, now)
+    // Classify occurrences (all overlap the window) into now / next.
     var nowEvents: [RNCandidate] = []
     var nextEvents: [RNCandidate] = []
     var seenEvents = Set<String>()
-    for occ in occurrences.sorted(by: { $0.startDate < $1.startDate }) {
+    for occ in snapshot.occurrences {
         let uid = occ.event.uid
         guard keep(uid), seenEvents.insert(uid).inserted else { continue }
-        guard occ.startDate < windowEnd, occ.endDate > windowFloor else { continue }
         if includeHappeningNow, occ.startDate <= now, occ.endDate > now {
             nowEvents.append(eventCandidate(occ))
         } else {
@@ -195,9 +202,7 @@ func gatherRightNowCandidates(
                                   coordinate: coord, startDate: nil, timeInfo: nil, walkMinutes: walk(coord)))
     }
     if vibeMentionsVehicles(trimmedVibe) || (trimmedVibe.isEmpty && lean == .surprise) {
-        var mvFilter = MutantVehicleFilter.all
-        if !trimmedVibe.isEmpty { mvFilter.searchText = trimmedVibe }
-        for obj in try await playaDB.fetchMutantVehicles(filter: mvFilter) {
+        for obj in snapshot.mutantVehicles {
             guard keep(obj.uid), seenPlaces.insert(obj.uid).inserted else { continue }
             places.append(RNCandidate(uid: obj.uid, name: obj.name, type: .mutantVehicle,
                                       coordinate: nil, startDate: nil, timeInfo: nil, walkMinutes: nil))
@@ -268,9 +273,39 @@ struct RightNowWorkflow: Workflow {
     let name = "RightNow"
 
     func execute(context: WorkflowContext, onProgress: @escaping (WorkflowProgress) -> Void) async throws -> RightNowResult {
-        // Step 1: taste
+        // Steps 1 & 2 read independently, so run them together: taste from favorites, and
+        // the candidate snapshot for the area
         onProgress(.stepStarted(name: "taste", description: "Reading your favorites"))
-        let favorites = try await context.playaDB.getFavorites()
+        onProgress(.stepStarted(name: "gather", description: "Finding what's around you"))
+        let playaDB = context.playaDB
+        let origin = context.region?.center ?? context.location?.coordinate ?? YearSettings.manCenterCoordinate
+        let filterRegion = context.region ?? context.location.map {
+            MKCoordinateRegion(center: $0.coordinate,
+                               span: MKCoordinateSpan(latitudeDelta: 0.012, longitudeDelta: 0.012))
+        }
+        let includeNow = context.windowStart <= context.date && context.date <= context.windowEnd
+        let snapshotArguments = [
+            filterRegion.map { "\($0.center.latitude),\($0.center.longitude),\($0.span.latitudeDelta),\($0.span.longitudeDelta)" } ?? "",
+            "\(context.date.timeIntervalSince1970)",
+            "\(context.windowStart.timeIntervalSince1970)-\(context.windowEnd.timeIntervalSince1970)",
+            context.vibe,
+        ].joined(separator: "|")
+
+        async let favoritesFetch = context.tools.run("getFavorites") {
+            try await playaDB.getFavorites()
+        }
+        async let snapshotFetch = context.tools.run("contextSnapshot", arguments: snapshotArguments) {
+            try await fetchRightNowSnapshot(
+                playaDB: playaDB,
+                region: filterRegion,
+                now: context.date,
+                windowStart: context.windowStart,
+                windowEnd: context.windowEnd,
+                vibe: context.vibe
+            )
+        }
+
+        let favorites = try await favoritesFetch
         let favoriteUIDs = Set(favorites.map(\.uid))
         let tasteProfile: String
         if context.lean == .surprise || favorites.isEmpty {
@@ -280,22 +315,11 @@ struct RightNowWorkflow: Workflow {
         }
         onProgress(.stepCompleted(name: "taste"))
 
-        // Step 2: gather candidates
-        onProgress(.stepStarted(name: "gather", description: "Finding what's around you"))
-        let origin = context.region?.center ?? context.location?.coordinate ?? YearSettings.manCenterCoordinate
-        let filterRegion = context.region ?? context.location.map {
-            MKCoordinateRegion(center: $0.coordinate,
-                               span: MKCoordinateSpan(latitudeDelta: 0.012, longitudeDelta: 0.012))
-        }
-        let includeNow = context.windowStart <= context.date && context.date <= context.windowEnd
-
-        let (nowCands, nextCands) = try await gatherRightNowCandidates(
-            playaDB: context.playaDB,
-            region: filterRegion,
+        let snapshot = try await snapshotFetch
+        let (nowCands, nextCands) = rightNowCandidates(
+            from: snapshot,
             origin: origin,
             now: context.date,
-            windowStart: context.windowStart,
-            windowEnd: context.windowEnd,
             vibe: context.vibe,
             lean: context.lean,
             favoriteUIDs: favoriteUIDs,
@@ -364,8 +388,15 @@ struct RightNowWorkflow: Workflow {
         vibe: String,
         taste: String
     ) async throws -> Curated {
+        let candidates = Array(tagged.prefix(12))
+        // Instructions, vibe and section headers, plus the taste summary
+        let overheadTokens = 150 + ContextBudget.estimateTokens(vibe) + ContextBudget.estimateTokens(taste)
         let response: GenerableRightNowResponse = try await withContextWindowRetry(
-            initialCount: min(tagged.count, 12),
+            initialCount: min(candidates.count, initialCandidateCount(
+                lines: candidates.map { candidateLine($0.cand) },
+                overheadTokens: overheadTokens,
+                minimumCount: 4
+            )),
             minimumCount: 4
         ) { maxCount in
             try await retryWithCandidateFiltering(
@@ -46,6 +46,8 @@ struct WorkflowContext {
     let vibe: String
     /// Personalized vs surprise lean.
     let lean: DiscoveryLean
+    /// Memoizes and times this run's tool calls and queries; run independent ones concurrently.
+    let tools: ToolExecutor
 
     init(
         playaDB: PlayaDB,
@@ -56,7 +58,8 @@ struct WorkflowContext {
         windowStart: Date? = nil,
         windowEnd: Date? = nil,
         vibe: String = "",
-        lean: DiscoveryLean = .balanced
+        lean: DiscoveryLean = .balanced,
+        tools: ToolExecutor = ToolExecutor()
     ) {
         self.playaDB = playaDB
         self.location = location
@@ -67,6 +70,7 @@ struct WorkflowContext {
         self.windowEnd = windowEnd ?? date.addingTimeInterval(2 * 3600)
         self.vibe = vibe
         self.lean = lean
+        self.tools = tools
     }
 }
 
@@ -81,13 +85,11 @@ enum WorkflowProgress: Sendable {
 
 // MARK: - Utility: Distance Calculation
 
-/// Calculate walking time between two coordinates on the playa.
-/// Assumes ~4 km/h walking speed on playa dust.
+/// Calculate walking time between two coordinates on the playa, following the street grid.
+/// Assumes ~4 km/h walking speed on playa dust. To rank many destinations from one origin,
+/// use `PlayaRouter.shared.routes(from:)` instead.
 func playaWalkMinutes(from: CLLocationCoordinate2D, to: CLLocationCoordinate2D) -> Int {
-    let fromLoc = CLLocation(latitude: from.latitude, longitude: from.longitude)
-    let toLoc = CLLocation(latitude: to.latitude, longitude: to.longitude)
-    let meters = fromLoc.distance(from: toLoc)
-    return Int(ceil(meters / 67.0)) // ~4 km/h
+    PlayaRouter.shared.minutes(from: from, to: to, mode: .walking)
 }
 
 // MARK: - Utility: Object Field Access (DataObject name-conflict workaround)
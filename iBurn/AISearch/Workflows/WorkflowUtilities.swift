@@ -51,6 +51,14 @@ func withContextWindowRetry<R>(
     return try await attempt(minimumCount)
 }
 
+/// Starting count for `withContextWindowRetry`: how many of `lines`, in order, fit the
+/// context alongside `overheadTokens` of instructions and prompt scaffolding plus room for
+/// the response, so the first attempt doesn't overflow.
+func initialCandidateCount(lines: [String], overheadTokens: Int, minimumCount: Int) -> Int {
+    let budget = ContextBudget.maxTokens - ContextBudget.responseReserveTokens - overheadTokens
+    return max(minimumCount, ContextBudget.fittingCount(lines, budget: budget))
+}
+
 // MARK: - Schedule Tip Generator (Pure Swift — No LLM)
 
 /// Build factual schedule tips from actual event occurrence data.
@@ -172,32 +180,33 @@ func buildScheduleTips(from events: [EventObjectOccurrence]) -> [ScheduleTip] {
 
 /// Generate schedule tips (pure Swift) and an AI overview (LLM) for a host's events.
 /// Tips are always factual. The LLM overview may fail — tips alone are returned in that case.
+/// A cached overview for the host's current events skips the LLM.
 @available(iOS 26, *)
 func generateEventCollectionSummary(
     events: [EventObjectOccurrence],
     hostName: String,
     hostUID: String,
-    hostDescription: String? = nil
+    hostDescription: String? = nil,
+    cache: EventSummaryCache? = nil
 ) async -> EventSummaryContent? {
     guard !events.isEmpty else { return nil }
 
-    // Check cache first
-    if let cached = await EventSummaryCache.shared.get(hostUID) {
-        return cached
-    }
-
     // Step 1: Build factual tips from real data (instant, no LLM)
     let tips = buildScheduleTips(from: events)
 
-    // Step 2: Generate overview via LLM (may fail — that's OK)
-    let overview = await generateEventOverview(events: events, hostName: hostName, hostDescription: hostDescription)
+    // Step 2: Reuse a cached overview, or generate one via LLM (may fail — that's OK)
+    var overview = await cache?.overview(for: hostUID)
+    if overview == nil {
+        overview = await generateEventOverview(events: events, hostName: hostName, hostDescription: hostDescription)
+        if let overview {
+            await cache?.setOverview(overview, for: hostUID)
+        }
+    }
 
     // Only return content if we have something to show
     guard overview != nil || !tips.isEmpty else { return nil }
 
-    let content = EventSummaryContent(summary: overview, tips: tips)
-    await EventSummaryCache.shared.set(hostUID, content: content)
-    return content
+    return EventSummaryContent(summary: overview, tips: tips)
 }
 
 // MARK: - Source Data Assembly
@@ -291,11 +300,24 @@ private func generateEventOverview(
     hostName: String,
     hostDescription: String? = nil
 ) async -> String? {
+    func eventLine(_ number: Int, _ event: EventObjectOccurrence) -> String {
+        let type = EventTypeInfo.displayName(for: event.eventTypeCode)
+        let desc = event.description.map { String($0.prefix(120)) } ?? ""
+        return "\(number). \(event.name) [\(type)]\(desc.isEmpty ? "" : " - \(desc)")"
+    }
+    // Instructions plus the host description
+    let overheadTokens = 100 + ContextBudget.estimateTokens(String((hostDescription ?? "").prefix(200)))
+    let candidates = Array(events.prefix(20))
+
     // Pass 1: Generate (retries handled by withContextWindowRetry + retryWithCandidateFiltering)
     let rawOverview: String?
     do {
         rawOverview = try await withContextWindowRetry(
-            initialCount: min(events.count, 20),
+            initialCount: min(candidates.count, initialCandidateCount(
+                lines: candidates.enumerated().map { eventLine($0.offset + 1, $0.element) },
+                overheadTokens: overheadTokens,
+                minimumCount: 2
+            )),
             minimumCount: 2
         ) { maxCount in
             let slice = Array(events.prefix(maxCount))
@@ -305,11 +327,7 @@ private func generateEventOverview(
                 minimumCount: 2,
                 format: { $0.name }
             ) { batch in
-                let text = batch.enumerated().map { idx, event in
-                    let type = EventTypeInfo.displayName(for: event.eventTypeCode)
-                    let desc = event.description.map { String($0.prefix(120)) } ?? ""
-                    return "\(idx + 1). \(event.name) [\(type)]\(desc.isEmpty ? "" : " - \(desc)")"
-                }.joined(separator: "\n")
+                let text = batch.enumerated().map { eventLine($0.offset + 1, $0.element) }.joined(separator: "\n")
 
                 var prompt = "Events hosted by \(hostName):\n\(text)"
                 if let hostDesc = hostDescription, !hostDesc.isEmpty {
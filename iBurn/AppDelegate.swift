@@ -16,9 +16,9 @@ final class AppDelegate: BRCAppDelegate {
         let result = super.application(application, didFinishLaunchingWithOptions: launchOptions)
         Siren.shared.wail()
         
-        // Preload common emojis for better map performance
-        DispatchQueue.global(qos: .background).async {
-            EmojiImageRenderer.shared.preloadCommonEmojis()
+        // Pre-render every emoji marker variant into one sprite sheet for map performance
+        DispatchQueue.global(qos: .utility).async {
+            EmojiMarkerAtlas.shared.build()
         }
         
         return result
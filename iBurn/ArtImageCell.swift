@@ -64,42 +64,18 @@ public class ArtImageCell: BRCArtObjectTableViewCell {
     }
     
     private func processImageColors(for dataObject: BRCDataObject, metadata: BRCObjectMetadata, image: UIImage) {
-        DispatchQueue.global(qos: .default).async {
-            // Use ColorCache for art objects, fallback to simple extraction for others
-            if let art = dataObject as? BRCArtObject,
-               let artMetadata = metadata as? BRCArtMetadata {
-                ColorCache.shared.getColors(object: art, metadata: artMetadata, image: image, downscaleSize: .zero, processingQueue: nil, completion: { colors in
-                    guard self.objectUniqueId == dataObject.uniqueID else { return }
-                    DispatchQueue.main.async {
-                        UIView.animate(withDuration: 0.25, delay: 0.0, options: [], animations: {
-                            self.setupLabelColors(colors)
-                        })
-                    }
-                })
-            } else {
-                // Use simple color extraction for non-art objects
-                let colors = image.getColors()?.brc_ImageColors ?? Appearance.currentColors
-                
-                // Update metadata with colors
-                if let campMetadata = metadata as? BRCCampMetadata {
-                    campMetadata.thumbnailImageColors = colors
-                    let metadataObject = dataObject as BRCMetadataProtocol
-                    BRCDatabaseManager.shared.readWriteConnection.asyncReadWrite { transaction in
-                        metadataObject.replace(campMetadata, transaction: transaction)
-                    }
-                }
-                
-                guard self.objectUniqueId == dataObject.uniqueID else { return }
-                DispatchQueue.main.async {
-                    UIView.animate(withDuration: 0.25, delay: 0.0, options: [], animations: {
-                        self.setupLabelColors(colors)
-                    })
-                }
-            }
+        ColorCache.shared.getColors(
+            objectId: dataObject.uniqueID,
+            metadata: metadata as? BRCThumbnailImageColorsProtocol,
+            image: image
+        ) { colors in
+            guard self.objectUniqueId == dataObject.uniqueID else { return }
+            UIView.animate(withDuration: 0.25, delay: 0.0, options: [], animations: {
+                self.setupLabelColors(colors)
+            })
         }
     }
 
-
     private func setupLabelColors(_ colors: BRCImageColors) {
         self.backgroundColor = colors.backgroundColor
         self.titleLabel.textColor = colors.primaryColor
@@ -30,66 +30,67 @@ extension BRCAppDelegate {
         }
     }
 
-    /// Creates the favorites view controller, using SwiftUI when the feature flag is enabled.
+    /// Creates the favorites view controller. DEBUG builds can switch back to the legacy
+    /// YapDatabase list with the SwiftUI lists feature flag.
     /// Callable from ObjC for tab bar setup.
     @MainActor @objc
     func createFavoritesViewController() -> UIViewController {
         #if DEBUG
         let preferenceService = PreferenceServiceFactory.shared
-        if preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
-            return FavoritesListHostingController(dependencies: dependencies)
+        if !preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
+            let dbManager = BRCDatabaseManager.shared
+            let showExpiredEvents = UserSettings.showExpiredEventsInFavorites
+            let favoritesViewName = showExpiredEvents
+                ? dbManager.everythingFilteredByFavorite
+                : dbManager.everythingFilteredByFavoriteAndExpiration
+            let legacyVC = FavoritesViewController(
+                viewName: favoritesViewName,
+                searchViewName: dbManager.searchFavoritesView
+            )
+            legacyVC.title = "Favorites"
+            return legacyVC
         }
         #endif
 
-        let dbManager = BRCDatabaseManager.shared
-        let showExpiredEvents = UserSettings.showExpiredEventsInFavorites
-        let favoritesViewName = showExpiredEvents
-            ? dbManager.everythingFilteredByFavorite
-            : dbManager.everythingFilteredByFavoriteAndExpiration
-        let legacyVC = FavoritesViewController(
-            viewName: favoritesViewName,
-            searchViewName: dbManager.searchFavoritesView
-        )
-        legacyVC.title = "Favorites"
-        return legacyVC
+        return FavoritesListHostingController(dependencies: dependencies)
     }
 
-    /// Creates the nearby view controller, using SwiftUI when the feature flag is enabled.
+    /// Creates the nearby view controller (see `createFavoritesViewController`).
     /// Callable from ObjC for tab bar setup.
     @MainActor @objc
     func createNearbyViewController() -> UIViewController {
         #if DEBUG
         let preferenceService = PreferenceServiceFactory.shared
-        if preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
-            return NearbyListHostingController(dependencies: dependencies)
+        if !preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
+            let nearbyVC = NearbyViewController(
+                style: .grouped,
+                extensionName: BRCDatabaseManager.shared.rTreeIndex
+            )
+            nearbyVC.title = "Nearby"
+            return nearbyVC
         }
         #endif
 
-        let nearbyVC = NearbyViewController(
-            style: .grouped,
-            extensionName: BRCDatabaseManager.shared.rTreeIndex
-        )
-        nearbyVC.title = "Nearby"
-        return nearbyVC
+        return NearbyListHostingController(dependencies: dependencies)
     }
 
-    /// Creates the events view controller, using SwiftUI when the feature flag is enabled.
+    /// Creates the events view controller (see `createFavoritesViewController`).
     /// Callable from ObjC for tab bar setup.
     @MainActor @objc
     func createEventsViewController() -> UIViewController {
         #if DEBUG
         let preferenceService = PreferenceServiceFactory.shared
-        if preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
-            return EventListHostingController(dependencies: dependencies)
+        if !preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
+            let dbManager = BRCDatabaseManager.shared
+            let legacyVC = EventListViewController(
+                viewName: dbManager.eventsFilteredByDayExpirationAndTypeViewName,
+                searchViewName: dbManager.searchEventsView
+            )
+            legacyVC.title = "Events"
+            return legacyVC
         }
         #endif
 
-        let dbManager = BRCDatabaseManager.shared
-        let legacyVC = EventListViewController(
-            viewName: dbManager.eventsFilteredByDayExpirationAndTypeViewName,
-            searchViewName: dbManager.searchEventsView
-        )
-        legacyVC.title = "Events"
-        return legacyVC
+        return EventListHostingController(dependencies: dependencies)
     }
 }
@@ -84,27 +84,9 @@ static NSString * const kBRCBackgroundFetchIdentifier = @"kBRCBackgroundFetchIde
     // Background fetch is now handled by BackgroundTasks framework
     // [application setMinimumBackgroundFetchInterval:dailyInterval];
         
-    [BRCDatabaseManager.shared.backgroundReadConnection asyncReadWithBlock:^(YapDatabaseReadTransaction * __nonnull transaction) {
-        NSUInteger campCount = [transaction numberOfKeysInCollection:[BRCCampObject yapCollection]];
-        NSUInteger artCount = [transaction numberOfKeysInCollection:[BRCArtObject yapCollection]];
-        NSUInteger eventCount = [transaction numberOfKeysInCollection:[BRCEventObject yapCollection]];
-        NSLog(@"Existing data: \n%d Art\n%d Camp\n%d Event", (int)artCount, (int)campCount, (int)eventCount);
-    }];
-    
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-        NSLog(@"Loading bundled data...");
-        [self preloadExistingData];
-        if ([NSUserDefaults areDownloadsDisabled]) {
-            NSLog(@"Downloads are disabled, skipping.");
-            return;
-        }
-        NSLog(@"Loading data from internet...");
-        NSURL *updatesURL = [NSURL URLWithString:kBRCUpdatesURLString];
-        [self.dataImporter loadUpdatesFromURL:updatesURL fetchResultBlock:^(UIBackgroundFetchResult result) {
-            NSLog(@"Fetched data from internet with result: %d", (int)result);
-        }];
-        [ColorCache.shared prefetchAllColors];
-    });
+    // Launch only opens PlayaDB. The legacy YapDatabase store opens when a legacy screen
+    // first needs it, and catches up on bundled data and updates then.
+    [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(legacyDatabaseDidOpen:) name:BRCDatabaseManagerDidOpenNotification object:nil];
     
     // Handle launch from notification
     if (launchOptions[UIApplicationLaunchOptionsRemoteNotificationKey]) {
@@ -249,7 +231,7 @@ didReceiveNotificationResponse:(UNNotificationResponse *)response
 
 - (void) applicationDidReceiveMemoryWarning:(UIApplication *)application {
     DDLogWarn(@"applicationDidReceiveMemoryWarning:");
-    [BRCDatabaseManager.shared reduceCacheLimit];
+    [BRCDatabaseManager.sharedIfOpened reduceCacheLimit];
 }
 
 - (void)setupDefaultTabBarController
@@ -285,6 +267,22 @@ didReceiveNotificationResponse:(UNNotificationResponse *)response
     self.tabBarController.delegate = self;
 }
 
+- (void) legacyDatabaseDidOpen:(NSNotification*)notification {
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSLog(@"Loading bundled data...");
+        [self preloadExistingData];
+        if ([NSUserDefaults areDownloadsDisabled]) {
+            NSLog(@"Downloads are disabled, skipping.");
+            return;
+        }
+        NSLog(@"Loading data from internet...");
+        NSURL *updatesURL = [NSURL URLWithString:kBRCUpdatesURLString];
+        [self.dataImporter loadUpdatesFromURL:updatesURL fetchResultBlock:^(UIBackgroundFetchResult result) {
+            NSLog(@"Fetched data from internet with result: %d", (int)result);
+        }];
+    });
+}
+
 - (void) preloadExistingData {
     NSBundle *dataBundle = [NSBundle brc_dataBundle];
     
@@ -12,9 +12,6 @@ extension BRCDataObject {
     
     /// Get the emoji marker image for this data object
     @objc func emojiMarkerImage() -> UIImage? {
-        let emoji: String
-        var configuration = EmojiImageRenderer.Configuration.mapPin
-        
         // Check if object is favorited and get visit status
         var isFavorite = false
         var visitStatus = 0
@@ -24,38 +21,36 @@ extension BRCDataObject {
             visitStatus = metadata.visitStatus
         }
         
+        let emoji: String
+        var status = EmojiMarkerAtlas.Status.none
         if let artObject = self as? BRCArtObject {
             emoji = artObject.emoji
-            configuration = .mapPinWithStatus(isFavorite: isFavorite, visitStatus: visitStatus)
         } else if let campObject = self as? BRCCampObject {
             emoji = campObject.emoji
-            configuration = .mapPinWithStatus(isFavorite: isFavorite, visitStatus: visitStatus)
         } else if let eventObject = self as? BRCEventObject {
             emoji = eventObject.eventType.emoji
-            
-            // Apply event status colors
-            let statusColor = eventStatusColor(for: eventObject, at: Date.present)
-            configuration = .mapPinWithStatus(color: statusColor, isFavorite: isFavorite, visitStatus: visitStatus)
+            status = eventStatus(for: eventObject, at: Date.present)
         } else {
             // Default emoji for unknown types
             emoji = "📍"
-            configuration = .mapPinWithStatus(isFavorite: isFavorite, visitStatus: visitStatus)
         }
         
-        return EmojiImageRenderer.shared.renderEmoji(emoji, configuration: configuration)
+        let variant = EmojiMarkerAtlas.Variant(emoji: emoji, status: status, isFavorite: isFavorite, visitStatus: visitStatus)
+        return EmojiMarkerAtlas.shared.image(for: variant)
+            ?? EmojiImageRenderer.shared.renderEmoji(emoji, configuration: variant.configuration)
     }
     
-    /// Get the status color for an event
-    private func eventStatusColor(for event: BRCEventObject, at date: Date) -> UIColor? {
+    /// Get the status dot for an event
+    private func eventStatus(for event: BRCEventObject, at date: Date) -> EmojiMarkerAtlas.Status {
         if event.isStartingSoon(date) {
-            return .systemGreen
+            return .happening
         } else if event.isEndingSoon(date) {
-            return .systemOrange
+            return .endingSoon
         } else if event.hasEnded(date) {
-            return .systemRed
+            return .ended
         } else if event.isHappeningRightNow(date) {
-            return .systemGreen
+            return .happening
         }
-        return nil
+        return .none
     }
 }
@@ -161,8 +161,8 @@
     if (!objectLocation) {
         return CLLocationDistanceMax;
     }
-    CLLocationDistance distance = [location distanceFromLocation:objectLocation];
-    return distance;
+    // Along the street grid, matching the sorted lists
+    return [BRCPlayaRouting distanceFrom:location to:objectLocation];
 }
 
 
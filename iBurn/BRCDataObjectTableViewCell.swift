@@ -21,30 +21,12 @@ extension BRCDataObjectTableViewCell {
         }
         let currentLocation = BRCAppDelegate.shared.locationManager.location
         cell.setDataObject(dataObject.object, metadata: dataObject.metadata)
+        // Favorites live in PlayaDB; YapDatabase metadata only backs the rest of the row
+        let favorites = LegacyFavorites.shared
+        cell.favoriteButton.isSelected = favorites.isFavorite(dataObject.object)
         cell.updateDistanceLabel(from: currentLocation, dataObject: dataObject.object)
         cell.favoriteButtonAction = { (cell, isFavorite) in
-            writeConnection.readWrite { transaction in
-                guard let metadata = dataObject.object.metadata(with: transaction).copyAsSelf() else { return }
-                metadata.isFavorite = isFavorite
-                dataObject.object.replace(metadata, transaction: transaction)
-            }
-            // Sync to PlayaDB
-            let uid = dataObject.object.uniqueID
-            let obj = dataObject.object
-            Task { @MainActor in
-                let db = BRCAppDelegate.shared.dependencies.playaDB
-                do {
-                    if obj is BRCArtObject, let art = try await db.fetchArt(uid: uid) {
-                        try await db.setFavorite(isFavorite, for: art)
-                    } else if obj is BRCCampObject, let camp = try await db.fetchCamp(uid: uid) {
-                        try await db.setFavorite(isFavorite, for: camp)
-                    } else if obj is BRCEventObject, let event = try await db.fetchEvent(uid: uid) {
-                        try await db.setFavorite(isFavorite, for: event)
-                    }
-                } catch {
-                    print("PlayaDB cell favorite sync failed for \(uid): \(error)")
-                }
-            }
+            favorites.setFavorite(isFavorite, for: dataObject.object)
         }
         if let artCell = cell as? BRCArtObjectTableViewCell, let art = dataObject.object as? BRCArtObject {
             artCell.configurePlayPauseButton(art)
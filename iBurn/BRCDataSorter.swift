@@ -85,8 +85,8 @@ public final class BRCDataSorter: NSObject {
                 let sortOrder = options?.sortOrder ?? SortOrder.title
                 switch sortOrder {
                 case .distance(let from):
-                    camps.sort { $0.distance(from: from) < $1.distance(from: from) }
-                    art.sort { $0.distance(from: from) < $1.distance(from: from) }
+                    camps = DistanceEngine.sorted(camps, byDistanceFrom: from) { $0.location ?? $0.burnerMapLocation }
+                    art = DistanceEngine.sorted(art, byDistanceFrom: from) { $0.location ?? $0.burnerMapLocation }
                 case .title:
                     camps.sort { $0.title < $1.title }
                     art.sort { $0.title < $1.title }
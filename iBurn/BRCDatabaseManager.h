@@ -23,6 +23,10 @@ extern NSString * const kBRCDatabaseFolderName;
  the extension name under the "extensionName" key */
 extern NSString * const BRCDatabaseExtensionRegisteredNotification;
 
+/** Posted on the main queue after something first opens the shared database. Lists,
+ favorites and the map read PlayaDB, so this only happens for legacy screens. */
+extern NSString * const BRCDatabaseManagerDidOpenNotification;
+
 /** Visit status group names for the grouped view */
 extern NSString * const BRCVisitStatusGroupWantToVisit;
 extern NSString * const BRCVisitStatusGroupVisited;
@@ -42,8 +46,10 @@ extern NSString * const BRCVisitStatusGroupUnvisited;
 
 - (instancetype) initWithDatabaseName:(NSString*)databaseName;
 
-/** Default database */
+/** Default database, opened on first access */
 @property (nonatomic, class, readonly) BRCDatabaseManager *shared;
+/** Default database if it has already been opened, otherwise nil */
+@property (nonatomic, class, readonly, nullable) BRCDatabaseManager *sharedIfOpened;
 
 /** View containing all camp objects */
 @property (nonatomic, strong, readonly) NSString *campsViewName;
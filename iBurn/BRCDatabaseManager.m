@@ -21,6 +21,7 @@
 /** this is posted when an extension is ready. The userInfo contains
  the extension name under the "extensionName" key */
 NSString * const BRCDatabaseExtensionRegisteredNotification = @"BRCDatabaseExtensionRegisteredNotification";
+NSString * const BRCDatabaseManagerDidOpenNotification = @"BRCDatabaseManagerDidOpenNotification";
 
 static NSString * const RTreeMinLat = @"RTreeMinLat";
 static NSString * const RTreeMaxLat = @"RTreeMaxLat";
@@ -139,13 +140,22 @@ typedef NS_ENUM(NSUInteger, BRCDatabaseFilteredViewType) {
     return [[NSFileManager defaultManager] fileExistsAtPath:databsePath];
 }
 
+static BRCDatabaseManager *_sharedDatabaseManager = nil;
+
 + (BRCDatabaseManager*) shared {
-    static id databaseManager = nil;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        databaseManager = [[[self class] alloc] init];
+        _sharedDatabaseManager = [[[self class] alloc] init];
+        // Async so observers can use +shared without re-entering dispatch_once
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [[NSNotificationCenter defaultCenter] postNotificationName:BRCDatabaseManagerDidOpenNotification object:_sharedDatabaseManager];
+        });
     });
-    return databaseManager;
+    return _sharedDatabaseManager;
+}
+
++ (nullable BRCDatabaseManager*) sharedIfOpened {
+    return _sharedDatabaseManager;
 }
 
 // Call this before registerExtensions
@@ -200,7 +200,7 @@ static CGFloat const kTableViewHeaderHeight = 200;
 
 - (UIImage *)currentStarImage
 {
-    UIImage *starImage = [self imageIfFavorite:self.metadata.isFavorite];
+    UIImage *starImage = [self imageIfFavorite:[BRCLegacyFavorites.shared isFavorite:self.dataObject]];
     return starImage;
 }
 
@@ -209,17 +209,10 @@ static CGFloat const kTableViewHeaderHeight = 200;
     if (!self.dataObject) {
         return;
     }
-    BRCObjectMetadata *newMetadata = [self.metadata copy];
-    newMetadata.isFavorite = !newMetadata.isFavorite;
-    self.metadata = newMetadata;
-    BRCDataObject *tempObject = [self.dataObject copy];
-    [BRCDatabaseManager.shared.readWriteConnection asyncReadWriteWithBlock:^(YapDatabaseReadWriteTransaction *transaction) {
-        [self.dataObject replaceMetadata:newMetadata transaction:transaction];
-        if ([tempObject isKindOfClass:[BRCEventObject class]]) {
-            BRCEventObject *event = (BRCEventObject*)tempObject;
-            [event refreshCalendarEntry:transaction];
-        }
-    }];
+    // Favorites live in PlayaDB, which also schedules the calendar entry
+    BOOL isFavorite = ![BRCLegacyFavorites.shared isFavorite:self.dataObject];
+    [BRCLegacyFavorites.shared setFavorite:isFavorite for:self.dataObject];
+    self.favoriteBarButtonItem.image = [self imageIfFavorite:isFavorite];
 }
 
 - (void) saveUserNotes:(NSString*)userNotes atIndexPath:(NSIndexPath*)indexPath {
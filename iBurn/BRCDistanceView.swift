@@ -26,8 +26,8 @@ open class BRCDistanceView: UIView {
     }
     
     open func updateDistanceFromLocation(_ fromLocation: CLLocation) {
-        let distance = destination.distance(from: fromLocation)
-        let distanceString = TTTLocationFormatter.brc_humanizedString(forDistance: distance)
+        let distance = DistanceEngine.distance(from: fromLocation, to: destination)
+        let distanceString = DistanceEngine.nsAttributedString(forDistance: distance)
         distanceLabel.attributedText = distanceString
         distanceLabel.sizeToFit()
         self.frame = CGRect(x: frame.origin.x, y: frame.origin.y, width: distanceLabel.frame.size.width, height: distanceLabel.frame.size.height)
@@ -8,6 +8,8 @@
 
 import Foundation
 import UIImageColors
+import PlayaDB
+import CocoaLumberjack
 
 extension UIImageColors {
     var brc_ImageColors: BRCImageColors {
@@ -84,160 +86,60 @@ extension UIPageViewController {
 
 
 
+/// Thumbnail colors for legacy cells, stored in PlayaDB's `thumbnail_colors` table alongside
+/// the ones `ColorPrefetcher` computes, so each image is only analyzed once.
 public class ColorCache: NSObject {
     @objc static let shared = ColorCache()
-    let backgroundReadConnection = BRCDatabaseManager.shared.backgroundReadConnection
-    let writeConnection = BRCDatabaseManager.shared.readWriteConnection
     var completionQueue = DispatchQueue.main
-    
-    // Clean typealiases for all protocol compositions
-    typealias DataObjectWithMetadata = BRCDataObject & BRCMetadataProtocol
-    typealias ThumbnailDataObject = BRCDataObject & BRCThumbnailProtocol & BRCMetadataProtocol  
-    typealias ProcessableObject = BRCDataObject & BRCThumbnailProtocol
-    typealias ColorableMetadata = BRCObjectMetadata & BRCThumbnailImageColorsProtocol
-    
-    /** Collections to process for object operations */
-    private let collections = [BRCArtObject.yapCollection, BRCCampObject.yapCollection]
-    
-    @objc func prefetchAllColors() {
-        DispatchQueue.global(qos: .default).async {
-            var allObjects: [(ProcessableObject, ColorableMetadata)] = []
-            
-            self.backgroundReadConnection.read { transaction in
-                for collection in self.collections {
-                    transaction.iterateRows(inCollection: collection) { (key, obj: BRCDataObject, metadata: BRCObjectMetadata?, stop) in
-                        if let thumbnailObj = obj as? ThumbnailDataObject,
-                           let objMetadata = thumbnailObj.metadata(with: transaction) as? ColorableMetadata,
-                           objMetadata.thumbnailImageColors == nil,
-                           thumbnailObj.localThumbnailURL != nil {
-                            allObjects.append((thumbnailObj, objMetadata))
-                        }
-                    }
-                }
-            }
-            
-            // Process all objects uniformly
-            allObjects.forEach({ (obj, metadata) in
-                autoreleasepool {
-                    guard let image = BRCMediaDownloader.imageForObject(obj) else {
-                        return
-                    }
-                    self.getColors(object: obj, metadata: metadata, image: image, downscaleSize: .zero, processingQueue: nil, completion: nil)
-                }
-            })
-        }
-    }
-    
-    /** Processes objects missing color metadata. Useful for newly added objects. */
-    @objc func processMissingColors() {
-        DispatchQueue.global(qos: .default).async {
-            var allObjects: [(ProcessableObject, ColorableMetadata)] = []
-            
-            self.backgroundReadConnection.read { transaction in
-                for collection in self.collections {
-                    transaction.iterateRows(inCollection: collection) { (key, obj: BRCDataObject, metadata: BRCObjectMetadata?, stop) in
-                        if let thumbnailObj = obj as? ThumbnailDataObject,
-                           let objMetadata = thumbnailObj.metadata(with: transaction) as? ColorableMetadata,
-                           objMetadata.thumbnailImageColors == nil,
-                           thumbnailObj.localThumbnailURL != nil {
-                            allObjects.append((thumbnailObj, objMetadata))
-                        }
-                    }
-                }
-            }
-            
-            NSLog("ColorCache: Processing %d objects missing colors", allObjects.count)
-            
-            // Process all objects uniformly
-            allObjects.forEach({ (obj, metadata) in
-                autoreleasepool {
-                    guard let image = BRCMediaDownloader.imageForObject(obj) else {
-                        return
-                    }
-                    self.getColors(object: obj, metadata: metadata, image: image, downscaleSize: .zero, processingQueue: nil, completion: nil)
-                }
-            })
-        }
-    }
-    
-    /** Generic color computation for any object with thumbnail image colors. If processingQueue is nil, it will execute block on current queue */
-    func getColors<DataObject: DataObjectWithMetadata, Metadata: ColorableMetadata>(
-        object: DataObject,
-        metadata: Metadata,
+
+    /** Colors for `objectId`: from `metadata` when imported with the data, then PlayaDB, then extracted from `image` and saved */
+    func getColors(
+        objectId: String,
+        metadata: BRCThumbnailImageColorsProtocol?,
         image: UIImage,
-        downscaleSize: CGSize,
-        processingQueue: DispatchQueue?,
-        completion: ((BRCImageColors)->Void)?
+        completion: @escaping (BRCImageColors) -> Void
     ) {
         // If image colors theming is disabled, return global theme colors
         if !Appearance.useImageColorsTheming {
-            if let completion = completion {
-                self.completionQueue.async {
-                    completion(Appearance.currentColors)
-                }
+            completionQueue.async {
+                completion(Appearance.currentColors)
             }
             return
         }
-        
+
         // Found colors in cache
-        if let colors = metadata.thumbnailImageColors {
-            if let completion = completion {
-                self.completionQueue.async {
-                    completion(colors)
-                }
+        if let colors = metadata?.thumbnailImageColors {
+            completionQueue.async {
+                completion(colors)
             }
             return
         }
-        
-        let processBlock = {
-            // Maybe find colors in database when given stale metadata
-            var existingColors: BRCImageColors? = nil
-            self.backgroundReadConnection.read { transaction in
-                let freshMetadata = object.metadata(with: transaction)
-                if let colorMetadata = freshMetadata as? BRCThumbnailImageColorsProtocol {
-                    existingColors = colorMetadata.thumbnailImageColors
-                }
-            }
-            if let colors = existingColors {
-                if let completion = completion {
-                    self.completionQueue.async {
-                        completion(colors)
-                    }
+
+        let completionQueue = self.completionQueue
+        Task.detached(priority: .utility) {
+            let playaDB = await MainActor.run { BRCAppDelegate.shared.dependencies.playaDB }
+            if let cached = try? await playaDB.fetchThumbnailColors(objectId: objectId) {
+                completionQueue.async {
+                    completion(cached.brcImageColors)
                 }
                 return
             }
-            
+
             // Otherwise calculate the colors and save to db
             let brcColors: BRCImageColors? = autoreleasepool {
-                let colors = image.getColors(quality: .high)
-                return colors?.brc_ImageColors
+                image.getColors(quality: .high)?.brc_ImageColors
             }
-            
             guard let extractedColors = brcColors else {
                 return
             }
-            
-            if let completion = completion {
-                self.completionQueue.async {
-                    completion(extractedColors)
-                }
+            completionQueue.async {
+                completion(extractedColors)
             }
-            
-            self.writeConnection.asyncReadWrite { transaction in
-                let metadata = object.metadata(with: transaction).metadataCopy()
-                if let colorMetadata = metadata as? BRCThumbnailImageColorsProtocol {
-                    colorMetadata.thumbnailImageColors = extractedColors
-                    object.replace(metadata, transaction: transaction)
-                }
+            do {
+                try await playaDB.saveThumbnailColors(ThumbnailColors(objectId: objectId, brcColors: extractedColors))
+            } catch {
+                DDLogError("ColorCache: failed to save colors for \(objectId): \(error)")
             }
         }
-        
-        if let processingQueue = processingQueue {
-            processingQueue.async {
-                processBlock()
-            }
-        } else {
-            processBlock()
-        }
     }
 }
@@ -259,7 +259,8 @@ private final class DataUpdatesViewModel: ObservableObject {
     }
 
     /// Re-import PlayaDB from the bundled data to keep both databases in sync.
-    /// UI updates reactively via the GRDB observation — no manual refresh needed.
+    /// The import builds a shadow database so screens keep reading the current data until
+    /// it's swapped in; UI updates reactively via the GRDB observation — no manual refresh needed.
     private func reimportPlayaDB() async {
         let dataBundle = Bundle.brc_dataBundle
         do {
@@ -273,7 +274,8 @@ private final class DataUpdatesViewModel: ObservableObject {
                 artData: artData,
                 campData: campData,
                 eventData: eventData,
-                mvData: mvData
+                mvData: mvData,
+                mode: .shadow
             )
             playaDBStatus = "PlayaDB re-import complete"
         } catch {
@@ -8,6 +8,7 @@
 
 import Foundation
 import PlayaDB
+import UIKit
 
 /// Central container for app-wide dependencies
 /// Ensures single instances of core services (PlayaDB, LocationProvider)
@@ -34,6 +35,12 @@ class DependencyContainer {
     /// Art/camp thumbnail image downloader
     private let thumbnailImageDownloader: ThumbnailImageDownloader
 
+    /// Flushes queued last-viewed dates when the app enters the background
+    private var backgroundObserver: NSObjectProtocol?
+
+    /// Calendar entries for favorited events
+    private var favoriteEventCalendar: FavoriteEventCalendar?
+
     // MARK: - Data Providers (Lazy)
 
     /// Data provider for Art objects
@@ -56,6 +63,16 @@ class DependencyContainer {
         MutantVehicleDataProvider(playaDB: playaDB)
     }()
 
+    /// PlayaDB favorites for the legacy YapDatabase screens
+    private(set) lazy var legacyFavorites: LegacyFavorites = {
+        LegacyFavorites(
+            playaDB: playaDB,
+            artProvider: artDataProvider,
+            campProvider: campDataProvider,
+            eventProvider: eventDataProvider
+        )
+    }()
+
     /// AI search service (nil if device doesn't support Apple Intelligence)
     private(set) lazy var aiSearchService: AISearchService? = {
         AISearchServiceFactory.create(playaDB: playaDB)
@@ -79,8 +96,16 @@ class DependencyContainer {
 
         self.preferenceService = preferenceService
 
+        #if DEBUG
+        self.playaDB.setInstrumentationEnabled(preferenceService.getValue(Preferences.FeatureFlags.playaDBInstrumentation))
+        #endif
+
         self.playaDBSeeder = PlayaDBSeeder(playaDB: self.playaDB)
-        self.playaDBSeeder.seedIfNeeded()
+        let seedTask = self.playaDBSeeder.seedIfNeeded()
+        Task.detached(priority: .utility) { [playaDB = self.playaDB] in
+            await seedTask?.value
+            await LegacyUserDataMigration.migrateIfNeeded(playaDB: playaDB)
+        }
 
         self.mvImageDownloader = MutantVehicleImageDownloader(playaDB: self.playaDB)
         let mvTask = self.mvImageDownloader.downloadUncachedImages()
@@ -88,12 +113,46 @@ class DependencyContainer {
         self.thumbnailImageDownloader = ThumbnailImageDownloader(playaDB: self.playaDB)
         let thumbTask = self.thumbnailImageDownloader.downloadUncachedImages()
 
-        // After downloads complete, prefetch missing thumbnail colors
+        // After downloads complete, drop downloads duplicating bundled media,
+        // then prefetch missing thumbnail colors
         Task.detached(priority: .utility) { [playaDB = self.playaDB] in
             _ = await mvTask.value
             _ = await thumbTask.value
+            MediaManifest.shared.deduplicate()
             await ColorPrefetcher.prefetchMissingColors(playaDB: playaDB)
         }
+
+        // Views recorded within the debounce window would be lost if the app is suspended
+        // and killed before the deferred write runs
+        self.backgroundObserver = NotificationCenter.default.addObserver(
+            forName: UIApplication.didEnterBackgroundNotification,
+            object: nil,
+            queue: .main
+        ) { [playaDB = self.playaDB] _ in
+            Task { @MainActor in
+                let taskID = UIApplication.shared.beginBackgroundTask(withName: "FlushPendingViews")
+                do {
+                    try await playaDB.flushPendingViews()
+                } catch {
+                    print("Failed to flush last-viewed dates: \(error)")
+                }
+                UIApplication.shared.endBackgroundTask(taskID)
+            }
+        }
+
+        // Follows PlayaDB favorites, whichever screen sets them
+        self.favoriteEventCalendar = FavoriteEventCalendar(eventProvider: eventDataProvider)
+        self.favoriteEventCalendar?.start()
+
+        // Overviews for favorited hosts, once launch work has settled
+        #if canImport(FoundationModels)
+        if #available(iOS 26, *) {
+            Task.detached(priority: .background) { [playaDB = self.playaDB] in
+                try? await Task.sleep(nanoseconds: 30_000_000_000)
+                await EventSummaryPrewarmer.prewarmFavoriteHosts(playaDB: playaDB)
+            }
+        }
+        #endif
     }
 
     // MARK: - Factory Methods
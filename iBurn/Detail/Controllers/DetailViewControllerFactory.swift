@@ -16,13 +16,14 @@ class DetailViewControllerFactory {
     /// Creates a detail view controller using the preference system to determine implementation
     /// - Parameters:
     ///   - dataObject: The data object to display
+    ///   - prefetched: Optional images warmed by `DetailPrefetcher` (SwiftUI implementation only)
     /// - Returns: Either the new SwiftUI or legacy UIKit implementation based on preference
-    static func createDetailViewController(for dataObject: BRCDataObject) -> UIViewController {
+    static func createDetailViewController(for dataObject: BRCDataObject, prefetched: DetailPrefetch? = nil) -> UIViewController {
         // Check user interface preference
         let service = PreferenceServiceFactory.shared
         if service.getValue(Preferences.UserInterface.useSwiftUIDetailView) {
             // Use new SwiftUI implementation
-            return create(with: dataObject)
+            return create(with: dataObject, prefetched: prefetched)
         }
         
         // Use legacy UIKit implementation
@@ -34,10 +35,11 @@ class DetailViewControllerFactory {
     ///   - dataObject: The data object to display
     /// - Returns: A UIViewController ready for presentation
     static func create(
-        with dataObject: BRCDataObject
+        with dataObject: BRCDataObject,
+        prefetched: DetailPrefetch? = nil
     ) -> DetailHostingController {
 
-        // Create concrete service instances with PlayaDB for dual-write sync
+        // Favorites and notes go to PlayaDB when it has the object
         let dataService = DetailDataService(playaDB: BRCAppDelegate.shared.dependencies.playaDB)
         let audioService = AudioService()
         let locationService = LocationService()
@@ -46,7 +48,8 @@ class DetailViewControllerFactory {
             with: dataObject,
             dataService: dataService,
             audioService: audioService,
-            locationService: locationService
+            locationService: locationService,
+            prefetched: prefetched
         )
     }
     
@@ -56,12 +59,14 @@ class DetailViewControllerFactory {
     ///   - dataService: Custom data service implementation
     ///   - audioService: Custom audio service implementation
     ///   - locationService: Custom location service implementation
+    ///   - prefetched: Optional images warmed by `DetailPrefetcher`
     /// - Returns: A UIViewController ready for presentation
     static func create(
         with dataObject: BRCDataObject,
         dataService: DetailDataServiceProtocol,
         audioService: AudioServiceProtocol,
-        locationService: LocationServiceProtocol
+        locationService: LocationServiceProtocol,
+        prefetched: DetailPrefetch? = nil
     ) -> DetailHostingController {
         
         // Create coordinator without presenter initially
@@ -73,7 +78,8 @@ class DetailViewControllerFactory {
             dataService: dataService,
             audioService: audioService,
             locationService: locationService,
-            coordinator: coordinator
+            coordinator: coordinator,
+            prefetched: prefetched
         )
         
         // Create controller with all dependencies
@@ -139,7 +145,8 @@ class DetailViewControllerFactory {
         with subject: DetailSubject,
         playaDB: PlayaDB,
         preloadedMetadata: ObjectMetadata?,
-        preloadedColors: ThumbnailColors?
+        preloadedColors: ThumbnailColors?,
+        prefetched: DetailPrefetch? = nil
     ) -> DetailHostingController {
         let coordinator = DetailActionCoordinatorFactory.makeCoordinator()
         let locationService = LocationService()
@@ -150,7 +157,8 @@ class DetailViewControllerFactory {
             locationService: locationService,
             coordinator: coordinator,
             preloadedMetadata: preloadedMetadata,
-            preloadedColors: preloadedColors
+            preloadedColors: preloadedColors,
+            prefetched: prefetched
         )
 
         let controller = DetailHostingController(
@@ -58,6 +58,24 @@ extension DetailSubject {
         }
     }
 
+    /// The PlayaDB object being displayed, nil for legacy subjects.
+    var playaDBObject: (any DataObject)? {
+        switch self {
+        case .legacy:
+            return nil
+        case .art(let art):
+            return art
+        case .camp(let camp):
+            return camp
+        case .event(let event):
+            return event
+        case .eventOccurrence(let occ):
+            return occ
+        case .mutantVehicle(let mv):
+            return mv
+        }
+    }
+
     var location: CLLocation? {
         switch self {
         case .legacy(let obj):
@@ -114,3 +132,43 @@ extension DetailSubject {
         }
     }
 }
+
+extension DetailSubject {
+    /// Local header/thumbnail image files shown at the top of the detail screen.
+    /// Events use their host camp or art image.
+    func headerImageURLs(mediaProvider: MediaAssetProviding, dataService: DetailDataServiceProtocol?) -> [URL] {
+        var urls: [URL] = []
+        switch self {
+        case .legacy(let obj):
+            if let artObj = obj as? BRCArtObject, let url = artObj.localThumbnailURL {
+                urls.append(url)
+            } else if let campObj = obj as? BRCCampObject, let url = campObj.localThumbnailURL {
+                urls.append(url)
+            } else if let eventObj = obj as? BRCEventObject {
+                if let campId = eventObj.hostedByCampUniqueID,
+                   let camp = dataService?.getCamp(withId: campId),
+                   let url = camp.localThumbnailURL {
+                    urls.append(url)
+                }
+                if let artId = eventObj.hostedByArtUniqueID,
+                   let art = dataService?.getArt(withId: artId),
+                   let url = art.localThumbnailURL {
+                    urls.append(url)
+                }
+            }
+        case .art(let art):
+            if let url = mediaProvider.localThumbnailURL(objectID: art.uid) { urls.append(url) }
+        case .camp(let camp):
+            if let url = mediaProvider.localThumbnailURL(objectID: camp.uid) { urls.append(url) }
+        case .event(let event):
+            if let hostUID = event.hostedByCamp ?? event.locatedAtArt,
+               let url = mediaProvider.localThumbnailURL(objectID: hostUID) { urls.append(url) }
+        case .eventOccurrence(let occ):
+            if let hostUID = occ.hostedByCamp ?? occ.locatedAtArt,
+               let url = mediaProvider.localThumbnailURL(objectID: hostUID) { urls.append(url) }
+        case .mutantVehicle(let mv):
+            if let url = mediaProvider.localThumbnailURL(objectID: mv.uid) { urls.append(url) }
+        }
+        return urls
+    }
+}
@@ -7,6 +7,7 @@
 //
 
 import Foundation
+import PlayaDB
 
 /// Protocol for data operations in the detail view
 protocol DetailDataServiceProtocol {
@@ -32,6 +33,11 @@ protocol DetailDataServiceProtocol {
     /// - Parameter object: The data object
     /// - Returns: The metadata or nil if not found
     func getMetadata(for object: BRCDataObject) -> BRCObjectMetadata?
+
+    /// Favorite and notes state for a data object, when PlayaDB holds it
+    /// - Parameter object: The data object
+    /// - Returns: The PlayaDB metadata, or nil when the object only exists in YapDatabase
+    func playaMetadata(for object: BRCDataObject) async -> ObjectMetadata?
     
     /// Checks if location data can be shown for an object (embargo handling)
     /// - Parameter object: The data object
@@ -81,4 +87,8 @@ protocol DetailDataServiceProtocol {
     /// - Parameter art: The art object
     /// - Returns: The next upcoming event for this art, or nil if none found
     func getNextEvent(for art: BRCArtObject) -> BRCEventObject?
-}
\ No newline at end of file
+}
+
+extension DetailDataServiceProtocol {
+    func playaMetadata(for object: BRCDataObject) async -> ObjectMetadata? { nil }
+}
@@ -19,6 +19,10 @@ class DetailDataService: DetailDataServiceProtocol {
     }
 
     func updateFavoriteStatus(for object: BRCDataObject, isFavorite: Bool) async throws {
+        if let playaDB, let playaObject = await playaObject(for: object) {
+            try await playaDB.setFavorite(isFavorite, for: playaObject)
+            return
+        }
         guard let metadata = getMetadata(for: object) else {
             throw DetailError.invalidData
         }
@@ -37,11 +41,13 @@ class DetailDataService: DetailDataServiceProtocol {
                 continuation.resume()
             }
         }
-
-        syncFavoriteToPlayaDB(for: object, isFavorite: isFavorite)
     }
 
     func updateUserNotes(for object: BRCDataObject, notes: String) async throws {
+        if let playaDB, let playaObject = await playaObject(for: object) {
+            try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: playaObject)
+            return
+        }
         guard let metadata = getMetadata(for: object) else {
             throw DetailError.invalidData
         }
@@ -56,8 +62,6 @@ class DetailDataService: DetailDataServiceProtocol {
                 continuation.resume()
             }
         }
-
-        syncNotesToPlayaDB(for: object, notes: notes)
     }
     
     func updateVisitStatus(for object: BRCDataObject, visitStatus: BRCVisitStatus) async throws {
@@ -90,6 +94,11 @@ class DetailDataService: DetailDataServiceProtocol {
         return metadata
     }
     
+    func playaMetadata(for object: BRCDataObject) async -> ObjectMetadata? {
+        guard let playaDB, let playaObject = await playaObject(for: object) else { return nil }
+        return try? await playaDB.existingMetadata(for: playaObject)
+    }
+
     func canShowLocation(for object: BRCDataObject) -> Bool {
         return BRCEmbargo.canShowLocation(for: object)
     }
@@ -225,43 +234,12 @@ class DetailDataService: DetailDataServiceProtocol {
         return nextEvent
     }
 
-    // MARK: - PlayaDB Sync
-
-    private func syncFavoriteToPlayaDB(for object: BRCDataObject, isFavorite: Bool) {
-        guard let playaDB else { return }
-        let uid = object.uniqueID
-
-        Task {
-            do {
-                if object is BRCArtObject, let art = try await playaDB.fetchArt(uid: uid) {
-                    try await playaDB.setFavorite(isFavorite, for: art)
-                } else if object is BRCCampObject, let camp = try await playaDB.fetchCamp(uid: uid) {
-                    try await playaDB.setFavorite(isFavorite, for: camp)
-                } else if object is BRCEventObject, let event = try await playaDB.fetchEvent(uid: uid) {
-                    try await playaDB.setFavorite(isFavorite, for: event)
-                }
-            } catch {
-                print("PlayaDB favorite sync failed for \(uid): \(error)")
-            }
-        }
-    }
-
-    private func syncNotesToPlayaDB(for object: BRCDataObject, notes: String) {
-        guard let playaDB else { return }
-        let uid = object.uniqueID
+    // MARK: - PlayaDB
 
-        Task {
-            do {
-                if object is BRCArtObject, let art = try await playaDB.fetchArt(uid: uid) {
-                    try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: art)
-                } else if object is BRCCampObject, let camp = try await playaDB.fetchCamp(uid: uid) {
-                    try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: camp)
-                } else if object is BRCEventObject, let event = try await playaDB.fetchEvent(uid: uid) {
-                    try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: event)
-                }
-            } catch {
-                print("PlayaDB notes sync failed for \(uid): \(error)")
-            }
-        }
+    /// The PlayaDB record for a legacy object. Favorites and notes live there; YapDatabase
+    /// metadata is only written for objects PlayaDB doesn't have.
+    private func playaObject(for object: BRCDataObject) async -> (any DataObject)? {
+        guard let playaDB else { return nil }
+        return await LegacyFavorites.playaObject(for: object, playaDB: playaDB)
     }
-}
\ No newline at end of file
+}
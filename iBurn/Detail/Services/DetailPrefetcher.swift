@@ -0,0 +1,143 @@
+import UIKit
+import PlayaDB
+
+/// Data warmed ahead of time for one detail page.
+struct DetailPrefetch {
+    /// Detail bundle (metadata, colors, host, related events); nil for legacy subjects.
+    /// Its metadata is as of the prefetch, so pages re-read favorite and notes on load.
+    let bundle: DetailBundle?
+    /// Decoded header images keyed by file path, same keys as `DetailViewModel.preloadedImages`
+    let images: [String: UIImage]
+}
+
+/// Warms detail data for the pages around the one being shown, so swiping in a
+/// `UIPageViewController` doesn't wait on queries and image decoding.
+///
+/// Callers pass the current window of subjects (nearest first) whenever the visible page
+/// changes. In-flight work for subjects that left the window is cancelled; finished results
+/// stay in a small LRU cache so swiping back is also instant.
+@MainActor
+final class DetailPrefetcher {
+    /// Pages to warm on each side of the current one
+    let radius: Int
+
+    private let playaDB: PlayaDB?
+    private let mediaProvider: MediaAssetProviding
+    private let dataService: DetailDataServiceProtocol?
+    private let capacity: Int
+
+    private var cache: [String: DetailPrefetch] = [:]
+    /// Least recently used first
+    private var recency: [String] = []
+    private var tasks: [String: Task<Void, Never>] = [:]
+
+    init(
+        playaDB: PlayaDB?,
+        mediaProvider: MediaAssetProviding = BRCMediaAssetProvider(),
+        dataService: DetailDataServiceProtocol? = nil,
+        radius: Int = 2,
+        capacity: Int = 8
+    ) {
+        self.playaDB = playaDB
+        self.mediaProvider = mediaProvider
+        self.dataService = dataService
+        self.radius = radius
+        self.capacity = max(capacity, radius * 2 + 1)
+    }
+
+    deinit {
+        tasks.values.forEach { $0.cancel() }
+    }
+
+    /// Window of `items` around `index`: the current item, then alternating neighbours outward.
+    /// Callers usually drop the first element, since the visible page loads itself.
+    func window<T>(around index: Int, in items: [T]) -> [T] {
+        guard items.indices.contains(index) else { return [] }
+        var result = [items[index]]
+        guard radius > 0 else { return result }
+        for distance in 1...radius {
+            if items.indices.contains(index + distance) { result.append(items[index + distance]) }
+            if items.indices.contains(index - distance) { result.append(items[index - distance]) }
+        }
+        return result
+    }
+
+    /// Starts warming `subjects` (in order) and cancels in-flight work for anything else.
+    func prefetch(_ subjects: [DetailSubject]) {
+        let wanted = Dictionary(subjects.map { (key(for: $0), $0) }, uniquingKeysWith: { first, _ in first })
+
+        for (key, task) in tasks where wanted[key] == nil {
+            task.cancel()
+            tasks[key] = nil
+        }
+
+        for subject in subjects {
+            let key = key(for: subject)
+            guard cache[key] == nil, tasks[key] == nil else { continue }
+            tasks[key] = Task { [weak self] in
+                guard let self else { return }
+                let prefetch = await self.load(subject)
+                // A cancelled task was already removed, and its key may belong to a newer task
+                guard !Task.isCancelled else { return }
+                self.tasks[key] = nil
+                guard let prefetch else { return }
+                self.store(prefetch, for: key)
+            }
+        }
+    }
+
+    /// Cached data for `subject`, if it has finished warming.
+    func prefetched(for subject: DetailSubject) -> DetailPrefetch? {
+        let key = key(for: subject)
+        guard let prefetch = cache[key] else { return nil }
+        touch(key)
+        return prefetch
+    }
+
+    /// Cancels all in-flight work, e.g. when the pager is dismissed.
+    func cancelAll() {
+        tasks.values.forEach { $0.cancel() }
+        tasks.removeAll()
+    }
+
+    // MARK: - Private
+
+    private func key(for subject: DetailSubject) -> String {
+        subject.playaDBObject?.uid ?? subject.uid
+    }
+
+    private func load(_ subject: DetailSubject) async -> DetailPrefetch? {
+        var bundle: DetailBundle?
+        if let playaDB, let object = subject.playaDBObject {
+            // Don't record a view: the page may never be shown.
+            bundle = try? await playaDB.fetchDetailBundle(uid: object.uid, recordingViewAt: nil)
+        }
+        guard !Task.isCancelled else { return nil }
+
+        let urls = subject.headerImageURLs(mediaProvider: mediaProvider, dataService: dataService)
+        let images = await Task.detached(priority: .utility) {
+            var result: [String: UIImage] = [:]
+            for url in urls {
+                // Decode now so the first frame doesn't pay for it on the main thread
+                if let image = UIImage(contentsOfFile: url.path) {
+                    result[url.path] = image.preparingForDisplay() ?? image
+                }
+            }
+            return result
+        }.value
+        return DetailPrefetch(bundle: bundle, images: images)
+    }
+
+    private func store(_ prefetch: DetailPrefetch, for key: String) {
+        cache[key] = prefetch
+        touch(key)
+        while recency.count > capacity {
+            cache[recency.removeFirst()] = nil
+        }
+    }
+
+    private func touch(_ key: String) {
+        recency.removeAll { $0 == key }
+        recency.append(key)
+    }
+}
@@ -24,7 +24,7 @@ class LocationService: LocationServiceProtocol {
             return nil
         }
         
-        return currentLocation.distance(from: objectLocation)
+        return DistanceEngine.distance(from: currentLocation, to: objectLocation)
     }
     
     func startLocationUpdates() {
@@ -78,6 +78,8 @@ class DetailViewModel: ObservableObject {
     private var resolvedEventOverview: String?
     /// Whether LLM overview generation is in progress
     private var isGeneratingEventOverview = false
+    /// Object, metadata, colors, host and related events for PlayaDB subjects, loaded in one read
+    private var detailBundle: DetailBundle?
     
     // MARK: - Initialization
 
@@ -87,7 +89,8 @@ class DetailViewModel: ObservableObject {
         dataService: DetailDataServiceProtocol,
         audioService: AudioServiceProtocol,
         locationService: LocationServiceProtocol,
-        coordinator: DetailActionCoordinator
+        coordinator: DetailActionCoordinator,
+        prefetched: DetailPrefetch? = nil
     ) {
         let mediaProvider = BRCMediaAssetProvider()
         let rowAssets: RowAssetsLoader?
@@ -112,6 +115,7 @@ class DetailViewModel: ObservableObject {
         // non-optional metadata object.
         let md = dataService.getMetadata(for: dataObject) ?? BRCObjectMetadata()!
         self.legacyMetadata = md
+        self.preloadedImages = prefetched?.images ?? [:]
         self.isFavorite = md.isFavorite
         self.userNotes = md.userNotes ?? ""
         self.extractedImageColors = rowAssets?.colors
@@ -129,6 +133,7 @@ class DetailViewModel: ObservableObject {
     /// - Parameters:
     ///   - preloadedMetadata: Optional pre-loaded metadata from ListRow (avoids async query on first render).
     ///   - preloadedColors: Optional pre-loaded thumbnail colors from ListRow (avoids async extraction).
+    ///   - prefetched: Optional bundle and decoded images warmed by `DetailPrefetcher` (skips the detail queries).
     init(
         subject: DetailSubject,
         playaDB: PlayaDB,
@@ -136,6 +141,7 @@ class DetailViewModel: ObservableObject {
         coordinator: DetailActionCoordinator,
         preloadedMetadata: ObjectMetadata? = nil,
         preloadedColors: ThumbnailColors? = nil,
+        prefetched: DetailPrefetch? = nil,
         mediaProvider: MediaAssetProviding = BRCMediaAssetProvider(),
         audioPlayer: any AudioPlayerProtocol = BRCAudioPlayer.sharedInstance
     ) {
@@ -171,7 +177,11 @@ class DetailViewModel: ObservableObject {
 
         self.legacyMetadata = nil
 
-        // Apply pre-loaded metadata immediately (avoids async flicker)
+        self.detailBundle = prefetched?.bundle
+        self.preloadedImages = prefetched?.images ?? [:]
+
+        // Apply pre-loaded metadata immediately (avoids async flicker). A prefetched bundle's
+        // metadata may predate favorite or notes edits, so `loadMetadata` reads it fresh.
         if let md = preloadedMetadata {
             self.isFavorite = md.isFavorite
             self.userNotes = md.userNotes ?? ""
@@ -183,7 +193,7 @@ class DetailViewModel: ObservableObject {
         }
 
         // Apply pre-loaded colors immediately, then fall back to RowAssetsLoader cache
-        if let tc = preloadedColors {
+        if let tc = preloadedColors ?? prefetched?.bundle?.thumbnailColors {
             self.extractedImageColors = tc.brcImageColors
         } else {
             self.extractedImageColors = rowAssets?.colors
@@ -239,84 +249,55 @@ class DetailViewModel: ObservableObject {
                 isFavorite = updated.isFavorite
                 userNotes = updated.userNotes ?? ""
             }
-            if let artObject = obj as? BRCArtObject, artObject.audioURL != nil {
-                isAudioPlaying = audioService?.isPlaying(artObject: artObject) ?? false
-            }
-
-        case .art(let art):
-            guard let playaDB else { break }
-            do {
-                let md = try await playaDB.metadata(for: art)
+            // Favorites and notes are only written to PlayaDB when it has the object
+            if let md = await dataService.playaMetadata(for: obj) {
+                let merged = legacyMetadata?.metadataCopy()
+                merged?.isFavorite = md.isFavorite
+                merged?.userNotes = md.userNotes
+                legacyMetadata = merged
                 isFavorite = md.isFavorite
                 userNotes = md.userNotes ?? ""
-                firstViewed = md.firstViewed
-                lastViewed = md.lastViewed
-            } catch {
-                self.error = error
-            }
-            if localAudioURL(objectID: art.uid) != nil {
-                isAudioPlaying = audioPlayer.isPlaying(id: art.uid)
             }
-
-        case .camp(let camp):
-            guard let playaDB else { break }
-            do {
-                let md = try await playaDB.metadata(for: camp)
-                isFavorite = md.isFavorite
-                userNotes = md.userNotes ?? ""
-                firstViewed = md.firstViewed
-                lastViewed = md.lastViewed
-            } catch {
-                self.error = error
+            if let artObject = obj as? BRCArtObject, artObject.audioURL != nil {
+                isAudioPlaying = audioService?.isPlaying(artObject: artObject) ?? false
             }
 
-        case .event(let event):
-            guard let playaDB else { break }
-            do {
-                let md = try await playaDB.metadata(for: event)
-                isFavorite = md.isFavorite
-                userNotes = md.userNotes ?? ""
-                firstViewed = md.firstViewed
-                lastViewed = md.lastViewed
-            } catch {
-                self.error = error
+        case .art, .camp, .event, .eventOccurrence, .mutantVehicle:
+            guard let playaDB, let object = subject.playaDBObject else { break }
+            var metadata: ObjectMetadata?
+            if let bundle = detailBundle {
+                // Warmed by DetailPrefetcher without recording a view. Only the object, host
+                // and events are reused; favorite and notes may have changed since.
+                playaDB.recordView(Date(), for: object)
+                metadata = (try? await playaDB.existingMetadata(for: bundle.object)) ?? bundle.metadata
+            } else {
+                do {
+                    // One read for metadata, colors, host and related events; the view is recorded lazily.
+                    detailBundle = try await playaDB.fetchDetailBundle(uid: object.uid)
+                } catch {
+                    self.error = error
+                }
+                metadata = detailBundle?.metadata
             }
-
-        case .eventOccurrence(let occ):
-            guard let playaDB else { break }
-            do {
-                let md = try await playaDB.metadata(for: occ)
+            if let md = metadata {
                 isFavorite = md.isFavorite
                 userNotes = md.userNotes ?? ""
                 firstViewed = md.firstViewed
                 lastViewed = md.lastViewed
-            } catch {
-                self.error = error
             }
-
-        case .mutantVehicle(let mv):
-            guard let playaDB else { break }
-            do {
-                let md = try await playaDB.metadata(for: mv)
-                isFavorite = md.isFavorite
-                userNotes = md.userNotes ?? ""
-                firstViewed = md.firstViewed
-                lastViewed = md.lastViewed
-            } catch {
-                self.error = error
+            if case .art(let art) = subject, localAudioURL(objectID: art.uid) != nil {
+                isAudioPlaying = audioPlayer.isPlaying(id: art.uid)
             }
         }
 
-        // For PlayaDB subjects without pre-loaded colors, try the DB cache.
+        // For PlayaDB subjects without pre-loaded colors, use the DB cache from the bundle.
         // This is faster than re-extracting from the image via RowAssetsLoader.
-        if extractedImageColors == nil, let playaDB {
-            if let tc = try? await playaDB.fetchThumbnailColors(objectId: subject.thumbnailObjectID) {
-                extractedImageColors = tc.brcImageColors
-            }
+        if extractedImageColors == nil, let tc = detailBundle?.thumbnailColors {
+            extractedImageColors = tc.brcImageColors
         }
     }
 
-    /// Phase 2: Expensive work (images, hosted events, setLastViewed) then refresh
+    /// Phase 2: Expensive work (images, bundle-resolved host and events) then refresh
     private func loadDeferredData() async {
         var needsRefresh = false
 
@@ -328,77 +309,27 @@ class DetailViewModel: ObservableObject {
         case .legacy:
             break
 
-        case .art(let art):
-            guard let playaDB else { break }
-            try? await playaDB.setLastViewed(Date(), for: art)
-            let events = (try? await playaDB.fetchEvents(locatedAtArtUID: art.uid)) ?? []
-            if !events.isEmpty {
-                resolvedHostEvents = events
-                needsRefresh = true
-            }
-
-        case .camp(let camp):
-            guard let playaDB else { break }
-            try? await playaDB.setLastViewed(Date(), for: camp)
-            let events = (try? await playaDB.fetchEvents(hostedByCampUID: camp.uid)) ?? []
-            if !events.isEmpty {
-                resolvedHostEvents = events
-                needsRefresh = true
-            }
-
-        case .event(let event):
-            guard let playaDB else { break }
-            try? await playaDB.setLastViewed(Date(), for: event)
-            // Resolve occurrences for schedule display
-            resolvedEventOccurrences = (try? await playaDB.fetchOccurrences(forEventUID: event.uid)) ?? []
-            // Resolve host info (mirroring eventOccurrence path)
-            if let campUID = event.hostedByCamp,
-               let camp = try? await playaDB.fetchCamp(uid: campUID) {
-                resolvedHostName = camp.name
-                resolvedHostSubject = .camp(camp)
-                resolvedHostDescription = camp.description
-                resolvedHostLocation = camp.locationString ?? camp.intersection
-                resolvedHostEvents = (try? await playaDB.fetchEvents(hostedByCampUID: campUID)) ?? []
-                needsRefresh = true
-            } else if let artUID = event.locatedAtArt,
-                      let art = try? await playaDB.fetchArt(uid: artUID) {
-                resolvedHostName = art.name
-                resolvedHostSubject = .art(art)
-                resolvedHostDescription = art.description
-                resolvedHostLocation = art.locationString ?? art.timeBasedAddress
-                resolvedHostEvents = (try? await playaDB.fetchEvents(locatedAtArtUID: artUID)) ?? []
-                needsRefresh = true
-            }
-            if !resolvedEventOccurrences.isEmpty { needsRefresh = true }
-
-        case .eventOccurrence(let occ):
-            guard let playaDB else { break }
-            try? await playaDB.setLastViewed(Date(), for: occ)
-            // Use pre-loaded host from JOIN, fall back to fetch
-            var host: (any PlaceDataObject)? = occ.host
-            if host == nil, let campUID = occ.hostedByCamp {
-                host = try? await playaDB.fetchCamp(uid: campUID)
-            }
-            if host == nil, let artUID = occ.locatedAtArt {
-                host = try? await playaDB.fetchArt(uid: artUID)
+        case .art, .camp, .event, .eventOccurrence, .mutantVehicle:
+            guard let bundle = detailBundle else { break }
+            resolvedHostEvents = bundle.hostEvents
+            if case .event = subject {
+                // Occurrences for schedule display
+                resolvedEventOccurrences = bundle.occurrences
             }
-            if let host {
+            if let host = bundle.host {
                 resolvedHostName = host.name
                 resolvedHostDescription = host.description
                 resolvedHostLocation = host.address
                 if let camp = host as? CampObject {
                     resolvedHostSubject = .camp(camp)
-                    resolvedHostEvents = (try? await playaDB.fetchEvents(hostedByCampUID: camp.uid)) ?? []
                 } else if let art = host as? ArtObject {
                     resolvedHostSubject = .art(art)
-                    resolvedHostEvents = (try? await playaDB.fetchEvents(locatedAtArtUID: art.uid)) ?? []
                 }
                 needsRefresh = true
             }
-
-        case .mutantVehicle(let mv):
-            guard let playaDB else { break }
-            try? await playaDB.setLastViewed(Date(), for: mv)
+            if !resolvedHostEvents.isEmpty || !resolvedEventOccurrences.isEmpty {
+                needsRefresh = true
+            }
         }
 
         rowAssets?.startIfNeeded()
@@ -427,22 +358,18 @@ class DetailViewModel: ObservableObject {
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.toggleFavorite(art)
                 isFavorite = try await playaDB.isFavorite(art)
-                syncFavoriteToYapDB(uid: art.uid, yapCollection: BRCArtObject.yapCollection, isFavorite: isFavorite)
             case .camp(let camp):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.toggleFavorite(camp)
                 isFavorite = try await playaDB.isFavorite(camp)
-                syncFavoriteToYapDB(uid: camp.uid, yapCollection: BRCCampObject.yapCollection, isFavorite: isFavorite)
             case .event(let event):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.toggleFavorite(event)
                 isFavorite = try await playaDB.isFavorite(event)
-                syncFavoriteToYapDB(uid: event.uid, yapCollection: BRCEventObject.yapCollection, isFavorite: isFavorite, isEvent: true)
             case .eventOccurrence(let occ):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.toggleFavorite(occ)
                 isFavorite = try await playaDB.isFavorite(occ)
-                syncFavoriteToYapDB(uid: occ.event.uid, yapCollection: BRCEventObject.yapCollection, isFavorite: isFavorite, isEvent: true)
             case .mutantVehicle(let mv):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.toggleFavorite(mv)
@@ -468,22 +395,18 @@ class DetailViewModel: ObservableObject {
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: art)
                 userNotes = notes
-                syncNotesToYapDB(uid: art.uid, yapCollection: BRCArtObject.yapCollection, notes: notes)
             case .camp(let camp):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: camp)
                 userNotes = notes
-                syncNotesToYapDB(uid: camp.uid, yapCollection: BRCCampObject.yapCollection, notes: notes)
             case .event(let event):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: event)
                 userNotes = notes
-                syncNotesToYapDB(uid: event.uid, yapCollection: BRCEventObject.yapCollection, notes: notes)
             case .eventOccurrence(let occ):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: occ.event)
                 userNotes = notes
-                syncNotesToYapDB(uid: occ.event.uid, yapCollection: BRCEventObject.yapCollection, notes: notes)
             case .mutantVehicle(let mv):
                 guard let playaDB else { throw DetailError.invalidData }
                 try await playaDB.setUserNotes(notes.isEmpty ? nil : notes, for: mv)
@@ -511,33 +434,6 @@ class DetailViewModel: ObservableObject {
         }
     }
 
-    // MARK: - YapDB Sync (backward compat during migration)
-
-    private func syncFavoriteToYapDB(uid: String, yapCollection: String, isFavorite: Bool, isEvent: Bool = false) {
-        Task.detached {
-            BRCDatabaseManager.shared.readWriteConnection.asyncReadWrite { transaction in
-                guard let object = transaction.object(forKey: uid, inCollection: yapCollection) as? BRCDataObject else { return }
-                let metadata = object.metadata(with: transaction).metadataCopy()
-                metadata.isFavorite = isFavorite
-                object.replace(metadata, transaction: transaction)
-                if isEvent, let event = object as? BRCEventObject {
-                    event.refreshCalendarEntry(transaction)
-                }
-            }
-        }
-    }
-
-    private func syncNotesToYapDB(uid: String, yapCollection: String, notes: String) {
-        Task.detached {
-            BRCDatabaseManager.shared.readWriteConnection.asyncReadWrite { transaction in
-                guard let object = transaction.object(forKey: uid, inCollection: yapCollection) as? BRCDataObject else { return }
-                let metadata = object.metadata(with: transaction).metadataCopy()
-                metadata.userNotes = notes
-                object.replace(metadata, transaction: transaction)
-            }
-        }
-    }
-
     func handleCellTap(_ cell: DetailCell) {
         switch cell.type {
         case .email(let email, _):
@@ -1701,39 +1597,9 @@ class DetailViewModel: ObservableObject {
 
     /// Preload images off the main thread before cell generation
     private func preloadImages() async {
-        var urls: [URL] = []
-
-        switch subject {
-        case .legacy(let obj):
-            if let artObj = obj as? BRCArtObject, let url = artObj.localThumbnailURL {
-                urls.append(url)
-            } else if let campObj = obj as? BRCCampObject, let url = campObj.localThumbnailURL {
-                urls.append(url)
-            } else if let eventObj = obj as? BRCEventObject {
-                if let campId = eventObj.hostedByCampUniqueID,
-                   let camp = dataService?.getCamp(withId: campId),
-                   let url = camp.localThumbnailURL {
-                    urls.append(url)
-                }
-                if let artId = eventObj.hostedByArtUniqueID,
-                   let art = dataService?.getArt(withId: artId),
-                   let url = art.localThumbnailURL {
-                    urls.append(url)
-                }
-            }
-        case .art(let art):
-            if let url = localThumbnailURL(objectID: art.uid) { urls.append(url) }
-        case .camp(let camp):
-            if let url = localThumbnailURL(objectID: camp.uid) { urls.append(url) }
-        case .event(let event):
-            if let hostUID = event.hostedByCamp ?? event.locatedAtArt,
-               let url = localThumbnailURL(objectID: hostUID) { urls.append(url) }
-        case .eventOccurrence(let occ):
-            if let hostUID = occ.hostedByCamp ?? occ.locatedAtArt,
-               let url = localThumbnailURL(objectID: hostUID) { urls.append(url) }
-        case .mutantVehicle(let mv):
-            if let url = localThumbnailURL(objectID: mv.uid) { urls.append(url) }
-        }
+        // Already decoded by DetailPrefetcher
+        guard preloadedImages.isEmpty else { return }
+        let urls = subject.headerImageURLs(mediaProvider: mediaProvider, dataService: dataService)
 
         let loaded = await Task.detached(priority: .userInitiated) {
             var result: [String: UIImage] = [:]
@@ -1796,7 +1662,7 @@ class DetailViewModel: ObservableObject {
 
     private func distanceToLocation(_ location: CLLocation?) -> CLLocationDistance? {
         guard let location, let current = locationService.getCurrentLocation() else { return nil }
-        return current.distance(from: location)
+        return DistanceEngine.distance(from: current, to: location)
     }
 
     /// Best available CLLocation for an event occurrence — prefers event's own GPS, falls back to host.
@@ -1909,13 +1775,7 @@ class DetailViewModel: ObservableObject {
         default: return
         }
 
-        // Check cache first — show immediately without loading spinner
-        if let cached = await EventSummaryCache.shared.get(hostUID) {
-            resolvedEventTips = cached.tips
-            resolvedEventOverview = cached.summary
-            self.cells = generateCells()
-            return
-        }
+        let summaryCache = playaDB.map(EventSummaryCache.init(playaDB:))
 
         // Step 1: Compute tips instantly from real data (pure Swift)
         #if canImport(FoundationModels)
@@ -1923,6 +1783,13 @@ class DetailViewModel: ObservableObject {
             resolvedEventTips = buildScheduleTips(from: resolvedHostEvents)
         }
         #endif
+
+        // Check cache first — show immediately without loading spinner
+        if let cached = await summaryCache?.overview(for: hostUID) {
+            resolvedEventOverview = cached
+            self.cells = generateCells()
+            return
+        }
         self.cells = generateCells()  // Show tips immediately
 
         // Step 2: Generate LLM overview asynchronously
@@ -1934,7 +1801,8 @@ class DetailViewModel: ObservableObject {
                 events: resolvedHostEvents,
                 hostName: hostName,
                 hostUID: hostUID,
-                hostDescription: resolvedHostDescription
+                hostDescription: resolvedHostDescription,
+                cache: summaryCache
             )
 
             isGeneratingEventOverview = false
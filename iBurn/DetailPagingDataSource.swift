@@ -20,14 +20,19 @@ struct DetailPageItem {
 /// the user taps a list row. The snapshot approach avoids the crashes
 /// that the legacy `PageViewManager` encountered when filters changed
 /// while the user was mid-swipe.
+///
+/// Neighbouring pages are warmed by a `DetailPrefetcher` so swiping
+/// doesn't wait on detail queries or image decoding.
 @MainActor
 final class DetailPagingDataSource: NSObject, UIPageViewControllerDataSource, UIPageViewControllerDelegate {
     private let items: [DetailPageItem]
     private let playaDB: PlayaDB
+    private let prefetcher: DetailPrefetcher
 
     init(items: [DetailPageItem], playaDB: PlayaDB) {
         self.items = items
         self.playaDB = playaDB
+        self.prefetcher = DetailPrefetcher(playaDB: playaDB)
         super.init()
     }
 
@@ -46,6 +51,7 @@ final class DetailPagingDataSource: NSObject, UIPageViewControllerDataSource, UI
         )
 
         let detailVC = makeDetailController(at: initialIndex)
+        prefetchAround(initialIndex)
         pageVC.dataSource = self
         pageVC.delegate = self
         pageVC.setViewControllers([detailVC], direction: .forward, animated: false, completion: nil)
@@ -80,6 +86,9 @@ final class DetailPagingDataSource: NSObject, UIPageViewControllerDataSource, UI
     ) {
         guard completed, let current = pageViewController.viewControllers?.first else { return }
         pageViewController.copyParameters(from: current)
+        if let index = currentIndex(of: current) {
+            prefetchAround(index)
+        }
     }
 
     // MARK: - Private
@@ -90,12 +99,18 @@ final class DetailPagingDataSource: NSObject, UIPageViewControllerDataSource, UI
             with: item.subject,
             playaDB: playaDB,
             preloadedMetadata: item.metadata,
-            preloadedColors: item.thumbnailColors
+            preloadedColors: item.thumbnailColors,
+            prefetched: prefetcher.prefetched(for: item.subject)
         )
         controller.indexPath = IndexPath(row: index, section: 0)
         return controller
     }
 
+    private func prefetchAround(_ index: Int) {
+        // The current page loads itself; warm its neighbours
+        prefetcher.prefetch(prefetcher.window(around: index, in: items).dropFirst().map(\.subject))
+    }
+
     private func currentIndex(of viewController: UIViewController) -> Int? {
         (viewController as? DetailHostingController)?.indexPath?.row
     }
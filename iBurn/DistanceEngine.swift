@@ -0,0 +1,127 @@
+//
+//  DistanceEngine.swift
+//  iBurn
+//
+//  Street-grid distance sorting and cached walk/bike time strings for lists.
+//
+
+import CoreLocation
+import Foundation
+
+/// Shared distance work for sorted and distance-labelled lists.
+///
+/// Every list, cell and label measures along the street grid (see `PlayaRouter`), so sort
+/// order and labels agree on every screen. They all ask from the same location update, so
+/// the route tree for recent origins is cached and each destination is a lookup in it. Row
+/// labels come from `attributedString(forDistance:)`, which formats each display bucket
+/// once and reuses it across rows and renders.
+enum DistanceEngine {
+    /// Distances are bucketed to this many meters before formatting. Well under the ~43 m a
+    /// minute of walking covers, so labels match unbucketed formatting to the minute.
+    static let displayQuantum: CLLocationDistance = 10
+
+    /// Street-grid distance, `CLLocationDistanceMax` for a missing destination
+    static func distance(from origin: CLLocation, to destination: CLLocation?) -> CLLocationDistance {
+        routes(from: origin).distance(to: destination)
+    }
+
+    /// `items` nearest first along the street grid from `origin`; items without a location
+    /// go last, in their original order
+    static func sorted<T>(_ items: [T], byDistanceFrom origin: CLLocation, location: (T) -> CLLocation?) -> [T] {
+        let routes = routes(from: origin)
+        let keys = items.map { routes.distance(to: location($0)) }
+        return keys.indices
+            .sorted { keys[$0] < keys[$1] || (keys[$0] == keys[$1] && $0 < $1) }
+            .map { items[$0] }
+    }
+
+    /// Shortest distances from `origin` over the whole grid, cached per origin
+    static func routes(from origin: CLLocation) -> PlayaRouteTree {
+        routeCache.routes(from: origin.coordinate)
+    }
+
+    /// Walk/bike estimate for `distance` (see `TTTLocationFormatter.brc_humanizedString`),
+    /// formatted once per display bucket
+    static func attributedString(forDistance distance: CLLocationDistance) -> AttributedString? {
+        formatCache.entry(forDistance: distance).attributed
+    }
+
+    /// UIKit form of `attributedString(forDistance:)`
+    static func nsAttributedString(forDistance distance: CLLocationDistance) -> NSAttributedString? {
+        formatCache.entry(forDistance: distance).ns
+    }
+
+    private static let formatCache = DistanceFormatCache()
+    private static let routeCache = RouteTreeCache()
+}
+
+// MARK: - Route Cache
+
+/// Route trees for the most recent origins: the real location, and a time-shifted one
+private final class RouteTreeCache: @unchecked Sendable {
+    private let limit = 4
+    private let lock = NSLock()
+    /// Most recent last; isolate access with `lock`
+    private var entries: [(origin: CLLocationCoordinate2D, routes: PlayaRouteTree)] = []
+
+    func routes(from origin: CLLocationCoordinate2D) -> PlayaRouteTree {
+        lock.lock()
+        if let index = entries.firstIndex(where: { $0.origin.latitude == origin.latitude && $0.origin.longitude == origin.longitude }) {
+            let entry = entries.remove(at: index)
+            entries.append(entry)
+            lock.unlock()
+            return entry.routes
+        }
+        lock.unlock()
+
+        let routes = PlayaRouter.shared.routes(from: origin)
+
+        lock.lock()
+        defer { lock.unlock() }
+        if entries.count >= limit {
+            entries.removeFirst()
+        }
+        entries.append((origin, routes))
+        return routes
+    }
+}
+
+// MARK: - Format Cache
+
+/// Formatted walk/bike strings keyed by distance bucket
+private final class DistanceFormatCache: @unchecked Sendable {
+    struct Entry {
+        let ns: NSAttributedString?
+        let attributed: AttributedString?
+    }
+
+    /// Buckets kept before the cache is emptied; about 20 km at 10 m buckets
+    private let limit = 2048
+    private let lock = NSLock()
+    /// isolate access with `lock`
+    private var entries: [Int: Entry] = [:]
+
+    func entry(forDistance distance: CLLocationDistance) -> Entry {
+        guard distance.isFinite, distance >= 0, distance < CLLocationDistanceMax else {
+            return Entry(ns: nil, attributed: nil)
+        }
+        let bucket = Int((distance / DistanceEngine.displayQuantum).rounded())
+        lock.lock()
+        if let entry = entries[bucket] {
+            lock.unlock()
+            return entry
+        }
+        lock.unlock()
+
+        let ns = TTTLocationFormatter.brc_humanizedString(forDistance: Double(bucket) * DistanceEngine.displayQuantum)
+        let entry = Entry(ns: ns, attributed: ns.map { AttributedString($0) })
+
+        lock.lock()
+        defer { lock.unlock() }
+        if entries.count >= limit {
+            entries.removeAll(keepingCapacity: true)
+        }
+        entries[bucket] = entry
+        return entry
+    }
+}
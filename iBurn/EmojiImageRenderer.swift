@@ -98,191 +98,173 @@ final class EmojiImageRenderer {
         }
         
         let renderer = UIGraphicsImageRenderer(size: configuration.size)
-        let image = renderer.image { context in
-            let rect = CGRect(origin: .zero, size: configuration.size)
+        let image = renderer.image { _ in
+            Self.drawEmoji(emoji, configuration: configuration)
+        }
+        
+        cache.setObject(image, forKey: cacheKey)
+        return image
+    }
+    
+    /// Draws an emoji marker into the current graphics context with its origin at (0, 0).
+    /// Shared by `renderEmoji` and `EmojiMarkerAtlas`, which draws many markers into one canvas.
+    static func drawEmoji(_ emoji: String, configuration: Configuration) {
+        let rect = CGRect(origin: .zero, size: configuration.size)
+        
+        // Draw background
+        if let backgroundColor = configuration.backgroundColor {
+            let path = UIBezierPath(roundedRect: rect.insetBy(dx: configuration.borderWidth / 2, dy: configuration.borderWidth / 2),
+                                   cornerRadius: configuration.cornerRadius)
+            backgroundColor.setFill()
+            path.fill()
+        }
+        
+        // Draw border
+        if let borderColor = configuration.borderColor, configuration.borderWidth > 0 {
+            let borderPath = UIBezierPath(roundedRect: rect.insetBy(dx: configuration.borderWidth / 2, dy: configuration.borderWidth / 2),
+                                         cornerRadius: configuration.cornerRadius)
+            borderPath.lineWidth = configuration.borderWidth
+            borderColor.setStroke()
+            borderPath.stroke()
+        }
+        
+        // Draw emoji
+        let fontSize = min(configuration.size.width, configuration.size.height) * 0.7
+        let font = UIFont.systemFont(ofSize: fontSize)
+        let attributes: [NSAttributedString.Key: Any] = [
+            .font: font
+        ]
+        
+        let attributedString = NSAttributedString(string: emoji, attributes: attributes)
+        let textSize = attributedString.size()
+        let textRect = CGRect(
+            x: (configuration.size.width - textSize.width) / 2,
+            y: (configuration.size.height - textSize.height) / 2,
+            width: textSize.width,
+            height: textSize.height
+        )
+        
+        attributedString.draw(in: textRect)
+        
+        // Draw status dot if present
+        if let statusDotColor = configuration.statusDotColor {
+            let dotRadius = configuration.statusDotSize / 2
+            let dotOffset: CGFloat = 2
+            let dotCenter = CGPoint(x: dotOffset + dotRadius, y: dotOffset + dotRadius)
             
-            // Draw background
-            if let backgroundColor = configuration.backgroundColor {
-                let path = UIBezierPath(roundedRect: rect.insetBy(dx: configuration.borderWidth / 2, dy: configuration.borderWidth / 2),
-                                       cornerRadius: configuration.cornerRadius)
-                backgroundColor.setFill()
-                path.fill()
-            }
+            // Draw white background for the dot for better visibility
+            let whiteDotPath = UIBezierPath(arcCenter: dotCenter, 
+                                           radius: dotRadius + 1, 
+                                           startAngle: 0, 
+                                           endAngle: .pi * 2, 
+                                           clockwise: true)
+            UIColor.white.setFill()
+            whiteDotPath.fill()
             
-            // Draw border
-            if let borderColor = configuration.borderColor, configuration.borderWidth > 0 {
-                let borderPath = UIBezierPath(roundedRect: rect.insetBy(dx: configuration.borderWidth / 2, dy: configuration.borderWidth / 2),
-                                             cornerRadius: configuration.cornerRadius)
-                borderPath.lineWidth = configuration.borderWidth
-                borderColor.setStroke()
-                borderPath.stroke()
-            }
+            // Draw the colored dot
+            let dotPath = UIBezierPath(arcCenter: dotCenter, 
+                                      radius: dotRadius, 
+                                      startAngle: 0, 
+                                      endAngle: .pi * 2, 
+                                      clockwise: true)
+            statusDotColor.setFill()
+            dotPath.fill()
+        }
+        
+        // Draw heart emoji if favorite
+        if configuration.isFavorite {
+            let heartEmoji = "❤️"
+            let heartOffset: CGFloat = 1
             
-            // Draw emoji
-            let fontSize = min(configuration.size.width, configuration.size.height) * 0.7
+            // Position heart in bottom-right corner
+            let heartSize = configuration.heartSize
+            let heartRect = CGRect(
+                x: configuration.size.width - heartSize - heartOffset,
+                y: configuration.size.height - heartSize - heartOffset,
+                width: heartSize,
+                height: heartSize
+            )
+            
+            // Create attributes with white stroke for visibility
+            let paragraphStyle = NSMutableParagraphStyle()
+            paragraphStyle.alignment = .center
+            
+            let fontSize = heartSize * 0.85
             let font = UIFont.systemFont(ofSize: fontSize)
             let attributes: [NSAttributedString.Key: Any] = [
-                .font: font
+                .font: font,
+                .strokeColor: UIColor.white,
+                .strokeWidth: -4.0,  // Negative for stroke + fill
+                .foregroundColor: UIColor.systemPink,
+                .paragraphStyle: paragraphStyle
             ]
             
-            let attributedString = NSAttributedString(string: emoji, attributes: attributes)
+            // Draw the emoji heart
+            let attributedString = NSAttributedString(string: heartEmoji, attributes: attributes)
             let textSize = attributedString.size()
-            let textRect = CGRect(
-                x: (configuration.size.width - textSize.width) / 2,
-                y: (configuration.size.height - textSize.height) / 2,
+            let centeredRect = CGRect(
+                x: heartRect.origin.x + (heartRect.width - textSize.width) / 2,
+                y: heartRect.origin.y + (heartRect.height - textSize.height) / 2,
                 width: textSize.width,
                 height: textSize.height
             )
+            attributedString.draw(in: centeredRect)
+        }
+        
+        // Draw visit status emoji if visited or want to visit
+        if configuration.visitStatus != 0 {
+            let visitEmoji: String
+            let emojiColor: UIColor
             
-            attributedString.draw(in: textRect)
-            
-            // Draw status dot if present
-            if let statusDotColor = configuration.statusDotColor {
-                let dotRadius = configuration.statusDotSize / 2
-                let dotOffset: CGFloat = 2
-                let dotCenter = CGPoint(x: dotOffset + dotRadius, y: dotOffset + dotRadius)
-                
-                // Draw white background for the dot for better visibility
-                let whiteDotPath = UIBezierPath(arcCenter: dotCenter, 
-                                               radius: dotRadius + 1, 
-                                               startAngle: 0, 
-                                               endAngle: .pi * 2, 
-                                               clockwise: true)
-                UIColor.white.setFill()
-                whiteDotPath.fill()
-                
-                // Draw the colored dot
-                let dotPath = UIBezierPath(arcCenter: dotCenter, 
-                                          radius: dotRadius, 
-                                          startAngle: 0, 
-                                          endAngle: .pi * 2, 
-                                          clockwise: true)
-                statusDotColor.setFill()
-                dotPath.fill()
+            switch configuration.visitStatus {
+            case 1: // visited
+                visitEmoji = "✅"
+                emojiColor = UIColor.systemGreen
+            case 2: // wantToVisit
+                visitEmoji = "⭐"
+                emojiColor = UIColor.systemYellow
+            default:
+                visitEmoji = ""
+                emojiColor = UIColor.clear
             }
             
-            // Draw heart emoji if favorite
-            if configuration.isFavorite {
-                let heartEmoji = "❤️"
-                let heartOffset: CGFloat = 1
+            if !visitEmoji.isEmpty {
+                let visitOffset: CGFloat = 1
                 
-                // Position heart in bottom-right corner
-                let heartSize = configuration.heartSize
-                let heartRect = CGRect(
-                    x: configuration.size.width - heartSize - heartOffset,
-                    y: configuration.size.height - heartSize - heartOffset,
-                    width: heartSize,
-                    height: heartSize
+                // Position visit emoji in top-right corner
+                let visitSize = configuration.visitEmojiSize
+                let visitRect = CGRect(
+                    x: configuration.size.width - visitSize - visitOffset,
+                    y: visitOffset,
+                    width: visitSize,
+                    height: visitSize
                 )
                 
                 // Create attributes with white stroke for visibility
                 let paragraphStyle = NSMutableParagraphStyle()
                 paragraphStyle.alignment = .center
                 
-                let fontSize = heartSize * 0.85
+                let fontSize = visitSize * 0.85
                 let font = UIFont.systemFont(ofSize: fontSize)
                 let attributes: [NSAttributedString.Key: Any] = [
                     .font: font,
                     .strokeColor: UIColor.white,
                     .strokeWidth: -4.0,  // Negative for stroke + fill
-                    .foregroundColor: UIColor.systemPink,
+                    .foregroundColor: emojiColor,
                     .paragraphStyle: paragraphStyle
                 ]
                 
-                // Draw the emoji heart
-                let attributedString = NSAttributedString(string: heartEmoji, attributes: attributes)
+                // Draw the visit emoji
+                let attributedString = NSAttributedString(string: visitEmoji, attributes: attributes)
                 let textSize = attributedString.size()
                 let centeredRect = CGRect(
-                    x: heartRect.origin.x + (heartRect.width - textSize.width) / 2,
-                    y: heartRect.origin.y + (heartRect.height - textSize.height) / 2,
+                    x: visitRect.origin.x + (visitRect.width - textSize.width) / 2,
+                    y: visitRect.origin.y + (visitRect.height - textSize.height) / 2,
                     width: textSize.width,
                     height: textSize.height
                 )
                 attributedString.draw(in: centeredRect)
             }
-            
-            // Draw visit status emoji if visited or want to visit
-            if configuration.visitStatus != 0 {
-                let visitEmoji: String
-                let emojiColor: UIColor
-                
-                switch configuration.visitStatus {
-                case 1: // visited
-                    visitEmoji = "✅"
-                    emojiColor = UIColor.systemGreen
-                case 2: // wantToVisit
-                    visitEmoji = "⭐"
-                    emojiColor = UIColor.systemYellow
-                default:
-                    visitEmoji = ""
-                    emojiColor = UIColor.clear
-                }
-                
-                if !visitEmoji.isEmpty {
-                    let visitOffset: CGFloat = 1
-                    
-                    // Position visit emoji in top-right corner
-                    let visitSize = configuration.visitEmojiSize
-                    let visitRect = CGRect(
-                        x: configuration.size.width - visitSize - visitOffset,
-                        y: visitOffset,
-                        width: visitSize,
-                        height: visitSize
-                    )
-                    
-                    // Create attributes with white stroke for visibility
-                    let paragraphStyle = NSMutableParagraphStyle()
-                    paragraphStyle.alignment = .center
-                    
-                    let fontSize = visitSize * 0.85
-                    let font = UIFont.systemFont(ofSize: fontSize)
-                    let attributes: [NSAttributedString.Key: Any] = [
-                        .font: font,
-                        .strokeColor: UIColor.white,
-                        .strokeWidth: -4.0,  // Negative for stroke + fill
-                        .foregroundColor: emojiColor,
-                        .paragraphStyle: paragraphStyle
-                    ]
-                    
-                    // Draw the visit emoji
-                    let attributedString = NSAttributedString(string: visitEmoji, attributes: attributes)
-                    let textSize = attributedString.size()
-                    let centeredRect = CGRect(
-                        x: visitRect.origin.x + (visitRect.width - textSize.width) / 2,
-                        y: visitRect.origin.y + (visitRect.height - textSize.height) / 2,
-                        width: textSize.width,
-                        height: textSize.height
-                    )
-                    attributedString.draw(in: centeredRect)
-                }
-            }
-        }
-        
-        cache.setObject(image, forKey: cacheKey)
-        return image
-    }
-    
-    /// Pre-render commonly used emojis for better performance
-    func preloadCommonEmojis() {
-        let commonEmojis = [
-            "🎨", "⛺", "🎉", "🧑‍🏫", "💃", "🏥", "🔮", "🎯", 
-            "🔥", "🔞", "👨‍👩‍👧‍👦", "🎏", "🍔", "🎺", "💗", "🔨", 
-            "♻️", "🧘", "🤷"
-        ]
-        
-        for emoji in commonEmojis {
-            _ = renderEmoji(emoji, configuration: .mapPin)
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(color: .systemGreen))
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(color: .systemOrange))
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(color: .systemRed))
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(isFavorite: true))
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(color: .systemGreen, isFavorite: true))
-            
-            // Preload visit status combinations
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(visitStatus: 1)) // visited
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(visitStatus: 2)) // want to visit
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(isFavorite: true, visitStatus: 1))
-            _ = renderEmoji(emoji, configuration: .mapPinWithStatus(isFavorite: true, visitStatus: 2))
         }
     }
     
@@ -0,0 +1,184 @@
+import UIKit
+import MapLibre
+import CocoaLumberjack
+
+/// Pre-rendered sprite sheet holding every emoji map marker variant.
+///
+/// The set of markers is small and closed: one emoji per object type or event type, combined
+/// with an event status dot, a favorite heart and a visit badge. `build()` draws all of them
+/// into a single canvas once, so scrolling the map never hits Core Text. Individual sprites are
+/// `CGImage` crops of the sheet and share its backing store.
+///
+/// The sheet is rendered at no more than 2x. At 3x the full sheet costs ~23 MB versus ~10 MB,
+/// and the markers are only 36pt.
+final class EmojiMarkerAtlas {
+
+    enum Status: Int, CaseIterable {
+        case none
+        case happening
+        case endingSoon
+        case ended
+
+        var color: UIColor? {
+            switch self {
+            case .none: return nil
+            case .happening: return .systemGreen
+            case .endingSoon: return .systemOrange
+            case .ended: return .systemRed
+            }
+        }
+    }
+
+    struct Variant: Hashable {
+        let emoji: String
+        let status: Status
+        let isFavorite: Bool
+        /// Matches `BRCObjectMetadata.visitStatus`: 0 none, 1 visited, 2 want to visit
+        let visitStatus: Int
+
+        var configuration: EmojiImageRenderer.Configuration {
+            .mapPinWithStatus(color: status.color, isFavorite: isFavorite, visitStatus: visitStatus)
+        }
+
+        /// Name under which the sprite is registered with an `MLNStyle`, for use as `iconImageName`
+        /// in a symbol layer.
+        var styleImageName: String {
+            let scalars = emoji.unicodeScalars.map { String($0.value, radix: 16) }.joined(separator: "-")
+            return "emoji-marker-\(scalars)-s\(status.rawValue)-f\(isFavorite ? 1 : 0)-v\(visitStatus)"
+        }
+    }
+
+    static let shared = EmojiMarkerAtlas()
+
+    /// Emojis for non-event objects. These never carry a status dot.
+    static let placeEmojis: [String] = ["🎨", "⛺", "🚐", "📍"]
+
+    static var eventEmojis: [String] {
+        var seen = Set<String>()
+        return BRCEventType.allCases.map(\.emoji).filter { seen.insert($0).inserted }
+    }
+
+    static var allVariants: [Variant] {
+        let visitStatuses = [0, 1, 2]
+        var variants: [Variant] = []
+        for emoji in placeEmojis {
+            for isFavorite in [false, true] {
+                for visitStatus in visitStatuses {
+                    variants.append(Variant(emoji: emoji, status: .none, isFavorite: isFavorite, visitStatus: visitStatus))
+                }
+            }
+        }
+        for emoji in eventEmojis {
+            for status in Status.allCases {
+                for isFavorite in [false, true] {
+                    for visitStatus in visitStatuses {
+                        variants.append(Variant(emoji: emoji, status: status, isFavorite: isFavorite, visitStatus: visitStatus))
+                    }
+                }
+            }
+        }
+        return variants
+    }
+
+    private let queue = DispatchQueue(label: "com.burningman.iburn.emojimarkeratlas", attributes: .concurrent)
+    /// isolate access on `queue`
+    private var sheet: UIImage?
+    /// isolate access on `queue`
+    private var sprites: [Variant: UIImage] = [:]
+    /// Styles that asked to register before the sheet was built. isolate access on `queue`
+    private let pendingStyles = NSHashTable<MLNStyle>.weakObjects()
+
+    private let cellSize = EmojiImageRenderer.Configuration.mapPinWithStatus().size
+    private let maxScale: CGFloat = 2
+
+    var isBuilt: Bool {
+        queue.sync { sheet != nil }
+    }
+
+    /// Pre-rendered sprite for `variant`, or nil if the atlas hasn't been built yet or the
+    /// emoji isn't part of it. Callers fall back to `EmojiImageRenderer`.
+    func image(for variant: Variant) -> UIImage? {
+        queue.sync { sprites[variant] }
+    }
+
+    /// Renders the sheet. Safe to call from any queue; call from a background queue at launch.
+    func build() {
+        guard !isBuilt else { return }
+        let start = Date()
+        let variants = Self.allVariants
+        let columns = Int(ceil(Double(variants.count).squareRoot()))
+        let rows = (variants.count + columns - 1) / columns
+
+        var frames: [Variant: CGRect] = [:]
+        frames.reserveCapacity(variants.count)
+        for (index, variant) in variants.enumerated() {
+            let origin = CGPoint(
+                x: CGFloat(index % columns) * cellSize.width,
+                y: CGFloat(index / columns) * cellSize.height
+            )
+            frames[variant] = CGRect(origin: origin, size: cellSize)
+        }
+
+        let format = UIGraphicsImageRendererFormat.preferred()
+        let scale = min(format.scale, maxScale)
+        format.scale = scale
+        format.opaque = false
+        let canvasSize = CGSize(width: CGFloat(columns) * cellSize.width, height: CGFloat(rows) * cellSize.height)
+        let renderer = UIGraphicsImageRenderer(size: canvasSize, format: format)
+        let sheet = renderer.image { context in
+            for (variant, frame) in frames {
+                context.cgContext.saveGState()
+                context.cgContext.translateBy(x: frame.minX, y: frame.minY)
+                EmojiImageRenderer.drawEmoji(variant.emoji, configuration: variant.configuration)
+                context.cgContext.restoreGState()
+            }
+        }
+
+        guard let cgSheet = sheet.cgImage else {
+            DDLogError("EmojiMarkerAtlas: failed to render sprite sheet")
+            return
+        }
+        var sprites: [Variant: UIImage] = [:]
+        sprites.reserveCapacity(frames.count)
+        for (variant, frame) in frames {
+            let pixelRect = CGRect(
+                x: frame.minX * scale,
+                y: frame.minY * scale,
+                width: frame.width * scale,
+                height: frame.height * scale
+            )
+            guard let cgSprite = cgSheet.cropping(to: pixelRect) else { continue }
+            sprites[variant] = UIImage(cgImage: cgSprite, scale: scale, orientation: .up)
+        }
+
+        let pending: [MLNStyle] = queue.sync(flags: .barrier) {
+            self.sheet = sheet
+            self.sprites = sprites
+            defer { pendingStyles.removeAllObjects() }
+            return pendingStyles.allObjects
+        }
+        if !pending.isEmpty {
+            DispatchQueue.main.async {
+                pending.forEach(self.register(in:))
+            }
+        }
+        DDLogInfo("EmojiMarkerAtlas: rendered \(sprites.count) markers in \(String(format: "%.0f", Date().timeIntervalSince(start) * 1000))ms")
+    }
+
+    /// Registers every sprite with the map style so symbol layers can reference them by
+    /// `Variant.styleImageName`. If the atlas isn't built yet, the style is registered on the
+    /// main queue once `build()` finishes. Call from the main queue.
+    func register(in style: MLNStyle) {
+        let sprites: [Variant: UIImage]? = queue.sync(flags: .barrier) {
+            guard sheet != nil else {
+                pendingStyles.add(style)
+                return nil
+            }
+            return self.sprites
+        }
+        guard let sprites else { return }
+        for (variant, image) in sprites {
+            style.setImage(image, forName: variant.styleImageName)
+        }
+    }
+}
@@ -0,0 +1,135 @@
+//
+//  FavoriteEventCalendar.swift
+//  iBurn
+//
+//  Calendar entries with reminders for favorited events.
+//
+
+import EventKit
+import Foundation
+import PlayaDB
+
+/// Keeps a calendar entry, with alarms 90 and 10 minutes ahead, for every upcoming favorited
+/// event occurrence, and removes it when the occurrence is unfavorited.
+///
+/// Follows PlayaDB favorites, so favoriting from any screen schedules the reminder; this is
+/// what `-[BRCEventObject refreshCalendarEntry:]` did for YapDatabase favorites. Entry
+/// identifiers are kept in `UserSettings.favoriteCalendarEventIdentifiers` by occurrence uid.
+@MainActor
+final class FavoriteEventCalendar {
+    private let eventProvider: EventDataProvider
+    private let store = EKEventStore()
+    private var observationTask: Task<Void, Never>?
+    /// Favorites at the last update; nil until the first one
+    private var favorites: [EventObjectOccurrence]?
+
+    init(eventProvider: EventDataProvider) {
+        self.eventProvider = eventProvider
+    }
+
+    deinit {
+        observationTask?.cancel()
+    }
+
+    func start() {
+        observationTask?.cancel()
+        observationTask = Task { [weak self] in
+            guard let self else { return }
+            for await rows in self.eventProvider.observeObjects(filter: EventFilter(onlyFavorites: true)) {
+                await MainActor.run {
+                    self.update(favorites: rows.map(\.object))
+                }
+            }
+        }
+    }
+
+    // MARK: - Private
+
+    private func update(favorites: [EventObjectOccurrence]) {
+        let uids = Set(favorites.map(\.uid))
+        let added = self.favorites.map { !uids.subtracting($0.map(\.uid)).isEmpty } ?? false
+        self.favorites = favorites
+
+        let status = EKEventStore.authorizationStatus(for: .event)
+        switch status {
+        case .notDetermined:
+            // Ask when the user favorites something, not on launch; then add what's favorited
+            if added {
+                BRCPermissions.promptForEvents { [weak self] in
+                    guard let self, let favorites = self.favorites,
+                          EKEventStore.authorizationStatus(for: .event) != .notDetermined else { return }
+                    self.store.reset()
+                    self.update(favorites: favorites)
+                }
+            }
+            return
+        case .denied, .restricted:
+            return
+        default:
+            break
+        }
+        // Write-only access can add entries but not look them up, so stored identifiers are
+        // trusted as they are and unfavorited entries can't be removed
+        var canRead = true
+        if #available(iOS 17, *), status == .writeOnly {
+            canRead = false
+        }
+
+        var identifiers = UserSettings.favoriteCalendarEventIdentifiers
+        for (uid, identifier) in identifiers where !uids.contains(uid) {
+            if canRead, let entry = store.event(withIdentifier: identifier) {
+                do {
+                    try store.remove(entry, span: .thisEvent)
+                } catch {
+                    print("Couldn't remove calendar entry for \(uid): \(error)")
+                }
+            }
+            identifiers[uid] = nil
+        }
+        let now = Date.present
+        for occurrence in favorites where occurrence.endDate > now {
+            if let identifier = identifiers[occurrence.uid], !canRead || store.event(withIdentifier: identifier) != nil {
+                continue
+            }
+            // Entries added by the legacy YapDatabase path aren't in `identifiers`
+            if canRead, let existing = existingEntry(for: occurrence) {
+                identifiers[occurrence.uid] = existing.eventIdentifier
+                continue
+            }
+            let entry = calendarEntry(for: occurrence)
+            do {
+                try store.save(entry, span: .thisEvent)
+                identifiers[occurrence.uid] = entry.eventIdentifier
+            } catch {
+                print("Couldn't save calendar entry for \(occurrence.uid): \(error)")
+            }
+        }
+        UserSettings.favoriteCalendarEventIdentifiers = identifiers
+    }
+
+    private func existingEntry(for occurrence: EventObjectOccurrence) -> EKEvent? {
+        let predicate = store.predicateForEvents(withStart: occurrence.startDate, end: occurrence.endDate, calendars: nil)
+        return store.events(matching: predicate).first {
+            $0.title == occurrence.name && $0.startDate == occurrence.startDate
+        }
+    }
+
+    private func calendarEntry(for occurrence: EventObjectOccurrence) -> EKEvent {
+        let entry = EKEvent(eventStore: store)
+        entry.calendar = store.defaultCalendarForNewEvents
+        entry.title = occurrence.name
+        entry.location = [occurrence.hostAddress, occurrence.hostName]
+            .compactMap { $0?.isEmpty == false ? $0 : nil }
+            .joined(separator: " - ")
+        entry.timeZone = TimeZone.burningManTimeZone
+        entry.startDate = occurrence.startDate
+        entry.endDate = occurrence.endDate
+        entry.isAllDay = occurrence.allDay
+        entry.url = occurrence.url
+        entry.notes = occurrence.description
+        // Remind 1.5 hrs and 10 min in advance
+        entry.addAlarm(EKAlarm(relativeOffset: -90 * 60))
+        entry.addAlarm(EKAlarm(relativeOffset: -10 * 60))
+        return entry
+    }
+}
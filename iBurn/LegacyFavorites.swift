@@ -0,0 +1,127 @@
+//
+//  LegacyFavorites.swift
+//  iBurn
+//
+//  PlayaDB favorite state for the YapDatabase-backed screens.
+//
+
+import Foundation
+import PlayaDB
+
+/// Favorites for the legacy YapDatabase screens (hosted events, audio tour, visit list,
+/// search), which list objects from YapDatabase views but draw stars and write favorites
+/// through PlayaDB, the only store the rest of the app reads.
+///
+/// Keeps the uids of favorited art, camps and events from PlayaDB observations, and posts
+/// `didChangeNotification` when they change so visible cells can redraw. Objects missing
+/// from PlayaDB fall back to YapDatabase metadata.
+@MainActor
+@objc(BRCLegacyFavorites) final class LegacyFavorites: NSObject {
+    static let didChangeNotification = Notification.Name("BRCLegacyFavoritesDidChange")
+
+    @objc static var shared: LegacyFavorites {
+        BRCAppDelegate.shared.dependencies.legacyFavorites
+    }
+
+    private let playaDB: PlayaDB
+    private var tasks: [Task<Void, Never>] = []
+    private var artUIDs: Set<String> = []
+    private var campUIDs: Set<String> = []
+    /// Event uids and occurrence uids, so either kind of favorite stars the legacy event
+    private var eventUIDs: Set<String> = []
+
+    init(
+        playaDB: PlayaDB,
+        artProvider: ArtDataProvider,
+        campProvider: CampDataProvider,
+        eventProvider: EventDataProvider
+    ) {
+        self.playaDB = playaDB
+        super.init()
+        tasks.append(Task { [weak self] in
+            for await rows in artProvider.observeObjects(filter: ArtFilter(onlyFavorites: true)) {
+                self?.update(\.artUIDs, Set(rows.map(\.object.uid)))
+            }
+        })
+        tasks.append(Task { [weak self] in
+            for await rows in campProvider.observeObjects(filter: CampFilter(onlyFavorites: true)) {
+                self?.update(\.campUIDs, Set(rows.map(\.object.uid)))
+            }
+        })
+        tasks.append(Task { [weak self] in
+            for await rows in eventProvider.observeObjects(filter: EventFilter(onlyFavorites: true)) {
+                self?.update(\.eventUIDs, Set(rows.flatMap { [$0.object.event.uid, $0.object.uid] }))
+            }
+        })
+    }
+
+    deinit {
+        tasks.forEach { $0.cancel() }
+    }
+
+    @objc func isFavorite(_ object: BRCDataObject) -> Bool {
+        let uid = object.uniqueID
+        switch object {
+        case is BRCArtObject: return artUIDs.contains(uid)
+        case is BRCCampObject: return campUIDs.contains(uid)
+        case is BRCEventObject: return eventUIDs.contains(uid)
+        default: return false
+        }
+    }
+
+    /// Writes the favorite to PlayaDB, or to YapDatabase metadata for objects PlayaDB
+    /// doesn't have
+    @objc func setFavorite(_ isFavorite: Bool, for object: BRCDataObject) {
+        Task {
+            do {
+                try await setFavorite(isFavorite, for: object)
+            } catch {
+                print("Favorite write failed for \(object.uniqueID): \(error)")
+            }
+        }
+    }
+
+    func setFavorite(_ isFavorite: Bool, for object: BRCDataObject) async throws {
+        if let playaObject = await Self.playaObject(for: object, playaDB: playaDB) {
+            try await playaDB.setFavorite(isFavorite, for: playaObject)
+            return
+        }
+        await withCheckedContinuation { continuation in
+            BRCDatabaseManager.shared.readWriteConnection.asyncReadWrite { transaction in
+                guard let metadata = object.metadata(with: transaction).copyAsSelf() else { return }
+                metadata.isFavorite = isFavorite
+                object.replace(metadata, transaction: transaction)
+                if let event = object as? BRCEventObject {
+                    event.refreshCalendarEntry(transaction)
+                }
+            } completionBlock: {
+                continuation.resume()
+            }
+        }
+    }
+
+    /// The PlayaDB record for a legacy object
+    nonisolated static func playaObject(for object: BRCDataObject, playaDB: PlayaDB) async -> (any DataObject)? {
+        let uid = object.uniqueID
+        do {
+            if object is BRCArtObject {
+                return try await playaDB.fetchArt(uid: uid)
+            } else if object is BRCCampObject {
+                return try await playaDB.fetchCamp(uid: uid)
+            } else if object is BRCEventObject {
+                return try await playaDB.fetchEvent(uid: uid)
+            }
+        } catch {
+            print("PlayaDB lookup failed for \(uid): \(error)")
+        }
+        return nil
+    }
+
+    // MARK: - Private
+
+    private func update(_ keyPath: ReferenceWritableKeyPath<LegacyFavorites, Set<String>>, _ uids: Set<String>) {
+        guard self[keyPath: keyPath] != uids else { return }
+        self[keyPath: keyPath] = uids
+        NotificationCenter.default.post(name: Self.didChangeNotification, object: self)
+    }
+}
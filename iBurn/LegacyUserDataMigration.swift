@@ -0,0 +1,74 @@
+//
+//  LegacyUserDataMigration.swift
+//  iBurn
+//
+//  One-time copy of favorites and notes from the YapDatabase store into PlayaDB.
+//
+
+import Foundation
+import PlayaDB
+import YapDatabase
+import CocoaLumberjack
+
+/// Favorites and notes made on the legacy screens were only written to YapDatabase. Copies
+/// them into PlayaDB once, so the PlayaDB lists show them without YapDatabase opening at launch.
+enum LegacyUserDataMigration {
+    private static let completedKey = "LegacyUserDataMigrated-\(kBRCDatabaseName)"
+
+    private struct Entry {
+        let uid: String
+        let collection: String
+        let isFavorite: Bool
+        let notes: String?
+    }
+
+    /// Run after PlayaDB is seeded; later launches return without touching YapDatabase
+    static func migrateIfNeeded(playaDB: PlayaDB) async {
+        guard !UserDefaults.standard.bool(forKey: completedKey) else { return }
+        // Fresh installs have no legacy store, and opening one would copy it from the bundle
+        guard BRCDatabaseManager.existsDatabase(withName: kBRCDatabaseName) else {
+            UserDefaults.standard.set(true, forKey: completedKey)
+            return
+        }
+
+        var entries: [Entry] = []
+        let collections = [BRCArtObject.yapCollection, BRCCampObject.yapCollection, BRCEventObject.yapCollection]
+        BRCDatabaseManager.shared.backgroundReadConnection.read { transaction in
+            for collection in collections {
+                transaction.iterateRows(inCollection: collection) { (key, _: BRCDataObject, metadata: BRCObjectMetadata?, _) in
+                    guard let metadata else { return }
+                    let notes = metadata.userNotes.flatMap { $0.isEmpty ? nil : $0 }
+                    guard metadata.isFavorite || notes != nil else { return }
+                    entries.append(Entry(uid: key, collection: collection, isFavorite: metadata.isFavorite, notes: notes))
+                }
+            }
+        }
+
+        var migrated = 0
+        for entry in entries {
+            do {
+                let object: (any DataObject)?
+                switch entry.collection {
+                case BRCArtObject.yapCollection: object = try await playaDB.fetchArt(uid: entry.uid)
+                case BRCCampObject.yapCollection: object = try await playaDB.fetchCamp(uid: entry.uid)
+                default: object = try await playaDB.fetchEvent(uid: entry.uid)
+                }
+                guard let object else { continue }
+                let existing = try await playaDB.metadata(for: object)
+                if entry.isFavorite, !existing.isFavorite {
+                    try await playaDB.setFavorite(true, for: object)
+                }
+                // Notes already edited on a PlayaDB screen are newer
+                if let notes = entry.notes, existing.userNotes?.isEmpty ?? true {
+                    try await playaDB.setUserNotes(notes, for: object)
+                }
+                migrated += 1
+            } catch {
+                DDLogError("Legacy user data migration failed for \(entry.uid): \(error)")
+                return
+            }
+        }
+        DDLogInfo("Migrated \(migrated) legacy favorites and notes to PlayaDB")
+        UserDefaults.standard.set(true, forKey: completedKey)
+    }
+}
@@ -47,6 +47,28 @@ class ArtDataProvider: ObjectListDataProvider {
         }
     }
 
+    func observeWindow(filter: ArtFilter, limit: Int) -> AsyncStream<ListWindow<ArtObject>> {
+        AsyncStream { continuation in
+            let token = playaDB.observeArt(filter: filter, window: ListWindowRequest(limit: limit)) { window in
+                continuation.yield(window)
+            } onError: { error in
+                print("Art observation error: \(error)")
+            }
+
+            continuation.onTermination = { @Sendable _ in
+                token.cancel()
+            }
+        }
+    }
+
+    func countObjects(filter: ArtFilter) async throws -> Int {
+        try await playaDB.countArt(filter: filter)
+    }
+
+    func fetchObjects(filter: ArtFilter) async throws -> [ArtObject] {
+        try await playaDB.fetchArt(filter: filter)
+    }
+
     func toggleFavorite(_ object: ArtObject) async throws {
         try await playaDB.toggleFavorite(object)
     }
@@ -56,13 +78,7 @@ class ArtDataProvider: ObjectListDataProvider {
               let objectLocation = object.location else {
             return nil
         }
-
-        let distance = location.distance(from: objectLocation)
-
-        // Use existing TTTLocationFormatter for consistent walk/bike estimates + coloring.
-        guard let nsAttributedString = TTTLocationFormatter.brc_humanizedString(forDistance: distance) else {
-            return nil
-        }
-        return AttributedString(nsAttributedString)
+        // Walk/bike estimates + coloring, formatted once per distance bucket
+        return DistanceEngine.attributedString(forDistance: DistanceEngine.distance(from: location, to: objectLocation))
     }
 }
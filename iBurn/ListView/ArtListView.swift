@@ -74,6 +74,13 @@ struct ArtListView: View {
                         onSelect(row.object)
                     }
                 }
+
+                if viewModel.hasMore {
+                    LoadMoreFooter(loadedCount: viewModel.items.count, totalCount: viewModel.totalCount) {
+                        viewModel.loadMore()
+                    }
+                    .listRowSeparator(.hidden)
+                }
             }
             .listStyle(.plain)
             .searchable(
@@ -155,7 +162,7 @@ struct ArtListView: View {
 
     /// Show the map view with current art items
     private func showMap() {
-        onShowMap(viewModel.filteredItems.map(\.object))
+        Task { onShowMap(await viewModel.allFilteredObjects()) }
     }
 
 }
@@ -226,15 +233,26 @@ private class PreviewArtDataProvider: ArtDataProvider {
 
     override func observeObjects(filter: ArtFilter) -> AsyncStream<[ListRow<ArtObject>]> {
         AsyncStream { continuation in
-            continuation.yield([
-                Self.createMockArt(name: "Temple of Transition"),
-                Self.createMockArt(name: "The Man"),
-                Self.createMockArt(name: "Galaxy Portal")
-            ].map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) })
+            continuation.yield(Self.mockRows())
+            continuation.finish()
+        }
+    }
+
+    override func observeWindow(filter: ArtFilter, limit: Int) -> AsyncStream<ListWindow<ArtObject>> {
+        AsyncStream { continuation in
+            continuation.yield(ListWindow(rows: Self.mockRows(), next: nil))
             continuation.finish()
         }
     }
 
+    private nonisolated static func mockRows() -> [ListRow<ArtObject>] {
+        [
+            createMockArt(name: "Temple of Transition"),
+            createMockArt(name: "The Man"),
+            createMockArt(name: "Galaxy Portal")
+        ].map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) }
+    }
+
     private nonisolated static func createMockArt(name: String) -> ArtObject {
         ArtObject(
             uid: UUID().uuidString,
@@ -47,6 +47,28 @@ class CampDataProvider: ObjectListDataProvider {
         }
     }
 
+    func observeWindow(filter: CampFilter, limit: Int) -> AsyncStream<ListWindow<CampObject>> {
+        AsyncStream { continuation in
+            let token = playaDB.observeCamps(filter: filter, window: ListWindowRequest(limit: limit)) { window in
+                continuation.yield(window)
+            } onError: { error in
+                print("Camp observation error: \(error)")
+            }
+
+            continuation.onTermination = { @Sendable _ in
+                token.cancel()
+            }
+        }
+    }
+
+    func countObjects(filter: CampFilter) async throws -> Int {
+        try await playaDB.countCamps(filter: filter)
+    }
+
+    func fetchObjects(filter: CampFilter) async throws -> [CampObject] {
+        try await playaDB.fetchCamps(filter: filter)
+    }
+
     func toggleFavorite(_ object: CampObject) async throws {
         try await playaDB.toggleFavorite(object)
     }
@@ -56,11 +78,6 @@ class CampDataProvider: ObjectListDataProvider {
               let objectLocation = object.location else {
             return nil
         }
-
-        let distance = location.distance(from: objectLocation)
-        guard let nsAttributedString = TTTLocationFormatter.brc_humanizedString(forDistance: distance) else {
-            return nil
-        }
-        return AttributedString(nsAttributedString)
+        return DistanceEngine.attributedString(forDistance: DistanceEngine.distance(from: location, to: objectLocation))
     }
 }
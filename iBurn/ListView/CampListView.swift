@@ -48,6 +48,13 @@ struct CampListView: View {
                         onSelect(row.object)
                     }
                 }
+
+                if viewModel.hasMore {
+                    LoadMoreFooter(loadedCount: viewModel.items.count, totalCount: viewModel.totalCount) {
+                        viewModel.loadMore()
+                    }
+                    .listRowSeparator(.hidden)
+                }
             }
             .listStyle(.plain)
             .searchable(
@@ -119,7 +126,7 @@ struct CampListView: View {
     }
 
     private func showMap() {
-        onShowMap(viewModel.filteredItems.map(\.object))
+        Task { onShowMap(await viewModel.allFilteredObjects()) }
     }
 
     private func rightSubtitle(for camp: CampObject) -> String? {
@@ -165,15 +172,26 @@ private class PreviewCampDataProvider: CampDataProvider {
 
     override func observeObjects(filter: CampFilter) -> AsyncStream<[ListRow<CampObject>]> {
         AsyncStream { continuation in
-            continuation.yield([
-                Self.createMockCamp(name: "Solaris Camp"),
-                Self.createMockCamp(name: "Dusty Mermaid"),
-                Self.createMockCamp(name: "Roaming Oasis")
-            ].map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) })
+            continuation.yield(Self.mockRows())
+            continuation.finish()
+        }
+    }
+
+    override func observeWindow(filter: CampFilter, limit: Int) -> AsyncStream<ListWindow<CampObject>> {
+        AsyncStream { continuation in
+            continuation.yield(ListWindow(rows: Self.mockRows(), next: nil))
             continuation.finish()
         }
     }
 
+    private nonisolated static func mockRows() -> [ListRow<CampObject>] {
+        [
+            createMockCamp(name: "Solaris Camp"),
+            createMockCamp(name: "Dusty Mermaid"),
+            createMockCamp(name: "Roaming Oasis")
+        ].map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) }
+    }
+
     private nonisolated static func createMockCamp(name: String) -> CampObject {
         CampObject(
             uid: UUID().uuidString,
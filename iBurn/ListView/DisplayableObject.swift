@@ -79,6 +79,24 @@ extension EventObjectOccurrence {
         return defaultTimeText
     }
 
+    /// Next instant after `now` at which `timeDescription(now:)` or the happening / ended
+    /// state changes: the start of the 30 min "starts soon" window, then each minute of the
+    /// countdown to start, then each minute of the countdown to end. Nil once ended.
+    func nextDisplayChange(after now: Date) -> Date? {
+        if allDay {
+            // Text is static; only happening / ended state changes
+            if now < startDate { return startDate }
+            return now < endDate ? endDate : nil
+        }
+        let startingSoon = startDate.addingTimeInterval(-30 * 60)
+        if now < startingSoon { return startingSoon }
+        let target = now < startDate ? startDate : endDate
+        guard now < target else { return nil }
+        // Countdown text changes on whole minutes before the target
+        let step = target.timeIntervalSince(now).truncatingRemainder(dividingBy: 60)
+        return now.addingTimeInterval(step > 0 ? step : 60)
+    }
+
     /// Static time description without live status (e.g. "Mon 9:00am (2h 45m)").
     var defaultTimeText: String {
         if allDay { return "\(dayAbbrev(startDate)) (All Day)" }
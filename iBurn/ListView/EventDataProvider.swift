@@ -71,6 +71,44 @@ class EventDataProvider: ObjectListDataProvider {
         }
     }
 
+    /// Observe events as one columnar store; bucket with `EventOccurrenceStore.dayHourRanges()`.
+    /// Events and hosts are shared across occurrences instead of copied into every row.
+    func observeOccurrenceStore(filter: EventFilter) -> AsyncStream<EventOccurrenceStore> {
+        AsyncStream { continuation in
+            let token = playaDB.observeEventOccurrenceStore(filter: filter) { store in
+                continuation.yield(store)
+            } onError: { error in
+                print("Event observation error: \(error)")
+            }
+
+            continuation.onTermination = { @Sendable _ in
+                token.cancel()
+            }
+        }
+    }
+
+    func observeWindow(filter: EventFilter, limit: Int) -> AsyncStream<ListWindow<EventObjectOccurrence>> {
+        AsyncStream { continuation in
+            let token = playaDB.observeEvents(filter: filter, window: ListWindowRequest(limit: limit)) { window in
+                continuation.yield(window)
+            } onError: { error in
+                print("Event observation error: \(error)")
+            }
+
+            continuation.onTermination = { @Sendable _ in
+                token.cancel()
+            }
+        }
+    }
+
+    func countObjects(filter: EventFilter) async throws -> Int {
+        try await playaDB.countEvents(filter: filter)
+    }
+
+    func fetchObjects(filter: EventFilter) async throws -> [EventObjectOccurrence] {
+        try await playaDB.fetchEvents(filter: filter)
+    }
+
     func toggleFavorite(_ object: EventObjectOccurrence) async throws {
         try await playaDB.toggleFavorite(object)
     }
@@ -80,12 +118,6 @@ class EventDataProvider: ObjectListDataProvider {
               let objectLocation = object.location else {
             return nil
         }
-
-        let distance = location.distance(from: objectLocation)
-
-        guard let nsAttributedString = TTTLocationFormatter.brc_humanizedString(forDistance: distance) else {
-            return nil
-        }
-        return AttributedString(nsAttributedString)
+        return DistanceEngine.attributedString(forDistance: DistanceEngine.distance(from: location, to: objectLocation))
     }
 }
@@ -1,6 +1,5 @@
 import SwiftUI
 import UIKit
-import PlayaDB
 
 /// Vertical hour quick-scroll strip overlay for the SwiftUI Events list.
 /// Mirrors the legacy `UITableView.sectionIndexTitles` strip used in `EventListViewController`:
@@ -8,7 +7,8 @@ import PlayaDB
 /// continuous drag-scrub with light haptic feedback on hour transitions, plus a floating
 /// scrubber bubble that fades in during a drag and tracks the finger above the touch point.
 struct EventHourIndexView: View {
-    let sections: [EventHourSection]
+    /// Section hours (0...23) in list order
+    let hours: [Int]
     /// Receives the section's hour (0...23) when the user taps or scrubs onto it.
     let onScrollTo: (Int) -> Void
 
@@ -34,8 +34,8 @@ struct EventHourIndexView: View {
 
     var body: some View {
         VStack(spacing: 2) {
-            ForEach(sections, id: \.hour) { section in
-                Text(Self.stripLabel(for: section.hour))
+            ForEach(hours, id: \.self) { hour in
+                Text(Self.stripLabel(for: hour))
                     .font(.system(size: 11, weight: .semibold))
                     .foregroundColor(themeColors.primaryColor)
                     .frame(width: 18, height: 14)
@@ -43,7 +43,7 @@ struct EventHourIndexView: View {
                         GeometryReader { geo in
                             Color.clear.preference(
                                 key: HourFramePreferenceKey.self,
-                                value: [section.hour: geo.frame(in: .named("eventHourStrip"))]
+                                value: [hour: geo.frame(in: .named("eventHourStrip"))]
                             )
                         }
                     )
@@ -65,8 +65,8 @@ struct EventListView: View {
                             switch viewModel.mode {
                             case .browse:
                                 ForEach(viewModel.browseSections, id: \.hour) { section in
-                                    ForEach(section.rows, id: \.object.uid) { row in
-                                        let isFirstInSection = row.object.uid == section.rows.first?.object.uid
+                                    ForEach(section.rows, id: \.uid) { row in
+                                        let isFirstInSection = row.index == section.rows.startIndex
                                         rowButton(for: row, scrollAnchorHour: isFirstInSection ? section.hour : nil)
                                             .padding(Self.browseRowInsets)
                                         Divider()
@@ -77,13 +77,21 @@ struct EventListView: View {
                                     Button {
                                         onSelect(row.object)
                                     } label: {
-                                        eventRow(for: row)
+                                        eventRow(for: row.object, isFavorite: row.isFavorite, thumbnailColors: row.thumbnailColors)
                                             .contentShape(Rectangle())
                                             .padding(Self.searchRowInsets)
                                     }
                                     .buttonStyle(.plain)
                                     Divider()
                                 }
+                                if viewModel.hasMoreSearchResults {
+                                    LoadMoreFooter(
+                                        loadedCount: viewModel.searchResults.count,
+                                        totalCount: viewModel.searchResultCount
+                                    ) {
+                                        viewModel.loadMoreSearchResults()
+                                    }
+                                }
                             }
                         }
                     }
@@ -93,7 +101,7 @@ struct EventListView: View {
                     )
                     .overlay(alignment: .trailing) {
                         if case .browse = viewModel.mode, !viewModel.browseSections.isEmpty {
-                            EventHourIndexView(sections: viewModel.browseSections) { hour in
+                            EventHourIndexView(hours: viewModel.browseSections.map(\.hour)) { hour in
                                 withAnimation(.easeOut(duration: 0.15)) {
                                     proxy.scrollTo(hour, anchor: .top)
                                 }
@@ -174,16 +182,18 @@ struct EventListView: View {
     // MARK: - Row Builder
 
     /// Wraps the tappable row with a conditional `.id(hour)` anchor so
-    /// `ScrollViewReader` can target the first row of each section.
+    /// `ScrollViewReader` can target the first row of each section. The occurrence is
+    /// only materialized here, for rows the lazy stack actually builds.
     @ViewBuilder
     private func rowButton(
-        for row: ListRow<EventObjectOccurrence>,
+        for row: EventOccurrenceStore.Row,
         scrollAnchorHour: Int?
     ) -> some View {
+        let object = row.materialize()
         let button = Button {
-            onSelect(row.object)
+            onSelect(object)
         } label: {
-            eventRow(for: row)
+            eventRow(for: object, isFavorite: row.isFavorite, thumbnailColors: row.thumbnailColors)
                 .contentShape(Rectangle())
         }
         .buttonStyle(.plain)
@@ -195,20 +205,24 @@ struct EventListView: View {
         }
     }
 
-    private func eventRow(for row: ListRow<EventObjectOccurrence>) -> some View {
+    private func eventRow(
+        for object: EventObjectOccurrence,
+        isFavorite: Bool,
+        thumbnailColors: ThumbnailColors?
+    ) -> some View {
         return ObjectRowView(
-            object: row.object,
-            subtitle: viewModel.distanceAttributedString(for: row.object),
-            rightSubtitle: row.object.timeDescription(now: viewModel.now),
-            hostName: row.object.hostName,
-            hostAddress: BRCEmbargo.allowEmbargoedData() ? row.object.hostAddress : nil,
-            isFavorite: row.isFavorite,
-            thumbnailColors: row.thumbnailColors,
+            object: object,
+            subtitle: viewModel.distanceAttributedString(for: object),
+            rightSubtitle: viewModel.timeDescription(for: object),
+            hostName: object.hostName,
+            hostAddress: BRCEmbargo.allowEmbargoedData() ? object.hostAddress : nil,
+            isFavorite: isFavorite,
+            thumbnailColors: thumbnailColors,
             onFavoriteTap: {
-                Task { await viewModel.toggleFavorite(row) }
+                Task { await viewModel.toggleFavorite(object) }
             }
         ) { _ in
-            Text(EventTypeInfo.emoji(for: row.object.eventTypeCode))
+            Text(EventTypeInfo.emoji(for: object.eventTypeCode))
                 .font(.subheadline)
         }
     }
@@ -225,6 +239,6 @@ struct EventListView: View {
     }
 
     private func showMap() {
-        onShowMap(viewModel.visibleObjects)
+        Task { onShowMap(await viewModel.allVisibleObjects()) }
     }
 }
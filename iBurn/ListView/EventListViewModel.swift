@@ -11,16 +11,40 @@ final class EventListViewModel: ObservableObject {
         case search(String)
     }
 
+    /// One hour of the selected day: a slice of `browseStore`, so nothing is copied
+    struct BrowseSection {
+        /// 0...23
+        let hour: Int
+        let rows: Slice<EventOccurrenceStore>
+    }
+
     // MARK: - Published
 
-    /// Full-festival browse results, bucketed by start-of-day then hour. Built once per
-    /// filter/search change and re-emitted only when underlying data changes (favorites,
-    /// imports). Day-tab switching is a pure in-memory dictionary lookup over this map —
-    /// no observation restart, no DB hit.
-    @Published private(set) var dayBuckets: [Date: [EventHourSection]] = [:]
+    /// Full-festival browse results as one columnar store. Built once per filter/search
+    /// change and re-emitted only when underlying data changes (favorites, imports).
+    /// Day-tab switching is a pure in-memory lookup into `dayRanges` — no observation
+    /// restart, no DB hit.
+    @Published private(set) var browseStore = EventOccurrenceStore() {
+        didSet {
+            dayRanges = browseStore.dayHourRanges()
+            updateRefreshSchedule()
+        }
+    }
 
-    /// Flat results for search mode (FTS). Empty when not searching.
-    @Published var searchResults: [ListRow<EventObjectOccurrence>] = []
+    /// Start-of-day → hour ranges into `browseStore`
+    private var dayRanges: [Date: [EventOccurrenceStore.HourRange]] = [:]
+
+    /// Flat results for search mode (FTS), a window of the first `searchLimit` matches that
+    /// grows with `loadMoreSearchResults()`. Empty when not searching.
+    @Published var searchResults: [ListRow<EventObjectOccurrence>] = [] {
+        didSet { updateRefreshSchedule() }
+    }
+
+    /// Whether matches follow `searchResults`
+    @Published private(set) var hasMoreSearchResults: Bool = false
+
+    /// Number of search matches, counted separately from the loaded window
+    @Published private(set) var searchResultCount: Int?
 
     @Published var filter: EventFilter {
         didSet {
@@ -37,10 +61,12 @@ final class EventListViewModel: ObservableObject {
     @Published var currentLocation: CLLocation?
 
     /// Currently selected day. Does NOT trigger an observation restart — the browse
-    /// observation produces all days; the UI slices `dayBuckets` by this value.
-    @Published var selectedDay: Date
+    /// observation produces all days; the UI slices `dayRanges` by this value.
+    @Published var selectedDay: Date {
+        didSet { updateRefreshSchedule() }
+    }
 
-    /// Current time, updated every 60s for status indicators
+    /// Time of the last visible event status change, for status indicators
     @Published var now: Date = .present
 
     /// Browse vs. search; derived from `searchText`.
@@ -62,7 +88,15 @@ final class EventListViewModel: ObservableObject {
     private var observationTask: Task<Void, Never>?
     private var locationTask: Task<Void, Never>?
     private var loadingGateTask: Task<Void, Never>?
-    private var timerTask: Task<Void, Never>?
+
+    /// Search matches per window growth
+    static let searchPageSize = 50
+    private var searchLimit = EventListViewModel.searchPageSize
+
+    /// Wakes when a visible event starts, ends, or ticks a countdown
+    private lazy var refreshScheduler = EventRefreshScheduler { [weak self] now, _ in
+        self?.now = now
+    }
 
     // MARK: - Init
 
@@ -88,14 +122,12 @@ final class EventListViewModel: ObservableObject {
 
         restartObservation()
         startLocationUpdates()
-        startRefreshTimer()
     }
 
     deinit {
         observationTask?.cancel()
         locationTask?.cancel()
         loadingGateTask?.cancel()
-        timerTask?.cancel()
     }
 
     // MARK: - Derived
@@ -106,25 +138,34 @@ final class EventListViewModel: ObservableObject {
 
     /// Sections for the currently selected day — pure in-memory dict lookup.
     /// Returns `[]` for days the user hasn't generated content for.
-    var browseSections: [EventHourSection] {
+    var browseSections: [BrowseSection] {
         let key = Calendar.current.startOfDay(for: selectedDay)
-        return dayBuckets[key] ?? []
+        return (dayRanges[key] ?? []).map { BrowseSection(hour: $0.hour, rows: browseStore[$0.range]) }
     }
 
-    /// Flat list of all currently visible rows (sections flattened in browse mode).
-    /// Used by the hosting controller for detail-paging order.
-    var visibleRows: [ListRow<EventObjectOccurrence>] {
+    /// Detail pages for all currently visible rows (sections flattened in browse mode),
+    /// in list order. Used by the hosting controller for detail paging.
+    var visiblePageItems: [DetailPageItem] {
         switch mode {
         case .browse:
-            return browseSections.flatMap { $0.rows }
+            return browseSections.flatMap { $0.rows }.map { row in
+                DetailPageItem(subject: .eventOccurrence(row.materialize()), thumbnailColors: row.thumbnailColors)
+            }
         case .search:
-            return searchResults
+            return searchResults.map { row in
+                DetailPageItem(subject: .eventOccurrence(row.object), metadata: row.metadata, thumbnailColors: row.thumbnailColors)
+            }
         }
     }
 
     /// Flat list of all currently visible event objects, for the "Show map" action.
     var visibleObjects: [EventObjectOccurrence] {
-        visibleRows.map(\.object)
+        switch mode {
+        case .browse:
+            return browseSections.flatMap { $0.rows.map { $0.materialize() } }
+        case .search:
+            return searchResults.map(\.object)
+        }
     }
 
     var isEmpty: Bool {
@@ -134,22 +175,43 @@ final class EventListViewModel: ObservableObject {
         }
     }
 
+    /// Every visible event for "Show map", fetching search matches past the loaded window
+    func allVisibleObjects() async -> [EventObjectOccurrence] {
+        guard case .search(let query) = mode, hasMoreSearchResults else {
+            return visibleObjects
+        }
+        do {
+            return try await dataProvider.fetchObjects(filter: searchFilter(query: query))
+        } catch {
+            print("Error fetching events for \(query): \(error)")
+            return visibleObjects
+        }
+    }
+
     // MARK: - Actions
 
+    /// Grow the search window by a page; call when the end of the results scrolls into view
+    func loadMoreSearchResults() {
+        guard case .search(let query) = mode, hasMoreSearchResults,
+              searchResults.count >= searchLimit else { return }
+        searchLimit += Self.searchPageSize
+        observeSearch(query: query)
+    }
+
     /// Toggle favorite. The DB observation re-emits the updated rows;
     /// no optimistic in-memory mutation here.
-    func toggleFavorite(_ row: ListRow<EventObjectOccurrence>) async {
+    func toggleFavorite(_ occurrence: EventObjectOccurrence) async {
         do {
-            try await dataProvider.toggleFavorite(row.object)
+            try await dataProvider.toggleFavorite(occurrence)
         } catch {
-            print("Error toggling favorite for \(row.object.name): \(error)")
+            print("Error toggling favorite for \(occurrence.name): \(error)")
         }
     }
 
     // MARK: - Observation
 
     /// Browse mode filter: user filters across the full festival. No day scoping (the UI
-    /// slices `dayBuckets[selectedDay]` in memory) and no searchText.
+    /// slices `dayRanges[selectedDay]` in memory) and no searchText.
     private func browseFilter() -> EventFilter {
         var f = filter
         f.startDate = nil
@@ -175,37 +237,52 @@ final class EventListViewModel: ObservableObject {
         switch mode {
         case .browse:
             searchResults = []
+            hasMoreSearchResults = false
+            searchResultCount = nil
             let f = browseFilter()
             observationTask = Task { [weak self] in
                 guard let self else { return }
                 var didReceiveFirstEmission = false
-                for await bucket in self.dataProvider.observeObjectsByDayThenHour(filter: f) {
+                for await store in self.dataProvider.observeOccurrenceStore(filter: f) {
                     didReceiveFirstEmission = true
                     await MainActor.run {
-                        self.dayBuckets = bucket
-                        if !bucket.isEmpty {
+                        self.browseStore = store
+                        if !store.isEmpty {
                             self.isLoading = false
                         }
                     }
-                    if didReceiveFirstEmission, !bucket.isEmpty {
+                    if didReceiveFirstEmission, !store.isEmpty {
                         await MainActor.run { self.loadingGateTask?.cancel() }
-                    } else if didReceiveFirstEmission, bucket.isEmpty {
+                    } else if didReceiveFirstEmission, store.isEmpty {
                         startLoadingGateIfNeeded()
                     }
                 }
             }
 
         case .search(let query):
-            dayBuckets = [:]
-            let f = searchFilter(query: query)
-            observationTask = Task { [weak self] in
+            browseStore = EventOccurrenceStore()
+            searchLimit = Self.searchPageSize
+            observeSearch(query: query)
+        }
+    }
+
+    private func observeSearch(query: String) {
+        observationTask?.cancel()
+        let f = searchFilter(query: query)
+        let windows = dataProvider.observeWindow(filter: f, limit: searchLimit)
+        observationTask = Task { [weak self] in
+            for await window in windows {
                 guard let self else { return }
-                for await rows in self.dataProvider.observeObjects(filter: f) {
-                    await MainActor.run {
-                        self.searchResults = rows
-                        self.isLoading = false
-                    }
+                self.searchResults = window.rows
+                self.hasMoreSearchResults = window.hasMore
+                self.isLoading = false
+
+                var count: Int? = window.rows.count
+                if window.hasMore {
+                    count = try? await self.dataProvider.countObjects(filter: f)
                 }
+                guard !Task.isCancelled else { return }
+                self.searchResultCount = count
             }
         }
     }
@@ -255,18 +332,15 @@ final class EventListViewModel: ObservableObject {
         }
     }
 
-    // MARK: - Refresh Timer
+    // MARK: - Event Time Refresh
 
-    private func startRefreshTimer() {
-        timerTask = Task { [weak self] in
-            while !Task.isCancelled {
-                try? await Task.sleep(nanoseconds: 60_000_000_000) // 60 seconds
-                guard let self else { return }
-                await MainActor.run {
-                    self.now = .present
-                }
-            }
-        }
+    /// Row time text, e.g. "Starts 5 min (1h)"; refreshed by `refreshScheduler`
+    func timeDescription(for occurrence: EventObjectOccurrence) -> String {
+        refreshScheduler.timeDescription(for: occurrence)
+    }
+
+    private func updateRefreshSchedule() {
+        refreshScheduler.update(visible: visibleObjects)
     }
 
     // MARK: - Filter Persistence
@@ -0,0 +1,125 @@
+//
+//  EventRefreshScheduler.swift
+//  iBurn
+//
+//  Wakes event lists when a visible row's status changes, instead of polling.
+//
+
+import Foundation
+import PlayaDB
+import UIKit
+
+/// Keeps event row time text current by waking at the next instant any visible occurrence
+/// starts, ends, or ticks a countdown (see `EventObjectOccurrence.nextDisplayChange(after:)`).
+///
+/// Caches each row's `timeDescription(now:)` and, when it fires, drops only the rows whose
+/// text changed before calling `onChange`. The list view models republish on that call, so
+/// SwiftUI re-evaluates the whole list, but unchanged rows keep their cached text and only
+/// the changed ones are formatted again. Between boundaries nothing runs, so an idle list
+/// of far-off events doesn't wake at all. Call `update(visible:)` whenever the rows on
+/// screen change.
+///
+/// `Task.sleep` counts uptime, which stops while the device sleeps, and the wall clock can
+/// jump; returning to the foreground and significant time changes re-read the clock.
+@MainActor
+final class EventRefreshScheduler {
+    private struct CachedText {
+        let startDate: Date
+        let endDate: Date
+        let text: String
+    }
+
+    private let clock: () -> Date
+    private let onChange: (_ now: Date, _ changedUIDs: Set<String>) -> Void
+    private var visible: [EventObjectOccurrence] = []
+    private var texts: [String: CachedText] = [:]
+    private var task: Task<Void, Never>?
+    private var observers: [NSObjectProtocol] = []
+    /// Next wake-up, if any visible occurrence will still change
+    private(set) var nextFireDate: Date?
+
+    /// - Parameter onChange: Called on the main actor with the time and the uids of the rows
+    ///   whose status or time text changed
+    init(
+        clock: @escaping () -> Date = { .present },
+        onChange: @escaping (_ now: Date, _ changedUIDs: Set<String>) -> Void
+    ) {
+        self.clock = clock
+        self.onChange = onChange
+        let names = [UIApplication.willEnterForegroundNotification, UIApplication.significantTimeChangeNotification]
+        observers = names.map { name in
+            NotificationCenter.default.addObserver(forName: name, object: nil, queue: .main) { [weak self] _ in
+                MainActor.assumeIsolated {
+                    self?.clockDidChange()
+                }
+            }
+        }
+    }
+
+    deinit {
+        task?.cancel()
+        observers.forEach { NotificationCenter.default.removeObserver($0) }
+    }
+
+    /// Row time text, formatted once per status change
+    func timeDescription(for occurrence: EventObjectOccurrence) -> String {
+        if let cached = texts[occurrence.uid],
+           cached.startDate == occurrence.startDate, cached.endDate == occurrence.endDate {
+            return cached.text
+        }
+        let text = occurrence.timeDescription(now: clock())
+        texts[occurrence.uid] = CachedText(startDate: occurrence.startDate, endDate: occurrence.endDate, text: text)
+        return text
+    }
+
+    /// Replace the occurrences on screen and reschedule for them
+    func update(visible occurrences: [EventObjectOccurrence]) {
+        visible = occurrences
+        let uids = Set(occurrences.map(\.uid))
+        texts = texts.filter { uids.contains($0.key) }
+        reschedule()
+    }
+
+    /// Drops the rows whose text is stale at the current time and reschedules from it
+    func clockDidChange() {
+        let now = clock()
+        let changed = Set(visible.filter { occurrence in
+            texts[occurrence.uid].map { $0.text != occurrence.timeDescription(now: now) } ?? false
+        }.map(\.uid))
+        for uid in changed {
+            texts[uid] = nil
+        }
+        reschedule()
+        if !changed.isEmpty {
+            onChange(now, changed)
+        }
+    }
+
+    private func reschedule() {
+        task?.cancel()
+        let now = clock()
+        let changes = visible.compactMap { occurrence in
+            occurrence.nextDisplayChange(after: now).map { (uid: occurrence.uid, date: $0) }
+        }
+        nextFireDate = changes.map(\.date).min()
+        guard let fireDate = nextFireDate else {
+            task = nil
+            return
+        }
+
+        task = Task { [weak self] in
+            let delay = max(0, fireDate.timeIntervalSince(now))
+            try? await Task.sleep(nanoseconds: UInt64(delay * 1_000_000_000))
+            guard !Task.isCancelled, let self else { return }
+            let firedAt = self.clock()
+            let changed = Set(changes.filter { $0.date <= firedAt }.map(\.uid))
+            for uid in changed {
+                self.texts[uid] = nil
+            }
+            self.reschedule()
+            if !changed.isEmpty {
+                self.onChange(firedAt, changed)
+            }
+        }
+    }
+}
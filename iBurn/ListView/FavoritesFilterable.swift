@@ -10,8 +10,8 @@ import PlayaDB
 
 /// Minimal protocol for filters that can scope results to favorites only.
 ///
-/// During the migration, the SwiftUI lists treat legacy (YapDatabase) favorites as the UI source of truth,
-/// so we observe *all* rows from PlayaDB and apply favorites filtering client-side.
+/// Favorites live in PlayaDB metadata (legacy YapDatabase favorites are copied over once by
+/// `LegacyUserDataMigration`), so favorites-only lists are observed straight from PlayaDB.
 protocol FavoritesFilterable {
     var onlyFavorites: Bool { get set }
 }
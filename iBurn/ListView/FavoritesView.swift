@@ -161,7 +161,7 @@ struct FavoritesView: View {
             ObjectRowView(
                 object: event.object,
                 subtitle: viewModel.distanceAttributedString(for: .event(event)),
-                rightSubtitle: event.object.timeDescription(now: viewModel.now),
+                rightSubtitle: viewModel.timeDescription(for: event.object),
                 hostName: event.object.hostName,
                 hostAddress: BRCEmbargo.allowEmbargoedData() ? event.object.hostAddress : nil,
                 isFavorite: event.isFavorite,
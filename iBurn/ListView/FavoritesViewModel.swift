@@ -9,7 +9,9 @@ final class FavoritesViewModel: ObservableObject {
 
     @Published var artItems: [ListRow<ArtObject>] = []
     @Published var campItems: [ListRow<CampObject>] = []
-    @Published var eventItems: [ListRow<EventObjectOccurrence>] = []
+    @Published var eventItems: [ListRow<EventObjectOccurrence>] = [] {
+        didSet { refreshScheduler.update(visible: eventItems.map(\.object)) }
+    }
     @Published var mvItems: [ListRow<MutantVehicleObject>] = []
 
     @Published var selectedTypeFilter: FavoritesTypeFilter {
@@ -22,7 +24,7 @@ final class FavoritesViewModel: ObservableObject {
     @Published var isLoading: Bool = true
     @Published var currentLocation: CLLocation?
 
-    /// Current time, updated every 60s for event status indicators
+    /// Time of the last favorited event status change, for event status indicators
     @Published var now: Date = .present
 
     // MARK: - Dependencies
@@ -40,9 +42,13 @@ final class FavoritesViewModel: ObservableObject {
     private var eventTask: Task<Void, Never>?
     private var mvTask: Task<Void, Never>?
     private var locationTask: Task<Void, Never>?
-    private var timerTask: Task<Void, Never>?
     private var loadingGateTask: Task<Void, Never>?
 
+    /// Wakes when a favorited event starts, ends, or ticks a countdown
+    private lazy var refreshScheduler = EventRefreshScheduler { [weak self] now, _ in
+        self?.now = now
+    }
+
     /// Track which type streams have emitted at least once
     private var receivedFirstEmission: Set<String> = []
 
@@ -66,7 +72,6 @@ final class FavoritesViewModel: ObservableObject {
 
         startAllObservations()
         startLocationUpdates()
-        startRefreshTimer()
     }
 
     deinit {
@@ -75,7 +80,6 @@ final class FavoritesViewModel: ObservableObject {
         eventTask?.cancel()
         mvTask?.cancel()
         locationTask?.cancel()
-        timerTask?.cancel()
         loadingGateTask?.cancel()
     }
 
@@ -347,18 +351,10 @@ final class FavoritesViewModel: ObservableObject {
         }
     }
 
-    // MARK: - Refresh Timer
+    // MARK: - Event Time Refresh
 
-    private func startRefreshTimer() {
-        timerTask = Task { [weak self] in
-            while !Task.isCancelled {
-                try? await Task.sleep(nanoseconds: 60_000_000_000) // 60 seconds
-                guard let self else { return }
-                await MainActor.run {
-                    self.now = .present
-                }
-            }
-        }
+    /// Row time text, e.g. "Starts 5 min (1h)"; refreshed by `refreshScheduler`
+    func timeDescription(for occurrence: EventObjectOccurrence) -> String {
+        refreshScheduler.timeDescription(for: occurrence)
     }
-
 }
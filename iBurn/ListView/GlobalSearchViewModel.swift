@@ -12,7 +12,7 @@ final class GlobalSearchViewModel: ObservableObject {
     @Published var sections: [SearchResultSection] = []
     @Published var isSearching: Bool = false
 
-    /// UIDs of results that came from AI semantic search (not FTS5)
+    /// UIDs of results that came from semantic or AI search (not FTS5)
     @Published var aiSuggestedUIDs: Set<String> = []
 
     /// Whether AI search is currently running (FTS5 results already shown)
@@ -28,6 +28,11 @@ final class GlobalSearchViewModel: ObservableObject {
     private var searchTask: Task<Void, Never>?
     private var aiSearchTask: Task<Void, Never>?
 
+    /// Nearest embeddings considered per query
+    private static let semanticResultLimit = 12
+    /// Cosine similarity below which embedding neighbors are too loosely related to show
+    private static let semanticMinimumScore: Float = 0.35
+
     // MARK: - Init
 
     init(playaDB: PlayaDB, aiSearchService: AISearchService? = nil) {
@@ -84,9 +89,13 @@ final class GlobalSearchViewModel: ObservableObject {
                     self.isSearching = false
                 }
 
+                // Embedding neighbors take milliseconds and need no model call
+                let semanticUIDs = await self.runSemanticSearch(query: query, ftsUIDs: ftsUIDs)
+                guard !Task.isCancelled else { return }
+
                 // Launch AI search in parallel if available
                 if let aiService = self.aiSearchService, aiService.isAvailable {
-                    await self.runAISearch(query: query, ftsUIDs: ftsUIDs)
+                    await self.runAISearch(query: query, ftsUIDs: ftsUIDs.union(semanticUIDs))
                 }
             } catch {
                 guard !Task.isCancelled else { return }
@@ -99,6 +108,34 @@ final class GlobalSearchViewModel: ObservableObject {
         }
     }
 
+    /// Merge the nearest embedding matches not found by FTS5. Returns the merged objects' UIDs.
+    private func runSemanticSearch(query: String, ftsUIDs: Set<String>) async -> Set<String> {
+        do {
+            let matches = try await playaDB.semanticSearch(query, types: nil, limit: Self.semanticResultLimit)
+            guard !Task.isCancelled else { return [] }
+
+            var newUIDs: Set<String> = []
+            var newItems: [SearchResultItem] = []
+            for match in matches where match.score >= Self.semanticMinimumScore && !ftsUIDs.contains(match.object.uid) {
+                if let item = await searchItem(for: match.object) {
+                    newUIDs.insert(match.object.uid)
+                    newItems.append(item)
+                }
+            }
+            guard !newItems.isEmpty, !Task.isCancelled else { return [] }
+
+            await MainActor.run {
+                // Event items are keyed by occurrence
+                self.aiSuggestedUIDs.formUnion(newItems.map(\.uid))
+                self.mergeAIResults(newItems)
+            }
+            return newUIDs
+        } catch {
+            print("Semantic search error: \(error)")
+            return []
+        }
+    }
+
     /// Run AI search and merge any new results not found by FTS5
     private func runAISearch(query: String, ftsUIDs: Set<String>) async {
         guard let aiService = aiSearchService else { return }
@@ -130,7 +167,7 @@ final class GlobalSearchViewModel: ObservableObject {
                 }
 
                 await MainActor.run {
-                    self.aiSuggestedUIDs = Set(newUIDs)
+                    self.aiSuggestedUIDs.formUnion(newUIDs)
                     self.mergeAIResults(newItems)
                     self.isAISearching = false
                 }
@@ -177,6 +214,21 @@ final class GlobalSearchViewModel: ObservableObject {
 
     // MARK: - Grouping
 
+    /// Display item for a search hit, resolving an `EventObject` to its first occurrence
+    private func searchItem(for object: any DataObject) async -> SearchResultItem? {
+        if let art = object as? ArtObject {
+            return .art(art)
+        } else if let camp = object as? CampObject {
+            return .camp(camp)
+        } else if let event = object as? EventObject {
+            guard let occurrences = try? await playaDB.fetchOccurrences(forEventUID: event.uid) else { return nil }
+            return occurrences.first.map { .event($0) }
+        } else if let mv = object as? MutantVehicleObject {
+            return .mutantVehicle(mv)
+        }
+        return nil
+    }
+
     /// Group search results into sections, resolving EventObject → EventObjectOccurrence
     private func groupResults(_ objects: [Any]) async -> [SearchResultSection] {
         var artItems: [SearchResultItem] = []
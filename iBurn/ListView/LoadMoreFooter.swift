@@ -0,0 +1,31 @@
+//
+//  LoadMoreFooter.swift
+//  iBurn
+//
+//  Trailing row of a windowed list that loads the next page when it scrolls into view.
+//
+
+import SwiftUI
+
+/// Shown after the loaded rows while more follow. Appearing on screen calls `onAppear`,
+/// which grows the observed window by a page.
+struct LoadMoreFooter: View {
+    let loadedCount: Int
+    let totalCount: Int?
+    let onAppear: () -> Void
+    @Environment(\.themeColors) var themeColors
+
+    var body: some View {
+        HStack(spacing: 8) {
+            ProgressView()
+            if let totalCount {
+                Text("\(loadedCount) of \(totalCount)")
+                    .font(.footnote)
+                    .foregroundColor(themeColors.secondaryColor)
+            }
+        }
+        .frame(maxWidth: .infinity)
+        .padding(.vertical, 8)
+        .onAppear(perform: onAppear)
+    }
+}
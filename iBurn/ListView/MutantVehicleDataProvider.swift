@@ -31,6 +31,28 @@ class MutantVehicleDataProvider: ObjectListDataProvider {
         }
     }
 
+    func observeWindow(filter: MutantVehicleFilter, limit: Int) -> AsyncStream<ListWindow<MutantVehicleObject>> {
+        AsyncStream { continuation in
+            let token = playaDB.observeMutantVehicles(filter: filter, window: ListWindowRequest(limit: limit)) { window in
+                continuation.yield(window)
+            } onError: { error in
+                print("MV observation error: \(error)")
+            }
+
+            continuation.onTermination = { @Sendable _ in
+                token.cancel()
+            }
+        }
+    }
+
+    func countObjects(filter: MutantVehicleFilter) async throws -> Int {
+        try await playaDB.countMutantVehicles(filter: filter)
+    }
+
+    func fetchObjects(filter: MutantVehicleFilter) async throws -> [MutantVehicleObject] {
+        try await playaDB.fetchMutantVehicles(filter: filter)
+    }
+
     func toggleFavorite(_ object: MutantVehicleObject) async throws {
         try await playaDB.toggleFavorite(object)
     }
@@ -36,6 +36,13 @@ struct MutantVehicleListView: View {
                         onSelect(row.object)
                     }
                 }
+
+                if viewModel.hasMore {
+                    LoadMoreFooter(loadedCount: viewModel.items.count, totalCount: viewModel.totalCount) {
+                        viewModel.loadMore()
+                    }
+                    .listRowSeparator(.hidden)
+                }
             }
             .listStyle(.plain)
             .searchable(
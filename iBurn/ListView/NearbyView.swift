@@ -131,8 +131,7 @@ struct NearbyView: View {
 
     private var distanceLabel: some View {
         let distance = viewModel.searchDistance
-        if let nsAttr = TTTLocationFormatter.brc_humanizedString(forDistance: distance) {
-            let attributed = AttributedString(nsAttr)
+        if let attributed = DistanceEngine.attributedString(forDistance: distance) {
             return Text("Within ") + Text(attributed)
         } else {
             return Text("Within \(Int(distance))m") + Text("")
@@ -201,7 +200,7 @@ struct NearbyView: View {
             ObjectRowView(
                 object: event.object,
                 subtitle: viewModel.distanceString(for: .event(event)),
-                rightSubtitle: event.object.timeDescription(now: viewModel.now),
+                rightSubtitle: viewModel.timeDescription(for: event.object),
                 hostName: event.object.hostName,
                 hostAddress: BRCEmbargo.allowEmbargoedData() ? event.object.hostAddress : nil,
                 isFavorite: event.isFavorite,
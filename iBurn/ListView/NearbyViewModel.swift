@@ -9,7 +9,9 @@ final class NearbyViewModel: ObservableObject {
 
     @Published var artItems: [ListRow<ArtObject>] = []
     @Published var campItems: [ListRow<CampObject>] = []
-    @Published var eventItems: [ListRow<EventObjectOccurrence>] = []
+    @Published var eventItems: [ListRow<EventObjectOccurrence>] = [] {
+        didSet { refreshScheduler.update(visible: eventItems.map(\.object)) }
+    }
 
     @Published var searchDistance: CLLocationDistance = 500 {
         didSet { restartObservations() }
@@ -27,6 +29,7 @@ final class NearbyViewModel: ObservableObject {
     }
 
     @Published var isLoading: Bool = true
+    /// Time of the last nearby event status change; re-filters happening events
     @Published var now: Date = .present
 
     // MARK: - Dependencies
@@ -48,10 +51,14 @@ final class NearbyViewModel: ObservableObject {
     private var campTask: Task<Void, Never>?
     private var eventTask: Task<Void, Never>?
     private var locationTask: Task<Void, Never>?
-    private var timerTask: Task<Void, Never>?
     private var loadingGateTask: Task<Void, Never>?
     private var receivedFirstEmission: Set<String> = []
 
+    /// Wakes when an event in the region starts, ends, or ticks a countdown
+    private lazy var refreshScheduler = EventRefreshScheduler { [weak self] now, _ in
+        self?.now = now
+    }
+
     // MARK: - Computed
 
     var currentLocation: CLLocation? {
@@ -98,7 +105,6 @@ final class NearbyViewModel: ObservableObject {
         self.rawLocation = locationProvider.currentLocation
 
         startLocationUpdates()
-        startRefreshTimer()
         restartObservations()
     }
 
@@ -107,7 +113,6 @@ final class NearbyViewModel: ObservableObject {
         campTask?.cancel()
         eventTask?.cancel()
         locationTask?.cancel()
-        timerTask?.cancel()
         loadingGateTask?.cancel()
     }
 
@@ -143,16 +148,12 @@ final class NearbyViewModel: ObservableObject {
 
     private var sortedArt: [ListRow<ArtObject>] {
         guard let loc = currentLocation else { return artItems }
-        return artItems.sorted { a, b in
-            distanceTo(a.object.location, from: loc) < distanceTo(b.object.location, from: loc)
-        }
+        return DistanceEngine.sorted(artItems, byDistanceFrom: loc) { $0.object.location }
     }
 
     private var sortedCamps: [ListRow<CampObject>] {
         guard let loc = currentLocation else { return campItems }
-        return campItems.sorted { a, b in
-            distanceTo(a.object.location, from: loc) < distanceTo(b.object.location, from: loc)
-        }
+        return DistanceEngine.sorted(campItems, byDistanceFrom: loc) { $0.object.location }
     }
 
     /// Events happening at the effective date, sorted by start time
@@ -163,19 +164,11 @@ final class NearbyViewModel: ObservableObject {
             .sorted { $0.object.startDate < $1.object.startDate }
     }
 
-    private func distanceTo(_ location: CLLocation?, from reference: CLLocation) -> CLLocationDistance {
-        guard let location else { return .greatestFiniteMagnitude }
-        return reference.distance(from: location)
-    }
-
     // MARK: - Distance Display
 
     func distanceString(for item: NearbyItem) -> AttributedString? {
-        switch item {
-        case .art(let r): artProvider.distanceAttributedString(from: currentLocation, to: r.object)
-        case .camp(let r): campProvider.distanceAttributedString(from: currentLocation, to: r.object)
-        case .event(let r): eventProvider.distanceAttributedString(from: currentLocation, to: r.object)
-        }
+        guard let location = currentLocation, let objectLocation = item.location else { return nil }
+        return DistanceEngine.attributedString(forDistance: DistanceEngine.distance(from: location, to: objectLocation))
     }
 
     // MARK: - Favorites
@@ -345,17 +338,10 @@ final class NearbyViewModel: ObservableObject {
         }
     }
 
-    // MARK: - Refresh Timer
+    // MARK: - Event Time Refresh
 
-    private func startRefreshTimer() {
-        timerTask = Task { [weak self] in
-            while !Task.isCancelled {
-                try? await Task.sleep(nanoseconds: 60_000_000_000)
-                guard let self else { return }
-                await MainActor.run {
-                    self.now = .present
-                }
-            }
-        }
+    /// Row time text, e.g. "2:00pm (30 min left)"; refreshed by `refreshScheduler`
+    func timeDescription(for occurrence: EventObjectOccurrence) -> String {
+        refreshScheduler.timeDescription(for: occurrence)
     }
 }
@@ -39,6 +39,17 @@ protocol ObjectListDataProvider<Object, Filter> {
     /// - Returns: AsyncStream that yields arrays of fully-inflated list rows
     func observeObjects(filter: Filter) -> AsyncStream<[ListRow<Object>]>
 
+    /// Observe the first `limit` list rows matching the filter, in list order. Only those rows
+    /// are fetched and inflated; `ListWindow.hasMore` tells whether more follow. Observe again
+    /// with a larger limit to grow the window as the user scrolls.
+    func observeWindow(filter: Filter, limit: Int) -> AsyncStream<ListWindow<Object>>
+
+    /// Number of objects matching the filter, counted in the database
+    func countObjects(filter: Filter) async throws -> Int
+
+    /// Every object matching the filter, without list metadata (e.g. for "Show map")
+    func fetchObjects(filter: Filter) async throws -> [Object]
+
     /// Toggle the favorite status of an object
     ///
     /// This operation persists to the database and triggers observation updates.
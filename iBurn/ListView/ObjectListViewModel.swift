@@ -10,6 +10,12 @@ import Dispatch
 import Foundation
 import PlayaDB
 
+/// Backs the art, camp and mutant vehicle lists.
+///
+/// While browsing, it observes a window of the list that starts at `pageSize` rows and grows
+/// by a page whenever the end scrolls into view (`loadMore()`), so each emission inflates only
+/// the rows loaded so far. Search is a substring match over the whole filtered list, so it
+/// observes every row while `searchText` is non-empty.
 @MainActor
 final class ObjectListViewModel<Object: DisplayableObject, Filter: Codable & FavoritesFilterable>: ObservableObject {
     // MARK: - Published
@@ -23,10 +29,26 @@ final class ObjectListViewModel<Object: DisplayableObject, Filter: Codable & Fav
         }
     }
 
-    @Published var searchText: String = ""
+    @Published var searchText: String = "" {
+        didSet {
+            // Only switching between browsing and searching changes what's observed
+            if oldValue.isEmpty != searchText.isEmpty {
+                restartObservation()
+            }
+        }
+    }
     @Published var isLoading: Bool = true
     @Published var currentLocation: CLLocation?
 
+    /// Whether rows follow the loaded window
+    @Published private(set) var hasMore: Bool = false
+
+    /// Number of objects matching the filter, counted separately from the loaded window
+    @Published private(set) var totalCount: Int?
+
+    /// Rows added to the window per `loadMore()`
+    static var pageSize: Int { 50 }
+
     // MARK: - Dependencies
 
     private let dataProvider: any ObjectListDataProvider<Object, Filter>
@@ -36,6 +58,9 @@ final class ObjectListViewModel<Object: DisplayableObject, Filter: Codable & Fav
     private let matchesSearch: (Object, String) -> Bool
     private let isDatabaseSeeded: (() async -> Bool)?
 
+    /// Rows in the observed window while browsing
+    private var windowLimit = ObjectListViewModel.pageSize
+
     // MARK: - Tasks
 
     private var observationTask: Task<Void, Never>?
@@ -90,8 +115,29 @@ final class ObjectListViewModel<Object: DisplayableObject, Filter: Codable & Fav
         return items.filter { matchesSearch($0.object, q) }
     }
 
+    /// Every object matching the filter and search, for "Show map". Fetches past the loaded
+    /// window when more rows follow.
+    func allFilteredObjects() async -> [Object] {
+        guard searchText.isEmpty, hasMore else {
+            return filteredItems.map(\.object)
+        }
+        do {
+            return try await dataProvider.fetchObjects(filter: effectiveFilterForObservation(filter))
+        } catch {
+            print("Error fetching objects for \(filter): \(error)")
+            return items.map(\.object)
+        }
+    }
+
     // MARK: - Actions
 
+    /// Grow the window by a page; call when the end of the list scrolls into view
+    func loadMore() {
+        guard searchText.isEmpty, hasMore, items.count >= windowLimit else { return }
+        windowLimit += Self.pageSize
+        observe(showLoading: false)
+    }
+
     func toggleFavorite(_ row: ListRow<Object>) async {
         let originalRow = row
         // Optimistic update
@@ -114,34 +160,58 @@ final class ObjectListViewModel<Object: DisplayableObject, Filter: Codable & Fav
     // MARK: - Observation
 
     private func startObserving() {
+        windowLimit = Self.pageSize
+        observe(showLoading: true)
+    }
+
+    private func observe(showLoading: Bool) {
         observationTask?.cancel()
         loadingGateTask?.cancel()
 
-        isLoading = true
+        if showLoading {
+            isLoading = true
+        }
         let filterForObservation = effectiveFilterForObservation(filter)
 
-        observationTask = Task { [weak self] in
-            guard let self else { return }
-
-            var didReceiveFirstEmission = false
-            for await rows in self.dataProvider.observeObjects(filter: filterForObservation) {
-                didReceiveFirstEmission = true
-                await MainActor.run {
-                    self.items = rows
-                    if !rows.isEmpty {
-                        self.isLoading = false
-                    }
+        if searchText.isEmpty {
+            let windows = dataProvider.observeWindow(filter: filterForObservation, limit: windowLimit)
+            observationTask = Task { [weak self] in
+                for await window in windows {
+                    guard let self else { return }
+                    await self.receive(window.rows, hasMore: window.hasMore, filter: filterForObservation)
                 }
-
-                if didReceiveFirstEmission, !rows.isEmpty {
-                    loadingGateTask?.cancel()
-                } else if didReceiveFirstEmission, rows.isEmpty {
-                    startLoadingGateIfNeeded()
+            }
+        } else {
+            let stream = dataProvider.observeObjects(filter: filterForObservation)
+            observationTask = Task { [weak self] in
+                for await rows in stream {
+                    guard let self else { return }
+                    await self.receive(rows, hasMore: false, filter: filterForObservation)
                 }
             }
         }
     }
 
+    private func receive(_ rows: [ListRow<Object>], hasMore: Bool, filter: Filter) async {
+        items = rows
+        self.hasMore = hasMore
+        if rows.isEmpty {
+            startLoadingGateIfNeeded()
+        } else {
+            isLoading = false
+            loadingGateTask?.cancel()
+        }
+
+        // Recounted per emission, since emissions follow data changes
+        guard hasMore else {
+            totalCount = rows.count
+            return
+        }
+        let count = try? await dataProvider.countObjects(filter: filter)
+        guard !Task.isCancelled else { return }
+        totalCount = count
+    }
+
     private func startLoadingGateIfNeeded() {
         guard loadingGateTask == nil else { return }
         guard let isDatabaseSeeded else {
@@ -100,11 +100,7 @@ final class RecentlyViewedViewModel: ObservableObject {
             guard let location = currentLocation else {
                 return items.sorted { $0.lastViewed > $1.lastViewed }
             }
-            return items.sorted { a, b in
-                let distA = a.location.map { location.distance(from: $0) } ?? .greatestFiniteMagnitude
-                let distB = b.location.map { location.distance(from: $0) } ?? .greatestFiniteMagnitude
-                return distA < distB
-            }
+            return DistanceEngine.sorted(items, byDistanceFrom: location) { $0.location }
         }
     }
 
@@ -119,7 +115,7 @@ final class RecentlyViewedViewModel: ObservableObject {
 
     func distanceString(for item: RecentlyViewedItem) -> String? {
         guard let location = currentLocation, let itemLoc = item.location else { return nil }
-        let meters = location.distance(from: itemLoc)
+        let meters = DistanceEngine.distance(from: location, to: itemLoc)
         if meters < 1000 {
             return "\(Int(meters))m"
         } else {
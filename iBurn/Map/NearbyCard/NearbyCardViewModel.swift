@@ -181,15 +181,14 @@ final class NearbyCardViewModel: ObservableObject {
             .map { NearbyItem.event($0) }
 
         var others: [(item: NearbyItem, distance: CLLocationDistance)] = []
+        // Within `radius` as the crow flies, ordered by walking distance like the lists
         for row in art {
-            guard let loc = row.object.location else { continue }
-            let distance = location.distance(from: loc)
-            if distance <= radius { others.append((.art(row), distance)) }
+            guard let loc = row.object.location, location.distance(from: loc) <= radius else { continue }
+            others.append((.art(row), DistanceEngine.distance(from: location, to: loc)))
         }
         for row in camps {
-            guard let loc = row.object.location else { continue }
-            let distance = location.distance(from: loc)
-            if distance <= radius { others.append((.camp(row), distance)) }
+            guard let loc = row.object.location, location.distance(from: loc) <= radius else { continue }
+            others.append((.camp(row), DistanceEngine.distance(from: location, to: loc)))
         }
         let sortedOthers = others.sorted { $0.distance < $1.distance }.map(\.item)
 
@@ -184,6 +184,7 @@ extension MapViewAdapter: MLNMapViewDelegate {
             }
             style.setImage(image, forName: key)
         }
+        EmojiMarkerAtlas.shared.register(in: style)
     }
     
     public func mapView(_ mapView: MLNMapView, viewFor annotation: MLNAnnotation) -> MLNAnnotationView? {
@@ -0,0 +1,305 @@
+import Foundation
+import CryptoKit
+import CocoaLumberjack
+
+/// In-memory index of every locally available media file (`<uid>.jpg`, `<uid>.m4a`).
+///
+/// Replaces the per-call `FileManager.fileExists` probing in `BRCMediaDownloader.localMediaURL`:
+/// the bundled media directory and `Documents/MediaFiles` are enumerated once, persisted to
+/// `MediaFiles/MediaManifest.json`, and kept current as downloads land. Lookups are a
+/// dictionary hit under a concurrent queue.
+///
+/// Bundled media is indexed in place instead of being copied into `Documents`. Downloaded
+/// copies whose content hash matches the bundled file are removed by `deduplicate()`.
+final class MediaManifest {
+
+    struct Entry: Codable, Equatable {
+        enum Source: String, Codable {
+            /// Lives in the read-only bundled media bundle
+            case bundle
+            /// Lives in `Documents/MediaFiles` (downloaded, or copied by older app versions)
+            case cache
+        }
+
+        let fileName: String
+        var source: Source
+        /// File size in bytes
+        var size: Int64
+        /// Hex SHA-256 of the file contents. Computed lazily (on download or during dedup).
+        var sha256: String?
+    }
+
+    /// On-disk representation. Rebuilt whenever the app build changes, since the bundled
+    /// media may have changed with it, and whenever files in the cache directory were
+    /// added or removed without going through the manifest (e.g. by a data update).
+    private struct Snapshot: Codable {
+        var buildVersion: String
+        /// Cache directory modification date when saved, seconds since 1970
+        var cacheModified: TimeInterval?
+        var entries: [String: Entry]
+    }
+
+    static let shared = MediaManifest(
+        cacheDirectory: URL(fileURLWithPath: BRCMediaDownloader.mediaFilesPath),
+        bundle: Bundle.bundledMedia
+    )
+
+    static let manifestFileName = "MediaManifest.json"
+
+    private let cacheDirectory: URL
+    private let bundleDirectory: URL?
+    private let buildVersion: String
+    private let fileManager = FileManager.default
+
+    private let queue = DispatchQueue(label: "com.burningman.iburn.mediamanifest", attributes: .concurrent)
+    private let saveQueue = DispatchQueue(label: "com.burningman.iburn.mediamanifest.save", qos: .utility)
+    /// isolate access on `queue`
+    private var entries: [String: Entry] = [:]
+    /// isolate access on `queue`
+    private var isLoaded = false
+    /// isolate access on `saveQueue`
+    private var saveScheduled = false
+
+    init(
+        cacheDirectory: URL,
+        bundle: Bundle?,
+        buildVersion: String = Bundle.main.object(forInfoDictionaryKey: "CFBundleVersion") as? String ?? ""
+    ) {
+        self.cacheDirectory = cacheDirectory
+        self.bundleDirectory = bundle?.resourceURL
+        self.buildVersion = buildVersion
+    }
+
+    private var manifestURL: URL {
+        cacheDirectory.appendingPathComponent(Self.manifestFileName)
+    }
+
+    // MARK: - Lookup
+
+    /// Local URL for `fileName`, preferring a downloaded copy over the bundled one.
+    func url(forFileName fileName: String) -> URL? {
+        guard let entry = entry(forFileName: fileName) else { return nil }
+        return url(for: entry)
+    }
+
+    func entry(forFileName fileName: String) -> Entry? {
+        loadIfNeeded()
+        return queue.sync { entries[fileName] }
+    }
+
+    /// Whether a non-empty local copy of `fileName` exists.
+    func contains(_ fileName: String) -> Bool {
+        (entry(forFileName: fileName)?.size ?? 0) > 0
+    }
+
+    private func url(for entry: Entry) -> URL? {
+        switch entry.source {
+        case .cache:
+            return cacheDirectory.appendingPathComponent(entry.fileName)
+        case .bundle:
+            return bundleDirectory?.appendingPathComponent(entry.fileName)
+        }
+    }
+
+    // MARK: - Updates
+
+    /// Record a file that was just written to the cache directory (download finished).
+    /// If the content is identical to the bundled copy the download is discarded.
+    func recordDownload(fileName: String) {
+        loadIfNeeded()
+        let fileURL = cacheDirectory.appendingPathComponent(fileName)
+        guard let size = fileSize(at: fileURL) else {
+            removeEntry(fileName: fileName)
+            return
+        }
+        var entry = Entry(fileName: fileName, source: .cache, size: size, sha256: sha256(of: fileURL))
+        if var bundled = bundledEntry(fileName: fileName), bundled.size == size,
+           let bundleURL = url(for: bundled) {
+            bundled.sha256 = sha256(of: bundleURL)
+            if bundled.sha256 != nil, bundled.sha256 == entry.sha256 {
+                try? fileManager.removeItem(at: fileURL)
+                entry = bundled
+            }
+        }
+        queue.sync(flags: .barrier) {
+            entries[fileName] = entry
+        }
+        scheduleSave()
+    }
+
+    /// Drop a cached file from the index (e.g. it was found to be corrupt and deleted).
+    /// Falls back to the bundled copy if one exists.
+    func removeEntry(fileName: String) {
+        loadIfNeeded()
+        let fallback = bundledEntry(fileName: fileName)
+        queue.sync(flags: .barrier) {
+            entries[fileName] = fallback
+        }
+        scheduleSave()
+    }
+
+    /// Removes downloaded files whose contents are byte-identical to the bundled copy and
+    /// re-points their entries at the bundle. Only same-size pairs are hashed, so this is
+    /// cheap after the first run. Call from a background queue.
+    func deduplicate() {
+        loadIfNeeded()
+        guard let bundleDirectory else { return }
+        let candidates = queue.sync { entries.values.filter { $0.source == .cache } }
+        var removed = 0
+        for var cached in candidates {
+            let bundleURL = bundleDirectory.appendingPathComponent(cached.fileName)
+            guard let bundledSize = fileSize(at: bundleURL), bundledSize == cached.size else { continue }
+            let cacheURL = cacheDirectory.appendingPathComponent(cached.fileName)
+            if cached.sha256 == nil {
+                cached.sha256 = sha256(of: cacheURL)
+            }
+            let bundledHash = sha256(of: bundleURL)
+            guard let hash = cached.sha256, hash == bundledHash else {
+                queue.sync(flags: .barrier) { entries[cached.fileName] = cached }
+                continue
+            }
+            do {
+                try fileManager.removeItem(at: cacheURL)
+                removed += 1
+                let bundled = Entry(fileName: cached.fileName, source: .bundle, size: bundledSize, sha256: bundledHash)
+                queue.sync(flags: .barrier) { entries[cached.fileName] = bundled }
+            } catch {
+                DDLogError("MediaManifest: failed to remove duplicate \(cached.fileName): \(error)")
+            }
+        }
+        if removed > 0 {
+            DDLogInfo("MediaManifest: removed \(removed) downloaded files duplicating bundled media")
+        }
+        scheduleSave()
+    }
+
+    // MARK: - Loading
+
+    private func loadIfNeeded() {
+        if queue.sync(execute: { isLoaded }) { return }
+        queue.sync(flags: .barrier) {
+            guard !isLoaded else { return }
+            entries = loadSnapshot() ?? buildEntries()
+            isLoaded = true
+        }
+        scheduleSave()
+    }
+
+    private func loadSnapshot() -> [String: Entry]? {
+        guard let data = try? Data(contentsOf: manifestURL),
+              let snapshot = try? JSONDecoder().decode(Snapshot.self, from: data),
+              snapshot.buildVersion == buildVersion,
+              let saved = snapshot.cacheModified,
+              let modified = cacheModificationDate(),
+              abs(modified.timeIntervalSince1970 - saved) < 0.001 else {
+            return nil
+        }
+        return snapshot.entries
+    }
+
+    /// One directory enumeration each for the bundle and the cache.
+    private func buildEntries() -> [String: Entry] {
+        createCacheDirectoryIfNeeded()
+        var result: [String: Entry] = [:]
+        if let bundleDirectory {
+            for (fileName, size) in enumerateFiles(in: bundleDirectory) {
+                result[fileName] = Entry(fileName: fileName, source: .bundle, size: size, sha256: nil)
+            }
+        }
+        // Downloaded media wins over bundled media.
+        for (fileName, size) in enumerateFiles(in: cacheDirectory) where fileName != Self.manifestFileName {
+            result[fileName] = Entry(fileName: fileName, source: .cache, size: size, sha256: nil)
+        }
+        DDLogInfo("MediaManifest: indexed \(result.count) media files")
+        return result
+    }
+
+    private func enumerateFiles(in directory: URL) -> [(String, Int64)] {
+        let keys: [URLResourceKey] = [.fileSizeKey, .isRegularFileKey]
+        guard let urls = try? fileManager.contentsOfDirectory(
+            at: directory,
+            includingPropertiesForKeys: keys,
+            options: [.skipsHiddenFiles]
+        ) else {
+            return []
+        }
+        return urls.compactMap { url in
+            guard let values = try? url.resourceValues(forKeys: Set(keys)),
+                  values.isRegularFile == true else { return nil }
+            return (url.lastPathComponent, Int64(values.fileSize ?? 0))
+        }
+    }
+
+    private func createCacheDirectoryIfNeeded() {
+        guard !fileManager.fileExists(atPath: cacheDirectory.path) else { return }
+        do {
+            try fileManager.createDirectory(at: cacheDirectory, withIntermediateDirectories: true)
+            var url = cacheDirectory
+            var resourceValues = URLResourceValues()
+            resourceValues.isExcludedFromBackup = true
+            try url.setResourceValues(resourceValues)
+        } catch {
+            DDLogError("MediaManifest: error creating media directory \(error)")
+        }
+    }
+
+    private func bundledEntry(fileName: String) -> Entry? {
+        guard let bundleDirectory else { return nil }
+        let url = bundleDirectory.appendingPathComponent(fileName)
+        guard let size = fileSize(at: url) else { return nil }
+        return Entry(fileName: fileName, source: .bundle, size: size, sha256: nil)
+    }
+
+    private func cacheModificationDate() -> Date? {
+        try? cacheDirectory.resourceValues(forKeys: [.contentModificationDateKey]).contentModificationDate
+    }
+
+    private func fileSize(at url: URL) -> Int64? {
+        guard let attrs = try? fileManager.attributesOfItem(atPath: url.path),
+              let size = attrs[.size] as? NSNumber else {
+            return nil
+        }
+        return size.int64Value
+    }
+
+    private func sha256(of url: URL) -> String? {
+        guard let data = try? Data(contentsOf: url, options: .mappedIfSafe) else { return nil }
+        return SHA256.hash(data: data).map { String(format: "%02x", $0) }.joined()
+    }
+
+    // MARK: - Persistence
+
+    /// Coalesces bursts of updates (a download batch finishes hundreds of files) into one write.
+    private func scheduleSave() {
+        saveQueue.async {
+            guard !self.saveScheduled else { return }
+            self.saveScheduled = true
+            self.saveQueue.asyncAfter(deadline: .now() + 1) {
+                self.saveScheduled = false
+                self.save()
+            }
+        }
+    }
+
+    /// Writes any pending changes now. Call from a background queue.
+    func flush() {
+        saveQueue.sync { save() }
+    }
+
+    private func save() {
+        var snapshot = queue.sync { Snapshot(buildVersion: buildVersion, entries: entries) }
+        do {
+            createCacheDirectoryIfNeeded()
+            if !fileManager.fileExists(atPath: manifestURL.path) {
+                fileManager.createFile(atPath: manifestURL.path, contents: nil)
+            }
+            snapshot.cacheModified = cacheModificationDate()?.timeIntervalSince1970
+            let data = try JSONEncoder().encode(snapshot)
+            // Overwritten in place, so the directory's modification date only moves when
+            // media files come and go
+            try data.write(to: manifestURL)
+        } catch {
+            DDLogError("MediaManifest: failed to persist manifest: \(error)")
+        }
+    }
+}
@@ -346,18 +346,18 @@ class MoreViewController: UITableViewController, SKStoreProductViewControllerDel
     func pushArtView() {
         #if DEBUG
         let preferenceService = PreferenceServiceFactory.shared
-        if preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
-            let artVC = ArtListHostingController(dependencies: BRCAppDelegate.shared.dependencies)
+        if !preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
+            let dbManager = BRCDatabaseManager.shared
+            // Always use filtered view - it shows all art when filter is disabled
+            let artVC = ArtListViewController(viewName: dbManager.artFilteredByEvents, searchViewName: dbManager.searchArtView)
+            artVC.tableView.separatorStyle = .none
             artVC.title = "Art"
             navigationController?.pushViewController(artVC, animated: true)
             return
         }
         #endif
 
-        let dbManager = BRCDatabaseManager.shared
-        // Always use filtered view - it shows all art when filter is disabled
-        let artVC = ArtListViewController(viewName: dbManager.artFilteredByEvents, searchViewName: dbManager.searchArtView)
-        artVC.tableView.separatorStyle = .none
+        let artVC = ArtListHostingController(dependencies: BRCAppDelegate.shared.dependencies)
         artVC.title = "Art"
         navigationController?.pushViewController(artVC, animated: true)
     }
@@ -365,16 +365,16 @@ class MoreViewController: UITableViewController, SKStoreProductViewControllerDel
     func pushCampsView() {
         #if DEBUG
         let preferenceService = PreferenceServiceFactory.shared
-        if preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
-            let campsVC = CampListHostingController(dependencies: BRCAppDelegate.shared.dependencies)
+        if !preferenceService.getValue(Preferences.FeatureFlags.useSwiftUILists) {
+            let dbManager = BRCDatabaseManager.shared
+            let campsVC = ObjectListViewController(viewName: dbManager.campsViewName, searchViewName: dbManager.searchCampsView)
             campsVC.title = "Camps"
             navigationController?.pushViewController(campsVC, animated: true)
             return
         }
         #endif
 
-        let dbManager = BRCDatabaseManager.shared
-        let campsVC = ObjectListViewController(viewName: dbManager.campsViewName, searchViewName: dbManager.searchCampsView)
+        let campsVC = CampListHostingController(dependencies: BRCAppDelegate.shared.dependencies)
         campsVC.title = "Camps"
         navigationController?.pushViewController(campsVC, animated: true)
     }
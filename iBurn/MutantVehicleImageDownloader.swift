@@ -31,13 +31,15 @@ final class MutantVehicleImageDownloader {
 
             for (uid, remoteURL) in imageURLs {
                 let fileName = "\(uid).jpg"
-                // Validate existing file: must exist and be non-empty
-                if let localURL = BRCMediaDownloader.localMediaURL(fileName) {
-                    if let attrs = try? FileManager.default.attributesOfItem(atPath: localURL.path),
-                       let size = attrs[.size] as? Int, size > 0 {
+                // Validate existing file via the manifest: must exist and be non-empty
+                if let entry = MediaManifest.shared.entry(forFileName: fileName) {
+                    if entry.size > 0 {
                         continue
                     }
-                    try? FileManager.default.removeItem(at: localURL)
+                    if entry.source == .cache {
+                        try? FileManager.default.removeItem(at: BRCMediaDownloader.localCacheURL(fileName))
+                        MediaManifest.shared.removeEntry(fileName: fileName)
+                    }
                 }
 
                 do {
@@ -54,6 +56,7 @@ final class MutantVehicleImageDownloader {
                     }
                     try FileManager.default.moveItem(at: tempURL, to: destURL)
                     try (destURL as NSURL).setResourceValue(true, forKey: .isExcludedFromBackupKey)
+                    MediaManifest.shared.recordDownload(fileName: fileName)
                     newlyDownloaded.insert(uid)
                     DDLogInfo("MV image cached: \(uid)")
                 } catch {
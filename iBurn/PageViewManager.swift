@@ -15,6 +15,11 @@ import EventKitUI
     
     var tableView: UITableView
     var objectProvider: DataObjectProvider
+    /// Decodes header images for neighbouring rows ahead of the swipe
+    private let prefetcher = DetailPrefetcher(
+        playaDB: nil,
+        dataService: DetailDataService(playaDB: BRCAppDelegate.shared.dependencies.playaDB)
+    )
     
     @objc public init(objectProvider: DataObjectProvider,
                       tableView: UITableView) {
@@ -52,6 +57,7 @@ import EventKitUI
         }
         navBar?.setColorTheme(colors, animated: false)
         pageVC.setViewControllers([detailVC], direction: .forward, animated: false, completion: nil)
+        prefetchAround(indexPath)
         // Navigation item forwarding is now handled automatically by DetailPageViewController
         return pageVC
     }
@@ -76,7 +82,10 @@ private extension PageViewManager {
         }
         
         // Create new detail view controller (coordinator is handled internally)
-        let newDetailVC = DetailViewControllerFactory.createDetailViewController(for: dataObject.object)
+        let newDetailVC = DetailViewControllerFactory.createDetailViewController(
+            for: dataObject.object,
+            prefetched: prefetcher.prefetched(for: .legacy(dataObject.object))
+        )
         
         // Set indexPath based on controller type
         if let brcDetail = newDetailVC as? BRCDetailViewController {
@@ -91,6 +100,25 @@ private extension PageViewManager {
         }
         return newDetailVC
     }
+
+    /// Warms the rows within `prefetcher.radius` of `indexPath`, nearest first.
+    func prefetchAround(_ indexPath: IndexPath) {
+        // Only the SwiftUI detail view consumes prefetched data
+        guard PreferenceServiceFactory.shared.getValue(Preferences.UserInterface.useSwiftUIDetailView) else { return }
+        var subjects: [DetailSubject] = []
+        var after: IndexPath? = indexPath
+        var before: IndexPath? = indexPath
+        for _ in 0..<prefetcher.radius {
+            after = after?.nextIndexPath(direction: .after, tableView: tableView)
+            before = before?.nextIndexPath(direction: .before, tableView: tableView)
+            for neighbour in [after, before].compactMap({ $0 }) {
+                if let object = objectProvider.dataObjectAtIndexPath(neighbour)?.object {
+                    subjects.append(.legacy(object))
+                }
+            }
+        }
+        prefetcher.prefetch(subjects)
+    }
 }
 
 extension PageViewManager: UIPageViewControllerDelegate {
@@ -99,6 +127,9 @@ extension PageViewManager: UIPageViewControllerDelegate {
         
         // Copy navigation items from current child to page view controller
         pageViewController.copyParameters(from: current)
+        if let indexPath = (current as? DetailHostingController)?.indexPath ?? (current as? BRCDetailViewController)?.indexPath {
+            prefetchAround(indexPath)
+        }
     }
 }
 
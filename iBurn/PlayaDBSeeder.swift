@@ -21,15 +21,23 @@ final class PlayaDBSeeder {
         self.dataBundle = dataBundle
     }
 
-    func seedIfNeeded() {
-        guard !didStart else { return }
+    /// Seeds an empty database from the data bundle. Returns the seeding task on the first call.
+    @discardableResult
+    func seedIfNeeded() -> Task<Void, Never>? {
+        guard !didStart else { return nil }
         didStart = true
 
-        Task { [playaDB, dataBundle] in
+        return Task { [playaDB, dataBundle] in
             do {
                 let updateInfo = try await playaDB.getUpdateInfo()
                 guard updateInfo.isEmpty else { return }
 
+                // Prefer the binary pack built by the "Build Data Pack" phase
+                if let pack = await Self.loadSeedPack(from: [.main, dataBundle]) {
+                    try await playaDB.importFromDataPack(pack)
+                    return
+                }
+
                 let seedData = try await Self.loadSeedData(from: dataBundle)
 
                 try await playaDB.importFromData(
@@ -51,6 +59,17 @@ final class PlayaDBSeeder {
         let mvData: Data?
     }
 
+    /// Opens the first data pack found in `bundles` off the main thread (first launch
+    /// decompresses it).
+    private static func loadSeedPack(from bundles: [Bundle]) async -> PlayaDataPack? {
+        await withCheckedContinuation { continuation in
+            DispatchQueue.global(qos: .background).async {
+                let pack = bundles.lazy.compactMap { try? BundleDataLoader.loadDataPack(from: $0) }.first
+                continuation.resume(returning: pack)
+            }
+        }
+    }
+
     private static func loadSeedData(from bundle: Bundle) async throws -> SeedData {
         try await withCheckedThrowingContinuation { continuation in
             DispatchQueue.global(qos: .background).async {
@@ -0,0 +1,39 @@
+//
+//  DatabaseStatsHostingController.swift
+//  iBurn
+//
+//  Copyright © 2025 Burning Man Earth. All rights reserved.
+//
+
+#if DEBUG
+
+import UIKit
+import SwiftUI
+import PlayaDB
+
+/// UIKit hosting controller for the database stats debug view
+class DatabaseStatsHostingController: UIHostingController<DatabaseStatsView> {
+    
+    init(playaDB: PlayaDB) {
+        super.init(rootView: DatabaseStatsView(playaDB: playaDB))
+        
+        // Apply current theme
+        updateColors(animated: false)
+    }
+    
+    @MainActor required dynamic init?(coder aDecoder: NSCoder) {
+        fatalError("init(coder:) has not been implemented")
+    }
+    
+    override func viewWillAppear(_ animated: Bool) {
+        super.viewWillAppear(animated)
+        updateColors(animated: animated)
+    }
+    
+    private func updateColors(animated: Bool) {
+        refreshNavigationBarColors(animated)
+        view.backgroundColor = Appearance.currentColors.backgroundColor
+    }
+}
+
+#endif
@@ -0,0 +1,116 @@
+//
+//  DatabaseStatsView.swift
+//  iBurn
+//
+//  Copyright © 2025 Burning Man Earth. All rights reserved.
+//
+
+#if DEBUG
+
+import SwiftUI
+import PlayaDB
+
+/// Debug view showing PlayaDB query, observation and write timings
+struct DatabaseStatsView: View {
+    let playaDB: PlayaDB
+
+    @State private var isEnabled: Bool
+    @State private var stats = PlayaDBStats.empty
+    @State private var timer: Timer?
+
+    init(playaDB: PlayaDB) {
+        self.playaDB = playaDB
+        _isEnabled = State(initialValue: playaDB.isInstrumentationEnabled)
+    }
+
+    var body: some View {
+        List {
+            Section {
+                Toggle("Record Timings", isOn: $isEnabled)
+                    .onChange(of: isEnabled) { newValue in
+                        playaDB.setInstrumentationEnabled(newValue)
+                        UserDefaults.standard.setValue(newValue, forKey: Preferences.FeatureFlags.playaDBInstrumentation.key)
+                        refresh()
+                    }
+                Button("Reset") {
+                    playaDB.resetInstrumentationStats()
+                    refresh()
+                }
+                .disabled(!isEnabled)
+            } header: {
+                Text("Instrumentation")
+            } footer: {
+                Text("Since \(stats.since.formatted(date: .omitted, time: .standard)). Intervals are also emitted as signposts under com.iburnapp.PlayaDB for Instruments.")
+                    .font(.footnote)
+            }
+
+            ForEach(kinds, id: \.self) { kind in
+                let operations = stats.operations.filter { $0.kind == kind }
+                if !operations.isEmpty {
+                    Section {
+                        ForEach(operations, id: \.self) { operation in
+                            OperationRow(operation: operation)
+                        }
+                    } header: {
+                        Text(title(for: kind))
+                    }
+                }
+            }
+        }
+        .navigationTitle("Database")
+        .navigationBarTitleDisplayMode(.inline)
+        .onAppear {
+            refresh()
+            timer = Timer.scheduledTimer(withTimeInterval: 1.0, repeats: true) { _ in
+                refresh()
+            }
+        }
+        .onDisappear {
+            timer?.invalidate()
+        }
+    }
+
+    private let kinds: [PlayaDBOperationStats.Kind] = [.query, .observation, .write]
+
+    private func title(for kind: PlayaDBOperationStats.Kind) -> String {
+        switch kind {
+        case .query: return "Queries"
+        case .observation: return "Observation Re-fires"
+        case .write: return "Writes"
+        }
+    }
+
+    private func refresh() {
+        stats = playaDB.instrumentationStats()
+    }
+}
+
+private struct OperationRow: View {
+    let operation: PlayaDBOperationStats
+
+    var body: some View {
+        VStack(alignment: .leading, spacing: 4) {
+            Text(operation.name)
+                .font(.system(.body, design: .monospaced))
+            HStack(spacing: 12) {
+                Text("×\(operation.count)")
+                Text("avg \(milliseconds(operation.averageDuration))")
+                Text("max \(milliseconds(operation.maxDuration))")
+                Text("\(operation.rows) rows")
+            }
+            .font(.caption)
+            .foregroundColor(.secondary)
+            if operation.maxWait > 0.001 {
+                Text("waited \(milliseconds(operation.totalWait)), max \(milliseconds(operation.maxWait))")
+                    .font(.caption)
+                    .foregroundColor(.orange)
+            }
+        }
+    }
+
+    private func milliseconds(_ interval: TimeInterval) -> String {
+        String(format: "%.1f ms", interval * 1000)
+    }
+}
+
+#endif
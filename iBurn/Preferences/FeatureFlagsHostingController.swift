@@ -16,6 +16,9 @@ class FeatureFlagsHostingController: UIHostingController<FeatureFlagsView> {
     
     init() {
         super.init(rootView: FeatureFlagsView())
+        rootView.onShowDatabaseStats = { [weak self] in
+            self?.pushDatabaseStats()
+        }
         
         // Apply current theme
         updateColors(animated: false)
@@ -32,6 +35,11 @@ class FeatureFlagsHostingController: UIHostingController<FeatureFlagsView> {
         updateColors(animated: animated)
     }
     
+    private func pushDatabaseStats() {
+        let statsVC = DatabaseStatsHostingController(playaDB: BRCAppDelegate.shared.dependencies.playaDB)
+        navigationController?.pushViewController(statsVC, animated: true)
+    }
+    
     private func updateColors(animated: Bool) {
         // Apply current app theme to navigation bar
         refreshNavigationBarColors(animated)
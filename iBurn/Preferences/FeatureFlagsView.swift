@@ -13,13 +13,16 @@ import SwiftUI
 /// Debug view for toggling feature flags at runtime
 struct FeatureFlagsView: View {
 
+    /// Pushes the database stats view; set by the hosting controller
+    var onShowDatabaseStats: () -> Void = {}
+
     @State private var mockDateEnabled = UserDefaults.standard.bool(forKey: "BRCMockDateEnabled")
     @State private var mockDateValue = Date()
     @State private var currentDate = Date.present
     @State private var timer: Timer?
 
     // SwiftUI Lists feature flag
-    @State private var useSwiftUILists = UserDefaults.standard.bool(forKey: Preferences.FeatureFlags.useSwiftUILists.key)
+    @State private var useSwiftUILists = PreferenceServiceFactory.shared.getValue(Preferences.FeatureFlags.useSwiftUILists)
     
     // Dynamically calculated Burning Man dates based on Labor Day
     private var eventYear: Int {
@@ -117,7 +120,19 @@ struct FeatureFlagsView: View {
             } header: {
                 Text("UI Features")
             } footer: {
-                Text("Use new SwiftUI-based list views for Art and Camps instead of legacy UIKit implementation.")
+                Text("Turn off to use the legacy YapDatabase-backed UIKit lists, which open the legacy database.")
+                    .font(.footnote)
+            }
+
+            // Database Section
+            Section {
+                Button("Query Stats") {
+                    onShowDatabaseStats()
+                }
+            } header: {
+                Text("Database")
+            } footer: {
+                Text("Latency, row counts, observation re-fires and write-lock waits for PlayaDB.")
                     .font(.footnote)
             }
 
@@ -25,8 +25,14 @@ enum Preferences {
     enum FeatureFlags {
         static let useSwiftUILists = Preference<Bool>(
             key: "featureFlag.lists.useSwiftUI",
+            defaultValue: true,
+            description: "Use PlayaDB-backed SwiftUI lists; off switches back to the legacy YapDatabase lists"
+        )
+
+        static let playaDBInstrumentation = Preference<Bool>(
+            key: "featureFlag.playaDB.instrumentation",
             defaultValue: false,
-            description: "Use new SwiftUI list views instead of legacy UIKit for Art and Camps"
+            description: "Record PlayaDB query, observation and write timings"
         )
     }
     #endif
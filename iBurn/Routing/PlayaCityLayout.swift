@@ -0,0 +1,108 @@
+//
+//  PlayaCityLayout.swift
+//  iBurn
+//
+//  Copyright © 2025 Burning Man Earth. All rights reserved.
+//
+
+import Foundation
+import CoreLocation
+
+/// Street geometry of Black Rock City: lettered rings around the Man, clock radials
+/// between 2:00 and 10:00, and closed plazas at ring/radial intersections.
+///
+/// Distances are in feet from the Man, as in the geocoder's layout data; times are
+/// "h:mm" clock positions.
+struct PlayaCityLayout: Codable, Hashable {
+    struct Ring: Codable, Hashable {
+        let name: String
+        /// Feet from the Man
+        let distance: Double
+    }
+
+    struct Radial: Codable, Hashable {
+        /// Clock position, e.g. "4:30"
+        let time: String
+        /// Name of the innermost ring the radial reaches; it runs from there to the outer ring
+        let fromRing: String
+    }
+
+    struct Plaza: Codable, Hashable {
+        let time: String
+        let ring: String
+        /// Feet; the interior is closed, so streets meeting here walk around it
+        let radius: Double
+    }
+
+    let centerLatitude: Double
+    let centerLongitude: Double
+    /// Compass bearing of 12:00, in degrees
+    let bearing: Double
+    /// Inner to outer; the first ring is the Esplanade
+    let rings: [Ring]
+    let radials: [Radial]
+    let plazas: [Plaza]
+
+    var center: CLLocationCoordinate2D {
+        CLLocationCoordinate2D(latitude: centerLatitude, longitude: centerLongitude)
+    }
+
+    /// Minutes after 12:00 for an "h:mm" clock time, nil if malformed
+    static func clockMinutes(_ time: String) -> Double? {
+        let parts = time.split(separator: ":")
+        guard parts.count == 2, let hour = Double(parts[0]), let minute = Double(parts[1]) else { return nil }
+        return (hour.truncatingRemainder(dividingBy: 12)) * 60 + minute
+    }
+}
+
+// MARK: - Loading
+
+extension PlayaCityLayout {
+    /// `layout.json` from the current year's data bundle, or the built-in layout
+    /// centered on `YearSettings.manCenterCoordinate`
+    static let current: PlayaCityLayout = {
+        if let url = Bundle.brc_dataBundle.url(forResource: "layout", withExtension: "json") {
+            do {
+                let layout = try JSONDecoder().decode(PlayaCityLayout.self, from: Data(contentsOf: url))
+                if layout.rings.count > 1, layout.radials.count > 1 {
+                    return layout
+                }
+                print("City layout has too few streets, using built-in")
+            } catch {
+                print("Error loading city layout, using built-in: \(error)")
+            }
+        }
+        return standard(center: YearSettings.manCenterCoordinate)
+    }()
+
+    /// The standard city plan: Esplanade plus rings A–K, half-hour radials from the
+    /// Esplanade, quarter-hour radials from G outward, and the public plazas.
+    static func standard(center: CLLocationCoordinate2D) -> PlayaCityLayout {
+        let ringDistances: [(String, Double)] = [
+            ("Esplanade", 2500), ("A", 2940), ("B", 3230), ("C", 3520), ("D", 3810), ("E", 4100),
+            ("F", 4590), ("G", 4880), ("H", 5170), ("I", 5460), ("J", 5750), ("K", 6040),
+        ]
+        var radials: [Radial] = []
+        for quarter in 8...40 {
+            let minutes = quarter * 15
+            let time = "\(minutes / 60):\(String(format: "%02d", minutes % 60))"
+            radials.append(Radial(time: time, fromRing: minutes % 30 == 0 ? "Esplanade" : "G"))
+        }
+        return PlayaCityLayout(
+            centerLatitude: center.latitude,
+            centerLongitude: center.longitude,
+            bearing: 45,
+            rings: ringDistances.map { Ring(name: $0.0, distance: $0.1) },
+            radials: radials,
+            plazas: [
+                Plaza(time: "6:00", ring: "A", radius: 350),
+                Plaza(time: "3:00", ring: "B", radius: 125),
+                Plaza(time: "9:00", ring: "B", radius: 125),
+                Plaza(time: "3:00", ring: "G", radius: 125),
+                Plaza(time: "4:30", ring: "G", radius: 125),
+                Plaza(time: "7:30", ring: "G", radius: 125),
+                Plaza(time: "9:00", ring: "G", radius: 125),
+            ]
+        )
+    }
+}
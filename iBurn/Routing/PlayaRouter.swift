@@ -0,0 +1,497 @@
+//
+//  PlayaRouter.swift
+//  iBurn
+//
+//  Copyright © 2025 Burning Man Earth. All rights reserved.
+//
+
+import Foundation
+import CoreLocation
+
+/// How fast you cross the playa
+enum PlayaTravelMode: Sendable {
+    case walking
+    case biking
+
+    /// ~4 km/h on foot and ~12 km/h by bike, on playa dust
+    var metersPerMinute: Double {
+        switch self {
+        case .walking: return 67
+        case .biking: return 200
+        }
+    }
+
+    func minutes(for meters: CLLocationDistance) -> Int {
+        Int(ceil(meters / metersPerMinute))
+    }
+}
+
+/// Travel distances over the Black Rock City street grid.
+///
+/// Inside the city you follow rings and radials and walk around closed plazas; the open
+/// playa inside the Esplanade and beyond the city is crossed in a straight line. The grid
+/// is built once per layout as a compact adjacency array (a few hundred nodes), so a
+/// single A* query or a one-to-many `routes(from:)` tree takes well under a millisecond.
+final class PlayaRouter: Sendable {
+    static let shared = PlayaRouter(layout: .current)
+
+    // Local projection around the Man
+    private let centerLatitude: Double
+    private let centerLongitude: Double
+    private let metersPerDegreeLatitude: Double
+    private let metersPerDegreeLongitude: Double
+    /// Compass bearing of 12:00, radians
+    private let bearing: Double
+
+    // City footprint: ring radii in meters, radial clock angles in radians
+    private let footprint: CityFootprint
+    private let ringRadii: [Double]
+    private let radialAngles: [Double]
+    private let radialFromRing: [Int]
+
+    // Street graph, compressed sparse rows
+    private let nodes: [RoutePoint]
+    private let edgeOffsets: [Int32]
+    private let edgeTargets: [Int32]
+    private let edgeLengths: [Float]
+    /// Nodes at each ring/radial intersection (`ring * radialCount + radial`): one for a plain
+    /// intersection, four around a plaza, none where the radial doesn't reach the ring
+    private let intersections: [[Int32]]
+    /// Nodes on the city's edge, where the open playa meets the streets
+    private let boundaryNodes: [Int32]
+
+    init(layout: PlayaCityLayout) {
+        let feet = 0.3048
+        centerLatitude = layout.centerLatitude
+        centerLongitude = layout.centerLongitude
+        let latitude = layout.centerLatitude * .pi / 180
+        metersPerDegreeLatitude = 111_132.92 - 559.82 * cos(2 * latitude) + 1.175 * cos(4 * latitude)
+        metersPerDegreeLongitude = 111_412.84 * cos(latitude) - 93.5 * cos(3 * latitude)
+        let bearing = layout.bearing * .pi / 180
+        self.bearing = bearing
+
+        let rings = layout.rings.sorted { $0.distance < $1.distance }
+        let ringIndex = Dictionary(rings.enumerated().map { ($1.name, $0) }, uniquingKeysWith: { first, _ in first })
+        let radials = layout.radials
+            .compactMap { radial -> (angle: Double, fromRing: Int)? in
+                guard let minutes = PlayaCityLayout.clockMinutes(radial.time) else { return nil }
+                return (minutes / 720 * 2 * .pi, ringIndex[radial.fromRing] ?? 0)
+            }
+            .sorted { $0.angle < $1.angle }
+        let ringRadii = rings.map { $0.distance * feet }
+        let radialAngles = radials.map(\.angle)
+        let radialFromRing = radials.map(\.fromRing)
+        self.ringRadii = ringRadii
+        self.radialAngles = radialAngles
+        self.radialFromRing = radialFromRing
+        let footprint = CityFootprint(ringRadii: ringRadii, radialAngles: radialAngles, bearing: bearing)
+        self.footprint = footprint
+
+        var builder = GraphBuilder(bearing: bearing)
+        let radialCount = radials.count
+        var plazaRadius: [Int: Double] = [:]
+        for plaza in layout.plazas {
+            guard let ring = ringIndex[plaza.ring],
+                  let minutes = PlayaCityLayout.clockMinutes(plaza.time),
+                  let radial = radialAngles.firstIndex(where: { abs($0 - minutes / 720 * 2 * .pi) < 1e-9 }),
+                  radialFromRing[radial] <= ring else { continue }
+            plazaRadius[ring * radialCount + radial] = plaza.radius * feet
+        }
+
+        var intersections = [[Int32]](repeating: [], count: ringRadii.count * radialCount)
+        for ring in ringRadii.indices {
+            for radial in radialAngles.indices where radialFromRing[radial] <= ring {
+                let r = ringRadii[ring]
+                let theta = radialAngles[radial]
+                let key = ring * radialCount + radial
+                if let radius = plazaRadius[key] {
+                    // Ports where the streets meet the plaza, joined around its edge
+                    let ports = [
+                        builder.addNode(r: r + radius, theta: theta),
+                        builder.addNode(r: r, theta: theta + radius / r),
+                        builder.addNode(r: r - radius, theta: theta),
+                        builder.addNode(r: r, theta: theta - radius / r),
+                    ]
+                    for side in ports.indices {
+                        builder.addEdge(ports[side], ports[(side + 1) % 4], length: .pi * radius / 2)
+                    }
+                    intersections[key] = ports
+                } else {
+                    intersections[key] = [builder.addNode(r: r, theta: theta)]
+                }
+            }
+        }
+
+        func port(_ key: Int, _ side: PlazaSide) -> Int32 {
+            let nodes = intersections[key]
+            return nodes.count == 4 ? nodes[side.rawValue] : nodes[0]
+        }
+        for ring in ringRadii.indices {
+            let reaching = radialAngles.indices.filter { radialFromRing[$0] <= ring }
+            for (a, b) in zip(reaching, reaching.dropFirst()) {
+                let keyA = ring * radialCount + a
+                let keyB = ring * radialCount + b
+                let length = ringRadii[ring] * (radialAngles[b] - radialAngles[a])
+                    - (plazaRadius[keyA] ?? 0) - (plazaRadius[keyB] ?? 0)
+                builder.addEdge(port(keyA, .clockwise), port(keyB, .counterclockwise), length: max(length, 0))
+            }
+        }
+        for radial in radialAngles.indices {
+            for ring in stride(from: radialFromRing[radial], to: ringRadii.count - 1, by: 1) {
+                let inner = ring * radialCount + radial
+                let outer = (ring + 1) * radialCount + radial
+                let length = ringRadii[ring + 1] - ringRadii[ring]
+                    - (plazaRadius[inner] ?? 0) - (plazaRadius[outer] ?? 0)
+                builder.addEdge(port(inner, .outward), port(outer, .inward), length: max(length, 0))
+            }
+        }
+
+        var boundary = Set<Int32>()
+        for ring in ringRadii.indices {
+            for radial in radialAngles.indices {
+                let onEdge = ring == 0 || ring == ringRadii.count - 1
+                    || radial == 0 || radial == radialCount - 1
+                if onEdge { boundary.formUnion(intersections[ring * radialCount + radial]) }
+            }
+        }
+        // Shortcuts across the open playa, inside the Esplanade or around the city
+        let boundaryNodes = boundary.sorted()
+        for (index, a) in boundaryNodes.enumerated() {
+            let pointA = builder.node(a)
+            for b in boundaryNodes[(index + 1)...] {
+                let pointB = builder.node(b)
+                guard !footprint.isCrossed(by: pointA, pointB) else { continue }
+                builder.addEdge(a, b, length: pointA.distance(to: pointB))
+            }
+        }
+
+        let graph = builder.compressed()
+        nodes = graph.nodes
+        edgeOffsets = graph.offsets
+        edgeTargets = graph.targets
+        edgeLengths = graph.lengths
+        self.intersections = intersections
+        self.boundaryNodes = boundaryNodes
+    }
+
+    // MARK: - Queries
+
+    /// Shortest travel distance in meters between two points, by A*
+    func distance(from origin: CLLocationCoordinate2D, to destination: CLLocationCoordinate2D) -> CLLocationDistance {
+        let a = point(origin)
+        let b = point(destination)
+        let blockA = block(containing: a)
+        let blockB = block(containing: b)
+        if let direct = directDistance(a, blockA, b, blockB) { return direct }
+
+        let targets = Dictionary(access(b, blockB).map { ($0.node, $0.length) }, uniquingKeysWith: min)
+        let sources = access(a, blockA)
+        guard !sources.isEmpty, !targets.isEmpty else { return a.distance(to: b) }
+
+        var best = Double.infinity
+        var settled = [Double](repeating: .infinity, count: nodes.count)
+        var heap = MinHeap()
+        for source in sources where source.length < settled[Int(source.node)] {
+            settled[Int(source.node)] = source.length
+            heap.push(source.length + nodes[Int(source.node)].distance(to: b), source.node)
+        }
+        while let (estimate, node) = heap.pop() {
+            guard estimate < best else { break }
+            let index = Int(node)
+            let length = settled[index]
+            // Skip entries superseded by a shorter path
+            guard estimate <= length + nodes[index].distance(to: b) + 1e-6 else { continue }
+            if let remaining = targets[node] { best = min(best, length + remaining) }
+            for edge in Int(edgeOffsets[index])..<Int(edgeOffsets[index + 1]) {
+                let next = Int(edgeTargets[edge])
+                let candidate = length + Double(edgeLengths[edge])
+                if candidate < settled[next] {
+                    settled[next] = candidate
+                    heap.push(candidate + nodes[next].distance(to: b), edgeTargets[edge])
+                }
+            }
+        }
+        return best.isFinite ? best : a.distance(to: b)
+    }
+
+    /// Shortest distances from `origin` to the whole grid, for ranking many destinations
+    func routes(from origin: CLLocationCoordinate2D) -> PlayaRouteTree {
+        let a = point(origin)
+        let blockA = block(containing: a)
+        var settled = [Double](repeating: .infinity, count: nodes.count)
+        var heap = MinHeap()
+        for source in access(a, blockA) where source.length < settled[Int(source.node)] {
+            settled[Int(source.node)] = source.length
+            heap.push(source.length, source.node)
+        }
+        while let (length, node) = heap.pop() {
+            let index = Int(node)
+            guard length <= settled[index] else { continue }
+            for edge in Int(edgeOffsets[index])..<Int(edgeOffsets[index + 1]) {
+                let next = Int(edgeTargets[edge])
+                let candidate = length + Double(edgeLengths[edge])
+                if candidate < settled[next] {
+                    settled[next] = candidate
+                    heap.push(candidate, edgeTargets[edge])
+                }
+            }
+        }
+        return PlayaRouteTree(router: self, origin: a, originBlock: blockA, settled: settled)
+    }
+
+    /// Travel distances in meters from `origin` to each destination, from one search
+    func distances(from origin: CLLocationCoordinate2D, to destinations: [CLLocationCoordinate2D]) -> [CLLocationDistance] {
+        let tree = routes(from: origin)
+        return destinations.map { tree.distance(to: $0) }
+    }
+
+    func minutes(from origin: CLLocationCoordinate2D, to destination: CLLocationCoordinate2D, mode: PlayaTravelMode = .walking) -> Int {
+        mode.minutes(for: distance(from: origin, to: destination))
+    }
+
+    // MARK: - Geometry
+
+    fileprivate func point(_ coordinate: CLLocationCoordinate2D) -> RoutePoint {
+        let x = (coordinate.longitude - centerLongitude) * metersPerDegreeLongitude
+        let y = (coordinate.latitude - centerLatitude) * metersPerDegreeLatitude
+        return RoutePoint(x: x, y: y, bearing: bearing)
+    }
+
+    /// The block around a point inside the city, with the street nodes at its edges
+    fileprivate func block(containing p: RoutePoint) -> RouteBlock? {
+        guard footprint.contains(p), ringRadii.count > 1 else { return nil }
+        let ring = min(ringRadii.lastIndex { $0 <= p.r } ?? 0, ringRadii.count - 2)
+        let reaching = radialAngles.indices.filter { radialFromRing[$0] <= ring }
+        guard let lower = reaching.last(where: { radialAngles[$0] <= p.theta }),
+              let upper = reaching.first(where: { radialAngles[$0] >= p.theta }) else { return nil }
+
+        let radialCount = radialAngles.count
+        var edges = intersections[ring * radialCount + lower] + intersections[ring * radialCount + upper]
+        for radial in lower...upper where radialFromRing[radial] <= ring + 1 {
+            edges += intersections[(ring + 1) * radialCount + radial]
+        }
+        // Only the plaza ports facing this block; the others are across the plaza
+        let tolerance = 1e-6
+        edges.removeAll { node in
+            let p = nodes[Int(node)]
+            return p.r < ringRadii[ring] - tolerance || p.r > ringRadii[ring + 1] + tolerance
+                || p.theta < radialAngles[lower] - tolerance || p.theta > radialAngles[upper] + tolerance
+        }
+        return RouteBlock(id: ring * radialCount + lower, nodes: edges)
+    }
+
+    /// Distance without the grid: within one block, or a clear line across open playa
+    fileprivate func directDistance(_ a: RoutePoint, _ blockA: RouteBlock?, _ b: RoutePoint, _ blockB: RouteBlock?) -> Double? {
+        switch (blockA, blockB) {
+        case let (blockA?, blockB?) where blockA.id == blockB.id:
+            return a.gridDistance(to: b)
+        case (nil, nil) where !footprint.isCrossed(by: a, b):
+            return a.distance(to: b)
+        default:
+            return nil
+        }
+    }
+
+    /// Ways onto the grid: a block's edge nodes along the streets, or boundary nodes in a
+    /// clear line from open playa
+    fileprivate func access(_ p: RoutePoint, _ block: RouteBlock?) -> [(node: Int32, length: Double)] {
+        if let block {
+            return block.nodes.map { ($0, p.gridDistance(to: nodes[Int($0)])) }
+        }
+        return boundaryNodes.compactMap { node in
+            let target = nodes[Int(node)]
+            return footprint.isCrossed(by: p, target) ? nil : (node, p.distance(to: target))
+        }
+    }
+}
+
+// MARK: - Route Tree
+
+/// Shortest distances from one origin over the whole grid. Each `distance(to:)` only
+/// looks at the destination's way onto the grid.
+struct PlayaRouteTree: Sendable {
+    fileprivate let router: PlayaRouter
+    fileprivate let origin: RoutePoint
+    fileprivate let originBlock: RouteBlock?
+    fileprivate let settled: [Double]
+
+    func distance(to destination: CLLocationCoordinate2D) -> CLLocationDistance {
+        let b = router.point(destination)
+        let blockB = router.block(containing: b)
+        if let direct = router.directDistance(origin, originBlock, b, blockB) { return direct }
+        let best = router.access(b, blockB)
+            .map { settled[Int($0.node)] + $0.length }
+            .min() ?? .infinity
+        return best.isFinite ? best : origin.distance(to: b)
+    }
+
+    /// Infinite for a missing location, so unlocated items sort last
+    func distance(to location: CLLocation?) -> CLLocationDistance {
+        guard let location else { return .greatestFiniteMagnitude }
+        return distance(to: location.coordinate)
+    }
+
+    func minutes(to destination: CLLocationCoordinate2D, mode: PlayaTravelMode = .walking) -> Int {
+        mode.minutes(for: distance(to: destination))
+    }
+}
+
+// MARK: - Objective-C
+
+/// Street-grid distance for the Objective-C data objects and list cells, looked up in the
+/// cached route tree for `origin` rather than searched per call
+@objc(BRCPlayaRouting) final class PlayaRouting: NSObject {
+    @objc static func distance(from origin: CLLocation, to destination: CLLocation) -> CLLocationDistance {
+        DistanceEngine.distance(from: origin, to: destination)
+    }
+}
+
+// MARK: - Private
+
+/// A point in meters around the Man, with its polar form: `r` from the Man and `theta`
+/// clockwise from 12:00
+fileprivate struct RoutePoint: Sendable {
+    let x: Double
+    let y: Double
+    let r: Double
+    let theta: Double
+
+    init(x: Double, y: Double, bearing: Double) {
+        self.x = x
+        self.y = y
+        r = (x * x + y * y).squareRoot()
+        let angle = (atan2(x, y) - bearing).truncatingRemainder(dividingBy: 2 * .pi)
+        theta = angle < 0 ? angle + 2 * .pi : angle
+    }
+
+    init(r: Double, theta: Double, bearing: Double) {
+        let compass = theta + bearing
+        self.init(x: r * sin(compass), y: r * cos(compass), bearing: bearing)
+    }
+
+    func distance(to other: RoutePoint) -> Double {
+        ((x - other.x) * (x - other.x) + (y - other.y) * (y - other.y)).squareRoot()
+    }
+
+    /// Along a radial then a ring, taking the ring at the smaller radius
+    func gridDistance(to other: RoutePoint) -> Double {
+        abs(r - other.r) + min(r, other.r) * abs(theta - other.theta)
+    }
+}
+
+/// The blocks between the Esplanade, the outer ring and the end radials
+fileprivate struct CityFootprint: Sendable {
+    let ringRadii: [Double]
+    let radialAngles: [Double]
+    let bearing: Double
+
+    /// Less than half the narrowest block, so a crossing can't slip between samples
+    private static let sampleSpacing = 30.0
+
+    /// Strictly inside; points on the edge streets are on open playa
+    func contains(_ p: RoutePoint) -> Bool {
+        let margin = 1.0
+        guard let inner = ringRadii.first, let outer = ringRadii.last,
+              let first = radialAngles.first, let last = radialAngles.last,
+              p.r > inner + margin, p.r < outer - margin else { return false }
+        let angularMargin = margin / p.r
+        return p.theta > first + angularMargin && p.theta < last - angularMargin
+    }
+
+    /// Whether the straight line from `a` to `b` passes through city blocks
+    func isCrossed(by a: RoutePoint, _ b: RoutePoint) -> Bool {
+        // Inside the Esplanade is a disc, so lines between its points stay on open playa
+        if let inner = ringRadii.first, a.r <= inner + 1, b.r <= inner + 1 { return false }
+        let steps = Int(a.distance(to: b) / Self.sampleSpacing)
+        guard steps > 1 else { return false }
+        for step in 1..<steps {
+            let t = Double(step) / Double(steps)
+            if contains(RoutePoint(x: a.x + (b.x - a.x) * t, y: a.y + (b.y - a.y) * t, bearing: bearing)) {
+                return true
+            }
+        }
+        return false
+    }
+}
+
+fileprivate struct RouteBlock: Sendable {
+    let id: Int
+    let nodes: [Int32]
+}
+
+private enum PlazaSide: Int {
+    case outward, clockwise, inward, counterclockwise
+}
+
+private struct GraphBuilder {
+    let bearing: Double
+    private var nodes: [RoutePoint] = []
+    private var adjacency: [[(node: Int32, length: Float)]] = []
+
+    init(bearing: Double) {
+        self.bearing = bearing
+    }
+
+    mutating func addNode(r: Double, theta: Double) -> Int32 {
+        nodes.append(RoutePoint(r: r, theta: theta, bearing: bearing))
+        adjacency.append([])
+        return Int32(nodes.count - 1)
+    }
+
+    func node(_ id: Int32) -> RoutePoint {
+        nodes[Int(id)]
+    }
+
+    mutating func addEdge(_ a: Int32, _ b: Int32, length: Double) {
+        adjacency[Int(a)].append((b, Float(length)))
+        adjacency[Int(b)].append((a, Float(length)))
+    }
+
+    func compressed() -> (nodes: [RoutePoint], offsets: [Int32], targets: [Int32], lengths: [Float]) {
+        var offsets: [Int32] = [0]
+        var targets: [Int32] = []
+        var lengths: [Float] = []
+        for edges in adjacency {
+            targets += edges.map(\.node)
+            lengths += edges.map(\.length)
+            offsets.append(Int32(targets.count))
+        }
+        return (nodes, offsets, targets, lengths)
+    }
+}
+
+/// Binary min-heap of (key, node) for the searches
+private struct MinHeap {
+    private var items: [(key: Double, node: Int32)] = []
+
+    mutating func push(_ key: Double, _ node: Int32) {
+        items.append((key, node))
+        var child = items.count - 1
+        while child > 0 {
+            let parent = (child - 1) / 2
+            guard items[child].key < items[parent].key else { break }
+            items.swapAt(child, parent)
+            child = parent
+        }
+    }
+
+    mutating func pop() -> (key: Double, node: Int32)? {
+        guard let first = items.first else { return nil }
+        let last = items.removeLast()
+        if !items.isEmpty {
+            items[0] = last
+            var parent = 0
+            while true {
+                let left = 2 * parent + 1
+                let right = left + 1
+                var smallest = parent
+                if left < items.count, items[left].key < items[smallest].key { smallest = left }
+                if right < items.count, items[right].key < items[smallest].key { smallest = right }
+                guard smallest != parent else { break }
+                items.swapAt(parent, smallest)
+                parent = smallest
+            }
+        }
+        return first
+    }
+}
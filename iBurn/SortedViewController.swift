@@ -107,6 +107,7 @@ public class SortedViewController: UITableViewController {
         }
         NotificationCenter.default.addObserver(self, selector: NSSelectorFromString("databaseExtensionRegistered:"), name: NSNotification.Name.BRCDatabaseExtensionRegistered, object: BRCDatabaseManager.shared);
         NotificationCenter.default.addObserver(self, selector: #selector(audioPlayerChangeNotification(_:)), name: NSNotification.Name(rawValue: BRCAudioPlayer.BRCAudioPlayerChangeNotification), object: BRCAudioPlayer.sharedInstance)
+        NotificationCenter.default.addObserver(self, selector: #selector(favoritesChangeNotification(_:)), name: LegacyFavorites.didChangeNotification, object: nil)
     }
     
     fileprivate override init(nibName nibNameOrNil: String!, bundle nibBundleOrNil: Bundle!) {
@@ -152,6 +153,10 @@ public class SortedViewController: UITableViewController {
     @objc open func audioPlayerChangeNotification(_ notification: Notification) {
         self.tableView.reloadData()
     }
+
+    @objc open func favoritesChangeNotification(_ notification: Notification) {
+        self.tableView.reloadData()
+    }
     
     open override func viewWillAppear(_ animated: Bool) {
         super.viewWillAppear(animated)
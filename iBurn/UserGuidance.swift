@@ -24,7 +24,7 @@ class UserGuidance {
             .filter { $0.pinType == targetType }
             .compactMap { pin -> (BRCUserMapPoint, CLLocationDistance)? in
                 let loc = CLLocation(latitude: pin.latitude, longitude: pin.longitude)
-                let distance = userLocation.distance(from: loc)
+                let distance = DistanceEngine.distance(from: userLocation, to: loc)
                 return (BRCUserMapPoint(userMapPin: pin), distance)
             }
             .min(by: { $0.1 < $1.1 })?
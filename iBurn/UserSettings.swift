@@ -45,6 +45,8 @@ public final class UserSettings: NSObject {
         static let showCampBoundaries = "kBRCShowCampBoundariesKey"
         static let showCampBoundariesAlways = "kBRCShowCampBoundariesAlwaysKey"
         static let showBigCampNames = "kBRCShowBigCampNamesKey"
+        // Calendar keys
+        static let favoriteCalendarEventIdentifiers = "kBRCFavoriteCalendarEventIdentifiersKey"
     }
     
     /// Selected favorites filter (legacy, used by FavoritesViewController)
@@ -476,4 +478,14 @@ public final class UserSettings: NSObject {
             return Set(statuses)
         }
     }
+
+    /// Calendar entries added for favorited events, keyed by occurrence uid
+    static var favoriteCalendarEventIdentifiers: [String: String] {
+        set {
+            UserDefaults.standard.set(newValue, forKey: Keys.favoriteCalendarEventIdentifiers)
+        }
+        get {
+            UserDefaults.standard.dictionary(forKey: Keys.favoriteCalendarEventIdentifiers) as? [String: String] ?? [:]
+        }
+    }
 }
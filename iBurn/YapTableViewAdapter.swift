@@ -29,6 +29,7 @@ import Foundation
     public var groupTransformer: (String) -> String = { $0 }
     public weak var delegate: YapTableViewAdapterDelegate?
     var audioObserver: NSObjectProtocol?
+    var favoritesObserver: NSObjectProtocol?
     /// on the right side quick scroll bar
     var showSectionIndexTitles = true
     /// header sections
@@ -55,6 +56,9 @@ private extension YapTableViewAdapter {
         audioObserver = NotificationCenter.default.addObserver(forName: NSNotification.Name(rawValue: BRCAudioPlayer.BRCAudioPlayerChangeNotification), object: BRCAudioPlayer.sharedInstance, queue: OperationQueue.main, using: { [weak self] (notification) in
             self?.audioPlayerChangeNotification(notification)
         })
+        favoritesObserver = NotificationCenter.default.addObserver(forName: LegacyFavorites.didChangeNotification, object: nil, queue: OperationQueue.main, using: { [weak self] _ in
+            self?.tableView.reloadData()
+        })
     }
     
     @objc func audioPlayerChangeNotification(_ notification: Notification) {
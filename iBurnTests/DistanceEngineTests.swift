@@ -0,0 +1,109 @@
+//
+//  DistanceEngineTests.swift
+//  iBurnTests
+//
+//  Tests and benchmarks street-grid sorting against CLLocation comparators.
+//
+
+import CoreLocation
+import XCTest
+@testable import iBurn
+
+final class DistanceEngineTests: XCTestCase {
+
+    private struct Pin {
+        let id: Int
+        let location: CLLocation?
+    }
+
+    private let man = CLLocation(latitude: 40.786958, longitude: -119.202994)
+
+    /// Deterministic scatter over a playa-sized area around the Man, every 97th pin unplaced
+    private func pins(_ count: Int) -> [Pin] {
+        var generator = SeededGenerator(seed: 0x1BB2)
+        return (0..<count).map { id in
+            guard id % 97 != 0 else { return Pin(id: id, location: nil) }
+            let lat = man.coordinate.latitude + Double.random(in: -0.02...0.02, using: &generator)
+            let lon = man.coordinate.longitude + Double.random(in: -0.025...0.025, using: &generator)
+            return Pin(id: id, location: CLLocation(latitude: lat, longitude: lon))
+        }
+    }
+
+    /// The previous approach: two geodesic distances per comparison
+    private func comparatorSorted(_ pins: [Pin], from origin: CLLocation) -> [Pin] {
+        pins.sorted {
+            ($0.location?.distance(from: origin) ?? CLLocationDistanceMax) < ($1.location?.distance(from: origin) ?? CLLocationDistanceMax)
+        }
+    }
+
+    // MARK: - Sorting
+
+    func testSortFollowsStreetGridDistance() {
+        let pins = pins(1_000)
+        let origin = CLLocation(latitude: 40.7801, longitude: -119.2117)
+
+        let sorted = DistanceEngine.sorted(pins, byDistanceFrom: origin) { $0.location }
+
+        XCTAssertEqual(Set(sorted.map(\.id)), Set(pins.map(\.id)))
+        let distances = sorted.compactMap { $0.location.map { DistanceEngine.distance(from: origin, to: $0) } }
+        XCTAssertEqual(distances, distances.sorted())
+        XCTAssertEqual(sorted.suffix(11).map(\.id), pins.filter { $0.location == nil }.map(\.id),
+                       "Unplaced pins last, in their original order")
+    }
+
+    func testCachedDistanceMatchesSingleRoute() {
+        let origin = CLLocation(latitude: 40.7801, longitude: -119.2117)
+        for pin in pins(20) {
+            guard let location = pin.location else { continue }
+            XCTAssertEqual(
+                DistanceEngine.distance(from: origin, to: location),
+                PlayaRouter.shared.distance(from: origin.coordinate, to: location.coordinate),
+                accuracy: 1
+            )
+        }
+        XCTAssertEqual(DistanceEngine.distance(from: origin, to: nil), CLLocationDistanceMax)
+    }
+
+    // MARK: - Formatting
+
+    func testFormattedDistanceIsCachedPerBucket() {
+        let first = DistanceEngine.attributedString(forDistance: 1_234)
+        XCTAssertNotNil(first)
+        XCTAssertEqual(DistanceEngine.attributedString(forDistance: 1_236), first)
+        XCTAssertEqual(
+            DistanceEngine.nsAttributedString(forDistance: 1_230)?.string,
+            TTTLocationFormatter.brc_humanizedString(forDistance: 1_230)?.string
+        )
+        XCTAssertNil(DistanceEngine.attributedString(forDistance: CLLocationDistanceMax))
+    }
+
+    // MARK: - Benchmarks
+
+    func testComparatorSortPerformance() {
+        let pins = pins(5_000)
+        measure(metrics: [XCTClockMetric()]) {
+            _ = comparatorSorted(pins, from: man)
+        }
+    }
+
+    func testDistanceEngineSortPerformance() {
+        let pins = pins(5_000)
+        measure(metrics: [XCTClockMetric()]) {
+            _ = DistanceEngine.sorted(pins, byDistanceFrom: man) { $0.location }
+        }
+    }
+}
+
+/// SplitMix64, so benchmark inputs are the same on every run
+private struct SeededGenerator: RandomNumberGenerator {
+    var state: UInt64
+    init(seed: UInt64) { state = seed }
+
+    mutating func next() -> UInt64 {
+        state &+= 0x9E37_79B9_7F4A_7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+        z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+        return z ^ (z >> 31)
+    }
+}
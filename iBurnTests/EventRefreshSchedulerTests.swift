@@ -0,0 +1,105 @@
+//
+//  EventRefreshSchedulerTests.swift
+//  iBurnTests
+//
+//  Tests the status-change instants that drive event list refreshes.
+//
+
+import XCTest
+@testable import iBurn
+@testable import PlayaDB
+
+@MainActor
+final class EventRefreshSchedulerTests: XCTestCase {
+
+    private let reference = Date(timeIntervalSince1970: 1_756_000_000)
+
+    private func occurrence(id: Int64, start: TimeInterval, duration: TimeInterval = 3600, allDay: Bool = false) -> EventObjectOccurrence {
+        let event = EventObject(
+            uid: "event-\(id)",
+            name: "Event \(id)",
+            year: 2025,
+            eventTypeLabel: "Workshop",
+            eventTypeCode: "work",
+            allDay: allDay
+        )
+        let startDate = reference.addingTimeInterval(start)
+        return EventObjectOccurrence(
+            event: event,
+            occurrence: EventOccurrence(id: id, eventId: event.uid, startTime: startDate, endTime: startDate.addingTimeInterval(duration))
+        )
+    }
+
+    // MARK: - nextDisplayChange
+
+    func testFarOffEventWakesWhenStartingSoon() {
+        let occ = occurrence(id: 1, start: 3 * 3600)
+        XCTAssertEqual(occ.nextDisplayChange(after: reference), occ.startDate.addingTimeInterval(-30 * 60))
+    }
+
+    func testCountdownTicksOnWholeMinutesBeforeStart() {
+        let occ = occurrence(id: 1, start: 10 * 60 + 20)
+        XCTAssertEqual(occ.nextDisplayChange(after: reference), reference.addingTimeInterval(20))
+
+        let onMinute = occurrence(id: 2, start: 10 * 60)
+        XCTAssertEqual(onMinute.nextDisplayChange(after: reference), reference.addingTimeInterval(60))
+    }
+
+    func testHappeningEventCountsDownToEndThenStops() {
+        let occ = occurrence(id: 1, start: -600, duration: 600 + 90)
+        XCTAssertEqual(occ.nextDisplayChange(after: reference), reference.addingTimeInterval(30))
+        XCTAssertNil(occ.nextDisplayChange(after: occ.endDate))
+    }
+
+    func testAllDayEventOnlyChangesAtStartAndEnd() {
+        let occ = occurrence(id: 1, start: 600, duration: 86_400, allDay: true)
+        XCTAssertEqual(occ.nextDisplayChange(after: reference), occ.startDate)
+        XCTAssertEqual(occ.nextDisplayChange(after: occ.startDate), occ.endDate)
+    }
+
+    // MARK: - Scheduler
+
+    func testSchedulesEarliestVisibleChange() {
+        let scheduler = EventRefreshScheduler(clock: { [reference] in reference }) { _, _ in }
+        scheduler.update(visible: [
+            occurrence(id: 1, start: 5 * 3600),
+            occurrence(id: 2, start: 3600),
+            occurrence(id: 3, start: -7200, duration: 3600),
+        ])
+        XCTAssertEqual(scheduler.nextFireDate, reference.addingTimeInterval(30 * 60))
+
+        scheduler.update(visible: [occurrence(id: 3, start: -7200, duration: 3600)])
+        XCTAssertNil(scheduler.nextFireDate, "Ended events never wake the list")
+    }
+
+    func testCachesTimeTextPerRow() {
+        var now = reference
+        let scheduler = EventRefreshScheduler(clock: { now }) { _, _ in }
+        let occ = occurrence(id: 1, start: 10 * 60)
+        let text = scheduler.timeDescription(for: occ)
+        XCTAssertEqual(text, occ.timeDescription(now: reference))
+
+        // Cached until the scheduler marks the row changed
+        now = reference.addingTimeInterval(120)
+        XCTAssertEqual(scheduler.timeDescription(for: occ), text)
+    }
+
+    func testClockChangeDropsStaleRows() {
+        var now = reference
+        var changed: Set<String> = []
+        let scheduler = EventRefreshScheduler(clock: { now }) { _, uids in changed = uids }
+        let soon = occurrence(id: 1, start: 10 * 60)
+        let later = occurrence(id: 2, start: 5 * 3600)
+        scheduler.update(visible: [soon, later])
+        _ = scheduler.timeDescription(for: soon)
+        let laterText = scheduler.timeDescription(for: later)
+
+        // The device slept past the start without the sleeping task waking
+        now = reference.addingTimeInterval(20 * 60)
+        scheduler.clockDidChange()
+        XCTAssertEqual(changed, [soon.uid])
+        XCTAssertEqual(scheduler.timeDescription(for: soon), soon.timeDescription(now: now))
+        XCTAssertEqual(scheduler.timeDescription(for: later), laterText)
+        XCTAssertEqual(scheduler.nextFireDate, soon.nextDisplayChange(after: now))
+    }
+}
@@ -0,0 +1,111 @@
+import XCTest
+@testable import iBurn
+
+final class MediaManifestTests: XCTestCase {
+
+    private var rootURL: URL!
+    private var cacheURL: URL!
+    private var bundleURL: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        rootURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("MediaManifestTests-\(UUID().uuidString)")
+        cacheURL = rootURL.appendingPathComponent("MediaFiles")
+        bundleURL = rootURL.appendingPathComponent("Media.bundle")
+        try FileManager.default.createDirectory(at: cacheURL, withIntermediateDirectories: true)
+        try FileManager.default.createDirectory(at: bundleURL, withIntermediateDirectories: true)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: rootURL)
+        try super.tearDownWithError()
+    }
+
+    private func makeManifest(buildVersion: String = "1") -> MediaManifest {
+        MediaManifest(cacheDirectory: cacheURL, bundle: Bundle(url: bundleURL), buildVersion: buildVersion)
+    }
+
+    private func write(_ string: String, to directory: URL, name: String) throws {
+        try Data(string.utf8).write(to: directory.appendingPathComponent(name))
+    }
+
+    func testLookupPrefersDownloadedOverBundled() throws {
+        try write("bundled", to: bundleURL, name: "a.jpg")
+        try write("downloaded", to: cacheURL, name: "a.jpg")
+        try write("bundled only", to: bundleURL, name: "b.jpg")
+
+        let manifest = makeManifest()
+
+        XCTAssertEqual(manifest.entry(forFileName: "a.jpg")?.source, .cache)
+        XCTAssertEqual(manifest.entry(forFileName: "b.jpg")?.source, .bundle)
+        XCTAssertNil(manifest.url(forFileName: "missing.jpg"))
+    }
+
+    func testRecordDownloadUpdatesIndexWithSizeAndHash() throws {
+        let manifest = makeManifest()
+        XCTAssertNil(manifest.entry(forFileName: "c.jpg"))
+
+        try write("fresh", to: cacheURL, name: "c.jpg")
+        manifest.recordDownload(fileName: "c.jpg")
+
+        let entry = try XCTUnwrap(manifest.entry(forFileName: "c.jpg"))
+        XCTAssertEqual(entry.source, .cache)
+        XCTAssertEqual(entry.size, 5)
+        XCTAssertNotNil(entry.sha256)
+        XCTAssertTrue(manifest.contains("c.jpg"))
+    }
+
+    func testRecordDownloadIdenticalToBundleIsDiscarded() throws {
+        try write("same", to: bundleURL, name: "d.jpg")
+        let manifest = makeManifest()
+
+        try write("same", to: cacheURL, name: "d.jpg")
+        manifest.recordDownload(fileName: "d.jpg")
+
+        XCTAssertEqual(manifest.entry(forFileName: "d.jpg")?.source, .bundle)
+        XCTAssertFalse(FileManager.default.fileExists(atPath: cacheURL.appendingPathComponent("d.jpg").path))
+    }
+
+    func testDeduplicateRemovesOnlyIdenticalCopies() throws {
+        try write("same", to: bundleURL, name: "e.jpg")
+        try write("same", to: cacheURL, name: "e.jpg")
+        try write("v1", to: bundleURL, name: "f.jpg")
+        try write("v2", to: cacheURL, name: "f.jpg")
+
+        let manifest = makeManifest()
+        manifest.deduplicate()
+
+        XCTAssertEqual(manifest.entry(forFileName: "e.jpg")?.source, .bundle)
+        XCTAssertFalse(FileManager.default.fileExists(atPath: cacheURL.appendingPathComponent("e.jpg").path))
+        XCTAssertEqual(manifest.entry(forFileName: "f.jpg")?.source, .cache)
+        XCTAssertTrue(FileManager.default.fileExists(atPath: cacheURL.appendingPathComponent("f.jpg").path))
+    }
+
+    func testRemoveEntryFallsBackToBundledCopy() throws {
+        try write("bundled", to: bundleURL, name: "g.jpg")
+        try write("", to: cacheURL, name: "g.jpg")
+        let manifest = makeManifest()
+        XCTAssertFalse(manifest.contains("g.jpg"))
+
+        try FileManager.default.removeItem(at: cacheURL.appendingPathComponent("g.jpg"))
+        manifest.removeEntry(fileName: "g.jpg")
+
+        XCTAssertEqual(manifest.entry(forFileName: "g.jpg")?.source, .bundle)
+        XCTAssertTrue(manifest.contains("g.jpg"))
+    }
+
+    func testSavedManifestIsRebuiltWhenCacheDirectoryChanges() throws {
+        try write("old", to: cacheURL, name: "h.jpg")
+        let first = makeManifest()
+        XCTAssertNotNil(first.entry(forFileName: "h.jpg"))
+        first.flush()
+
+        // Written by a data update rather than a download the manifest saw
+        try write("new", to: cacheURL, name: "i.jpg")
+
+        let second = makeManifest()
+        XCTAssertEqual(second.entry(forFileName: "i.jpg")?.source, .cache)
+        XCTAssertNotNil(second.entry(forFileName: "h.jpg"))
+    }
+}
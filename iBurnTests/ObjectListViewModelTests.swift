@@ -32,25 +32,50 @@ private final class TestDataProvider: ObjectListDataProvider {
     typealias Filter = TestFilter
 
     private(set) var lastObservedFilters: [TestFilter] = []
+    /// Window limits observed, nil for full (unwindowed) observations
+    private(set) var observedLimits: [Int?] = []
     private(set) var favoriteCalls: [String] = []
     private(set) var favorites: Set<String> = []
 
     var continuations: [String: AsyncStream<[ListRow<TestObject>]>.Continuation] = [:]
+    var windowContinuations: [String: AsyncStream<ListWindow<TestObject>>.Continuation] = [:]
 
     func observeObjects(filter: TestFilter) -> AsyncStream<[ListRow<TestObject>]> {
         lastObservedFilters.append(filter)
+        observedLimits.append(nil)
         return AsyncStream { continuation in
             self.continuations[filter.tag] = continuation
         }
     }
 
+    func observeWindow(filter: TestFilter, limit: Int) -> AsyncStream<ListWindow<TestObject>> {
+        lastObservedFilters.append(filter)
+        observedLimits.append(limit)
+        return AsyncStream { continuation in
+            self.windowContinuations[filter.tag] = continuation
+        }
+    }
+
+    func countObjects(filter: TestFilter) async throws -> Int {
+        0
+    }
+
+    func fetchObjects(filter: TestFilter) async throws -> [TestObject] {
+        []
+    }
+
     func yield(_ objects: [TestObject], tag: String = "main") {
-        let rows = objects.map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) }
+        yieldRows(objects.map { ListRow(object: $0, metadata: nil, thumbnailColors: nil) }, tag: tag)
+    }
+
+    func yieldRows(_ rows: [ListRow<TestObject>], tag: String = "main") {
         continuations[tag]?.yield(rows)
+        windowContinuations[tag]?.yield(ListWindow(rows: rows, next: nil))
     }
 
     func finish(tag: String = "main") {
         continuations[tag]?.finish()
+        windowContinuations[tag]?.finish()
     }
 
     func toggleFavorite(_ object: TestObject) async throws {
@@ -175,7 +200,7 @@ final class ObjectListViewModelTests: XCTestCase {
         let favObj = TestObject(name: "Fav", description: nil, uid: "fav")
         let meta = ObjectMetadata(objectType: "test", objectId: "fav", isFavorite: true)
         let row = ListRow(object: favObj, metadata: meta, thumbnailColors: nil)
-        provider.continuations["main"]?.yield([row])
+        provider.yieldRows([row], tag: "main")
 
         let ok = await eventually { vm.isFavorite(favObj) }
         XCTAssertTrue(ok)
@@ -219,4 +244,38 @@ final class ObjectListViewModelTests: XCTestCase {
         XCTAssertTrue(unfavorited)
         XCTAssertEqual(provider.favoriteCalls, ["x", "x"])
     }
+
+    func testBrowsingObservesWindowAndSearchObservesAllRows() async {
+        let provider = TestDataProvider()
+
+        let vm = ObjectListViewModel<TestObject, TestFilter>(
+            dataProvider: provider,
+            locationProvider: MockLocationProvider(),
+            filterStorageKey: "ObjectListViewModelTests.window.\(UUID().uuidString)",
+            initialFilter: TestFilter(),
+            effectiveFilterForObservation: { f in
+                var f = f
+                f.tag = "main"
+                return f
+            },
+            matchesSearch: { obj, q in obj.name.lowercased().contains(q) }
+        )
+
+        await Task.yield()
+        XCTAssertEqual(provider.observedLimits, [ObjectListViewModel<TestObject, TestFilter>.pageSize])
+
+        provider.yield([TestObject(name: "Thing", description: nil, uid: "x")], tag: "main")
+        let gotWindow = await eventually { vm.items.count == 1 && vm.totalCount == 1 }
+        XCTAssertTrue(gotWindow)
+        XCTAssertFalse(vm.hasMore)
+
+        // Substring search runs over every row; refining the search doesn't re-observe
+        vm.searchText = "th"
+        vm.searchText = "thi"
+        XCTAssertEqual(provider.observedLimits.count, 2)
+        XCTAssertEqual(provider.observedLimits.last, .some(nil), "Search observes every row")
+
+        vm.searchText = ""
+        XCTAssertEqual(provider.observedLimits.last, ObjectListViewModel<TestObject, TestFilter>.pageSize)
+    }
 }
@@ -0,0 +1,116 @@
+//
+//  PlayaRouterTests.swift
+//  iBurnTests
+//
+//  Copyright © 2025 Burning Man Earth. All rights reserved.
+//
+
+import XCTest
+import CoreLocation
+@testable import iBurn
+
+final class PlayaRouterTests: XCTestCase {
+
+    private let center = CLLocationCoordinate2D(latitude: 40.7864, longitude: -119.2065)
+    private lazy var layout = PlayaCityLayout.standard(center: center)
+    private lazy var router = PlayaRouter(layout: layout)
+
+    private let feet = 0.3048
+
+    /// Coordinate at a clock position and distance from the Man
+    private func coordinate(_ time: String, feet distance: Double) -> CLLocationCoordinate2D {
+        let latitude = center.latitude * .pi / 180
+        let metersPerDegreeLatitude = 111_132.92 - 559.82 * cos(2 * latitude) + 1.175 * cos(4 * latitude)
+        let metersPerDegreeLongitude = 111_412.84 * cos(latitude) - 93.5 * cos(3 * latitude)
+        let clock = PlayaCityLayout.clockMinutes(time)! / 720 * 2 * .pi
+        let compass = clock + layout.bearing * .pi / 180
+        let meters = distance * feet
+        return CLLocationCoordinate2D(
+            latitude: center.latitude + meters * cos(compass) / metersPerDegreeLatitude,
+            longitude: center.longitude + meters * sin(compass) / metersPerDegreeLongitude
+        )
+    }
+
+    private func straightLine(_ a: CLLocationCoordinate2D, _ b: CLLocationCoordinate2D) -> CLLocationDistance {
+        CLLocation(latitude: a.latitude, longitude: a.longitude)
+            .distance(from: CLLocation(latitude: b.latitude, longitude: b.longitude))
+    }
+
+    private func ring(_ name: String) -> Double {
+        layout.rings.first { $0.name == name }!.distance
+    }
+
+    // MARK: - Tests
+
+    func testOpenPlayaIsStraightLine() {
+        let distance = router.distance(from: center, to: coordinate("12:00", feet: 1000))
+        XCTAssertEqual(distance, 1000 * feet, accuracy: 1)
+    }
+
+    func testRingStreetFollowsArc() {
+        let from = coordinate("3:30", feet: ring("C"))
+        let to = coordinate("4:00", feet: ring("C"))
+        let arc = ring("C") * feet * .pi / 12
+        XCTAssertEqual(router.distance(from: from, to: to), arc, accuracy: 2)
+    }
+
+    func testWalksAroundClosedPlaza() {
+        let from = coordinate("3:00", feet: ring("A"))
+        let to = coordinate("3:00", feet: ring("C"))
+        let radius = layout.plazas.first { $0.time == "3:00" && $0.ring == "B" }!.radius * feet
+        let expected = (ring("C") - ring("A")) * feet + (.pi - 2) * radius
+        XCTAssertEqual(router.distance(from: from, to: to), expected, accuracy: 2)
+    }
+
+    func testCrossingTheCityGoesThroughOpenPlaya() {
+        let from = coordinate("4:00", feet: ring("K"))
+        let to = coordinate("8:00", feet: ring("K"))
+        // Out along the 4:00 radial, across inside the Esplanade, back along 8:00
+        let esplanade = ring("Esplanade")
+        let expected = (2 * (ring("K") - esplanade) + 3.squareRoot() * esplanade) * feet
+        let distance = router.distance(from: from, to: to)
+        XCTAssertGreaterThan(distance, straightLine(from, to) * 1.05)
+        XCTAssertEqual(distance, expected, accuracy: expected * 0.01)
+    }
+
+    func testOpenPlayaAroundTheTopOfTheCity() {
+        // The line from 2:00 to 10:00 on the outer ring passes behind the Man, never through blocks
+        let from = coordinate("2:00", feet: ring("K"))
+        let to = coordinate("10:00", feet: ring("K"))
+        XCTAssertEqual(router.distance(from: from, to: to), straightLine(from, to), accuracy: straightLine(from, to) * 0.005)
+    }
+
+    func testRouteTreeMatchesSingleQueries() {
+        let origin = coordinate("4:15", feet: 4700)
+        let destinations = [
+            coordinate("4:15", feet: 4750),
+            coordinate("7:45", feet: 5300),
+            coordinate("9:00", feet: 3100),
+            coordinate("12:00", feet: 2500),
+            coordinate("1:00", feet: 7000),
+            center,
+        ]
+        let tree = router.routes(from: origin)
+        for destination in destinations {
+            XCTAssertEqual(tree.distance(to: destination), router.distance(from: origin, to: destination), accuracy: 0.01)
+        }
+        XCTAssertEqual(router.distances(from: origin, to: destinations).count, destinations.count)
+    }
+
+    func testRouteIsNeverShorterThanStraightLine() {
+        let origin = coordinate("6:00", feet: 3000)
+        let tree = router.routes(from: origin)
+        for hour in 2...10 {
+            for distance in stride(from: 1000.0, through: 7000, by: 500) {
+                let destination = coordinate("\(hour):00", feet: distance)
+                let straight = straightLine(origin, destination)
+                XCTAssertGreaterThanOrEqual(tree.distance(to: destination), straight * 0.995, "\(hour):00 \(distance)'")
+            }
+        }
+    }
+
+    func testTravelModeMinutes() {
+        XCTAssertEqual(PlayaTravelMode.walking.minutes(for: 670), 10)
+        XCTAssertEqual(PlayaTravelMode.biking.minutes(for: 670), 4)
+    }
+}
@@ -0,0 +1,129 @@
+//
+//  ToolExecutorTests.swift
+//  iBurnTests
+//
+//  Tests memoization, call coalescing, and latency recording for AI tool calls.
+//
+
+import XCTest
+@testable import iBurn
+
+final class ToolExecutorTests: XCTestCase {
+
+    /// Counts executions across concurrent calls
+    private final class Counter: @unchecked Sendable {
+        private let lock = NSLock()
+        private var value = 0
+
+        var count: Int {
+            lock.lock(); defer { lock.unlock() }
+            return value
+        }
+
+        func increment() {
+            lock.lock(); defer { lock.unlock() }
+            value += 1
+        }
+    }
+
+    private struct Failure: Error {}
+
+    func testIdenticalCallsExecuteOnce() async throws {
+        let executor = ToolExecutor()
+        let counter = Counter()
+
+        for _ in 0..<3 {
+            let result = try await executor.run("fetchEventsByCamp", arguments: "camp-1") {
+                counter.increment()
+                return "events for camp-1"
+            }
+            XCTAssertEqual(result, "events for camp-1")
+        }
+        _ = try await executor.run("fetchEventsByCamp", arguments: "camp-2") {
+            counter.increment()
+            return "events for camp-2"
+        }
+
+        XCTAssertEqual(counter.count, 2)
+        let latency = try XCTUnwrap(executor.summary()["fetchEventsByCamp"])
+        XCTAssertEqual(latency.calls, 2)
+        XCTAssertEqual(latency.memoHits, 2)
+    }
+
+    func testConcurrentCallsShareOneExecution() async throws {
+        let executor = ToolExecutor()
+        let counter = Counter()
+
+        let results = try await withThrowingTaskGroup(of: Int.self) { group in
+            for _ in 0..<5 {
+                group.addTask {
+                    try await executor.run("fetchNearby", arguments: "40.78,-119.2") {
+                        counter.increment()
+                        try await Task.sleep(nanoseconds: 50_000_000)
+                        return 42
+                    }
+                }
+            }
+            return try await group.reduce(into: []) { $0.append($1) }
+        }
+
+        XCTAssertEqual(results, Array(repeating: 42, count: 5))
+        XCTAssertEqual(counter.count, 1)
+    }
+
+    func testFailuresAreNotMemoized() async throws {
+        let executor = ToolExecutor()
+        let counter = Counter()
+
+        do {
+            _ = try await executor.run("getFavorites") { () async throws -> String in
+                counter.increment()
+                throw Failure()
+            }
+            XCTFail("Expected the first call to throw")
+        } catch is Failure {}
+
+        let result = try await executor.run("getFavorites") {
+            counter.increment()
+            return "favorites"
+        }
+        XCTAssertEqual(result, "favorites")
+        XCTAssertEqual(counter.count, 2)
+    }
+
+    func testResultTypeIsPartOfTheKey() async throws {
+        let executor = ToolExecutor()
+
+        let rows = try await executor.run("getFavorites") { ["art-1", "camp-2"] }
+        let text = try await executor.run("getFavorites") { "2 favorites" }
+
+        XCTAssertEqual(rows, ["art-1", "camp-2"])
+        XCTAssertEqual(text, "2 favorites")
+    }
+
+    func testExecutionIsCancelledWithItsLastCaller() async throws {
+        let executor = ToolExecutor()
+        let counter = Counter()
+        let started = expectation(description: "work started")
+
+        let caller = Task {
+            try await executor.run("searchEvents", arguments: "fire") { () async throws -> String in
+                started.fulfill()
+                do {
+                    try await Task.sleep(nanoseconds: 10_000_000_000)
+                } catch {
+                    counter.increment()
+                    throw error
+                }
+                return "slow"
+            }
+        }
+        await fulfillment(of: [started], timeout: 5)
+        caller.cancel()
+        _ = await caller.result
+        XCTAssertEqual(counter.count, 1, "Work should see the cancellation")
+
+        let result = try await executor.run("searchEvents", arguments: "fire") { "fresh" }
+        XCTAssertEqual(result, "fresh")
+    }
+}